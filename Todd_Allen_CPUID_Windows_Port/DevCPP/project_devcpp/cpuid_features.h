@@ -0,0 +1,516 @@
+/*
+**
+** cpuid dumps CPUID information for each CPU.
+** Copyright 2003,2004,2005,2006,2010,2011,2012,2013,2014,2015,2016,2017,2018,
+** 2020 by Todd Allen.
+**
+** Header-only feature queries for runtime dispatch, C++11:
+**    if (cpu::has<cpu::feature::avx512vl>()) { ... }
+** CPUID executed once at first query into cache line aligned bitmap,
+** so queries are valid from static initializers of any translation unit,
+** each query is initialization guard check, load and test, and constant if
+** compile-time target (e.g. -mavx2, /arch:AVX2) already requires the feature.
+** AMX features are usable only after arch_prctl(ARCH_REQ_XCOMP_PERM) on Linux,
+** AMX queries check this permission each time, it is not cached.
+** Feature bits and names are the same as named_item tables of cpuid.cpp,
+** cpuid.cpp checks it at compile time, see FEATURES_NAMED().
+**
+** This program is free software; you can redistribute it and/or
+** modify it under the terms of the GNU General Public License
+** as published by the Free Software Foundation; either version 2
+** of the License, or (at your option) any later version.
+**
+*/
+
+#ifndef CPUID_FEATURES_H
+#define CPUID_FEATURES_H
+
+#if defined(__GNUC__)
+#include <cpuid.h>
+#else
+#include <intrin.h>
+#endif
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+// list of features: X(id, CPUID function, subfunction, register, bit, required OS state, cpuid.cpp name)
+// register: eax, ebx, ecx, edx, indexes same as WORD_EAX - WORD_EDX of cpuid.cpp
+// required OS state: XCR0 state components enabled by OS, see cpu::detail::state_t
+// name: parameter name of cpuid.cpp named_item table for this register, must be equal
+#define CPUID_FEATURES(X) \
+   X(sse3,               0x01,       0, ecx,  0, none,   "PNI/SSE3: Prescott New Instructions")      \
+   X(pclmulqdq,          0x01,       0, ecx,  1, none,   "PCLMULDQ instruction")                     \
+   X(ssse3,              0x01,       0, ecx,  9, none,   "SSSE3 extensions")                         \
+   X(fma,                0x01,       0, ecx, 12, avx,    "FMA instruction")                          \
+   X(cmpxchg16b,         0x01,       0, ecx, 13, none,   "CMPXCHG16B instruction")                   \
+   X(sse41,              0x01,       0, ecx, 19, none,   "SSE4.1 extensions")                        \
+   X(sse42,              0x01,       0, ecx, 20, none,   "SSE4.2 extensions")                        \
+   X(movbe,              0x01,       0, ecx, 22, none,   "MOVBE instruction")                        \
+   X(popcnt,             0x01,       0, ecx, 23, none,   "POPCNT instruction")                       \
+   X(aes,                0x01,       0, ecx, 25, none,   "AES instruction")                          \
+   X(xsave,              0x01,       0, ecx, 26, none,   "XSAVE/XSTOR states")                       \
+   X(osxsave,            0x01,       0, ecx, 27, none,   "OS-enabled XSAVE/XSTOR")                   \
+   X(avx,                0x01,       0, ecx, 28, avx,    "AVX: advanced vector extensions")          \
+   X(f16c,               0x01,       0, ecx, 29, avx,    "F16C half-precision convert instruction")  \
+   X(rdrand,             0x01,       0, ecx, 30, none,   "RDRAND instruction")                       \
+   X(cmov,               0x01,       0, edx, 15, none,   "CMOV: conditional move/compare instr")     \
+   X(mmx,                0x01,       0, edx, 23, none,   "MMX Technology")                           \
+   X(fxsr,               0x01,       0, edx, 24, none,   "FXSAVE/FXRSTOR")                           \
+   X(sse,                0x01,       0, edx, 25, none,   "SSE extensions")                           \
+   X(sse2,               0x01,       0, edx, 26, none,   "SSE2 extensions")                          \
+   X(fsgsbase,           0x07,       0, ebx,  0, none,   "FSGSBASE instructions")                    \
+   X(bmi1,               0x07,       0, ebx,  3, none,   "BMI1 instructions")                        \
+   X(avx2,               0x07,       0, ebx,  5, avx,    "AVX2: advanced vector extensions 2")       \
+   X(bmi2,               0x07,       0, ebx,  8, none,   "BMI2 instructions")                        \
+   X(erms,               0x07,       0, ebx,  9, none,   "enhanced REP MOVSB/STOSB")                 \
+   X(rtm,                0x07,       0, ebx, 11, none,   "RTM: restricted transactional memory")     \
+   X(avx512f,            0x07,       0, ebx, 16, avx512, "AVX512F: AVX-512 foundation instructions") \
+   X(avx512dq,           0x07,       0, ebx, 17, avx512, "AVX512DQ: double & quadword instructions") \
+   X(rdseed,             0x07,       0, ebx, 18, none,   "RDSEED instruction")                       \
+   X(adx,                0x07,       0, ebx, 19, none,   "ADX instructions")                         \
+   X(avx512ifma,         0x07,       0, ebx, 21, avx512, "AVX512IFMA: fused multiply add")           \
+   X(clflushopt,         0x07,       0, ebx, 23, none,   "CLFLUSHOPT instruction")                   \
+   X(clwb,               0x07,       0, ebx, 24, none,   "CLWB instruction")                         \
+   X(avx512cd,           0x07,       0, ebx, 28, avx512, "AVX512CD: conflict detection instrs")      \
+   X(sha,                0x07,       0, ebx, 29, none,   "SHA instructions")                         \
+   X(avx512bw,           0x07,       0, ebx, 30, avx512, "AVX512BW: byte & word instructions")       \
+   X(avx512vl,           0x07,       0, ebx, 31, avx512, "AVX512VL: vector length")                  \
+   X(avx512vbmi,         0x07,       0, ecx,  1, avx512, "AVX512VBMI: vector byte manipulation")     \
+   X(waitpkg,            0x07,       0, ecx,  5, none,   "WAITPKG instructions")                     \
+   X(avx512vbmi2,        0x07,       0, ecx,  6, avx512, "AVX512_VBMI2: byte VPCOMPRESS, VPEXPAND")  \
+   X(gfni,               0x07,       0, ecx,  8, none,   "GFNI: Galois Field New Instructions")      \
+   X(vaes,               0x07,       0, ecx,  9, avx,    "VAES instructions")                        \
+   X(vpclmulqdq,         0x07,       0, ecx, 10, avx,    "VPCLMULQDQ instruction")                   \
+   X(avx512vnni,         0x07,       0, ecx, 11, avx512, "AVX512_VNNI: neural network instructions") \
+   X(avx512bitalg,       0x07,       0, ecx, 12, avx512, "AVX512_BITALG: bit count/shiffle")         \
+   X(avx512vpopcntdq,    0x07,       0, ecx, 14, avx512, "AVX512: VPOPCNTDQ instruction")            \
+   X(rdpid,              0x07,       0, ecx, 22, none,   "RDPID: read processor D supported")        \
+   X(movdiri,            0x07,       0, ecx, 27, none,   "MOVDIRI instruction")                      \
+   X(movdir64b,          0x07,       0, ecx, 28, none,   "MOVDIR64B instruction")                    \
+   X(enqcmd,             0x07,       0, ecx, 29, none,   "ENQCMD instruction")                       \
+   X(fsrm,               0x07,       0, edx,  4, none,   "fast short REP MOV")                       \
+   X(avx512vp2intersect, 0x07,       0, edx,  8, avx512, "AVX512_VP2INTERSECT: intersect mask regs") \
+   X(serialize,          0x07,       0, edx, 14, none,   "SERIALIZE instruction")                    \
+   X(tsxldtrk,           0x07,       0, edx, 16, none,   "TSXLDTRK: TSX suspend load addr tracking") \
+   X(amx_bf16,           0x07,       0, edx, 22, amx,    "AMX-BF16: tile bfloat16 support")          \
+   X(avx512fp16,         0x07,       0, edx, 23, avx512, "AVX512_FP16: fp16 support")                \
+   X(amx_tile,           0x07,       0, edx, 24, amx,    "AMX-TILE: tile architecture support")      \
+   X(amx_int8,           0x07,       0, edx, 25, amx,    "AMX-INT8: tile 8-bit integer support")     \
+   X(avxvnni,            0x07,       1, eax,  4, avx,    "AVX-VNNI: AVX VNNI neural network instrs") \
+   X(avx512bf16,         0x07,       1, eax,  5, avx512, "AVX512_BF16: bfloat16 instructions")       \
+   X(hreset,             0x07,       1, eax, 22, none,   "HRESET: history reset support")            \
+   X(xsaveopt,           0x0d,       1, eax,  0, none,   "XSAVEOPT instruction")                     \
+   X(xsavec,             0x0d,       1, eax,  1, none,   "XSAVEC instruction")                       \
+   X(xgetbv1,            0x0d,       1, eax,  2, none,   "XGETBV instruction")                       \
+   X(xsaves,             0x0d,       1, eax,  3, none,   "XSAVES/XRSTORS instructions")              \
+   X(lahf_lm,            0x80000001, 0, ecx,  0, none,   "LAHF/SAHF supported in 64-bit mode")       \
+   X(lzcnt,              0x80000001, 0, ecx,  5, none,   "LZCNT advanced bit manipulation")          \
+   X(sse4a,              0x80000001, 0, ecx,  6, none,   "SSE4A support")                            \
+   X(prefetchw,          0x80000001, 0, ecx,  8, none,   "3DNow! PREFETCH/PREFETCHW instructions")   \
+   X(xop,                0x80000001, 0, ecx, 11, avx,    "XOP support")                              \
+   X(fma4,               0x80000001, 0, ecx, 16, avx,    "4-operand FMA instruction")                \
+   X(tbm,                0x80000001, 0, ecx, 21, none,   "TBM support")
+
+namespace cpu {
+
+// feature identifiers, query by has<feature::id>()
+enum class feature : unsigned int {
+#define CPUID_FEATURE_ID(id, leaf, subleaf, word, bit, state, name)  id,
+    CPUID_FEATURES(CPUID_FEATURE_ID)
+#undef CPUID_FEATURE_ID
+};
+
+namespace detail {
+
+// CPUID output register indexes
+enum : unsigned int { eax, ebx, ecx, edx };
+
+// XCR0 state components, which OS must enable for use of feature registers
+enum state_t : unsigned int {
+    none   = 0,
+    avx    = 0x00000006,   // SSE and AVX (YMM) states
+    avx512 = 0x000000e6,   // SSE, AVX and AVX-512 (opmask, ZMM) states
+    amx    = 0x00060000,   // AMX TILECFG and TILEDATA states, Linux also requires arch_prctl() permission
+};
+
+// Linux arch_prctl() codes for permission of XSAVE state components, see asm/prctl.h
+enum : unsigned int {
+    arch_get_xcomp_perm = 0x1022,   // ARCH_GET_XCOMP_PERM: read permitted components
+    xfeature_xtiledata  = 18,       // XFEATURE_XTILEDATA: AMX TILEDATA component
+};
+
+// one feature of CPUID_FEATURES list
+struct descriptor {
+    unsigned int  leaf;      // CPUID function number
+    unsigned int  subleaf;   // CPUID sub-function number
+    unsigned int  word;      // output register index
+    unsigned int  bit;       // bit of output register
+    unsigned int  state;     // required XCR0 state components
+    const char*   name;      // cpuid.cpp parameter name
+    const char*   id;        // feature identifier, as name of feature enumeration
+};
+
+// features in order of feature identifiers
+constexpr descriptor  descriptors[] = {
+#define CPUID_FEATURE_DESCRIPTOR(id, leaf, subleaf, word, bit, state, name)  { leaf, subleaf, word, bit, state, name, #id },
+    CPUID_FEATURES(CPUID_FEATURE_DESCRIPTOR)
+#undef CPUID_FEATURE_DESCRIPTOR
+};
+
+// number of features
+constexpr unsigned int  feature_count = sizeof(descriptors) / sizeof(descriptors[0]);
+
+// CPUID functions required by features, read once per query
+struct query {
+    unsigned int  leaf;      // CPUID function number
+    unsigned int  subleaf;   // CPUID sub-function number
+};
+constexpr query  queries[] = { { 0x01, 0 }, { 0x07, 0 }, { 0x07, 1 }, { 0x0d, 1 }, { 0x80000001, 0 } };
+constexpr unsigned int  query_count = sizeof(queries) / sizeof(queries[0]);
+
+// features bitmap, bit N = feature with identifier N, one cache line for queries
+struct alignas(64) bitmap {
+    unsigned int  words[(feature_count + 31) / 32];
+};
+
+// return true if compile-time target requires feature, so query is constant
+// AMX features are never constant, process permission is known at run time only
+// f = feature identifier
+constexpr bool
+targeted(feature f)
+{
+    return false
+#if defined(__SSE3__)
+        || f == feature::sse3
+#endif
+#if defined(__PCLMUL__)
+        || f == feature::pclmulqdq
+#endif
+#if defined(__SSSE3__)
+        || f == feature::ssse3
+#endif
+#if defined(__FMA__)
+        || f == feature::fma
+#endif
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+        || f == feature::cmpxchg16b
+#endif
+#if defined(__SSE4_1__)
+        || f == feature::sse41
+#endif
+#if defined(__SSE4_2__)
+        || f == feature::sse42
+#endif
+#if defined(__MOVBE__)
+        || f == feature::movbe
+#endif
+#if defined(__POPCNT__)
+        || f == feature::popcnt
+#endif
+#if defined(__AES__)
+        || f == feature::aes
+#endif
+#if defined(__XSAVE__)
+        || f == feature::xsave
+#endif
+#if defined(__AVX__)
+        || f == feature::avx
+#endif
+#if defined(__F16C__)
+        || f == feature::f16c
+#endif
+#if defined(__RDRND__)
+        || f == feature::rdrand
+#endif
+#if defined(__x86_64__) || defined(_M_X64)
+        || f == feature::cmov
+#endif
+#if defined(__MMX__)
+        || f == feature::mmx
+#endif
+#if defined(__FXSR__) || defined(_M_X64)
+        || f == feature::fxsr
+#endif
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        || f == feature::sse
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        || f == feature::sse2
+#endif
+#if defined(__FSGSBASE__)
+        || f == feature::fsgsbase
+#endif
+#if defined(__BMI__)
+        || f == feature::bmi1
+#endif
+#if defined(__AVX2__)
+        || f == feature::avx2
+#endif
+#if defined(__BMI2__)
+        || f == feature::bmi2
+#endif
+#if defined(__RTM__)
+        || f == feature::rtm
+#endif
+#if defined(__AVX512F__)
+        || f == feature::avx512f
+#endif
+#if defined(__AVX512DQ__)
+        || f == feature::avx512dq
+#endif
+#if defined(__RDSEED__)
+        || f == feature::rdseed
+#endif
+#if defined(__ADX__)
+        || f == feature::adx
+#endif
+#if defined(__AVX512IFMA__)
+        || f == feature::avx512ifma
+#endif
+#if defined(__CLFLUSHOPT__)
+        || f == feature::clflushopt
+#endif
+#if defined(__CLWB__)
+        || f == feature::clwb
+#endif
+#if defined(__AVX512CD__)
+        || f == feature::avx512cd
+#endif
+#if defined(__SHA__)
+        || f == feature::sha
+#endif
+#if defined(__AVX512BW__)
+        || f == feature::avx512bw
+#endif
+#if defined(__AVX512VL__)
+        || f == feature::avx512vl
+#endif
+#if defined(__AVX512VBMI__)
+        || f == feature::avx512vbmi
+#endif
+#if defined(__WAITPKG__)
+        || f == feature::waitpkg
+#endif
+#if defined(__AVX512VBMI2__)
+        || f == feature::avx512vbmi2
+#endif
+#if defined(__GFNI__)
+        || f == feature::gfni
+#endif
+#if defined(__VAES__)
+        || f == feature::vaes
+#endif
+#if defined(__VPCLMULQDQ__)
+        || f == feature::vpclmulqdq
+#endif
+#if defined(__AVX512VNNI__)
+        || f == feature::avx512vnni
+#endif
+#if defined(__AVX512BITALG__)
+        || f == feature::avx512bitalg
+#endif
+#if defined(__AVX512VPOPCNTDQ__)
+        || f == feature::avx512vpopcntdq
+#endif
+#if defined(__RDPID__)
+        || f == feature::rdpid
+#endif
+#if defined(__MOVDIRI__)
+        || f == feature::movdiri
+#endif
+#if defined(__MOVDIR64B__)
+        || f == feature::movdir64b
+#endif
+#if defined(__ENQCMD__)
+        || f == feature::enqcmd
+#endif
+#if defined(__AVX512VP2INTERSECT__)
+        || f == feature::avx512vp2intersect
+#endif
+#if defined(__SERIALIZE__)
+        || f == feature::serialize
+#endif
+#if defined(__TSXLDTRK__)
+        || f == feature::tsxldtrk
+#endif
+#if defined(__AVX512FP16__)
+        || f == feature::avx512fp16
+#endif
+#if defined(__AVXVNNI__)
+        || f == feature::avxvnni
+#endif
+#if defined(__AVX512BF16__)
+        || f == feature::avx512bf16
+#endif
+#if defined(__HRESET__)
+        || f == feature::hreset
+#endif
+#if defined(__XSAVEOPT__)
+        || f == feature::xsaveopt
+#endif
+#if defined(__XSAVEC__)
+        || f == feature::xsavec
+#endif
+#if defined(__XSAVES__)
+        || f == feature::xsaves
+#endif
+#if defined(__LAHF_SAHF__)
+        || f == feature::lahf_lm
+#endif
+#if defined(__LZCNT__)
+        || f == feature::lzcnt
+#endif
+#if defined(__SSE4A__)
+        || f == feature::sse4a
+#endif
+#if defined(__PRFCHW__)
+        || f == feature::prefetchw
+#endif
+#if defined(__XOP__)
+        || f == feature::xop
+#endif
+#if defined(__FMA4__)
+        || f == feature::fma4
+#endif
+#if defined(__TBM__)
+        || f == feature::tbm
+#endif
+        ;
+}
+
+// execute CPUID instruction
+// leaf    = function number, input EAX
+// subleaf = sub-function number, input ECX
+// words   = array for return EAX, EBX, ECX, EDX
+inline void
+cpuid(unsigned int leaf, unsigned int subleaf, unsigned int words[4])
+{
+#if defined(__GNUC__)
+    __cpuid_count(leaf, subleaf, words[0], words[1], words[2], words[3]);
+#else
+    __cpuidex((int*)words, leaf, subleaf);
+#endif
+}
+
+// return XCR0 state components enabled by OS, only if OSXSAVE set
+inline unsigned int
+xcr0()
+{
+#if defined(__GNUC__)
+    unsigned int  low;
+    unsigned int  high;
+    __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a"(low), "=d"(high) : "c"(0));   // XGETBV
+    return low;
+#else
+    return (unsigned int)_xgetbv(0);
+#endif
+}
+
+// return true if AMX TILEDATA state permitted to this process,
+// on Linux only after arch_prctl(ARCH_REQ_XCOMP_PERM), so checked at each AMX query
+inline bool
+amx_permitted()
+{
+#if defined(__linux__) && defined(SYS_arch_prctl)
+    unsigned long long  perm = 0;
+    return syscall(SYS_arch_prctl, arch_get_xcomp_perm, &perm) == 0
+        && (perm & (1ull << xfeature_xtiledata)) != 0;
+#else
+    return true;
+#endif
+}
+
+// execute CPUID functions of features and build bitmap of features:
+// supported by processor and, if feature uses registers of XSAVE state, enabled by OS,
+// AMX permission of this process not included, see amx_permitted()
+inline bitmap
+read_features()
+{
+    bitmap        features = {};
+    unsigned int  results[query_count][4] = {};
+    unsigned int  max[2];    // maximum standard and extended CPUID functions
+    unsigned int  words[4];
+    unsigned int  state = 0;
+    unsigned int  i;
+    unsigned int  j;
+
+    cpuid(0, 0, words);
+    max[0] = words[eax];
+    cpuid(0x80000000, 0, words);
+    max[1] = words[eax];
+
+    for (i = 0; i < query_count; i++) {
+        unsigned int  limit = (queries[i].leaf & 0x80000000) ? max[1] : max[0];
+        if (queries[i].leaf > limit) continue;
+        if (queries[i].leaf == 0x07 && queries[i].subleaf > results[1][eax]) continue;   // 7/0 EAX = max subfunction
+        cpuid(queries[i].leaf, queries[i].subleaf, results[i]);
+    }
+    if (results[0][ecx] & (1u << 27)) {   // OSXSAVE: XGETBV enabled
+        state = xcr0();
+    }
+
+    for (i = 0; i < feature_count; i++) {
+        const descriptor&  item = descriptors[i];
+        for (j = 0; j < query_count; j++) {
+            if (queries[j].leaf == item.leaf && queries[j].subleaf == item.subleaf) break;
+        }
+        if ((results[j][item.word] & (1u << item.bit)) != 0
+            && (state & item.state) == item.state) {
+            features.words[i / 32] |= 1u << (i % 32);
+        }
+    }
+    return features;
+}
+
+// return bitmap of usable features, initialized once at first call,
+// inline function for one local static in all translation units
+inline const bitmap&
+features()
+{
+    static const bitmap  cached = read_features();
+    return cached;
+}
+
+// return true if feature usable: bit of bitmap set and, for AMX features, permitted now
+// f = feature identifier
+inline bool
+usable(feature f)
+{
+    return (features().words[(unsigned int)f / 32] & (1u << ((unsigned int)f % 32))) != 0
+        && ((descriptors[(unsigned int)f].state & amx) == 0 || amx_permitted());
+}
+
+} // namespace detail
+
+// return true if feature usable, constant if compile-time target requires feature
+// f = feature identifier
+template <feature f>
+inline bool
+has()
+{
+    return detail::targeted(f)
+        || detail::usable(f);
+}
+
+// return true if feature usable, for feature identifier known at run time only
+// f = feature identifier
+inline bool
+has(feature f)
+{
+    return detail::targeted(f)
+        || detail::usable(f);
+}
+
+// return cpuid.cpp parameter name of feature, for messages
+// f = feature identifier
+constexpr const char*
+name(feature f)
+{
+    return detail::descriptors[(unsigned int)f].name;
+}
+
+} // namespace cpu
+
+#endif // CPUID_FEATURES_H
@@ -78,16 +78,51 @@
 // must be located BEFORE headers
 #define _CRT_SECURE_NO_WARNINGS
 
+// this definition required for pthread_setaffinity_np and dynamic CPU sets at native Linux build
+// must be located BEFORE headers
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <ctype.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <regex>
+#include <type_traits>
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if !defined(_WIN32) && defined(__linux__)
+// kernel cpuid driver (/dev/cpu/N/cpuid) available at native Linux build, see -k option
+#define USE_CPUID_MODULE
+#define CPUID_MAJOR  203
+// snapshot cache of CPUID results keyed by boot ID, microcode and online CPUs, see -c option
+#define USE_SNAPSHOT_CACHE
+// topology and caches of all CPUs read from sysfs, without affinity changes, see -y option
+#define USE_SYSFS_TOPOLOGY
+#endif
 
 #if defined(__GNUC__)
 #include <cpuid.h>
+#include <x86intrin.h>
+#else
+#include <intrin.h>
 #endif
 
+#include "cpuid_api.h"
+#include "cpuid_features.h"
+
 // version strings
 #define VERSTR1 "Cpuid utility dumps CPUID information for each CPU. By Todd Allen. Original version: 20201006."
 #define VERSTR2 "Microsoft Windows port by Ilya Manusov. Port version v0.01.01 (October, 31, 2020)."
@@ -98,6 +133,11 @@
 #define VERSTR3 "Build type: x64 (x86-64). Dev-C++ 5.11."
 #elif defined _WIN32
 #define VERSTR3 "Build type: ia32 (x86). Dev-C++ 5.11."
+// Version message strings for native Linux build by GCC
+#elif defined(__linux__) && defined(__x86_64__)
+#define VERSTR3 "Build type: x64 (x86-64). Linux GCC."
+#elif defined(__linux__) && defined(__i386__)
+#define VERSTR3 "Build type: ia32 (x86). Linux GCC."
 #else
 #define VERSTR3 "Unknown build type, can be not compatible with x86, x86-64."
 #endif
@@ -122,6 +162,13 @@
 #define UNUSED
 #endif
 
+// this definition for check arguments of printf-like functions by format string
+#if defined(__GNUC__)
+#define PRINTF_LIKE(position, first) __attribute((format(printf, position, first)))
+#else
+#define PRINTF_LIKE(position, first)
+#endif
+
 // end of file value
 #ifndef EOF
 #define EOF (-1)
@@ -170,7 +217,7 @@ typedef const char* const ccstring;   // constant pointer to constant string
    (1 << (power))
 */
 #define POWER2(power) \
-   ((unsigned __int64)1 << (power))
+   ((unsigned long long)1 << (power))
 
 // calculate bitmask: all "1" if width >= BPI, or by width if width < BPI
 #define RIGHTMASK(width) \
@@ -200,19 +247,30 @@ typedef const char* const ccstring;   // constant pointer to constant string
 
 // program context, include variables required for linux context emulation on windows port, 
 // some of this variables yet not used
-cstring program = NULL;         // pointer to this application exe file name string, for messages
-cstring emulate_optarg = NULL;  // pointer to option additional arguments, setup when parse command line
-int emulate_opterr = 0;         // flag for enable print error messages by parser, enabled when nonzero
-int emulate_optind = 1;         // index of current parsed command line argument, starts with 0 = exe file name
-int emulate_errno = 0;          // last detected error number 
-int emulate_optopt = 0;         // last detected option character
+static cstring program = "cpuid";      // pointer to this application exe file name string, for messages
+static cstring emulate_optarg = NULL;  // pointer to option additional arguments, setup when parse command line
+static int emulate_opterr = 0;         // flag for enable print error messages by parser, enabled when nonzero
+static int emulate_optind = 1;         // index of current parsed command line argument, starts with 0 = exe file name
+static int emulate_errno UNUSED = 0;   // last detected error number 
+static int emulate_optopt = 0;         // last detected option character
 
-// find substring (regular expression build by string needle) in the string (haystack)
-static intbool strregexp(const char* haystack, const char* needle)
-{
-    std::regex rex(needle);
-    return std::regex_search(haystack, rex);
-}
+#ifdef USE_CPUID_MODULE
+static cstring cpuid_dev_dir = "/dev/cpu";  // directory of kernel cpuid driver nodes N/cpuid, CPUID_DEV_DIR environment variable overrides
+#endif
+
+// default number of executions of each CPUID function:subfunction in timing mode
+#define TIMING_RUNS_DEFAULT  1000
+// maximum number of executions of each CPUID function:subfunction in timing mode
+#define TIMING_RUNS_MAX      1000000
+// minimal latency in TSC cycles considered as trap to hypervisor or microcode assist,
+// native CPUID executes at 100-300 cycles
+#define TIMING_TRAP_CYCLES   1000
+
+static double tsc_per_ns = 1.0; // TSC cycles per nanosecond, calibrated for timing mode
+
+#ifdef USE_SNAPSHOT_CACHE
+static cstring snapshot_dir = "/run/cpuid";  // directory of CPUID results snapshots, CPUID_CACHE_DIR environment variable overrides
+#endif
 
 // structure for parameter show, parameters represented as bitfield of some data value
 typedef struct {
@@ -222,78 +280,560 @@ typedef struct {
     ccstring* images;         // pointer to array of decode strings or special code, see below
 } named_item;
 
+// bools naming, 0=false, 1=true
+static ccstring  bools[] = { "false",
+                             "true" };
+
+// markers of special codes, never indexed
+static ccstring  minus1_images[] = { NULL };
+static ccstring  x2_images[] = { NULL };
+
 // special codes for parameter decoding control
 // not listed values interpreted as pointer to array of decode strings
 #define NIL_IMAGES     (ccstring*)NULL   // decode string absent, show as "name = value" only
-#define MINUS1_IMAGES  (ccstring*)1      // for parameters, represented as value-1, show as "name = value+1"
-#define X2_IMAGES      (ccstring*)2      // for parameters, represented as value*2, show as "name = value/2"
+#define MINUS1_IMAGES  minus1_images     // for parameters, represented as value-1, show as "name = value+1"
+#define X2_IMAGES      x2_images         // for parameters, represented as value*2, show as "name = value/2"
 
-// return maximum parameter name length for text formatting
-// accept array of named_item structures (names) and this array number of elements (length)
-static unsigned int
-get_max_len(named_item names[], unsigned int length)
+// print only one-bit parameters decoded by bools which are set, omit false flags, see -b option
+static intbool names_set_only = FALSE;
+
+// return string length, compile time
+// name = string
+constexpr unsigned int
+name_length(const char* name)
 {
-    unsigned int  result = 0;
-    unsigned int  i;
+    return (*name == '\0') ? 0 : 1 + name_length(name + 1);
+}
+
+// return larger of l=left and r=right arguments, compile time, unlike MAX() evaluates arguments once
+constexpr unsigned int
+larger(unsigned int l, unsigned int r)
+{
+    return (l > r) ? l : r;
+}
+
+// return maximum parameter name length of items [first, last), compile time
+// items split by halves for keep recursion depth small
+// names = array of named_item structures
+// first = index of first item
+// last  = index after last item
+constexpr unsigned int
+names_max_len(const named_item names[], unsigned int first, unsigned int last)
+{
+    return (last - first == 1)
+        ? name_length(names[first].name)
+        : (last - first > 1)
+          ? larger(names_max_len(names, first, first + (last - first) / 2),
+                   names_max_len(names, first + (last - first) / 2, last))
+          : 0;
+}
+
+// return TRUE if low bits of items [i, length) strictly increase starting from min_bit, compile time
+// names   = array of named_item structures
+// i       = index of first checked item
+// length  = number of items
+// min_bit = minimal low bit of item i
+constexpr intbool
+names_sorted(const named_item names[], unsigned int i, unsigned int length, unsigned int min_bit)
+{
+    return (i == length)
+        || (   names[i].low_bit >= min_bit
+            && names[i].low_bit <= names[i].high_bit
+            && names[i].high_bit < BPI
+            && names_sorted(names, i + 1, length, names[i].low_bit + 1));
+}
+
+// return low bits of items [i, length) at bits 0-31 and bits of one-bit flags decoded by bools
+// at bits 32-63, compile time
+// names  = array of named_item structures
+// i      = index of first item
+// length = number of items
+constexpr unsigned long long
+names_bits(const named_item names[], unsigned int i, unsigned int length)
+{
+    return (i == length)
+        ? 0
+        : (1ull << names[i].low_bit)
+          | ((names[i].images == bools && names[i].low_bit == names[i].high_bit)
+             ? (1ull << (names[i].low_bit + BPI)) : 0)
+          | names_bits(names, i + 1, length);
+}
+
+// maximum parameter name length of static constexpr named_item array, for print_names() max_len
+#define NAMES_WIDTH(names) \
+   std::integral_constant<unsigned int, names_max_len(names, 0, LENGTH(names))>::value
+
+// layout of static constexpr named_item array, for print_names() walk of set flags only:
+// low bits of all items and bits of one-bit flags, 0 if items not sorted by low bit
+#define NAMES_LAYOUT(names) \
+   std::integral_constant<unsigned long long, \
+      names_sorted(names, 0, LENGTH(names), 0) ? names_bits(names, 0, LENGTH(names)) : 0>::value
+
+// return TRUE if strings are equal, compile time
+// l = left string
+// r = right string
+constexpr intbool
+names_equal(const char* l, const char* r)
+{
+    return (*l == *r) && (*l == '\0' || names_equal(l + 1, r + 1));
+}
+
+// return TRUE if one of items [i, length) is one-bit parameter at bit with name, compile time
+// names  = array of named_item structures
+// i      = index of first checked item
+// length = number of items
+// bit    = bit of parameter
+// name   = parameter name
+constexpr intbool
+names_have(const named_item names[], unsigned int i, unsigned int length, unsigned int bit, const char* name)
+{
+    return (i < length)
+        && ((   names[i].low_bit == bit
+             && names[i].high_bit == bit
+             && names_equal(names[i].name, name))
+            || names_have(names, i + 1, length, bit, name));
+}
+
+// return TRUE if all features [i, end) of cpuid_features.h list at register of function:subfunction
+// are named by items at same bits, compile time
+// names   = array of named_item structures of register
+// length  = number of items
+// reg     = CPUID function number
+// tryX    = CPUID subfunction number
+// word    = register index, WORD_EAX - WORD_EDX
+// i       = index of first checked feature
+constexpr intbool
+features_named(const named_item names[], unsigned int length, unsigned int reg, unsigned int tryX,
+    unsigned int word, unsigned int i)
+{
+    return (i == cpu::detail::feature_count)
+        || ((   cpu::detail::descriptors[i].leaf != reg
+             || cpu::detail::descriptors[i].subleaf != tryX
+             || cpu::detail::descriptors[i].word != word
+             || names_have(names, 0, length, cpu::detail::descriptors[i].bit, cpu::detail::descriptors[i].name))
+            && features_named(names, length, reg, tryX, word, i + 1));
+}
+
+// check of cpuid_features.h bits against static constexpr named_item array of register, for static_assert
+#define FEATURES_NAMED(names, reg, tryX, word) \
+   features_named(names, LENGTH(names), reg, tryX, word, 0)
+
+// return index of lowest set bit, tzcnt/bsf instruction
+// value = nonzero value
+static inline unsigned int
+lowest_bit(unsigned int value)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(value);
+#else
+    unsigned long  index;
+    _BitScanForward(&index, value);
+    return index;
+#endif
+}
+
+// return number of set bits, without popcnt instruction, which old processors lack
+// value = any value
+static inline unsigned int
+count_bits(unsigned int value)
+{
+#if defined(__GNUC__)
+    return __builtin_popcount(value);
+#else
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    return (((value + (value >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
+#endif
+}
 
-    for (i = 0; i < length; i++) {
-        result = MAX(result, (unsigned int)strlen(names[i].name));  // cycle for find maximum
+// format one bitfield with field-specific format, see print_names()
+// buffer  = output buffer, NULL if no space
+// size    = space of output buffer
+// value   = data value for extract target bitfield
+// item    = parameter control structure, select extracted bitfield
+// max_len = parameter name maximum length for string formatting
+// return length of formatted text, same as snprintf()
+static int
+format_item(char* buffer, size_t size, unsigned int value, const named_item* item, unsigned int max_len)
+{
+    unsigned int  field = BIT_EXTRACT_LE(value,
+        item->low_bit,
+        item->high_bit + 1);           // +1 for make bitfield inclusive, note macro parameter is exclusive
+    if (item->images == X2_IMAGES) {   // for parameters, represented as X*2
+        return snprintf(buffer, size, "      %-*s = %.1f\n",
+            (int)max_len,
+            item->name,
+            (double)field / 2.0);
+    }
+    else if (item->images == MINUS1_IMAGES) {   // for parameters, represented as X-1
+        return snprintf(buffer, size, "      %-*s = 0x%0llx (%llu)\n",
+            (int)max_len,
+            item->name,
+            (unsigned long long)field + 1ULL,
+            (unsigned long long)field + 1ULL);
+    }
+    else if (item->images == NIL_IMAGES
+        || item->images[field] == NULL) {   // for parameters, visualized simple as "name = value"
+        return snprintf(buffer, size, "      %-*s = 0x%0x (%u)\n",
+            (int)max_len,
+            item->name,
+            field,
+            field);
+    }
+    else {   // for parameters, represented as index of decode strings array, index=field, array=images
+        return snprintf(buffer, size, "      %-*s = %s\n",
+            (int)max_len,
+            item->name,
+            item->images[field]);
     }
+}
 
-    return result;
+// format bitfields sequence into caller buffer, text of print_names()
+// in set-only mode walk only set flags and multi-bit fields, by layout
+// buffer  = output buffer
+// size    = size of output buffer
+// value   = data value for extract target bitfield
+// names[] = array of parameters control structures, select extracted bitfields, see above
+// length  = number of parameters for extract
+// layout  = NAMES_LAYOUT() of names, 0 if unknown
+// max_len = parameter name maximum length for string formatting
+// return length of formatted text, text truncated if not less than size, same as snprintf()
+static size_t
+format_names(char* buffer, size_t size, unsigned int value, const named_item names[], unsigned int length,
+    unsigned long long layout, unsigned int max_len)
+{
+    unsigned int  items = (unsigned int)layout;          // low bits of all items
+    unsigned int  flags = (unsigned int)(layout >> BPI); // bits of one-bit flags
+    size_t        used = 0;
+
+    if (names_set_only && items != 0) {
+        // item index is number of items at lower bits, because items sorted by low bit
+        unsigned int  walk = (items & ~flags) | (value & flags);
+        while (walk != 0) {
+            unsigned int  bit = lowest_bit(walk);
+            walk &= walk - 1;
+            const named_item*  item = &names[count_bits(items & (unsigned int)(POWER2(bit) - 1))];
+            used += format_item((used < size) ? buffer + used : NULL, (used < size) ? size - used : 0,
+                value, item, max_len);
+        }
+    }
+    else {
+        unsigned int  i;
+        for (i = 0; i < length; i++) {
+            used += format_item((used < size) ? buffer + used : NULL, (used < size) ? size - used : 0,
+                value, &names[i], max_len);
+        }
+    }
+
+    return used;
 }
 
-// show (printf) bitfields sequence with field-specific formats, interpreting named_item structures
+// write bitfields sequence with field-specific formats to stdout, text of print_names()
+// whole sequence formatted in one buffer and written by one call
 // value   = data value for extract target bitfield
 // names[] = array of parameters control structures, select extracted bitfields, see above
 // length  = number of parameters for extract
+// layout  = NAMES_LAYOUT() of names, 0 if unknown
 // max_len = parameter name maximum length for string formatting
 static void
-print_names(unsigned int value, named_item names[], unsigned int length, unsigned int max_len)
+write_names(unsigned int value, const named_item names[], unsigned int length, unsigned long long layout,
+    unsigned int max_len)
 {
-    unsigned int  i;
+    char    buffer[4096];
+    size_t  size = format_names(buffer, sizeof(buffer), value, names, length, layout, max_len);
+
+    if (size < sizeof(buffer)) {
+        fwrite(buffer, 1, size, stdout);
+        return;
+    }
 
-    if (max_len == 0) {
-        max_len = get_max_len(names, length);
+    char*  large = (char*)malloc(size + 1);
+    if (large == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for decoded fields\n",
+            program);
+        exit(1);
     }
+    format_names(large, size + 1, value, names, length, layout, max_len);
+    fwrite(large, 1, size, stdout);
+    free(large);
+}
 
-    for (i = 0; i < length; i++) {
-        unsigned int  field = BIT_EXTRACT_LE(value,
-            names[i].low_bit,
-            names[i].high_bit + 1);           // +1 for make bitfield inclusive, note macro parameter is exclusive
-        if (names[i].images == X2_IMAGES) {   // for parameters, represented as X*2
-            printf("      %-*s = %.1f\n",
-                max_len,
-                names[i].name,
-                (double)field / 2.0);
-        }
-        else if (names[i].images == MINUS1_IMAGES) {   // for parameters, represented as X-1
-            printf("      %-*s = 0x%0llx (%llu)\n",
-                max_len,
-                names[i].name,
-                (unsigned long long)field + 1ULL,
-                (unsigned long long)field + 1ULL);
+// decoded output model: decoders output captured as tree of CPU, leaf, register and text nodes
+// instead of printing, when output formats selected by -F option,
+// then model rendered by each selected format, so decoding runs once for any number of formats
+
+// output formats of decoded information, -F option
+typedef enum {
+    FORMAT_TEXT,   // same text as printed by decoders
+    FORMAT_JSON,   // JSON array of model nodes
+    FORMAT_CSV,    // CSV table of bitfields, one row per field
+} output_format_t;
+
+// maximum number of output formats in -F option list
+#define MAX_OUTPUT_FORMATS  8
+
+static output_format_t  output_formats[MAX_OUTPUT_FORMATS];   // output formats in -F option list order
+static unsigned int     num_output_formats = 0;               // 0 means decoders print text directly, no model
+
+// chunk of arena allocator, followed by allocation space
+typedef struct arena_chunk {
+    struct arena_chunk*  next;   // previously allocated chunk
+} arena_chunk_t;
+
+// bump allocator: allocations carved one after other from current chunk, all released together
+typedef struct {
+    arena_chunk_t*  chunks;   // list of chunks, current chunk first
+    char*           ptr;      // first free byte of current chunk
+    char*           end;      // end of current chunk allocation space
+} arena_t;
+
+#define ARENA_CHUNK  0x10000                      // minimal size of chunk allocation space
+#define ARENA_ALIGN  sizeof(unsigned long long)   // alignment of allocations
+#define ARENA_ROUND(size) \
+   (((size) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+// allocate memory from arena, exit if no memory
+// arena = arena allocator
+// size  = number of bytes
+// return aligned uninitialized memory, valid until arena_free()
+static void*
+arena_alloc(arena_t* arena, size_t size)
+{
+    size = ARENA_ROUND(size);
+    if ((size_t)(arena->end - arena->ptr) < size) {
+        size_t          capacity = MAX(size, (size_t)ARENA_CHUNK);
+        arena_chunk_t*  chunk = (arena_chunk_t*)malloc(ARENA_ROUND(sizeof(arena_chunk_t)) + capacity);
+        if (chunk == NULL) {
+            fprintf(stderr,
+                "%s: unable to allocate memory for decoded output model\n",
+                program);
+            exit(1);
         }
-        else if (names[i].images == NIL_IMAGES
-            || names[i].images[field] == NULL) {   // for parameters, visualized simple as "name = value"
-            printf("      %-*s = 0x%0x (%u)\n",
-                max_len,
-                names[i].name,
-                field,
-                field);
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+        arena->ptr = (char*)chunk + ARENA_ROUND(sizeof(arena_chunk_t));
+        arena->end = arena->ptr + capacity;
+    }
+
+    void*  result = arena->ptr;
+    arena->ptr += size;
+    return result;
+}
+
+// release all memory of arena, arena can be reused
+// arena = arena allocator
+static void
+arena_free(arena_t* arena)
+{
+    while (arena->chunks != NULL) {
+        arena_chunk_t*  next = arena->chunks->next;
+        free(arena->chunks);
+        arena->chunks = next;
+    }
+    arena->ptr = NULL;
+    arena->end = NULL;
+}
+
+// kinds of decoded output model nodes
+typedef enum {
+    NODE_ROOT,    // whole output: CPU nodes and text outside of CPUs
+    NODE_CPU,     // logical processor, "CPU:" header: leaf nodes and text
+    NODE_LEAF,    // CPUID function:subfunction result: register and text nodes
+    NODE_NAMES,   // register: bitfields of one data value, decoded by print_names()
+    NODE_TEXT,    // any other decoded text
+} node_kind_t;
+
+// node of decoded output model, used fields depend on kind
+typedef struct model_node {
+    node_kind_t         kind;
+    struct model_node*  next;               // next sibling
+    struct model_node*  child;              // first child: root, CPU and leaf nodes
+    struct model_node*  tail;               // last child
+    unsigned int        cpu;                // NODE_CPU: logical processor number, CPU_UNNUMBERED if unknown
+    unsigned int        reg;                // NODE_LEAF: CPUID function number
+    unsigned int        tryX;               // NODE_LEAF: CPUID sub-function number
+    unsigned int        words[WORD_NUM];    // NODE_LEAF: EAX, EBX, ECX, EDX
+    unsigned int        value;              // NODE_NAMES: data value for extract bitfields
+    unsigned int        word;               // NODE_NAMES: index of leaf register of value, passed by decoder
+    const named_item*   names;              // NODE_NAMES: copy of parameters control structures
+    unsigned int        length;             // NODE_NAMES: number of parameters
+    unsigned long long  layout;             // NODE_NAMES: NAMES_LAYOUT() of names, 0 if unknown
+    unsigned int        max_len;            // NODE_NAMES: parameter name maximum length for text
+    const char*         text;               // NODE_TEXT: text, may hold several or partial lines
+    size_t              size;               // NODE_TEXT: text length
+} model_node_t;
+
+// decoded output model and capture state
+typedef struct {
+    intbool        active;   // TRUE while decoders output captured by model
+    arena_t        arena;    // memory of nodes and texts
+    model_node_t   root;     // root node
+    model_node_t*  cpu;      // current CPU node, NULL outside of CPUs
+    model_node_t*  leaf;     // current leaf node, NULL outside of leaves
+} output_model_t;
+
+static output_model_t  output_model;   // filled between model_begin() and model_end()
+
+// append new node to current node of model: leaf, CPU or root
+// kind = node kind
+// return zero-filled node
+static model_node_t*
+model_append(node_kind_t kind)
+{
+    model_node_t*  parent = (output_model.leaf != NULL) ? output_model.leaf
+        : (output_model.cpu != NULL) ? output_model.cpu
+        : &output_model.root;
+    model_node_t*  node = (model_node_t*)arena_alloc(&output_model.arena, sizeof(model_node_t));
+
+    memset(node, 0, sizeof(model_node_t));
+    node->kind = kind;
+    if (parent->tail == NULL) {
+        parent->child = node;
+    }
+    else {
+        parent->tail->next = node;
+    }
+    parent->tail = node;
+    return node;
+}
+
+// start capture of decoders output by model, only if output formats selected by -F option
+static void
+model_begin(void)
+{
+    if (num_output_formats == 0) return;
+
+    memset(&output_model, 0, sizeof(output_model));
+    output_model.root.kind = NODE_ROOT;
+    output_model.active = TRUE;
+}
+
+// start CPU node, following output belongs to this CPU, see print_cpu_header()
+// cpu = logical processor number, CPU_UNNUMBERED if unknown
+static void
+model_cpu(unsigned int cpu)
+{
+    output_model.leaf = NULL;
+    output_model.cpu = NULL;
+    output_model.cpu = model_append(NODE_CPU);
+    output_model.cpu->cpu = cpu;
+}
+
+// start leaf node, following output belongs to this leaf until model_leaf_end(), no action without model
+// reg   = CPUID function number
+// tryX  = CPUID sub-function number
+// words = array of EAX, EBX, ECX, EDX values after CPUID function:subfunction
+static void
+model_leaf(unsigned int reg, unsigned int tryX, const unsigned int words[WORD_NUM])
+{
+    if (!output_model.active) return;
+
+    output_model.leaf = NULL;
+    output_model.leaf = model_append(NODE_LEAF);
+    output_model.leaf->reg = reg;
+    output_model.leaf->tryX = tryX;
+    memcpy(output_model.leaf->words, words, sizeof(output_model.leaf->words));
+}
+
+// finish leaf node, following output belongs to CPU
+static void
+model_leaf_end(void)
+{
+    output_model.leaf = NULL;
+}
+
+// append register node, print_names() arguments, names copied because some tables are not static
+// see print_names() for parameters
+static void
+model_names(unsigned int value, unsigned int word, const named_item names[], unsigned int length,
+    unsigned long long layout, unsigned int max_len)
+{
+    model_node_t*  node = model_append(NODE_NAMES);
+    named_item*    copy = (named_item*)arena_alloc(&output_model.arena, length * sizeof(named_item));
+
+    memcpy((void*)copy, names, length * sizeof(named_item));
+    node->value = value;
+    node->names = copy;
+    node->length = length;
+    node->layout = layout;
+    node->max_len = max_len;
+    node->word = word;
+}
+
+// print decoded output, or append it to model as text node while model active
+// stream = output stream, only stdout output captured
+// format = printf format
+// args   = printf arguments
+static void
+emit_args(FILE* stream, ccstring format, va_list args)
+{
+    if (!output_model.active || stream != stdout) {
+        vfprintf(stream, format, args);
+        return;
+    }
+
+    char     buffer[1024];
+    va_list  again;
+    va_copy(again, args);
+    int      size = vsnprintf(buffer, sizeof(buffer), format, args);
+    if (size > 0) {
+        model_node_t*  node = model_append(NODE_TEXT);
+        char*          text = (char*)arena_alloc(&output_model.arena, size + 1);
+        if ((size_t)size < sizeof(buffer)) {
+            memcpy(text, buffer, size + 1);
         }
-        else {   // for parameters, represented as index of decode strings array, index=field, array=images
-            printf("      %-*s = %s\n",
-                max_len,
-                names[i].name,
-                names[i].images[field]);
+        else {
+            vsnprintf(text, size + 1, format, again);
         }
+        node->text = text;
+        node->size = size;
     }
+    va_end(again);
 }
 
-// bools naming, 0=false, 1=true
-static ccstring  bools[] = { "false",
-                             "true" };
+static void emit(ccstring format, ...) PRINTF_LIKE(1, 2);
+static void emit_to(FILE* stream, ccstring format, ...) PRINTF_LIKE(2, 3);
+
+// print decoded output to stdout, captured by model while model active, same arguments as printf()
+static void
+emit(ccstring format, ...)
+{
+    va_list  args;
+    va_start(args, format);
+    emit_args(stdout, format, args);
+    va_end(args);
+}
+
+// print decoded output to stream, captured by model while model active, same arguments as fprintf()
+static void
+emit_to(FILE* stream, ccstring format, ...)
+{
+    va_list  args;
+    va_start(args, format);
+    emit_args(stream, format, args);
+    va_end(args);
+}
+
+// show (printf) bitfields sequence with field-specific formats, interpreting named_item structures
+// appended to model as register node while model active
+// value   = data value for extract target bitfield
+// word    = index of leaf register of value, WORD_EAX - WORD_EDX, register of model node
+// names[] = array of parameters control structures, select extracted bitfields, see above
+// length  = number of parameters for extract
+// layout  = NAMES_LAYOUT() of names, 0 if unknown
+// max_len = parameter name maximum length for string formatting, NAMES_WIDTH() of names for align by longest name
+static void
+print_names(unsigned int value, unsigned int word, const named_item names[], unsigned int length,
+    unsigned long long layout, unsigned int max_len)
+{
+    if (output_model.active) {
+        model_names(value, word, names, length, layout, max_len);
+    }
+    else {
+        write_names(value, names, length, layout, max_len);
+    }
+}
 
 // processors vendors enumeration, 0 means processor vendor not recognized
 typedef enum {
@@ -360,34 +900,29 @@ typedef enum {
 #define _FM(xf,f,xm,m)     (_XF(xf) + _F(f) + _XM(xm) + _M(m))
 #define _FMS(xf,f,xm,m,s)  (_XF(xf) + _F(f) + _XM(xm) + _M(m) + _S(s))
 
-// building blocks for series of processor detection by Type, Family, Model, Stepping
-// each block contain detection criteria and actions, executed if detection criteria true
-// sequence of comparings compiled as sequence of if-else constructions,
-// recommended refactoring to array of criteria descriptors
-#define START \
-   if (0)
+// building blocks of signature tables, rows for processor detection by Type, Family, Model, Stepping
+// each block is row initializer with detection criteria descriptor (see criteria_t) and row data,
+// rows are compared in order of table, first matched row is result
 #define F(xf,f,...) \
-   else if (__F(val)    ==       _XF(xf)        +_F(f)                              ) ACT(__VA_ARGS__)
+   { { __F(~0u),           _XF(xf)        +_F(f)                ,  QUERY_NONE }, __VA_ARGS__ }
 #define FM(xf,f,xm,m,...) \
-   else if (__FM(val)   ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)                        ) ACT(__VA_ARGS__)
+   { { __FM(~0u),          _XF(xf)+_XM(xm)+_F(f)+_M(m)          ,  QUERY_NONE }, __VA_ARGS__ }
 #define FMS(xf,f,xm,m,s,...) \
-   else if (__FMS(val)  ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s)                  ) ACT(__VA_ARGS__)
+   { { __FMS(~0u),         _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s)    ,  QUERY_NONE }, __VA_ARGS__ }
 #define TF(t,xf,f,...) \
-   else if (__TF(val)   == _T(t)+_XF(xf)        +_F(f)                              ) ACT(__VA_ARGS__)
+   { { __TF(~0u),    _T(t)+_XF(xf)        +_F(f)                ,  QUERY_NONE }, __VA_ARGS__ }
 #define TFM(t,xf,f,xm,m,...) \
-   else if (__TFM(val)  == _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m)                        ) ACT(__VA_ARGS__)
+   { { __TFM(~0u),   _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m)          ,  QUERY_NONE }, __VA_ARGS__ }
 #define TFMS(t,xf,f,xm,m,s,...) \
-   else if (__TFMS(val) == _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s)                  ) ACT(__VA_ARGS__)
+   { { __TFMS(~0u),  _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s)    ,  QUERY_NONE }, __VA_ARGS__ }
 #define FQ(xf,f,q,...) \
-   else if (__F(val)    ==       _XF(xf)        +_F(f)             && (stash) && (q)) ACT(__VA_ARGS__)
+   { { __F(~0u),           _XF(xf)        +_F(f)                ,  QUERY_##q  }, __VA_ARGS__ }
 #define FMQ(xf,f,xm,m,q,...) \
-   else if (__FM(val)   ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)       && (stash) && (q)) ACT(__VA_ARGS__)
+   { { __FM(~0u),          _XF(xf)+_XM(xm)+_F(f)+_M(m)          ,  QUERY_##q  }, __VA_ARGS__ }
 #define FMSQ(xf,f,xm,m,s,q,...) \
-   else if (__FMS(val)  ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s) && (stash) && (q)) ACT(__VA_ARGS__)
+   { { __FMS(~0u),         _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s)    ,  QUERY_##q  }, __VA_ARGS__ }
 #define DEFAULT(...) \
-   else                                                                               ACT(__VA_ARGS__)
-#define FALLBACK(...) \
-   else __VA_ARGS__
+   { { 0,                  0                                    ,  QUERY_NONE }, __VA_ARGS__ }
 
 // data structure for processor detecting, represents vendor-specific and device-specific facts
 // this structure accumulate data when CPUID functions execution and used as argument for
@@ -524,11 +1059,11 @@ typedef struct {
 } code_stash_t;
 
 // duplicated, also defined inside code_stash_t, this required for Visual Studio compiler ?
-struct mp {
+static struct mp {
     const char* method;
     unsigned int   cores;
     unsigned int   hyperthreads;
-} mp;
+} mp UNUSED;
 
 // empty data structure for processor detection
 // this structure accumulate data when CPUID functions execution and used as argument for
@@ -1471,11 +2006,314 @@ static void
 print_override_brand(code_stash_t* stash)
 {
     if (stash->override_brand[0] != '\0') {
-        printf("   (override brand synth) = %s\n", stash->override_brand);
+        emit("   (override brand synth) = %s\n", stash->override_brand);
+    }
+}
+
+// kind of cache and TLB descriptor of CPUID function 00000002h
+typedef enum {
+    DESC_UNKNOWN,       // undefined descriptor
+    DESC_CACHE,         // cache: level, type, size, ways, line size
+    DESC_TLB,           // TLB: level, type, page sizes, ways, entries
+    DESC_TRACE,         // trace cache: size in K-uops, ways
+    DESC_PREFETCH,      // prefetching: size in line size
+    DESC_NO_CACHE,      // no cache of level
+    DESC_LEAF,          // information is in other CPUID function, number in size
+    DESC_VENDOR,        // vendor-specific, meaning unknown
+} desc_kind_t;
+
+// type of cache or TLB
+typedef enum {
+    DESC_UNIFIED,
+    DESC_DATA,
+    DESC_INSTRUCTION,
+} desc_type_t;
+
+// TLB page sizes, set of flags
+#define PAGES_4K       0x01
+#define PAGES_2M       0x02
+#define PAGES_4M       0x04
+#define PAGES_1G       0x08
+#define PAGES_4K_256M  0x10
+
+#define DESC_FULLY  0xff  // ways of fully associative cache or TLB
+#define DESC_CONT   "\n            "
+
+// one cache and TLB descriptor of CPUID function 00000002h
+typedef struct {
+    desc_kind_t     kind;       // kind of descriptor
+    unsigned char   level;      // cache or TLB level, 0 if not specified
+    desc_type_t     type;       // data, instruction or unified
+    unsigned char   ways;       // associativity, 0 if not specified, DESC_FULLY for fully associative
+    intbool         sectored;   // sectored cache
+    unsigned int    size;       // cache size in KB, trace cache size in K-uops, CPUID function number
+    unsigned int    line_size;  // cache line size or prefetching size in bytes
+    unsigned int    pages;      // TLB page sizes, set of PAGES_* flags
+    unsigned int    entries;    // TLB entries
+    ccstring        text;       // description for print, second TLB of 0x63 printed only
+} cache_desc_t;
+
+#define CACHE_DESC(level, type, size, ways, line_size, sectored, text) \
+    { DESC_CACHE, level, type, ways, sectored, size, line_size, 0, 0, text }
+#define TLB_DESC(level, type, pages, ways, entries, text) \
+    { DESC_TLB, level, type, ways, FALSE, 0, 0, pages, entries, text }
+#define TRACE_DESC(size, ways, text) \
+    { DESC_TRACE, 1, DESC_INSTRUCTION, ways, FALSE, size, 0, 0, 0, text }
+#define PREFETCH_DESC(line_size, text) \
+    { DESC_PREFETCH, 0, DESC_UNIFIED, 0, FALSE, 0, line_size, 0, 0, text }
+#define NO_CACHE_DESC(level, text) \
+    { DESC_NO_CACHE, level, DESC_UNIFIED, 0, FALSE, 0, 0, 0, 0, text }
+#define LEAF_DESC(leaf, text) \
+    { DESC_LEAF, 0, DESC_UNIFIED, 0, FALSE, leaf, 0, 0, 0, text }
+#define VENDOR_DESC(text) \
+    { DESC_VENDOR, 0, DESC_UNIFIED, 0, FALSE, 0, 0, 0, 0, text }
+#define UNKNOWN_DESC \
+    { DESC_UNKNOWN, 0, DESC_UNIFIED, 0, FALSE, 0, 0, 0, 0, "unknown" }
+
+// Intel cache and TLB descriptors of CPUID function 00000002h, indexed by descriptor byte
+// vendor-specific and family-specific meanings are in leaf_2_patches
+static constexpr cache_desc_t  leaf_2_descriptors[] = {
+    /* 0x00      */ UNKNOWN_DESC,
+    /* 0x01      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K,                       4,          32,   "instruction TLB: 4K pages, 4-way, 32 entries"),
+    /* 0x02      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4M,                       4,          2,    "instruction TLB: 4M pages, 4-way, 2 entries"),
+    /* 0x03      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       4,          64,   "data TLB: 4K pages, 4-way, 64 entries"),
+    /* 0x04      */ TLB_DESC(0, DESC_DATA,        PAGES_4M,                       4,          8,    "data TLB: 4M pages, 4-way, 8 entries"),
+    /* 0x05      */ TLB_DESC(0, DESC_DATA,        PAGES_4M,                       4,          32,   "data TLB: 4M pages, 4-way, 32 entries"),
+    /* 0x06      */ CACHE_DESC(1, DESC_INSTRUCTION, 8,     4,  32,  FALSE, "L1 instruction cache: 8K, 4-way, 32 byte lines"),
+    /* 0x07      */ UNKNOWN_DESC,
+    /* 0x08      */ CACHE_DESC(1, DESC_INSTRUCTION, 16,    4,  32,  FALSE, "L1 instruction cache: 16K, 4-way, 32 byte lines"),
+    /* 0x09      */ CACHE_DESC(1, DESC_INSTRUCTION, 32,    4,  64,  FALSE, "L1 instruction cache: 32K, 4-way, 64-byte lines"),
+    /* 0x0a      */ CACHE_DESC(1, DESC_DATA,        8,     2,  32,  FALSE, "L1 data cache: 8K, 2-way, 32 byte lines"),
+    /* 0x0b      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4M,                       4,          4,    "instruction TLB: 4M pages, 4-way, 4 entries"),
+    /* 0x0c      */ CACHE_DESC(1, DESC_DATA,        16,    4,  32,  FALSE, "L1 data cache: 16K, 4-way, 32 byte lines"),
+    /* 0x0d      */ CACHE_DESC(1, DESC_DATA,        16,    4,  64,  FALSE, "L1 data cache: 16K, 4-way, 64-byte lines"),
+    /* 0x0e      */ CACHE_DESC(1, DESC_DATA,        24,    6,  64,  FALSE, "L1 data cache: 24K, 6-way, 64 byte lines"),
+    /* 0x0f      */ UNKNOWN_DESC,
+    /* 0x10      */ CACHE_DESC(1, DESC_DATA,        16,    4,  32,  FALSE, "L1 data cache: 16K, 4-way, 32 byte lines"),
+    /* 0x11-0x14 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x15      */ CACHE_DESC(1, DESC_INSTRUCTION, 16,    4,  32,  FALSE, "L1 instruction cache: 16K, 4-way, 32 byte lines"),
+    /* 0x16-0x19 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x1a      */ CACHE_DESC(2, DESC_UNIFIED,     96,    6,  64,  FALSE, "L2 cache: 96K, 6-way, 64 byte lines"),
+    /* 0x1b-0x1c */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x1d      */ CACHE_DESC(2, DESC_UNIFIED,     128,   2,  64,  FALSE, "L2 cache: 128K, 2-way, 64 byte lines"),
+    /* 0x1e-0x20 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x21      */ CACHE_DESC(2, DESC_UNIFIED,     256,   8,  64,  FALSE, "L2 cache: 256K MLC, 8-way, 64 byte lines"),
+    /* 0x22      */ CACHE_DESC(3, DESC_UNIFIED,     512,   4,  64,  FALSE, "L3 cache: 512K, 4-way, 64 byte lines"),
+    /* 0x23      */ CACHE_DESC(3, DESC_UNIFIED,     1024,  8,  64,  FALSE, "L3 cache: 1M, 8-way, 64 byte lines"),
+    /* 0x24      */ CACHE_DESC(2, DESC_UNIFIED,     1024,  16, 64,  FALSE, "L2 cache: 1M, 16-way, 64 byte lines"),
+    /* 0x25      */ CACHE_DESC(3, DESC_UNIFIED,     2048,  8,  64,  FALSE, "L3 cache: 2M, 8-way, 64 byte lines"),
+    /* 0x26-0x28 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x29      */ CACHE_DESC(3, DESC_UNIFIED,     4096,  8,  64,  FALSE, "L3 cache: 4M, 8-way, 64 byte lines"),
+    /* 0x2a-0x2b */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x2c      */ CACHE_DESC(1, DESC_DATA,        32,    8,  64,  FALSE, "L1 data cache: 32K, 8-way, 64 byte lines"),
+    /* 0x2d-0x2f */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x30      */ CACHE_DESC(1, DESC_UNIFIED,     32,    8,  64,  FALSE, "L1 cache: 32K, 8-way, 64 byte lines"),
+    /* 0x31-0x38 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x39      */ CACHE_DESC(2, DESC_UNIFIED,     128,   4,  64,  TRUE,  "L2 cache: 128K, 4-way, sectored, 64 byte lines"),
+    /* 0x3a      */ CACHE_DESC(2, DESC_UNIFIED,     192,   6,  64,  TRUE,  "L2 cache: 192K, 6-way, sectored, 64 byte lines"),
+    /* 0x3b      */ CACHE_DESC(2, DESC_UNIFIED,     128,   2,  64,  TRUE,  "L2 cache: 128K, 2-way, sectored, 64 byte lines"),
+    /* 0x3c      */ CACHE_DESC(2, DESC_UNIFIED,     256,   4,  64,  TRUE,  "L2 cache: 256K, 4-way, sectored, 64 byte lines"),
+    /* 0x3d      */ CACHE_DESC(2, DESC_UNIFIED,     384,   6,  64,  TRUE,  "L2 cache: 384K, 6-way, sectored, 64 byte lines"),
+    /* 0x3e      */ CACHE_DESC(2, DESC_UNIFIED,     512,   4,  64,  TRUE,  "L2 cache: 512K, 4-way, sectored, 64 byte lines"),
+    /* 0x3f      */ UNKNOWN_DESC,
+    /* 0x40      */ NO_CACHE_DESC(3, "No L3 cache"),
+    /* 0x41      */ CACHE_DESC(2, DESC_UNIFIED,     128,   4,  32,  FALSE, "L2 cache: 128K, 4-way, 32 byte lines"),
+    /* 0x42      */ CACHE_DESC(2, DESC_UNIFIED,     256,   4,  32,  FALSE, "L2 cache: 256K, 4-way, 32 byte lines"),
+    /* 0x43      */ CACHE_DESC(2, DESC_UNIFIED,     512,   4,  32,  FALSE, "L2 cache: 512K, 4-way, 32 byte lines"),
+    /* 0x44      */ CACHE_DESC(2, DESC_UNIFIED,     1024,  4,  32,  FALSE, "L2 cache: 1M, 4-way, 32 byte lines"),
+    /* 0x45      */ CACHE_DESC(2, DESC_UNIFIED,     2048,  4,  32,  FALSE, "L2 cache: 2M, 4-way, 32 byte lines"),
+    /* 0x46      */ CACHE_DESC(3, DESC_UNIFIED,     4096,  4,  64,  FALSE, "L3 cache: 4M, 4-way, 64 byte lines"),
+    /* 0x47      */ CACHE_DESC(3, DESC_UNIFIED,     8192,  8,  64,  FALSE, "L3 cache: 8M, 8-way, 64 byte lines"),
+    /* 0x48      */ CACHE_DESC(2, DESC_UNIFIED,     3072,  12, 64,  FALSE, "L2 cache: 3M, 12-way, 64 byte lines"),
+    /* 0x49      */ CACHE_DESC(2, DESC_UNIFIED,     4096,  16, 64,  FALSE, "L2 cache: 4M, 16-way, 64 byte lines"),
+    /* 0x4a      */ CACHE_DESC(3, DESC_UNIFIED,     6144,  12, 64,  FALSE, "L3 cache: 6M, 12-way, 64 byte lines"),
+    /* 0x4b      */ CACHE_DESC(3, DESC_UNIFIED,     8192,  16, 64,  FALSE, "L3 cache: 8M, 16-way, 64 byte lines"),
+    /* 0x4c      */ CACHE_DESC(3, DESC_UNIFIED,     12288, 12, 64,  FALSE, "L3 cache: 12M, 12-way, 64 byte lines"),
+    /* 0x4d      */ CACHE_DESC(3, DESC_UNIFIED,     16384, 16, 64,  FALSE, "L3 cache: 16M, 16-way, 64 byte lines"),
+    /* 0x4e      */ CACHE_DESC(2, DESC_UNIFIED,     6144,  24, 64,  FALSE, "L2 cache: 6M, 24-way, 64 byte lines"),
+    /* 0x4f      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K,                       0,          32,   "instruction TLB: 4K pages, 32 entries"),
+    /* 0x50      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K | PAGES_2M | PAGES_4M, 0,          64,   "instruction TLB: 4K & 2M/4M pages, 64 entries"),
+    /* 0x51      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K | PAGES_2M | PAGES_4M, 0,          128,  "instruction TLB: 4K & 2M/4M pages, 128 entries"),
+    /* 0x52      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K | PAGES_2M | PAGES_4M, 0,          256,  "instruction TLB: 4K & 2M/4M pages, 256 entries"),
+    /* 0x53-0x54 */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x55      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_2M | PAGES_4M,            DESC_FULLY, 7,    "instruction TLB: 2M/4M pages, fully, 7 entries"),
+    /* 0x56      */ TLB_DESC(1, DESC_DATA,        PAGES_4M,                       4,          16,   "L1 data TLB: 4M pages, 4-way, 16 entries"),
+    /* 0x57      */ TLB_DESC(1, DESC_DATA,        PAGES_4K,                       4,          16,   "L1 data TLB: 4K pages, 4-way, 16 entries"),
+    /* 0x58      */ UNKNOWN_DESC,
+    /* 0x59      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       0,          16,   "data TLB: 4K pages, 16 entries"),
+    /* 0x5a      */ TLB_DESC(0, DESC_DATA,        PAGES_2M | PAGES_4M,            4,          32,   "data TLB: 2M/4M pages, 4-way, 32 entries"),
+    /* 0x5b      */ TLB_DESC(0, DESC_DATA,        PAGES_4K | PAGES_4M,            0,          64,   "data TLB: 4K & 4M pages, 64 entries"),
+    /* 0x5c      */ TLB_DESC(0, DESC_DATA,        PAGES_4K | PAGES_4M,            0,          128,  "data TLB: 4K & 4M pages, 128 entries"),
+    /* 0x5d      */ TLB_DESC(0, DESC_DATA,        PAGES_4K | PAGES_4M,            0,          256,  "data TLB: 4K & 4M pages, 256 entries"),
+    /* 0x5e-0x5f */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x60      */ CACHE_DESC(1, DESC_DATA,        16,    8,  64,  FALSE, "L1 data cache: 16K, 8-way, 64 byte lines"),
+    /* 0x61      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K,                       0,          48,   "instruction TLB: 4K pages, 48 entries"),
+    /* 0x62      */ UNKNOWN_DESC,
+    /* 0x63      */ TLB_DESC(0, DESC_DATA,        PAGES_2M | PAGES_4M,            4,          32,   "data TLB: 2M/4M pages, 4-way, 32 entries" DESC_CONT "data TLB: 1G pages, 4-way, 4 entries"),
+    /* 0x64      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       4,          512,  "data TLB: 4K pages, 4-way, 512 entries"),
+    /* 0x65      */ UNKNOWN_DESC,
+    /* 0x66      */ CACHE_DESC(1, DESC_DATA,        8,     4,  64,  FALSE, "L1 data cache: 8K, 4-way, 64 byte lines"),
+    /* 0x67      */ CACHE_DESC(1, DESC_DATA,        16,    4,  64,  FALSE, "L1 data cache: 16K, 4-way, 64 byte lines"),
+    /* 0x68      */ CACHE_DESC(1, DESC_DATA,        32,    4,  64,  FALSE, "L1 data cache: 32K, 4-way, 64 byte lines"),
+    /* 0x69      */ UNKNOWN_DESC,
+    /* 0x6a      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       8,          64,   "micro-data TLB: 4K pages, 8-way, 64 entries"),
+    /* 0x6b      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       8,          256,  "data TLB: 4K pages, 8-way, 256 entries"),
+    /* 0x6c      */ TLB_DESC(0, DESC_DATA,        PAGES_2M | PAGES_4M,            8,          128,  "data TLB: 2M/4M pages, 8-way, 128 entries"),
+    /* 0x6d      */ TLB_DESC(0, DESC_DATA,        PAGES_1G,                       DESC_FULLY, 16,   "data TLB: 1G pages, fully, 16 entries"),
+    /* 0x6e-0x6f */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x70      */ TRACE_DESC(12, 8, "Trace cache: 12K-uop, 8-way"),
+    /* 0x71      */ TRACE_DESC(16, 8, "Trace cache: 16K-uop, 8-way"),
+    /* 0x72      */ TRACE_DESC(32, 8, "Trace cache: 32K-uop, 8-way"),
+    /* 0x73      */ TRACE_DESC(64, 8, "Trace cache: 64K-uop, 8-way"),
+    /* 0x74-0x75 */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x76      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_2M | PAGES_4M,            DESC_FULLY, 8,    "instruction TLB: 2M/4M pages, fully, 8 entries"),
+    /* 0x77      */ CACHE_DESC(1, DESC_INSTRUCTION, 16,    4,  64,  TRUE,  "L1 instruction cache: 16K, 4-way, sectored, 64 byte lines"),
+    /* 0x78      */ CACHE_DESC(2, DESC_UNIFIED,     1024,  4,  64,  FALSE, "L2 cache: 1M, 4-way, 64 byte lines"),
+    /* 0x79      */ CACHE_DESC(2, DESC_UNIFIED,     128,   8,  64,  TRUE,  "L2 cache: 128K, 8-way, sectored, 64 byte lines"),
+    /* 0x7a      */ CACHE_DESC(2, DESC_UNIFIED,     256,   8,  64,  TRUE,  "L2 cache: 256K, 8-way, sectored, 64 byte lines"),
+    /* 0x7b      */ CACHE_DESC(2, DESC_UNIFIED,     512,   8,  64,  TRUE,  "L2 cache: 512K, 8-way, sectored, 64 byte lines"),
+    /* 0x7c      */ CACHE_DESC(2, DESC_UNIFIED,     1024,  8,  64,  TRUE,  "L2 cache: 1M, 8-way, sectored, 64 byte lines"),
+    /* 0x7d      */ CACHE_DESC(2, DESC_UNIFIED,     2048,  8,  64,  FALSE, "L2 cache: 2M, 8-way, 64 byte lines"),
+    /* 0x7e      */ CACHE_DESC(2, DESC_UNIFIED,     256,   8,  128, TRUE,  "L2 cache: 256K, 8-way, sectored, 128 byte lines"),
+    /* 0x7f      */ CACHE_DESC(2, DESC_UNIFIED,     512,   2,  64,  FALSE, "L2 cache: 512K, 2-way, 64 byte lines"),
+    /* 0x80      */ CACHE_DESC(2, DESC_UNIFIED,     512,   8,  64,  FALSE, "L2 cache: 512K, 8-way, 64 byte lines"),
+    /* 0x81      */ CACHE_DESC(2, DESC_UNIFIED,     128,   8,  32,  FALSE, "L2 cache: 128K, 8-way, 32 byte lines"),
+    /* 0x82      */ CACHE_DESC(2, DESC_UNIFIED,     256,   8,  32,  FALSE, "L2 cache: 256K, 8-way, 32 byte lines"),
+    /* 0x83      */ CACHE_DESC(2, DESC_UNIFIED,     512,   8,  32,  FALSE, "L2 cache: 512K, 8-way, 32 byte lines"),
+    /* 0x84      */ CACHE_DESC(2, DESC_UNIFIED,     1024,  8,  32,  FALSE, "L2 cache: 1M, 8-way, 32 byte lines"),
+    /* 0x85      */ CACHE_DESC(2, DESC_UNIFIED,     2048,  8,  32,  FALSE, "L2 cache: 2M, 8-way, 32 byte lines"),
+    /* 0x86      */ CACHE_DESC(2, DESC_UNIFIED,     512,   4,  64,  FALSE, "L2 cache: 512K, 4-way, 64 byte lines"),
+    /* 0x87      */ CACHE_DESC(2, DESC_UNIFIED,     1024,  8,  64,  FALSE, "L2 cache: 1M, 8-way, 64 byte lines"),
+    /* 0x88      */ CACHE_DESC(3, DESC_UNIFIED,     2048,  4,  64,  FALSE, "L3 cache: 2M, 4-way, 64 byte lines"),
+    /* 0x89      */ CACHE_DESC(3, DESC_UNIFIED,     4096,  4,  64,  FALSE, "L3 cache: 4M, 4-way, 64 byte lines"),
+    /* 0x8a      */ CACHE_DESC(3, DESC_UNIFIED,     8192,  4,  64,  FALSE, "L3 cache: 8M, 4-way, 64 byte lines"),
+    /* 0x8b-0x8c */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x8d      */ CACHE_DESC(3, DESC_UNIFIED,     3072,  12, 128, FALSE, "L3 cache: 3M, 12-way, 128 byte lines"),
+    /* 0x8e-0x8f */ UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x90      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K_256M,                  DESC_FULLY, 64,   "instruction TLB: 4K-256M, fully, 64 entries"),
+    /* 0x91-0x95 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x96      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K_256M,                  DESC_FULLY, 32,   "instruction TLB: 4K-256M, fully, 32 entries"),
+    /* 0x97-0x9a */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0x9b      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K_256M,                  DESC_FULLY, 96,   "instruction TLB: 4K-256M, fully, 96 entries"),
+    /* 0x9c-0x9f */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xa0      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       DESC_FULLY, 32,   "data TLB: 4K pages, fully, 32 entries"),
+    /* 0xa1-0xa8 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xa9-0xaf */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xb0      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K,                       4,          128,  "instruction TLB: 4K, 4-way, 128 entries"),
+    /* 0xb1      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_2M | PAGES_4M,            4,          8,    "instruction TLB: 2M/4M, 4-way, 4/8 entries"),
+    /* 0xb2      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K,                       4,          64,   "instruction TLB: 4K, 4-way, 64 entries"),
+    /* 0xb3      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       4,          128,  "data TLB: 4K pages, 4-way, 128 entries"),
+    /* 0xb4      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       4,          256,  "data TLB: 4K pages, 4-way, 256 entries"),
+    /* 0xb5      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K,                       8,          64,   "instruction TLB: 4K, 8-way, 64 entries"),
+    /* 0xb6      */ TLB_DESC(0, DESC_INSTRUCTION, PAGES_4K,                       8,          128,  "instruction TLB: 4K, 8-way, 128 entries"),
+    /* 0xb7-0xb9 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xba      */ TLB_DESC(0, DESC_DATA,        PAGES_4K,                       4,          64,   "data TLB: 4K pages, 4-way, 64 entries"),
+    /* 0xbb-0xbf */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xc0      */ TLB_DESC(0, DESC_DATA,        PAGES_4K | PAGES_4M,            4,          8,    "data TLB: 4K & 4M pages, 4-way, 8 entries"),
+    /* 0xc1      */ TLB_DESC(2, DESC_UNIFIED,     PAGES_4K | PAGES_2M,            8,          1024, "L2 TLB: 4K/2M pages, 8-way, 1024 entries"),
+    /* 0xc2      */ TLB_DESC(0, DESC_DATA,        PAGES_4K | PAGES_2M,            4,          16,   "data TLB: 4K & 2M pages, 4-way, 16 entries"),
+    /* 0xc3      */ TLB_DESC(2, DESC_UNIFIED,     PAGES_4K | PAGES_2M,            6,          1536, "L2 TLB: 4K/2M pages, 6-way, 1536 entries"),
+    /* 0xc4      */ TLB_DESC(0, DESC_DATA,        PAGES_2M | PAGES_4M,            4,          32,   "data TLB: 2M/4M pages, 4-way, 32 entries"),
+    /* 0xc5-0xc9 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xca      */ TLB_DESC(2, DESC_UNIFIED,     PAGES_4K,                       4,          512,  "L2 TLB: 4K pages, 4-way, 512 entries"),
+    /* 0xcb-0xcf */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xd0      */ CACHE_DESC(3, DESC_UNIFIED,     512,   4,  64,  FALSE, "L3 cache: 512K, 4-way, 64 byte lines"),
+    /* 0xd1      */ CACHE_DESC(3, DESC_UNIFIED,     1024,  4,  64,  FALSE, "L3 cache: 1M, 4-way, 64 byte lines"),
+    /* 0xd2      */ CACHE_DESC(3, DESC_UNIFIED,     2048,  4,  64,  FALSE, "L3 cache: 2M, 4-way, 64 byte lines"),
+    /* 0xd3-0xd5 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xd6      */ CACHE_DESC(3, DESC_UNIFIED,     1024,  8,  64,  FALSE, "L3 cache: 1M, 8-way, 64 byte lines"),
+    /* 0xd7      */ CACHE_DESC(3, DESC_UNIFIED,     2048,  8,  64,  FALSE, "L3 cache: 2M, 8-way, 64 byte lines"),
+    /* 0xd8      */ CACHE_DESC(3, DESC_UNIFIED,     4096,  8,  64,  FALSE, "L3 cache: 4M, 8-way, 64 byte lines"),
+    /* 0xd9-0xdb */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xdc      */ CACHE_DESC(3, DESC_UNIFIED,     1536,  12, 64,  FALSE, "L3 cache: 1.5M, 12-way, 64 byte lines"),
+    /* 0xdd      */ CACHE_DESC(3, DESC_UNIFIED,     3072,  12, 64,  FALSE, "L3 cache: 3M, 12-way, 64 byte lines"),
+    /* 0xde      */ CACHE_DESC(3, DESC_UNIFIED,     6144,  12, 64,  FALSE, "L3 cache: 6M, 12-way, 64 byte lines"),
+    /* 0xdf-0xe1 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xe2      */ CACHE_DESC(3, DESC_UNIFIED,     2048,  16, 64,  FALSE, "L3 cache: 2M, 16-way, 64 byte lines"),
+    /* 0xe3      */ CACHE_DESC(3, DESC_UNIFIED,     4096,  16, 64,  FALSE, "L3 cache: 4M, 16-way, 64 byte lines"),
+    /* 0xe4      */ CACHE_DESC(3, DESC_UNIFIED,     8192,  16, 64,  FALSE, "L3 cache: 8M, 16-way, 64 byte lines"),
+    /* 0xe5-0xe9 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xea      */ CACHE_DESC(3, DESC_UNIFIED,     12288, 24, 64,  FALSE, "L3 cache: 12M, 24-way, 64 byte lines"),
+    /* 0xeb      */ CACHE_DESC(3, DESC_UNIFIED,     18432, 24, 64,  FALSE, "L3 cache: 18M, 24-way, 64 byte lines"),
+    /* 0xec      */ CACHE_DESC(3, DESC_UNIFIED,     24576, 24, 64,  FALSE, "L3 cache: 24M, 24-way, 64 byte lines"),
+    /* 0xed-0xef */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xf0      */ PREFETCH_DESC(64,  "64 byte prefetching"),
+    /* 0xf1      */ PREFETCH_DESC(128, "128 byte prefetching"),
+    /* 0xf2-0xf9 */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xfa-0xfd */ UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC, UNKNOWN_DESC,
+    /* 0xfe      */ LEAF_DESC(0x18, "TLB data is in CPUID leaf 0x18"),
+    /* 0xff      */ LEAF_DESC(4,    "cache data is in CPUID leaf 4"),
+};
+
+static_assert(LENGTH(leaf_2_descriptors) == 256, "leaf_2_descriptors: one entry per descriptor byte");
+
+#define VENDOR_BIT(vendor)  (1u << (vendor))
+#define ALL_VENDORS         (~0u)
+
+// other meaning of descriptor for some vendors or processors
+typedef struct {
+    unsigned char  value;    // descriptor byte
+    unsigned int   vendors;  // set of VENDOR_BIT() flags, ALL_VENDORS for any vendor
+    unsigned int   mask;     // mask of CPUID function 00000001h EAX, 0 for any processor
+    unsigned int   low;      // range of masked CPUID function 00000001h EAX
+    unsigned int   high;
+    cache_desc_t   desc;     // descriptor for matched processors
+} cache_desc_patch_t;
+
+// first matched row replaces entry of leaf_2_descriptors
+static constexpr cache_desc_patch_t  leaf_2_patches[] = {
+    { 0x70, VENDOR_BIT(VENDOR_CYRIX) | VENDOR_BIT(VENDOR_VIA), 0, 0, 0,
+      TLB_DESC(0, DESC_UNIFIED, PAGES_4K, 4, 32, "TLB: 4K pages, 4-way, 32 entries") },
+    { 0x74, VENDOR_BIT(VENDOR_CYRIX) | VENDOR_BIT(VENDOR_VIA), 0, 0, 0,
+      VENDOR_DESC("Cyrix-specific: ?") },
+    { 0x77, VENDOR_BIT(VENDOR_CYRIX) | VENDOR_BIT(VENDOR_VIA), 0, 0, 0,
+      VENDOR_DESC("Cyrix-specific: ?") },
+    { 0x80, VENDOR_BIT(VENDOR_CYRIX) | VENDOR_BIT(VENDOR_VIA), 0, 0, 0,
+      CACHE_DESC(1, DESC_UNIFIED, 16, 4, 16, FALSE, "L1 cache: 16K, 4-way, 16 byte lines") },
+    { 0x82, VENDOR_BIT(VENDOR_CYRIX) | VENDOR_BIT(VENDOR_VIA), 0, 0, 0,
+      VENDOR_DESC("Cyrix-specific: ?") },
+    { 0x84, VENDOR_BIT(VENDOR_CYRIX) | VENDOR_BIT(VENDOR_VIA), 0, 0, 0,
+      CACHE_DESC(2, DESC_UNIFIED, 1024, 8, 32, FALSE, "L2 cache: 1M, 8-way, 32 byte lines") },
+    { 0x40, ALL_VENDORS, __F(~0u), 0, _XF(0) + _F(6),
+      NO_CACHE_DESC(2, "No L2 cache") },
+    { 0x49, ALL_VENDORS, __FM(~0u), _FM(0, 15, 0, 6), _FM(0, 15, 0, 6),
+      CACHE_DESC(3, DESC_UNIFIED, 4096, 16, 64, FALSE, "L3 cache: 4M, 16-way, 64 byte lines") },
+};
+
+#undef CACHE_DESC
+#undef TLB_DESC
+#undef TRACE_DESC
+#undef PREFETCH_DESC
+#undef NO_CACHE_DESC
+#undef LEAF_DESC
+#undef VENDOR_DESC
+#undef UNKNOWN_DESC
+
+// find meaning of cache and TLB descriptor of CPUID function 00000002h
+// value     = one descriptor byte from bytes sequence
+// vendor    = processor vendor numeric id by enumeration
+// val_1_eax = CPUID function 00000001h, register EAX
+// return descriptor, DESC_UNKNOWN if descriptor undefined
+static const cache_desc_t*
+lookup_cache_desc(unsigned char value, vendor_t vendor, unsigned int val_1_eax)
+{
+    unsigned int  i;
+
+    for (i = 0; i < LENGTH(leaf_2_patches); i++) {
+        const cache_desc_patch_t*  patch = &leaf_2_patches[i];
+        if (patch->value == value
+            && (patch->vendors & VENDOR_BIT(vendor)) != 0
+            && patch->low <= (val_1_eax & patch->mask)
+            && (val_1_eax & patch->mask) <= patch->high) {
+            return &patch->desc;
+        }
     }
+    return &leaf_2_descriptors[value];
 }
 
 // detect processor cache size by descriptors analysing, for INTEL style CPUID function 00000002h
+// flags follow Intel meaning of descriptor for all vendors and families, as synth decoders expect,
+// so leaf_2_patches not applied, 0x49 counts as L3 and 0x80 as 8-way 512K L2 of P6 style
 // stash = pointer to structure for accumulate processor information
 // value = one descriptor byte from bytes sequence, available by cpuid function 00000002h
 // for this function, accumulated information represented as set of binary flags (set TRUE or FALSE)
@@ -1483,87 +2321,43 @@ print_override_brand(code_stash_t* stash)
 static void
 stash_intel_cache(code_stash_t* stash, unsigned char value)
 {
-    switch (value) {
-    case 0x42: stash->L2_4w_256K = TRUE; break;
-    case 0x43: stash->L2_4w_512K = TRUE; break;
-    case 0x44: stash->L2_4w_1Mor2M = TRUE; break;
-    case 0x45: stash->L2_4w_1Mor2M = TRUE; break;
-    case 0x80: stash->L2_8w_512K = TRUE; break;
-    case 0x82: stash->L2_8w_256K = TRUE; break;
-    case 0x83: stash->L2_8w_512K = TRUE; break;
-    case 0x84: stash->L2_8w_1Mor2M = TRUE; break;
-    case 0x85: stash->L2_8w_1Mor2M = TRUE; break;
-    }
+    const cache_desc_t*  desc = &leaf_2_descriptors[value];
 
     switch (value) {
-    case 0x45:
-    case 0x7d:
-    case 0x85:
-        stash->L2_2M = TRUE;
-        break;
+    case 0x49: stash->L3 = TRUE;         return;
+    case 0x80: stash->L2_8w_512K = TRUE; return;
     }
 
-    switch (value) {
-    case 0x4e:
-        stash->L2_6M = TRUE;
-        break;
-    }
+    if (desc->kind != DESC_CACHE) return;
 
-    switch (value) {
-    case 0x22:
-    case 0x23:
-    case 0x25:
-    case 0x29:
-    case 0x46:
-    case 0x47:
-    case 0x49:
-    case 0x4a:
-    case 0x4b:
-    case 0x4c:
-    case 0x4d:
-    case 0x88:
-    case 0x89:
-    case 0x8a:
-    case 0x8d:
-    case 0xd0:
-    case 0xd1:
-    case 0xd2:
-    case 0xd6:
-    case 0xd7:
-    case 0xd8:
-    case 0xdc:
-    case 0xdd:
-    case 0xde:
-    case 0xe2:
-    case 0xe3:
-    case 0xe4:
-    case 0xea:
-    case 0xeb:
-    case 0xec:
+    if (desc->level == 3) {
         stash->L3 = TRUE;
-        break;
     }
+    if (desc->level != 2 || desc->type != DESC_UNIFIED) return;
 
-    switch (value) {
-    case 0x21:
-    case 0x3c:
-    case 0x42:
-    case 0x7a:
-    case 0x7e:
-    case 0x82:
-        stash->L2_256K = TRUE;
-        break;
+    switch (desc->size) {
+    case 256:  stash->L2_256K = TRUE; break;
+    case 512:  stash->L2_512K = TRUE; break;
+    case 2048: stash->L2_2M = TRUE;   break;
+    case 6144: stash->L2_6M = TRUE;   break;
     }
 
-    switch (value) {
-    case 0x3e:
-    case 0x43:
-    case 0x7b:
-    case 0x7f:
-    case 0x83:
-    case 0x86:
-        stash->L2_512K = TRUE;
-        break;
+    // P6 family L2 caches have 32 byte lines
+    if (desc->line_size == 32 && desc->ways == 4) {
+        switch (desc->size) {
+        case 256:  stash->L2_4w_256K = TRUE;   break;
+        case 512:  stash->L2_4w_512K = TRUE;   break;
+        case 1024:
+        case 2048: stash->L2_4w_1Mor2M = TRUE; break;
+        }
+    }
+    else if (desc->line_size == 32 && desc->ways == 8) {
+        switch (desc->size) {
+        case 256:  stash->L2_8w_256K = TRUE;   break;
+        case 512:  stash->L2_8w_512K = TRUE;   break;
+        case 1024:
+        case 2048: stash->L2_8w_1Mor2M = TRUE; break;
+        }
     }
 }
 
@@ -1628,102 +2422,301 @@ decode_brand_id_stash(code_stash_t* stash)
     }
 }
 
+// facts recognized in brand string, one token per flag of br structure,
+// plus prefixes required before model number patterns
+typedef enum {
+    BRAND_MOBILE,
+    BRAND_CELERON,
+    BRAND_CORE_TM,
+    BRAND_PENTIUM,
+    BRAND_ATOM,
+    BRAND_XEON_MP,
+    BRAND_XEON,
+    BRAND_PENTIUM_M,
+    BRAND_PENTIUM_D,
+    BRAND_GENERIC,
+    BRAND_SCALABLE,
+    BRAND_CC150,
+    BRAND_CORE,                 // prefix of "Core.* [im][3579]-" patterns
+    BRAND_ATHLON_LV,
+    BRAND_ATHLON_XP,
+    BRAND_DURON,
+    BRAND_ATHLON,
+    BRAND_SEMPRON,
+    BRAND_PHENOM,
+    BRAND_SERIES,
+    BRAND_A_SERIES,
+    BRAND_C_SERIES,
+    BRAND_E_SERIES,
+    BRAND_G_SERIES,
+    BRAND_R_SERIES,
+    BRAND_Z_SERIES,
+    BRAND_GEODE,
+    BRAND_TURION,
+    BRAND_NEO,
+    BRAND_ATHLON_FX,
+    BRAND_ATHLON_MP,
+    BRAND_DURON_MP,
+    BRAND_OPTERON,
+    BRAND_FX,
+    BRAND_FIREPRO,
+    BRAND_ULTRA,
+    BRAND_RYZEN,
+    BRAND_EPYC,
+    BRAND_EMBEDDED,
+    BRAND_CORES_2,
+    BRAND_CORES_3,
+    BRAND_CORES_4,
+    BRAND_CORES_6,
+    BRAND_MEDIAGX,
+    BRAND_C7,
+    BRAND_C7M,
+    BRAND_C7D,
+    BRAND_EDEN,
+    BRAND_ZHAOXIN,
+    BRAND_TOKENS                // number of tokens, must be last
+} brand_token_t;
+
+// keyword of brand string, literal text recognized as token
+typedef struct {
+    ccstring       text;        // literal text of keyword
+    unsigned int   length;      // length of text, without terminating zero
+    brand_token_t  token;       // recognized token
+} brand_keyword_t;
+
+#define BRAND_KEYWORD(text,token)  { text, sizeof(text) - 1, token }
+
+// keywords of brand string, several keywords can give same token
+static const brand_keyword_t  brand_keywords[] = {
+    BRAND_KEYWORD("Mobile", BRAND_MOBILE),
+    BRAND_KEYWORD("mobile", BRAND_MOBILE),
+    BRAND_KEYWORD("Celeron", BRAND_CELERON),
+    BRAND_KEYWORD("Core(TM)", BRAND_CORE_TM),
+    BRAND_KEYWORD("Pentium", BRAND_PENTIUM),
+    BRAND_KEYWORD("Atom", BRAND_ATOM),
+    BRAND_KEYWORD("Xeon MP", BRAND_XEON_MP),
+    BRAND_KEYWORD("Xeon(TM) MP", BRAND_XEON_MP),
+    BRAND_KEYWORD("Xeon(R)", BRAND_XEON_MP),
+    BRAND_KEYWORD("Xeon", BRAND_XEON),
+    BRAND_KEYWORD("Pentium(R) M", BRAND_PENTIUM_M),
+    BRAND_KEYWORD("Pentium(R) D", BRAND_PENTIUM_D),
+    BRAND_KEYWORD("Genuine Intel(R) CPU", BRAND_GENERIC),
+    BRAND_KEYWORD("Bronze", BRAND_SCALABLE),
+    BRAND_KEYWORD("Silver", BRAND_SCALABLE),
+    BRAND_KEYWORD("Gold", BRAND_SCALABLE),
+    BRAND_KEYWORD("Platinum", BRAND_SCALABLE),
+    BRAND_KEYWORD("CC150", BRAND_CC150),
+    BRAND_KEYWORD("Core", BRAND_CORE),
+    BRAND_KEYWORD("Athlon(tm) XP-M (LV)", BRAND_ATHLON_LV),
+    BRAND_KEYWORD("Athlon(tm) XP", BRAND_ATHLON_XP),
+    BRAND_KEYWORD("Athlon(TM) XP", BRAND_ATHLON_XP),
+    BRAND_KEYWORD("Duron", BRAND_DURON),
+    BRAND_KEYWORD("Athlon", BRAND_ATHLON),
+    BRAND_KEYWORD("Sempron", BRAND_SEMPRON),
+    BRAND_KEYWORD("Phenom", BRAND_PHENOM),
+    BRAND_KEYWORD("Series", BRAND_SERIES),
+    BRAND_KEYWORD("AMD A", BRAND_A_SERIES),
+    BRAND_KEYWORD("AMD PRO A", BRAND_A_SERIES),
+    BRAND_KEYWORD("AMD C", BRAND_C_SERIES),
+    BRAND_KEYWORD("AMD E", BRAND_E_SERIES),
+    BRAND_KEYWORD("AMD G", BRAND_G_SERIES),
+    BRAND_KEYWORD("AMD R", BRAND_R_SERIES),
+    BRAND_KEYWORD("AMD Z", BRAND_Z_SERIES),
+    BRAND_KEYWORD("Geode", BRAND_GEODE),
+    BRAND_KEYWORD("Turion", BRAND_TURION),
+    BRAND_KEYWORD("Neo", BRAND_NEO),
+    BRAND_KEYWORD("Athlon(tm) 64 FX", BRAND_ATHLON_FX),
+    BRAND_KEYWORD("Athlon(tm) MP", BRAND_ATHLON_MP),
+    BRAND_KEYWORD("Duron(tm) MP", BRAND_DURON_MP),
+    BRAND_KEYWORD("Opteron", BRAND_OPTERON),
+    BRAND_KEYWORD("AMD FX", BRAND_FX),
+    BRAND_KEYWORD("Firepro", BRAND_FIREPRO), // total guess
+    BRAND_KEYWORD("Ultra", BRAND_ULTRA),
+    BRAND_KEYWORD("Ryzen", BRAND_RYZEN),
+    BRAND_KEYWORD("EPYC", BRAND_EPYC),
+    BRAND_KEYWORD("Embedded", BRAND_EMBEDDED),
+    BRAND_KEYWORD("Dual Core", BRAND_CORES_2),
+    BRAND_KEYWORD(" X2 ", BRAND_CORES_2),
+    BRAND_KEYWORD("Triple-Core", BRAND_CORES_3),
+    BRAND_KEYWORD(" X3 ", BRAND_CORES_3),
+    BRAND_KEYWORD("Quad-Core", BRAND_CORES_4),
+    BRAND_KEYWORD(" X4 ", BRAND_CORES_4),
+    BRAND_KEYWORD("Six-Core", BRAND_CORES_6),
+    BRAND_KEYWORD(" X6 ", BRAND_CORES_6),
+    BRAND_KEYWORD("MediaGXtm", BRAND_MEDIAGX),
+    BRAND_KEYWORD("C7", BRAND_C7),
+    BRAND_KEYWORD("C7-M", BRAND_C7M),
+    BRAND_KEYWORD("C7-D", BRAND_C7D),
+    BRAND_KEYWORD("Eden", BRAND_EDEN),
+    BRAND_KEYWORD("ZHAOXIN", BRAND_ZHAOXIN),
+};
+
+#define BRAND_NO_KEYWORD  0xff
+
+// keywords chained by first character, built once, see brand_keywords_index()
+typedef struct {
+    unsigned char  first[256];                   // first keyword of character, BRAND_NO_KEYWORD if none
+    unsigned char  next[LENGTH(brand_keywords)]; // next keyword with same first character
+} brand_index_t;
+
+static_assert(LENGTH(brand_keywords) < BRAND_NO_KEYWORD, "brand_keywords: too many keywords for brand_index_t");
+
+// return index of brand keywords by first character, keep order of keywords
+static brand_index_t
+brand_keywords_index(void)
+{
+    brand_index_t  index;
+    unsigned int   i;
+    memset(index.first, BRAND_NO_KEYWORD, sizeof(index.first));
+    for (i = LENGTH(brand_keywords); i > 0; i--) {
+        unsigned char  c = (unsigned char)brand_keywords[i - 1].text[0];
+        index.next[i - 1] = index.first[c];
+        index.first[c] = (unsigned char)(i - 1);
+    }
+    return index;
+}
+
+// return number of decimal digits at the start of string
+// str = pointer to string
+static unsigned int
+count_digits(const char* str)
+{
+    unsigned int  n = 0;
+    while (str[n] >= '0' && str[n] <= '9') n++;
+    return n;
+}
+
 // decode brand string (CPU model name), recognize vendor-specific and model-specific facts,
-// search patterns in the model name string, use regular expressions
+// single scan of the model name string, keywords found by first character,
+// model number patterns matched at their first character
 // brand = pointer to argument string, processor name for parse
 // stash = pointer to structure for accumulate processor information,
 // for this function, accumulated information represented as set of binary flags (set TRUE or FALSE)
 static void
 decode_brand_string(const char* brand, code_stash_t* stash)
 {
-    stash->br.mobile = (strstr(brand, "Mobile") != NULL
-        || strstr(brand, "mobile") != NULL);
-
-    stash->br.celeron = strstr(brand, "Celeron") != NULL;
-    stash->br.core = strstr(brand, "Core(TM)") != NULL;
-    stash->br.pentium = strstr(brand, "Pentium") != NULL;
-    stash->br.atom = strstr(brand, "Atom") != NULL;
-    stash->br.xeon_mp = (strstr(brand, "Xeon MP") != NULL
-        || strstr(brand, "Xeon(TM) MP") != NULL
-        || strstr(brand, "Xeon(R)") != NULL);
-    stash->br.xeon = strstr(brand, "Xeon") != NULL;
-    stash->br.pentium_m = strstr(brand, "Pentium(R) M") != NULL;
-    stash->br.pentium_d = strstr(brand, "Pentium(R) D") != NULL;
-    stash->br.extreme = strregexp(brand, " ?X[0-9][0-9][0-9][0-9]");
-    stash->br.generic = strstr(brand, "Genuine Intel(R) CPU") != NULL;
-    stash->br.scalable = (strstr(brand, "Bronze") != NULL
-        || strstr(brand, "Silver") != NULL
-        || strstr(brand, "Gold") != NULL
-        || strstr(brand, "Platinum") != NULL);
-    stash->br.u_line = (strregexp(brand, "Core.* [im][3579]-[0-9]*U")
-        || strregexp(brand, "Pentium.* [0-9]*U")
-        || strregexp(brand, "Celeron.* [0-9]*U"));
-    stash->br.y_line = (strregexp(brand, "Core.* [im][3579]-[0-9]*Y")
-        || strregexp(brand, "Pentium.* [0-9]*Y")
-        || strregexp(brand, "Celeron.* [0-9]*Y"));
-    stash->br.g_line = strregexp(brand, "Core.* [im][3579]-[0-9]*G");
-    stash->br.i_8000 = strregexp(brand, "Core.* [im][3579]-8[0-9][0-9][0-9]");
-    stash->br.i_10000 = strregexp(brand, "Core.* i[3579]-10[0-9][0-9][0-9]");
-    stash->br.cc150 = strregexp(brand, "CC150");
-
-    stash->br.athlon_lv = strstr(brand, "Athlon(tm) XP-M (LV)") != NULL;
-    stash->br.athlon_xp = (strstr(brand, "Athlon(tm) XP") != NULL
-        || strstr(brand, "Athlon(TM) XP") != NULL);
-    stash->br.duron = strstr(brand, "Duron") != NULL;
-    stash->br.athlon = strstr(brand, "Athlon") != NULL;
-    stash->br.sempron = strstr(brand, "Sempron") != NULL;
-    stash->br.phenom = strstr(brand, "Phenom") != NULL;
-    stash->br.series = strstr(brand, "Series") != NULL;
-    stash->br.a_series = (strstr(brand, "AMD A") != NULL
-        || strstr(brand, "AMD PRO A") != NULL);
-    stash->br.c_series = strstr(brand, "AMD C") != NULL;
-    stash->br.e_series = strstr(brand, "AMD E") != NULL;
-    stash->br.g_series = strstr(brand, "AMD G") != NULL;
-    stash->br.r_series = strstr(brand, "AMD R") != NULL;
-    stash->br.z_series = strstr(brand, "AMD Z") != NULL;
-    stash->br.geode = strstr(brand, "Geode") != NULL;
-    stash->br.turion = strstr(brand, "Turion") != NULL;
-    stash->br.neo = strstr(brand, "Neo") != NULL;
-    stash->br.athlon_fx = strstr(brand, "Athlon(tm) 64 FX") != NULL;
-    stash->br.athlon_mp = strstr(brand, "Athlon(tm) MP") != NULL;
-    stash->br.duron_mp = strstr(brand, "Duron(tm) MP") != NULL;
-    stash->br.opteron = strstr(brand, "Opteron") != NULL;
-    stash->br.fx = strstr(brand, "AMD FX") != NULL;
-    stash->br.firepro = strstr(brand, "Firepro") != NULL; // total guess
-    stash->br.ultra = strstr(brand, "Ultra") != NULL;
-    stash->br.t_suffix = strregexp(brand, "[0-9][0-9][0-9][0-9]T");
-    stash->br.ryzen = strstr(brand, "Ryzen") != NULL;
-    stash->br.epyc = strstr(brand, "EPYC") != NULL;
-    stash->br.epyc_3000 = strregexp(brand, "EPYC 3[0-9][0-9][0-9]");
-
-    stash->br.embedded = strstr(brand, "Embedded") != NULL;
-    if (strstr(brand, "Dual Core") != NULL
-        || strstr(brand, " X2 ") != NULL) {
+    static const brand_index_t  index = brand_keywords_index();
+    intbool                     found[BRAND_TOKENS];
+    unsigned int                i;
+    memset(found, 0, sizeof(found));
+
+    stash->br.extreme = FALSE;
+    stash->br.u_line = FALSE;
+    stash->br.y_line = FALSE;
+    stash->br.g_line = FALSE;
+    stash->br.i_8000 = FALSE;
+    stash->br.i_10000 = FALSE;
+    stash->br.t_suffix = FALSE;
+    stash->br.epyc_3000 = FALSE;
+
+    for (i = 0; brand[i] != '\0'; i++) {
+        const char*    str = &brand[i];
+        unsigned char  k;
+        for (k = index.first[(unsigned char)*str]; k != BRAND_NO_KEYWORD; k = index.next[k]) {
+            if (strncmp(str, brand_keywords[k].text, brand_keywords[k].length) == 0) {
+                found[brand_keywords[k].token] = TRUE;
+            }
+        }
+
+        unsigned int  n;
+        switch (*str) {
+        case 'X':   // " ?X[0-9][0-9][0-9][0-9]"
+            if (count_digits(str + 1) >= 4) stash->br.extreme = TRUE;
+            break;
+        case 'E':   // "EPYC 3[0-9][0-9][0-9]"
+            if (strncmp(str, "EPYC 3", 6) == 0 && count_digits(str + 6) >= 3) stash->br.epyc_3000 = TRUE;
+            break;
+        case ' ':
+            // "Core.* [im][3579]-[0-9]*[UYG]", "Core.* [im][3579]-8[0-9][0-9][0-9]",
+            // "Core.* i[3579]-10[0-9][0-9][0-9]", Core keyword found at lower position
+            if (   found[BRAND_CORE]
+                && (str[1] == 'i' || str[1] == 'm')
+                && (str[2] == '3' || str[2] == '5' || str[2] == '7' || str[2] == '9')
+                && str[3] == '-') {
+                n = count_digits(str + 4);
+                if (str[4 + n] == 'U') stash->br.u_line = TRUE;
+                if (str[4 + n] == 'Y') stash->br.y_line = TRUE;
+                if (str[4 + n] == 'G') stash->br.g_line = TRUE;
+                if (n >= 4 && str[4] == '8') stash->br.i_8000 = TRUE;
+                if (n >= 5 && str[1] == 'i' && str[4] == '1' && str[5] == '0') stash->br.i_10000 = TRUE;
+            }
+            // "Pentium.* [0-9]*[UY]", "Celeron.* [0-9]*[UY]"
+            if (found[BRAND_PENTIUM] || found[BRAND_CELERON]) {
+                n = count_digits(str + 1);
+                if (str[1 + n] == 'U') stash->br.u_line = TRUE;
+                if (str[1 + n] == 'Y') stash->br.y_line = TRUE;
+            }
+            break;
+        default:    // "[0-9][0-9][0-9][0-9]T"
+            if (*str >= '0' && *str <= '9' && count_digits(str) >= 4 && str[4] == 'T') stash->br.t_suffix = TRUE;
+            break;
+        }
+    }
+
+    stash->br.mobile = found[BRAND_MOBILE];
+
+    stash->br.celeron = found[BRAND_CELERON];
+    stash->br.core = found[BRAND_CORE_TM];
+    stash->br.pentium = found[BRAND_PENTIUM];
+    stash->br.atom = found[BRAND_ATOM];
+    stash->br.xeon_mp = found[BRAND_XEON_MP];
+    stash->br.xeon = found[BRAND_XEON];
+    stash->br.pentium_m = found[BRAND_PENTIUM_M];
+    stash->br.pentium_d = found[BRAND_PENTIUM_D];
+    stash->br.generic = found[BRAND_GENERIC];
+    stash->br.scalable = found[BRAND_SCALABLE];
+    stash->br.cc150 = found[BRAND_CC150];
+
+    stash->br.athlon_lv = found[BRAND_ATHLON_LV];
+    stash->br.athlon_xp = found[BRAND_ATHLON_XP];
+    stash->br.duron = found[BRAND_DURON];
+    stash->br.athlon = found[BRAND_ATHLON];
+    stash->br.sempron = found[BRAND_SEMPRON];
+    stash->br.phenom = found[BRAND_PHENOM];
+    stash->br.series = found[BRAND_SERIES];
+    stash->br.a_series = found[BRAND_A_SERIES];
+    stash->br.c_series = found[BRAND_C_SERIES];
+    stash->br.e_series = found[BRAND_E_SERIES];
+    stash->br.g_series = found[BRAND_G_SERIES];
+    stash->br.r_series = found[BRAND_R_SERIES];
+    stash->br.z_series = found[BRAND_Z_SERIES];
+    stash->br.geode = found[BRAND_GEODE];
+    stash->br.turion = found[BRAND_TURION];
+    stash->br.neo = found[BRAND_NEO];
+    stash->br.athlon_fx = found[BRAND_ATHLON_FX];
+    stash->br.athlon_mp = found[BRAND_ATHLON_MP];
+    stash->br.duron_mp = found[BRAND_DURON_MP];
+    stash->br.opteron = found[BRAND_OPTERON];
+    stash->br.fx = found[BRAND_FX];
+    stash->br.firepro = found[BRAND_FIREPRO];
+    stash->br.ultra = found[BRAND_ULTRA];
+    stash->br.ryzen = found[BRAND_RYZEN];
+    stash->br.epyc = found[BRAND_EPYC];
+
+    stash->br.embedded = found[BRAND_EMBEDDED];
+    if (found[BRAND_CORES_2]) {
         stash->br.cores = 2;
     }
-    else if (strstr(brand, "Triple-Core") != NULL
-        || strstr(brand, " X3 ") != NULL) {
+    else if (found[BRAND_CORES_3]) {
         stash->br.cores = 3;
     }
-    else if (strstr(brand, "Quad-Core") != NULL
-        || strstr(brand, " X4 ") != NULL) {
+    else if (found[BRAND_CORES_4]) {
         stash->br.cores = 4;
     }
-    else if (strstr(brand, "Six-Core") != NULL
-        || strstr(brand, " X6 ") != NULL) {
+    else if (found[BRAND_CORES_6]) {
         stash->br.cores = 6;
     }
     else {
         stash->br.cores = 0; // means unspecified by the brand string
     }
 
-    stash->br.mediagx = strstr(brand, "MediaGXtm") != NULL;
+    stash->br.mediagx = found[BRAND_MEDIAGX];
 
-    stash->br.c7 = strstr(brand, "C7") != NULL;
-    stash->br.c7m = strstr(brand, "C7-M") != NULL;
-    stash->br.c7d = strstr(brand, "C7-D") != NULL;
-    stash->br.eden = strstr(brand, "Eden") != NULL;
-    stash->br.zhaoxin = strstr(brand, "ZHAOXIN") != NULL;
+    stash->br.c7 = found[BRAND_C7];
+    stash->br.c7m = found[BRAND_C7M];
+    stash->br.c7d = found[BRAND_C7D];
+    stash->br.eden = found[BRAND_EDEN];
+    stash->br.zhaoxin = found[BRAND_ZHAOXIN];
 }
 
 // decode brand string (CPU model name), use override logic
@@ -2087,18 +3080,461 @@ decode_vendor(vendor_t vendor, const code_stash_t* stash)
     }
 }
 
-#define ACT(...)  (__VA_ARGS__)
+// brand queries of signature tables, one id per query macro used by any table row,
+// numeric id stored in table rows instead of query expression
+typedef enum {
+    QUERY_NONE,
+    QUERY_EE, QUERY_dG, QUERY_dP, QUERY_dC, QUERY_da, QUERY_dd, QUERY_dc, QUERY_sX,
+    QUERY_sM, QUERY_sS, QUERY_MP, QUERY_MC, QUERY_MM, QUERY_Mc, QUERY_Xc, QUERY_LU,
+    QUERY_LY, QUERY_LG, QUERY_UC, QUERY_UP, QUERY_YC, QUERY_YP, QUERY_d1, QUERY_xD,
+    QUERY_mD, QUERY_cD, QUERY_xK, QUERY_pK, QUERY_sI, QUERY_sP, QUERY_dL, QUERY_QW,
+    QUERY_DG, QUERY_Qc, QUERY_XE, QUERY_sQ, QUERY_s7, QUERY_de, QUERY_Me, QUERY_Qe,
+    QUERY_se, QUERY_Y8, QUERY_UX, QUERY_dA, QUERY_dX, QUERY_dF, QUERY_df, QUERY_dD,
+    QUERY_dS, QUERY_dI, QUERY_dR, QUERY_sO, QUERY_sA, QUERY_sD, QUERY_sE, QUERY_MA,
+    QUERY_MX, QUERY_ML, QUERY_MD, QUERY_MS, QUERY_Mp, QUERY_Ms, QUERY_Mr, QUERY_MG,
+    QUERY_MT, QUERY_MU, QUERY_Mn, QUERY_MN, QUERY_Sa, QUERY_Sc, QUERY_Se, QUERY_Sg,
+    QUERY_Sr, QUERY_Sz, QUERY_Ta, QUERY_Te, QUERY_AR, QUERY_ER, QUERY_EO, QUERY_DO,
+    QUERY_SO, QUERY_DA, QUERY_TA, QUERY_QA, QUERY_Dp, QUERY_Tp, QUERY_Qp, QUERY_Sp,
+    QUERY_DS, QUERY_s8, QUERY_dt, QUERY_dm, QUERY_dr, QUERY_Mt, QUERY_cm, QUERY_v7,
+    QUERY_vM, QUERY_vD, QUERY_vE, QUERY_vZ, QUERY_t2, QUERY_t4, QUERY_t5, QUERY_t6,
+    QUERY_t8,
+} query_t;
+
+// return brand query value = f(query, stash)
+// query = query numeric id by query_t enumeration
+// stash = pointer to structure for accumulate processor information
+static intbool
+eval_query(query_t query, const code_stash_t* stash)
+{
+    switch (query) {
+    case QUERY_EE: return EE;
+    case QUERY_dG: return dG;
+    case QUERY_dP: return dP;
+    case QUERY_dC: return dC;
+    case QUERY_da: return da;
+    case QUERY_dd: return dd;
+    case QUERY_dc: return dc;
+    case QUERY_sX: return sX;
+    case QUERY_sM: return sM;
+    case QUERY_sS: return sS;
+    case QUERY_MP: return MP;
+    case QUERY_MC: return MC;
+    case QUERY_MM: return MM;
+    case QUERY_Mc: return Mc;
+    case QUERY_Xc: return Xc;
+    case QUERY_LU: return LU;
+    case QUERY_LY: return LY;
+    case QUERY_LG: return LG;
+    case QUERY_UC: return UC;
+    case QUERY_UP: return UP;
+    case QUERY_YC: return YC;
+    case QUERY_YP: return YP;
+    case QUERY_d1: return d1;
+    case QUERY_xD: return xD;
+    case QUERY_mD: return mD;
+    case QUERY_cD: return cD;
+    case QUERY_xK: return xK;
+    case QUERY_pK: return pK;
+    case QUERY_sI: return sI;
+    case QUERY_sP: return sP;
+    case QUERY_dL: return dL;
+    case QUERY_QW: return QW;
+    case QUERY_DG: return DG;
+    case QUERY_Qc: return Qc;
+    case QUERY_XE: return XE;
+    case QUERY_sQ: return sQ;
+    case QUERY_s7: return s7;
+    case QUERY_de: return de;
+    case QUERY_Me: return Me;
+    case QUERY_Qe: return Qe;
+    case QUERY_se: return se;
+    case QUERY_Y8: return Y8;
+    case QUERY_UX: return UX;
+    case QUERY_dA: return dA;
+    case QUERY_dX: return dX;
+    case QUERY_dF: return dF;
+    case QUERY_df: return df;
+    case QUERY_dD: return dD;
+    case QUERY_dS: return dS;
+    case QUERY_dI: return dI;
+    case QUERY_dR: return dR;
+    case QUERY_sO: return sO;
+    case QUERY_sA: return sA;
+    case QUERY_sD: return sD;
+    case QUERY_sE: return sE;
+    case QUERY_MA: return MA;
+    case QUERY_MX: return MX;
+    case QUERY_ML: return ML;
+    case QUERY_MD: return MD;
+    case QUERY_MS: return MS;
+    case QUERY_Mp: return Mp;
+    case QUERY_Ms: return Ms;
+    case QUERY_Mr: return Mr;
+    case QUERY_MG: return MG;
+    case QUERY_MT: return MT;
+    case QUERY_MU: return MU;
+    case QUERY_Mn: return Mn;
+    case QUERY_MN: return MN;
+    case QUERY_Sa: return Sa;
+    case QUERY_Sc: return Sc;
+    case QUERY_Se: return Se;
+    case QUERY_Sg: return Sg;
+    case QUERY_Sr: return Sr;
+    case QUERY_Sz: return Sz;
+    case QUERY_Ta: return Ta;
+    case QUERY_Te: return Te;
+    case QUERY_AR: return AR;
+    case QUERY_ER: return ER;
+    case QUERY_EO: return EO;
+    case QUERY_DO: return DO;
+    case QUERY_SO: return SO;
+    case QUERY_DA: return DA;
+    case QUERY_TA: return TA;
+    case QUERY_QA: return QA;
+    case QUERY_Dp: return Dp;
+    case QUERY_Tp: return Tp;
+    case QUERY_Qp: return Qp;
+    case QUERY_Sp: return Sp;
+    case QUERY_DS: return DS;
+    case QUERY_s8: return s8;
+    case QUERY_dt: return dt;
+    case QUERY_dm: return dm;
+    case QUERY_dr: return dr;
+    case QUERY_Mt: return Mt;
+    case QUERY_cm: return cm;
+    case QUERY_v7: return v7;
+    case QUERY_vM: return vM;
+    case QUERY_vD: return vD;
+    case QUERY_vE: return vE;
+    case QUERY_vZ: return vZ;
+    case QUERY_t2: return t2;
+    case QUERY_t4: return t4;
+    case QUERY_t5: return t5;
+    case QUERY_t6: return t6;
+    case QUERY_t8: return t8;
+    default: return FALSE;
+    }
+}
 
-// structure for descript architecture
+// detection criteria of table row, row match signature val if
+// (val & mask) == value and brand query, if any, is true
 typedef struct {
-    cstring  uarch;         // process-dependent name
-    cstring  family;        // process-neutral name:
-                            //    sometimes independent (e.g. Core)
-                            //    sometimes based on lead uarch (e.g. Nehalem)
-    cstring  phys;          // physical properties: die process, #pins, etc.
-    intbool  core_is_uarch; // for some uarches, the core names are based on the
-                            // uarch names, so the uarch name becomes redundant
-} arch_t;
+    unsigned int  mask;                          // compared bits of TFMS signature
+    unsigned int  value;                         // expected TFMS signature bits
+    query_t       query;                         // brand query numeric id, QUERY_NONE if no query
+} criteria_t;
+
+// return TRUE if first row match every signature matched by second row,
+// so second row placed after first row is never used
+// first  = detection criteria of previous row
+// second = detection criteria of next row
+constexpr intbool
+signature_shadows(const criteria_t& first, const criteria_t& second)
+{
+    return (first.query == QUERY_NONE || first.query == second.query)
+        && (first.mask & second.mask) == first.mask
+        && (second.value & first.mask) == first.value;
+}
+
+// return TRUE if any of rows [first, last) shadows row, compile time
+// rows split by halves for keep recursion depth small
+// rows  = table with criteria member in each row
+// row   = index of checked row
+// first = index of first row of checked range
+// last  = index after last row of checked range
+template <typename row_t, size_t count>
+constexpr intbool
+signature_row_shadowed(const row_t (&rows)[count], size_t row, size_t first, size_t last)
+{
+    return (last - first == 1)
+        ? signature_shadows(rows[first].criteria, rows[row].criteria)
+        : (last - first > 1)
+          && (   signature_row_shadowed(rows, row, first, first + (last - first) / 2)
+              || signature_row_shadowed(rows, row, first + (last - first) / 2, last));
+}
+
+// return TRUE if any of rows [first, last) shadowed by some previous row, compile time
+// rows  = table with criteria member in each row
+// first = index of first row of checked range
+// last  = index after last row of checked range
+template <typename row_t, size_t count>
+constexpr intbool
+signature_rows_shadowed(const row_t (&rows)[count], size_t first, size_t last)
+{
+    return (last - first == 1)
+        ? signature_row_shadowed(rows, first, 0, first)
+        : (last - first > 1)
+          && (   signature_rows_shadowed(rows, first, first + (last - first) / 2)
+              || signature_rows_shadowed(rows, first + (last - first) / 2, last));
+}
+
+// reject table with unreachable rows at compile time, row order is detection priority
+#define CHECK_SIGNATURES(rows) \
+   static_assert(!signature_rows_shadowed(rows, 0, LENGTH(rows)), #rows ": row shadowed by previous row")
+
+// signature table reference, rows of any type with first member criteria_t
+typedef struct {
+    const criteria_t*  rows;                     // criteria of first row
+    size_t             count;                    // number of rows
+    size_t             size;                     // size of row, step between criteria of rows
+} signature_table_t;
+
+#define SIGNATURE_TABLE(rows)  { &rows[0].criteria, LENGTH(rows), sizeof(rows[0]) }
+
+// signature bits of family and model, used as index keys
+#define SIGNATURE_FAMILY  0x0ff00f00
+#define SIGNATURE_MODEL   0x000f00f0
+#define MODEL_KEY(val)    ((((val) >> 12) & 0xf0) | (((val) >> 4) & 0x0f))
+
+// candidate rows of one family, by model key
+typedef struct {
+    unsigned int  family;                        // family bits of signature, SIGNATURE_FAMILY mask
+    unsigned int  first[256];                    // first candidate of model in candidates array
+    unsigned int  count[256];                    // number of candidates of model
+} signature_family_t;
+
+// index of signature tables, built once at first lookup,
+// candidates of each model keep order of rows in tables
+typedef struct {
+    const signature_table_t*  tables;            // indexed tables, looked up in order
+    size_t                    num_tables;        // number of indexed tables
+    signature_family_t*       families;          // families with rows, sorted by family bits
+    unsigned int              num_families;      // number of families
+    const criteria_t**        candidates;        // candidate lists of all families
+    unsigned int              other_first;       // first candidate of other families
+    unsigned int              other_count;       // number of candidates of other families
+} signature_index_t;
+
+#define SIGNATURE_INDEX(tables)  make_signature_index(tables, LENGTH(tables))
+
+// return criteria of row number = f(table, row)
+// table = signature table reference
+// row   = index of row in table
+static const criteria_t*
+signature_row(const signature_table_t* table, size_t row)
+{
+    return (const criteria_t*)((const char*)table->rows + row * table->size);
+}
+
+// append rows to candidates list, when rows can match family and model
+// index  = signature index under construction
+// family = family bits, or ~0u for rows without family criteria only
+// model  = model key, or ~0u for rows without model criteria only
+// pos    = pointer to next free position in candidates array, NULL for count only
+// return number of candidates
+static unsigned int
+add_signature_candidates(signature_index_t* index, unsigned int family, unsigned int model, unsigned int* pos)
+{
+    unsigned int  num = 0;
+    size_t        table;
+    size_t        row;
+    for (table = 0; table < index->num_tables; table++) {
+        for (row = 0; row < index->tables[table].count; row++) {
+            const criteria_t*  criteria = signature_row(&index->tables[table], row);
+            if ((criteria->mask & SIGNATURE_FAMILY) == SIGNATURE_FAMILY) {
+                if ((criteria->value & SIGNATURE_FAMILY) != family) continue;
+                if ((criteria->mask & SIGNATURE_MODEL) == SIGNATURE_MODEL) {
+                    if (MODEL_KEY(criteria->value) != model) continue;
+                }
+            }
+            if (pos != NULL) index->candidates[(*pos)++] = criteria;
+            num++;
+        }
+    }
+    return num;
+}
+
+// build index of signature tables, by family then by model
+// index = signature index to build
+// return TRUE if built, FALSE if no memory, partially built arrays stay in index
+static intbool
+build_signature_index(signature_index_t* index)
+{
+    size_t  total = 0;
+    size_t  table;
+    size_t  row;
+    for (table = 0; table < index->num_tables; table++) {
+        total += index->tables[table].count;
+    }
+
+    // sorted distinct families of rows with family criteria
+    unsigned int*  keys = (unsigned int*)malloc((total + 1) * sizeof(unsigned int));
+    if (keys == NULL) {
+        return FALSE;
+    }
+    unsigned int  num_keys = 0;
+    for (table = 0; table < index->num_tables; table++) {
+        for (row = 0; row < index->tables[table].count; row++) {
+            const criteria_t*  criteria = signature_row(&index->tables[table], row);
+            if ((criteria->mask & SIGNATURE_FAMILY) != SIGNATURE_FAMILY) continue;
+            unsigned int  family = criteria->value & SIGNATURE_FAMILY;
+            unsigned int  at = num_keys;
+            while (at > 0 && keys[at - 1] > family) at--;
+            if (at > 0 && keys[at - 1] == family) continue;
+            memmove(&keys[at + 1], &keys[at], (num_keys - at) * sizeof(unsigned int));
+            keys[at] = family;
+            num_keys++;
+        }
+    }
+
+    // model tables of distinct families only
+    index->families = (signature_family_t*)malloc((num_keys + 1) * sizeof(signature_family_t));
+    if (index->families == NULL) {
+        free(keys);
+        return FALSE;
+    }
+    for (index->num_families = 0; index->num_families < num_keys; index->num_families++) {
+        index->families[index->num_families].family = keys[index->num_families];
+    }
+    free(keys);
+
+    // count candidates, models without own rows share generic list of family
+    unsigned int  size = add_signature_candidates(index, ~0u, ~0u, NULL);
+    unsigned int  i;
+    unsigned int  model;
+    for (i = 0; i < index->num_families; i++) {
+        signature_family_t*  family = &index->families[i];
+        size += add_signature_candidates(index, family->family, ~0u, NULL);
+        for (model = 0; model < 256; model++) {
+            family->count[model] = 0;
+        }
+        for (table = 0; table < index->num_tables; table++) {
+            for (row = 0; row < index->tables[table].count; row++) {
+                const criteria_t*  criteria = signature_row(&index->tables[table], row);
+                if (   (criteria->mask & SIGNATURE_FAMILY) == SIGNATURE_FAMILY
+                    && (criteria->mask & SIGNATURE_MODEL) == SIGNATURE_MODEL
+                    && (criteria->value & SIGNATURE_FAMILY) == family->family) {
+                    family->count[MODEL_KEY(criteria->value)] = 1;
+                }
+            }
+        }
+        for (model = 0; model < 256; model++) {
+            if (family->count[model] != 0) {
+                size += add_signature_candidates(index, family->family, model, NULL);
+            }
+        }
+    }
+
+    index->candidates = (const criteria_t**)malloc((size + 1) * sizeof(const criteria_t*));
+    if (index->candidates == NULL) {
+        return FALSE;
+    }
+
+    // fill candidates lists
+    unsigned int  pos = 0;
+    index->other_first = pos;
+    index->other_count = add_signature_candidates(index, ~0u, ~0u, &pos);
+    for (i = 0; i < index->num_families; i++) {
+        signature_family_t*  family = &index->families[i];
+        unsigned int         generic_first = pos;
+        unsigned int         generic_count = add_signature_candidates(index, family->family, ~0u, &pos);
+        for (model = 0; model < 256; model++) {
+            if (family->count[model] != 0) {
+                family->first[model] = pos;
+                family->count[model] = add_signature_candidates(index, family->family, model, &pos);
+            }
+            else {
+                family->first[model] = generic_first;
+                family->count[model] = generic_count;
+            }
+        }
+    }
+    return TRUE;
+}
+
+// return built index of signature tables, initializer of function-local static index,
+// so index built once at first lookup, thread-safe,
+// without memory for index return empty index, lookup_signature() scans tables in order
+// tables     = indexed tables, looked up in order
+// num_tables = number of indexed tables
+static signature_index_t
+make_signature_index(const signature_table_t tables[], size_t num_tables)
+{
+    signature_index_t  index = { tables, num_tables, NULL, 0, NULL, 0, 0 };
+
+    if (!build_signature_index(&index)) {
+        free(index.families);
+        free(index.candidates);
+        index.families = NULL;
+        index.num_families = 0;
+        index.candidates = NULL;
+    }
+    return index;
+}
+
+// return TRUE if criteria of row matched = f(criteria, val, stash)
+// criteria = criteria of signature table row
+// val      = CPU TFMS signature
+// stash    = pointer to structure for accumulate processor information, NULL if rows with
+//            brand query must be skipped
+static intbool
+match_signature(const criteria_t* criteria, unsigned int val, const code_stash_t* stash)
+{
+    return (val & criteria->mask) == criteria->value
+        && (   criteria->query == QUERY_NONE
+            || (stash != NULL && eval_query(criteria->query, stash)));
+}
+
+// return criteria of first matched row = f(index, val, stash), NULL if no row matched
+// index = signature index of tables
+// val   = CPU TFMS signature
+// stash = pointer to structure for accumulate processor information, NULL if rows with
+//         brand query must be skipped
+static const criteria_t*
+lookup_signature(const signature_index_t* index, unsigned int val, const code_stash_t* stash)
+{
+    if (index->candidates == NULL) {
+        size_t  table;
+        size_t  row;
+        for (table = 0; table < index->num_tables; table++) {
+            for (row = 0; row < index->tables[table].count; row++) {
+                const criteria_t*  criteria = signature_row(&index->tables[table], row);
+                if (match_signature(criteria, val, stash)) {
+                    return criteria;
+                }
+            }
+        }
+        return NULL;
+    }
+
+    unsigned int  first = index->other_first;
+    unsigned int  count = index->other_count;
+    unsigned int  low = 0;
+    unsigned int  high = index->num_families;
+    while (low < high) {
+        unsigned int  mid = low + (high - low) / 2;
+        if (index->families[mid].family < (val & SIGNATURE_FAMILY)) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    if (low < index->num_families && index->families[low].family == (val & SIGNATURE_FAMILY)) {
+        first = index->families[low].first[MODEL_KEY(val)];
+        count = index->families[low].count[MODEL_KEY(val)];
+    }
+
+    unsigned int  i;
+    for (i = first; i < first + count; i++) {
+        const criteria_t*  criteria = index->candidates[i];
+        if (match_signature(criteria, val, stash)) {
+            return criteria;
+        }
+    }
+    return NULL;
+}
+
+// structure for descript architecture
+typedef struct {
+    cstring  uarch;         // process-dependent name
+    cstring  family;        // process-neutral name:
+                            //    sometimes independent (e.g. Core)
+                            //    sometimes based on lead uarch (e.g. Nehalem)
+    cstring  phys;          // physical properties: die process, #pins, etc.
+    intbool  core_is_uarch; // for some uarches, the core names are based on the
+                            // uarch names, so the uarch name becomes redundant
+} arch_t;
 
 // blank architecture fields
 // arch = pointer to structure
@@ -2111,19 +3547,19 @@ init_arch(arch_t* arch)
     arch->core_is_uarch = FALSE;
 }
 
-// decode microarchitecture for INTEL
-// val  = input value, processor TFMS signature, CPUID function 00000001h, register EAX output
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_intel(unsigned int val, arch_t* arch)
-{
-    init_arch(arch);
-
-    cstring* u = &arch->uarch;
-    cstring* f = &arch->family;
-    cstring* p = &arch->phys;
-    intbool* ciu = &arch->core_is_uarch;
-
+// row of microarchitecture table, architecture fields for detection criteria,
+// tables are usable without decode_uarch(), see lookup_uarch()
+typedef struct {
+    criteria_t  criteria;       // detection criteria, must be first member
+    cstring     uarch;          // process-dependent name, NULL if unknown
+    cstring     family;         // process-neutral name, NULL if unknown
+    cstring     phys;           // physical properties, NULL if unknown
+    intbool     core_is_uarch;  // core names are based on the uarch name
+} uarch_row_t;
+
+// microarchitecture table of INTEL processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_intel[] = {
     // Intel calls "Whiskey Lake", "Amber Lake", and "Comet Lake" distinct
     // uarch's optimized from "Kaby Lake".  That just leads to confusion and long
     // uarch names with slashes.  Their families & models overlap, and just
@@ -2147,386 +3583,454 @@ decode_uarch_intel(unsigned int val, arch_t* arch)
     //
     // NOTE: Ice Lake & Tiger Lake cores are in the separate Sunny Cove uarch.
 
-    START;
-    F(0, 4, *f = "i486");          // *p depends on core
-    FM(0, 5, 0, 0, *f = "P5", *p = ".8um");
-    FM(0, 5, 0, 1, *f = "P5", *p = ".8um");
-    FM(0, 5, 0, 2, *f = "P5");
-    FM(0, 5, 0, 3, *f = "P5", *p = ".6um");
-    FM(0, 5, 0, 4, *f = "P5 MMX");
-    FM(0, 5, 0, 7, *f = "P5 MMX");
-    FM(0, 5, 0, 8, *f = "P5 MMX", *p = ".25um");
-    FM(0, 5, 0, 9, *f = "P5 MMX");
-    FM(0, 6, 0, 0, *f = "P6 Pentium II");
-    FM(0, 6, 0, 1, *f = "P6 Pentium II"); // *p depends on core
-    FM(0, 6, 0, 2, *f = "P6 Pentium II");
-    FM(0, 6, 0, 3, *f = "P6 Pentium II", *p = ".35um");
-    FM(0, 6, 0, 4, *f = "P6 Pentium II");
-    FM(0, 6, 0, 5, *f = "P6 Pentium II", *p = ".25um");
-    FM(0, 6, 0, 6, *f = "P6 Pentium II", *p = "L2 cache");
-    FM(0, 6, 0, 7, *f = "P6 Pentium III", *p = ".25um");
-    FM(0, 6, 0, 8, *f = "P6 Pentium III", *p = ".18um");
-    FM(0, 6, 0, 9, *f = "P6 Pentium M", *p = ".13um");
-    FM(0, 6, 0, 10, *f = "P6 Pentium III", *p = ".18um");
-    FM(0, 6, 0, 11, *f = "P6 Pentium III", *p = ".13um");
-    FM(0, 6, 0, 13, *u = "Dothan", *f = "P6 Pentium M");  // *p depends on core
-    FM(0, 6, 0, 14, *u = "Yonah", *f = "P6 Pentium M", *p = "65nm");
-    FM(0, 6, 0, 15, *u = "Merom", *f = "Core", *p = "65nm");
-    FM(0, 6, 1, 5, *u = "Dothan", *f = "P6 Pentium M", *p = "90nm");
-    FM(0, 6, 1, 6, *u = "Merom", *f = "Core", *p = "65nm");
-    FM(0, 6, 1, 7, *u = "Penryn", *f = "Core", *p = "45nm");
-    FM(0, 6, 1, 10, *u = "Nehalem", *f = "Nehalem", *p = "45nm");
-    FM(0, 6, 1, 12, *u = "Bonnell", *p = "45nm");
-    FM(0, 6, 1, 13, *u = "Penryn", *f = "Core", *p = "45nm");
-    FM(0, 6, 1, 14, *u = "Nehalem", *f = "Nehalem", *p = "45nm");
-    FM(0, 6, 1, 15, *u = "Nehalem", *f = "Nehalem", *p = "45nm");
-    FM(0, 6, 2, 5, *u = "Westmere", *f = "Nehalem", *p = "32nm");
-    FM(0, 6, 2, 6, *u = "Bonnell", *p = "45nm");
-    FM(0, 6, 2, 7, *u = "Saltwell", *p = "32nm");
-    FM(0, 6, 2, 10, *u = "Sandy Bridge", *ciu = TRUE, *f = "Sandy Bridge", *p = "32nm");
-    FM(0, 6, 2, 12, *u = "Westmere", *f = "Nehalem", *p = "32nm");
-    FM(0, 6, 2, 13, *u = "Sandy Bridge", *ciu = TRUE, *f = "Sandy Bridge", *p = "32nm");
-    FM(0, 6, 2, 14, *u = "Nehalem", *f = "Nehalem", *p = "45nm");
-    FM(0, 6, 2, 15, *u = "Westmere", *f = "Nehalem", *p = "32nm");
-    FM(0, 6, 3, 5, *u = "Saltwell", *p = "14nm");
-    FM(0, 6, 3, 6, *u = "Saltwell", *p = "32nm");
-    FM(0, 6, 3, 7, *u = "Silvermont", *p = "22nm");
-    FM(0, 6, 3, 10, *u = "Ivy Bridge", *ciu = TRUE, *f = "Sandy Bridge", *p = "22nm");
-    FM(0, 6, 3, 12, *u = "Haswell", *ciu = TRUE, *f = "Haswell", *p = "22nm");
-    FM(0, 6, 3, 13, *u = "Broadwell", *ciu = TRUE, *f = "Haswell", *p = "14nm");
-    FM(0, 6, 3, 14, *u = "Ivy Bridge", *ciu = TRUE, *f = "Sandy Bridge", *p = "22nm");
-    FM(0, 6, 3, 15, *u = "Haswell", *ciu = TRUE, *f = "Haswell", *p = "22nm");
-    FM(0, 6, 4, 5, *u = "Haswell", *ciu = TRUE, *f = "Haswell", *p = "22nm");
-    FM(0, 6, 4, 6, *u = "Haswell", *ciu = TRUE, *f = "Haswell", *p = "22nm");
-    FM(0, 6, 4, 7, *u = "Broadwell", *ciu = TRUE, *f = "Haswell", *p = "14nm");
-    FM(0, 6, 4, 10, *u = "Silvermont", *p = "22nm"); // no docs, but /proc/cpuinfo seen in wild
-    FM(0, 6, 4, 12, *u = "Airmont", *p = "14nm");
-    FM(0, 6, 4, 13, *u = "Silvermont", *p = "22nm");
-    FMS(0, 6, 4, 14, 8, *u = "Kaby Lake", *f = "Skylake", *p = "14nm");
-    FM(0, 6, 4, 14, *u = "Skylake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FM(0, 6, 4, 15, *u = "Broadwell", *ciu = TRUE, *f = "Haswell", *p = "14nm");
-    FMS(0, 6, 5, 5, 6, *u = "Cascade Lake", *ciu = TRUE, *f = "Skylake", *p = "14nm"); // no docs, but example from Greg Stewart
-    FMS(0, 6, 5, 5, 7, *u = "Cascade Lake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FMS(0, 6, 5, 5, 10, *u = "Cooper Lake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FM(0, 6, 5, 5, *u = "Skylake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FM(0, 6, 5, 6, *u = "Broadwell", *ciu = TRUE, *f = "Haswell", *p = "14nm");
-    FM(0, 6, 5, 7, *u = "Knights Landing", *ciu = TRUE, *p = "14nm");
-    FM(0, 6, 5, 10, *u = "Silvermont", *p = "22nm"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 5, 12, *u = "Goldmont", *p = "14nm"); // no spec update for Atom; only MSR_CPUID_table* so far
-    FM(0, 6, 5, 13, *u = "Silvermont", *p = "22nm"); // no spec update; only MSR_CPUID_table* so far
-    FMS(0, 6, 5, 14, 8, *u = "Kaby Lake", *f = "Skylake", *p = "14nm");
-    FM(0, 6, 5, 14, *u = "Skylake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FM(0, 6, 5, 15, *u = "Goldmont", *p = "14nm");
-    FM(0, 6, 6, 6, *u = "Palm Cove", *f = "Skylake", *p = "10nm"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 6, 10, *u = "Sunny Cove", *f = "Sunny Cove", *p = "10nm"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 6, 12, *u = "Sunny Cove", *f = "Sunny Cove", *p = "10nm"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 7, 5, *u = "Airmont", *p = "14nm"); // no spec update; whispers & rumors
-    FM(0, 6, 7, 10, *u = "Goldmont Plus", *p = "14nm");
-    FM(0, 6, 7, 13, *u = "Sunny Cove", *f = "Sunny Cove", *p = "10nm"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 7, 14, *u = "Sunny Cove", *f = "Sunny Cove", *p = "10nm");
-    FM(0, 6, 8, 5, *u = "Knights Mill", *ciu = TRUE, *p = "14nm"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 8, 6, *u = "Tremont", *p = "10nm"); // LX*
-    FM(0, 6, 8, 10, *u = "Tremont", *p = "10nm"); // no spec update; LX*
-    FM(0, 6, 8, 12, *u = "Willow Cove", *f = "Sunny Cove", *p = "10nm"); // found only on en.wikichip.org
-    FM(0, 6, 8, 13, *u = "Willow Cove", *f = "Sunny Cove", *p = "10nm"); // LX*
-    FM(0, 6, 8, 14, *u = "Kaby Lake", *f = "Skylake", *p = "14nm");
-    FM(0, 6, 8, 15, *u = "Sapphire Rapids", *f = "Sunny Cove", *p = "10nm"); // LX*
-    FM(0, 6, 9, 6, *u = "Tremont", *p = "10nm"); // LX*
-    FM(0, 6, 9, 7, *u = "Golden Cove", *p = "10nm"); // LX*
-    FM(0, 6, 9, 10, *u = "Golden Cove", *p = "10nm"); // Coreboot*
-    FM(0, 6, 9, 12, *u = "Tremont", *p = "10nm"); // LX*
-    FM(0, 6, 9, 13, *u = "Sunny Cove", *f = "Sunny Cove", *p = "10nm"); // LX*
-    FMS(0, 6, 9, 14, 9, *u = "Kaby Lake", *f = "Skylake", *p = "14nm");
-    FMS(0, 6, 9, 14, 10, *u = "Coffee Lake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FMS(0, 6, 9, 14, 11, *u = "Coffee Lake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FMS(0, 6, 9, 14, 12, *u = "Coffee Lake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FMS(0, 6, 9, 14, 13, *u = "Coffee Lake", *ciu = TRUE, *f = "Skylake", *p = "14nm");
-    FM(0, 6, 9, 14, *u = "Kaby Lake / Coffee Lake", *f = "Skylake", *p = "14nm");
-    FM(0, 6, 10, 5, *u = "Kaby Lake", *f = "Skylake", *p = "14nm"); // LX*
-    FM(0, 6, 10, 6, *u = "Kaby Lake", *f = "Skylake", *p = "14nm"); // no spec update; only instlatx64 example
-    FM(0, 6, 10, 7, *u = "Rocket Lake", *f = "Sunny Cove", *p = "14nm"); // LX*
-    F(0, 7, *u = "Itanium");
-    FM(0, 11, 0, 0, *u = "Knights Ferry", *ciu = TRUE, *f = "K1OM", *p = "45nm"); // found only on en.wikichip.org
-    FM(0, 11, 0, 1, *u = "Knights Corner", *ciu = TRUE, *f = "K1OM", *p = "22nm");
-    FM(0, 15, 0, 0, *u = "Willamette", *f = "Netburst", *p = ".18um");
-    FM(0, 15, 0, 1, *u = "Willamette", *f = "Netburst", *p = ".18um");
-    FM(0, 15, 0, 2, *u = "Northwood", *f = "Netburst", *p = ".13um");
-    FM(0, 15, 0, 3, *u = "Prescott", *f = "Netburst", *p = "90nm");
-    FM(0, 15, 0, 4, *u = "Prescott", *f = "Netburst", *p = "90nm");
-    FM(0, 15, 0, 6, *u = "Cedar Mill", *f = "Netburst", *p = "65nm");
-    F(0, 15, *f = "Netburst");
-    FM(1, 15, 0, 0, *u = "Itanium2", *p = ".18um");
-    FM(1, 15, 0, 1, *u = "Itanium2", *p = ".13um");
-    FM(1, 15, 0, 2, *u = "Itanium2", *p = ".13um");
-    F(1, 15, *u = "Itanium2");
-    F(2, 0, *u = "Itanium2", *p = "90nm");
-    F(2, 1, *u = "Itanium2");
-    DEFAULT((void)NULL);
-}
-
-// decode microarchitecture for AMD
+    F(0, 4, NULL, "i486", NULL, FALSE),          // *p depends on core
+    FM(0, 5, 0, 0, NULL, "P5", ".8um", FALSE),
+    FM(0, 5, 0, 1, NULL, "P5", ".8um", FALSE),
+    FM(0, 5, 0, 2, NULL, "P5", NULL, FALSE),
+    FM(0, 5, 0, 3, NULL, "P5", ".6um", FALSE),
+    FM(0, 5, 0, 4, NULL, "P5 MMX", NULL, FALSE),
+    FM(0, 5, 0, 7, NULL, "P5 MMX", NULL, FALSE),
+    FM(0, 5, 0, 8, NULL, "P5 MMX", ".25um", FALSE),
+    FM(0, 5, 0, 9, NULL, "P5 MMX", NULL, FALSE),
+    FM(0, 6, 0, 0, NULL, "P6 Pentium II", NULL, FALSE),
+    FM(0, 6, 0, 1, NULL, "P6 Pentium II", NULL, FALSE), // *p depends on core
+    FM(0, 6, 0, 2, NULL, "P6 Pentium II", NULL, FALSE),
+    FM(0, 6, 0, 3, NULL, "P6 Pentium II", ".35um", FALSE),
+    FM(0, 6, 0, 4, NULL, "P6 Pentium II", NULL, FALSE),
+    FM(0, 6, 0, 5, NULL, "P6 Pentium II", ".25um", FALSE),
+    FM(0, 6, 0, 6, NULL, "P6 Pentium II", "L2 cache", FALSE),
+    FM(0, 6, 0, 7, NULL, "P6 Pentium III", ".25um", FALSE),
+    FM(0, 6, 0, 8, NULL, "P6 Pentium III", ".18um", FALSE),
+    FM(0, 6, 0, 9, NULL, "P6 Pentium M", ".13um", FALSE),
+    FM(0, 6, 0, 10, NULL, "P6 Pentium III", ".18um", FALSE),
+    FM(0, 6, 0, 11, NULL, "P6 Pentium III", ".13um", FALSE),
+    FM(0, 6, 0, 13, "Dothan", "P6 Pentium M", NULL, FALSE),  // *p depends on core
+    FM(0, 6, 0, 14, "Yonah", "P6 Pentium M", "65nm", FALSE),
+    FM(0, 6, 0, 15, "Merom", "Core", "65nm", FALSE),
+    FM(0, 6, 1, 5, "Dothan", "P6 Pentium M", "90nm", FALSE),
+    FM(0, 6, 1, 6, "Merom", "Core", "65nm", FALSE),
+    FM(0, 6, 1, 7, "Penryn", "Core", "45nm", FALSE),
+    FM(0, 6, 1, 10, "Nehalem", "Nehalem", "45nm", FALSE),
+    FM(0, 6, 1, 12, "Bonnell", NULL, "45nm", FALSE),
+    FM(0, 6, 1, 13, "Penryn", "Core", "45nm", FALSE),
+    FM(0, 6, 1, 14, "Nehalem", "Nehalem", "45nm", FALSE),
+    FM(0, 6, 1, 15, "Nehalem", "Nehalem", "45nm", FALSE),
+    FM(0, 6, 2, 5, "Westmere", "Nehalem", "32nm", FALSE),
+    FM(0, 6, 2, 6, "Bonnell", NULL, "45nm", FALSE),
+    FM(0, 6, 2, 7, "Saltwell", NULL, "32nm", FALSE),
+    FM(0, 6, 2, 10, "Sandy Bridge", "Sandy Bridge", "32nm", TRUE),
+    FM(0, 6, 2, 12, "Westmere", "Nehalem", "32nm", FALSE),
+    FM(0, 6, 2, 13, "Sandy Bridge", "Sandy Bridge", "32nm", TRUE),
+    FM(0, 6, 2, 14, "Nehalem", "Nehalem", "45nm", FALSE),
+    FM(0, 6, 2, 15, "Westmere", "Nehalem", "32nm", FALSE),
+    FM(0, 6, 3, 5, "Saltwell", NULL, "14nm", FALSE),
+    FM(0, 6, 3, 6, "Saltwell", NULL, "32nm", FALSE),
+    FM(0, 6, 3, 7, "Silvermont", NULL, "22nm", FALSE),
+    FM(0, 6, 3, 10, "Ivy Bridge", "Sandy Bridge", "22nm", TRUE),
+    FM(0, 6, 3, 12, "Haswell", "Haswell", "22nm", TRUE),
+    FM(0, 6, 3, 13, "Broadwell", "Haswell", "14nm", TRUE),
+    FM(0, 6, 3, 14, "Ivy Bridge", "Sandy Bridge", "22nm", TRUE),
+    FM(0, 6, 3, 15, "Haswell", "Haswell", "22nm", TRUE),
+    FM(0, 6, 4, 5, "Haswell", "Haswell", "22nm", TRUE),
+    FM(0, 6, 4, 6, "Haswell", "Haswell", "22nm", TRUE),
+    FM(0, 6, 4, 7, "Broadwell", "Haswell", "14nm", TRUE),
+    FM(0, 6, 4, 10, "Silvermont", NULL, "22nm", FALSE), // no docs, but /proc/cpuinfo seen in wild
+    FM(0, 6, 4, 12, "Airmont", NULL, "14nm", FALSE),
+    FM(0, 6, 4, 13, "Silvermont", NULL, "22nm", FALSE),
+    FMS(0, 6, 4, 14, 8, "Kaby Lake", "Skylake", "14nm", FALSE),
+    FM(0, 6, 4, 14, "Skylake", "Skylake", "14nm", TRUE),
+    FM(0, 6, 4, 15, "Broadwell", "Haswell", "14nm", TRUE),
+    FMS(0, 6, 5, 5, 6, "Cascade Lake", "Skylake", "14nm", TRUE), // no docs, but example from Greg Stewart
+    FMS(0, 6, 5, 5, 7, "Cascade Lake", "Skylake", "14nm", TRUE),
+    FMS(0, 6, 5, 5, 10, "Cooper Lake", "Skylake", "14nm", TRUE),
+    FM(0, 6, 5, 5, "Skylake", "Skylake", "14nm", TRUE),
+    FM(0, 6, 5, 6, "Broadwell", "Haswell", "14nm", TRUE),
+    FM(0, 6, 5, 7, "Knights Landing", NULL, "14nm", TRUE),
+    FM(0, 6, 5, 10, "Silvermont", NULL, "22nm", FALSE), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 5, 12, "Goldmont", NULL, "14nm", FALSE), // no spec update for Atom; only MSR_CPUID_table* so far
+    FM(0, 6, 5, 13, "Silvermont", NULL, "22nm", FALSE), // no spec update; only MSR_CPUID_table* so far
+    FMS(0, 6, 5, 14, 8, "Kaby Lake", "Skylake", "14nm", FALSE),
+    FM(0, 6, 5, 14, "Skylake", "Skylake", "14nm", TRUE),
+    FM(0, 6, 5, 15, "Goldmont", NULL, "14nm", FALSE),
+    FM(0, 6, 6, 6, "Palm Cove", "Skylake", "10nm", FALSE), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 6, 10, "Sunny Cove", "Sunny Cove", "10nm", FALSE), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 6, 12, "Sunny Cove", "Sunny Cove", "10nm", FALSE), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 7, 5, "Airmont", NULL, "14nm", FALSE), // no spec update; whispers & rumors
+    FM(0, 6, 7, 10, "Goldmont Plus", NULL, "14nm", FALSE),
+    FM(0, 6, 7, 13, "Sunny Cove", "Sunny Cove", "10nm", FALSE), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 7, 14, "Sunny Cove", "Sunny Cove", "10nm", FALSE),
+    FM(0, 6, 8, 5, "Knights Mill", NULL, "14nm", TRUE), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 8, 6, "Tremont", NULL, "10nm", FALSE), // LX*
+    FM(0, 6, 8, 10, "Tremont", NULL, "10nm", FALSE), // no spec update; LX*
+    FM(0, 6, 8, 12, "Willow Cove", "Sunny Cove", "10nm", FALSE), // found only on en.wikichip.org
+    FM(0, 6, 8, 13, "Willow Cove", "Sunny Cove", "10nm", FALSE), // LX*
+    FM(0, 6, 8, 14, "Kaby Lake", "Skylake", "14nm", FALSE),
+    FM(0, 6, 8, 15, "Sapphire Rapids", "Sunny Cove", "10nm", FALSE), // LX*
+    FM(0, 6, 9, 6, "Tremont", NULL, "10nm", FALSE), // LX*
+    FM(0, 6, 9, 7, "Golden Cove", NULL, "10nm", FALSE), // LX*
+    FM(0, 6, 9, 10, "Golden Cove", NULL, "10nm", FALSE), // Coreboot*
+    FM(0, 6, 9, 12, "Tremont", NULL, "10nm", FALSE), // LX*
+    FM(0, 6, 9, 13, "Sunny Cove", "Sunny Cove", "10nm", FALSE), // LX*
+    FMS(0, 6, 9, 14, 9, "Kaby Lake", "Skylake", "14nm", FALSE),
+    FMS(0, 6, 9, 14, 10, "Coffee Lake", "Skylake", "14nm", TRUE),
+    FMS(0, 6, 9, 14, 11, "Coffee Lake", "Skylake", "14nm", TRUE),
+    FMS(0, 6, 9, 14, 12, "Coffee Lake", "Skylake", "14nm", TRUE),
+    FMS(0, 6, 9, 14, 13, "Coffee Lake", "Skylake", "14nm", TRUE),
+    FM(0, 6, 9, 14, "Kaby Lake / Coffee Lake", "Skylake", "14nm", FALSE),
+    FM(0, 6, 10, 5, "Kaby Lake", "Skylake", "14nm", FALSE), // LX*
+    FM(0, 6, 10, 6, "Kaby Lake", "Skylake", "14nm", FALSE), // no spec update; only instlatx64 example
+    FM(0, 6, 10, 7, "Rocket Lake", "Sunny Cove", "14nm", FALSE), // LX*
+    F(0, 7, "Itanium", NULL, NULL, FALSE),
+    FM(0, 11, 0, 0, "Knights Ferry", "K1OM", "45nm", TRUE), // found only on en.wikichip.org
+    FM(0, 11, 0, 1, "Knights Corner", "K1OM", "22nm", TRUE),
+    FM(0, 15, 0, 0, "Willamette", "Netburst", ".18um", FALSE),
+    FM(0, 15, 0, 1, "Willamette", "Netburst", ".18um", FALSE),
+    FM(0, 15, 0, 2, "Northwood", "Netburst", ".13um", FALSE),
+    FM(0, 15, 0, 3, "Prescott", "Netburst", "90nm", FALSE),
+    FM(0, 15, 0, 4, "Prescott", "Netburst", "90nm", FALSE),
+    FM(0, 15, 0, 6, "Cedar Mill", "Netburst", "65nm", FALSE),
+    F(0, 15, NULL, "Netburst", NULL, FALSE),
+    FM(1, 15, 0, 0, "Itanium2", NULL, ".18um", FALSE),
+    FM(1, 15, 0, 1, "Itanium2", NULL, ".13um", FALSE),
+    FM(1, 15, 0, 2, "Itanium2", NULL, ".13um", FALSE),
+    F(1, 15, "Itanium2", NULL, NULL, FALSE),
+    F(2, 0, "Itanium2", NULL, "90nm", FALSE),
+    F(2, 1, "Itanium2", NULL, NULL, FALSE),
+};
+CHECK_SIGNATURES(uarch_intel);
+
+// return microarchitecture row = f(val), for INTEL
+// val  = input value, processor TFMS signature, CPUID function 00000001h, register EAX output
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_intel(unsigned int val)
+{
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_intel) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
+
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
+}
+
+// microarchitecture table of AMD processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_amd[] = {
+    FM(0, 4, 0, 3, "Am486", NULL, NULL, FALSE),
+    FM(0, 4, 0, 7, "Am486", NULL, NULL, FALSE),
+    FM(0, 4, 0, 8, "Am486", NULL, NULL, FALSE),
+    FM(0, 4, 0, 9, "Am486", NULL, NULL, FALSE),
+    F(0, 4, "Am5x86", NULL, NULL, FALSE),
+    FM(0, 5, 0, 6, "K6", NULL, ".30um", FALSE),
+    FM(0, 5, 0, 7, "K6", NULL, ".25um", FALSE), // *p from sandpile.org
+    FM(0, 5, 0, 13, "K6", NULL, ".18um", FALSE), // *p from sandpile.org
+    F(0, 5, "K6", NULL, NULL, FALSE),
+    FM(0, 6, 0, 1, "K7", NULL, ".25um", FALSE),
+    FM(0, 6, 0, 2, "K7", NULL, ".18um", FALSE),
+    F(0, 6, "K7", NULL, NULL, FALSE),
+    FMS(0, 15, 0, 4, 8, "K8", NULL, "754-pin, .13um", FALSE),
+    FM(0, 15, 0, 4, "K8", NULL, "940-pin, .13um", FALSE),
+    FM(0, 15, 0, 5, "K8", NULL, "940-pin, .13um", FALSE),
+    FM(0, 15, 0, 7, "K8", NULL, "939-pin, .13um", FALSE),
+    FM(0, 15, 0, 8, "K8", NULL, "754-pin, .13um", FALSE),
+    FM(0, 15, 0, 11, "K8", NULL, "939-pin, .13um", FALSE),
+    FM(0, 15, 0, 12, "K8", NULL, "754-pin, .13um", FALSE),
+    FM(0, 15, 0, 14, "K8", NULL, "754-pin, .13um", FALSE),
+    FM(0, 15, 0, 15, "K8", NULL, "939-pin, .13um", FALSE),
+    FM(0, 15, 1, 4, "K8", NULL, "754-pin, 90nm", FALSE),
+    FM(0, 15, 1, 5, "K8", NULL, "940-pin, 90nm", FALSE),
+    FM(0, 15, 1, 7, "K8", NULL, "939-pin, 90nm", FALSE),
+    FM(0, 15, 1, 8, "K8", NULL, "754-pin, 90nm", FALSE),
+    FM(0, 15, 1, 11, "K8", NULL, "939-pin, 90nm", FALSE),
+    FM(0, 15, 1, 12, "K8", NULL, "754-pin, 90nm", FALSE),
+    FM(0, 15, 1, 15, "K8", NULL, "939-pin, 90nm", FALSE),
+    FM(0, 15, 2, 1, "K8", NULL, "940-pin, 90nm", FALSE),
+    FM(0, 15, 2, 3, "K8", NULL, "939-pin, 90nm", FALSE),
+    FM(0, 15, 2, 4, "K8", NULL, "754-pin, 90nm", FALSE),
+    FM(0, 15, 2, 5, "K8", NULL, "940-pin, 90nm", FALSE),
+    FM(0, 15, 2, 7, "K8", NULL, "939-pin, 90nm", FALSE),
+    FM(0, 15, 2, 11, "K8", NULL, "939-pin, 90nm", FALSE),
+    FM(0, 15, 2, 12, "K8", NULL, "754-pin, 90nm", FALSE),
+    FM(0, 15, 2, 15, "K8", NULL, "939-pin, 90nm", FALSE),
+    FM(0, 15, 4, 1, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 4, 3, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 4, 8, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 4, 11, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 4, 12, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 4, 15, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 5, 13, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 5, 15, "K8", NULL, "90nm", FALSE),
+    FM(0, 15, 6, 8, "K8", NULL, "65nm", FALSE),
+    FM(0, 15, 6, 11, "K8", NULL, "65nm", FALSE),
+    FM(0, 15, 6, 12, "K8", NULL, "65nm", FALSE),
+    FM(0, 15, 6, 15, "K8", NULL, "65nm", FALSE),
+    FM(0, 15, 7, 12, "K8", NULL, "65nm", FALSE),
+    FM(0, 15, 7, 15, "K8", NULL, "65nm", FALSE),
+    FM(0, 15, 12, 1, "K8", NULL, "90nm", FALSE),
+    FM(1, 15, 0, 0, "K10", NULL, "65nm", FALSE), // sandpile.org
+    FM(1, 15, 0, 2, "K10", NULL, "65nm", FALSE),
+    FM(1, 15, 0, 4, "K10", NULL, "45nm", FALSE),
+    FM(1, 15, 0, 5, "K10", NULL, "45nm", FALSE),
+    FM(1, 15, 0, 6, "K10", NULL, "45nm", FALSE),
+    FM(1, 15, 0, 8, "K10", NULL, "45nm", FALSE),
+    FM(1, 15, 0, 9, "K10", NULL, "45nm", FALSE),
+    FM(1, 15, 0, 10, "K10", NULL, "45nm", FALSE),
+    F(2, 15, "Puma 2008", NULL, "65nm", FALSE),
+    F(3, 15, "K10", NULL, "32nm", FALSE),
+    F(5, 15, "Bobcat", NULL, "40nm", FALSE),
+    FM(6, 15, 0, 0, "Bulldozer", NULL, "32nm", FALSE), // instlatx64 engr sample
+    FM(6, 15, 0, 1, "Bulldozer", NULL, "32nm", FALSE),
+    FM(6, 15, 0, 2, "Piledriver", NULL, "32nm", FALSE),
+    FM(6, 15, 1, 0, "Piledriver", NULL, "32nm", FALSE),
+    FM(6, 15, 1, 3, "Piledriver", NULL, "32nm", FALSE),
+    FM(6, 15, 3, 0, "Steamroller", NULL, "28nm", FALSE),
+    FM(6, 15, 3, 8, "Steamroller", NULL, "28nm", FALSE),
+    FM(6, 15, 4, 0, "Steamroller", NULL, "28nm", FALSE), // Software Optimization Guide (15h) says it has the same inst latencies as (6,15),(3,x).
+    FM(6, 15, 6, 0, "Excavator", NULL, "28nm", FALSE), // undocumented, but instlatx64 samples
+    FM(6, 15, 6, 5, "Excavator", NULL, "28nm", FALSE), // undocumented, but sample from Alexandros Couloumbis
+    FM(6, 15, 7, 0, "Excavator", NULL, "28nm", FALSE),
+    FM(7, 15, 0, 0, "Jaguar", NULL, "28nm", FALSE),
+    FM(7, 15, 2, 6, "Cato", NULL, "28nm", FALSE), // only instlatx64 example; engr sample?
+    FM(7, 15, 3, 0, "Puma 2014", NULL, "28nm", FALSE),
+    FM(8, 15, 0, 0, "Zen", NULL, "14nm", FALSE), // instlatx64 engr sample
+    FM(8, 15, 0, 1, "Zen", NULL, "14nm", FALSE),
+    FM(8, 15, 0, 8, "Zen+", NULL, "12nm", FALSE),
+    FM(8, 15, 1, 1, "Zen", NULL, "14nm", FALSE), // found only on en.wikichip.org & instlatx64 examples
+    FM(8, 15, 1, 8, "Zen+", NULL, "12nm", FALSE),
+    FM(8, 15, 2, 0, "Zen", NULL, "14nm", FALSE),
+    FM(8, 15, 3, 1, "Zen 2", NULL, "7nm", FALSE),  // found only on en.wikichip.org
+    FM(8, 15, 6, 0, "Zen 2", NULL, "7nm", FALSE),
+    FM(8, 15, 7, 1, "Zen 2", NULL, "7nm", FALSE),  // undocumented, but samples from Steven Noonan
+    F(10, 15, "Zen 3", NULL, "7nm", FALSE),  // undocumented, LX*
+};
+CHECK_SIGNATURES(uarch_amd);
+
+// return microarchitecture row = f(val), for AMD
 // bug: 00000500h is K5
 // F(0, 5, *u = "K6");
 // early detection of 00000500h required before this string ?
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_amd(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_amd(unsigned int val)
 {
-    init_arch(arch);
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_amd) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    cstring* u = &arch->uarch;
-    cstring* p = &arch->phys;
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
+}
 
-    START;
-    FM(0, 4, 0, 3, *u = "Am486");
-    FM(0, 4, 0, 7, *u = "Am486");
-    FM(0, 4, 0, 8, *u = "Am486");
-    FM(0, 4, 0, 9, *u = "Am486");
-    F(0, 4, *u = "Am5x86");
-    FM(0, 5, 0, 6, *u = "K6", *p = ".30um");
-    FM(0, 5, 0, 7, *u = "K6", *p = ".25um"); // *p from sandpile.org
-    FM(0, 5, 0, 13, *u = "K6", *p = ".18um"); // *p from sandpile.org
-    F(0, 5, *u = "K6");
-    FM(0, 6, 0, 1, *u = "K7", *p = ".25um");
-    FM(0, 6, 0, 2, *u = "K7", *p = ".18um");
-    F(0, 6, *u = "K7");
-    FMS(0, 15, 0, 4, 8, *u = "K8", *p = "754-pin, .13um");
-    FM(0, 15, 0, 4, *u = "K8", *p = "940-pin, .13um");
-    FM(0, 15, 0, 5, *u = "K8", *p = "940-pin, .13um");
-    FM(0, 15, 0, 7, *u = "K8", *p = "939-pin, .13um");
-    FM(0, 15, 0, 8, *u = "K8", *p = "754-pin, .13um");
-    FM(0, 15, 0, 11, *u = "K8", *p = "939-pin, .13um");
-    FM(0, 15, 0, 12, *u = "K8", *p = "754-pin, .13um");
-    FM(0, 15, 0, 14, *u = "K8", *p = "754-pin, .13um");
-    FM(0, 15, 0, 15, *u = "K8", *p = "939-pin, .13um");
-    FM(0, 15, 1, 4, *u = "K8", *p = "754-pin, 90nm");
-    FM(0, 15, 1, 5, *u = "K8", *p = "940-pin, 90nm");
-    FM(0, 15, 1, 7, *u = "K8", *p = "939-pin, 90nm");
-    FM(0, 15, 1, 8, *u = "K8", *p = "754-pin, 90nm");
-    FM(0, 15, 1, 11, *u = "K8", *p = "939-pin, 90nm");
-    FM(0, 15, 1, 12, *u = "K8", *p = "754-pin, 90nm");
-    FM(0, 15, 1, 15, *u = "K8", *p = "939-pin, 90nm");
-    FM(0, 15, 2, 1, *u = "K8", *p = "940-pin, 90nm");
-    FM(0, 15, 2, 3, *u = "K8", *p = "939-pin, 90nm");
-    FM(0, 15, 2, 4, *u = "K8", *p = "754-pin, 90nm");
-    FM(0, 15, 2, 5, *u = "K8", *p = "940-pin, 90nm");
-    FM(0, 15, 2, 7, *u = "K8", *p = "939-pin, 90nm");
-    FM(0, 15, 2, 11, *u = "K8", *p = "939-pin, 90nm");
-    FM(0, 15, 2, 12, *u = "K8", *p = "754-pin, 90nm");
-    FM(0, 15, 2, 15, *u = "K8", *p = "939-pin, 90nm");
-    FM(0, 15, 4, 1, *u = "K8", *p = "90nm");
-    FM(0, 15, 4, 3, *u = "K8", *p = "90nm");
-    FM(0, 15, 4, 8, *u = "K8", *p = "90nm");
-    FM(0, 15, 4, 11, *u = "K8", *p = "90nm");
-    FM(0, 15, 4, 12, *u = "K8", *p = "90nm");
-    FM(0, 15, 4, 15, *u = "K8", *p = "90nm");
-    FM(0, 15, 5, 13, *u = "K8", *p = "90nm");
-    FM(0, 15, 5, 15, *u = "K8", *p = "90nm");
-    FM(0, 15, 6, 8, *u = "K8", *p = "65nm");
-    FM(0, 15, 6, 11, *u = "K8", *p = "65nm");
-    FM(0, 15, 6, 12, *u = "K8", *p = "65nm");
-    FM(0, 15, 6, 15, *u = "K8", *p = "65nm");
-    FM(0, 15, 7, 12, *u = "K8", *p = "65nm");
-    FM(0, 15, 7, 15, *u = "K8", *p = "65nm");
-    FM(0, 15, 12, 1, *u = "K8", *p = "90nm");
-    FM(1, 15, 0, 0, *u = "K10", *p = "65nm"); // sandpile.org
-    FM(1, 15, 0, 2, *u = "K10", *p = "65nm");
-    FM(1, 15, 0, 4, *u = "K10", *p = "45nm");
-    FM(1, 15, 0, 5, *u = "K10", *p = "45nm");
-    FM(1, 15, 0, 6, *u = "K10", *p = "45nm");
-    FM(1, 15, 0, 8, *u = "K10", *p = "45nm");
-    FM(1, 15, 0, 9, *u = "K10", *p = "45nm");
-    FM(1, 15, 0, 10, *u = "K10", *p = "45nm");
-    F(2, 15, *u = "Puma 2008", *p = "65nm");
-    F(3, 15, *u = "K10", *p = "32nm");
-    F(5, 15, *u = "Bobcat", *p = "40nm");
-    FM(6, 15, 0, 0, *u = "Bulldozer", *p = "32nm"); // instlatx64 engr sample
-    FM(6, 15, 0, 1, *u = "Bulldozer", *p = "32nm");
-    FM(6, 15, 0, 2, *u = "Piledriver", *p = "32nm");
-    FM(6, 15, 1, 0, *u = "Piledriver", *p = "32nm");
-    FM(6, 15, 1, 3, *u = "Piledriver", *p = "32nm");
-    FM(6, 15, 3, 0, *u = "Steamroller", *p = "28nm");
-    FM(6, 15, 3, 8, *u = "Steamroller", *p = "28nm");
-    FM(6, 15, 4, 0, *u = "Steamroller", *p = "28nm"); // Software Optimization Guide (15h) says it has the same inst latencies as (6,15),(3,x).
-    FM(6, 15, 6, 0, *u = "Excavator", *p = "28nm"); // undocumented, but instlatx64 samples
-    FM(6, 15, 6, 5, *u = "Excavator", *p = "28nm"); // undocumented, but sample from Alexandros Couloumbis
-    FM(6, 15, 7, 0, *u = "Excavator", *p = "28nm");
-    FM(7, 15, 0, 0, *u = "Jaguar", *p = "28nm");
-    FM(7, 15, 2, 6, *u = "Cato", *p = "28nm"); // only instlatx64 example; engr sample?
-    FM(7, 15, 3, 0, *u = "Puma 2014", *p = "28nm");
-    FM(8, 15, 0, 0, *u = "Zen", *p = "14nm"); // instlatx64 engr sample
-    FM(8, 15, 0, 1, *u = "Zen", *p = "14nm");
-    FM(8, 15, 0, 8, *u = "Zen+", *p = "12nm");
-    FM(8, 15, 1, 1, *u = "Zen", *p = "14nm"); // found only on en.wikichip.org & instlatx64 examples
-    FM(8, 15, 1, 8, *u = "Zen+", *p = "12nm");
-    FM(8, 15, 2, 0, *u = "Zen", *p = "14nm");
-    FM(8, 15, 3, 1, *u = "Zen 2", *p = "7nm");  // found only on en.wikichip.org
-    FM(8, 15, 6, 0, *u = "Zen 2", *p = "7nm");
-    FM(8, 15, 7, 1, *u = "Zen 2", *p = "7nm");  // undocumented, but samples from Steven Noonan
-    F(10, 15, *u = "Zen 3", *p = "7nm");  // undocumented, LX*
-    DEFAULT((void)NULL);
-}
-
-// decode microarchitecture for CYRIX
+// microarchitecture table of CYRIX processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_cyrix[] = {
+    F(0, 5, "M1", NULL, NULL, TRUE),
+    F(0, 6, "M2", NULL, NULL, TRUE),
+};
+CHECK_SIGNATURES(uarch_cyrix);
+
+// return microarchitecture row = f(val), for CYRIX
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_cyrix(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_cyrix(unsigned int val)
 {
-    init_arch(arch);
-
-    cstring* u = &arch->uarch;
-    intbool* ciu = &arch->core_is_uarch;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_cyrix) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    F(0, 5, *u = "M1", *ciu = TRUE);
-    F(0, 6, *u = "M2", *ciu = TRUE);
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-// decode microarchitecture for VIA
+// microarchitecture table of VIA processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_via[] = {
+    F(0, 5, "WinChip", NULL, NULL, TRUE),
+    FM(0, 6, 0, 6, "C3", NULL, ".18um", TRUE),
+    FM(0, 6, 0, 7, "C3", NULL, NULL, TRUE), // *p depends on core
+    FM(0, 6, 0, 8, "C3", NULL, ".13um", TRUE),
+    FM(0, 6, 0, 9, "C3", NULL, ".13um", TRUE),
+    FM(0, 6, 0, 10, "C7", NULL, "90nm", FALSE),
+    FM(0, 6, 0, 13, "C7", NULL, "90nm", FALSE),
+    FMSQ(0, 6, 0, 15, 14, vZ, "ZhangJiang", NULL, "28nm", FALSE),
+    FM(0, 6, 0, 15, "C7", NULL, NULL, FALSE),                      // *p depends on core
+    FM(0, 7, 0, 11, "ZhangJiang", NULL, "28nm", FALSE),
+};
+CHECK_SIGNATURES(uarch_via);
+
+// return microarchitecture row = f(val), for VIA
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
 // stash = pointer to structure for accumulate processor information, here used as additional argument
-static void
-decode_uarch_via(unsigned int val, arch_t* arch, const code_stash_t* stash)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_via(unsigned int val, const code_stash_t* stash)
 {
-    init_arch(arch);
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_via) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    cstring* u = &arch->uarch;
-    intbool* ciu = &arch->core_is_uarch;
-    cstring* p = &arch->phys;
+    return (const uarch_row_t*)lookup_signature(&index, val, stash);
+}
 
-    START;
-    F(0, 5, *u = "WinChip", *ciu = TRUE);
-    FM(0, 6, 0, 6, *u = "C3", *ciu = TRUE, *p = ".18um");
-    FM(0, 6, 0, 7, *u = "C3", *ciu = TRUE); // *p depends on core
-    FM(0, 6, 0, 8, *u = "C3", *ciu = TRUE, *p = ".13um");
-    FM(0, 6, 0, 9, *u = "C3", *ciu = TRUE, *p = ".13um");
-    FM(0, 6, 0, 10, *u = "C7", *p = "90nm");
-    FM(0, 6, 0, 13, *u = "C7", *p = "90nm");
-    FMSQ(0, 6, 0, 15, 14, vZ, *u = "ZhangJiang", *p = "28nm");
-    FM(0, 6, 0, 15, *u = "C7");                      // *p depends on core
-    FM(0, 7, 0, 11, *u = "ZhangJiang", *p = "28nm");
-    DEFAULT((void)NULL);
-}
-
-// decode microarchitecture for UMC
+// microarchitecture table of UMC processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_umc[] = {
+    F(0, 4, "486 U5", NULL, NULL, TRUE),
+};
+CHECK_SIGNATURES(uarch_umc);
+
+// return microarchitecture row = f(val), for UMC
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_umc(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_umc(unsigned int val)
 {
-    init_arch(arch);
-
-    cstring* u = &arch->uarch;
-    intbool* ciu = &arch->core_is_uarch;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_umc) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    F(0, 4, *u = "486 U5", *ciu = TRUE);
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-// decode microarchitecture for NEXGEN
+// microarchitecture table of NEXGEN processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_nexgen[] = {
+    F(0, 5, "Nx586", NULL, NULL, FALSE),
+};
+CHECK_SIGNATURES(uarch_nexgen);
+
+// return microarchitecture row = f(val), for NEXGEN
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_nexgen(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_nexgen(unsigned int val)
 {
-    init_arch(arch);
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_nexgen) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    cstring* u = &arch->uarch;
-
-    START;
-    F(0, 5, *u = "Nx586");
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-// decode microarchitecture for RISE
+// microarchitecture table of RISE processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_rise[] = {
+    F(0, 5, "mP6", NULL, NULL, TRUE),
+};
+CHECK_SIGNATURES(uarch_rise);
+
+// return microarchitecture row = f(val), for RISE
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_rise(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_rise(unsigned int val)
 {
-    init_arch(arch);
-
-    cstring* u = &arch->uarch;
-    intbool* ciu = &arch->core_is_uarch;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_rise) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    F(0, 5, *u = "mP6", *ciu = TRUE);
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-// decode microarchitecture for TRANSMETA
+// microarchitecture table of TRANSMETA processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_transmeta[] = {
+    F(0, 5, "Crusoe", NULL, NULL, TRUE),
+    F(0, 15, "Efficeon", NULL, NULL, TRUE),
+};
+CHECK_SIGNATURES(uarch_transmeta);
+
+// return microarchitecture row = f(val), for TRANSMETA
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_transmeta(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_transmeta(unsigned int val)
 {
-    init_arch(arch);
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_transmeta) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    cstring* u = &arch->uarch;
-    intbool* ciu = &arch->core_is_uarch;
-
-    START;
-    F(0, 5, *u = "Crusoe", *ciu = TRUE);
-    F(0, 15, *u = "Efficeon", *ciu = TRUE);
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-// decode microarchitecture for SIS
+// microarchitecture table of SIS processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_sis[] = {
+    F(0, 5, "mP6", NULL, NULL, TRUE),
+};
+CHECK_SIGNATURES(uarch_sis);
+
+// return microarchitecture row = f(val), for SIS
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_sis(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_sis(unsigned int val)
 {
-    init_arch(arch);
-
-    cstring* u = &arch->uarch;
-    intbool* ciu = &arch->core_is_uarch;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_sis) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    F(0, 5, *u = "mP6", *ciu = TRUE);
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-// decode microarchitecture for HYGON
+// microarchitecture table of HYGON processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_hygon[] = {
+    FM(9, 15, 0, 0, "Moksha", NULL, "14nm", FALSE),
+};
+CHECK_SIGNATURES(uarch_hygon);
+
+// return microarchitecture row = f(val), for HYGON
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_hygon(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_hygon(unsigned int val)
 {
-    init_arch(arch);
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_hygon) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    cstring* u = &arch->uarch;
-    cstring* p = &arch->phys;
-
-    START;
-    FM(9, 15, 0, 0, *u = "Moksha", *p = "14nm");
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-// decode microarchitecture for ZHAOXIN
+// microarchitecture table of ZHAOXIN processors, see lookup_uarch()
+// columns: signature criteria, uarch, family, phys, core_is_uarch
+static constexpr uarch_row_t  uarch_zhaoxin[] = {
+    FM(0, 7, 1, 11, "WuDaoKou", NULL, "28nm", TRUE),
+    FM(0, 7, 3, 11, "LuJiaZui", NULL, "16nm", TRUE),
+};
+CHECK_SIGNATURES(uarch_zhaoxin);
+
+// return microarchitecture row = f(val), for ZHAOXIN
 // val  = input value, processor TFMS signature
-// arch = pointer to structure for accumulate processor information
-static void
-decode_uarch_zhaoxin(unsigned int val, arch_t* arch)
+// return NULL if no row matched
+static const uarch_row_t*
+lookup_uarch_zhaoxin(unsigned int val)
 {
-    init_arch(arch);
-
-    cstring* u = &arch->uarch;
-    intbool* ciu = &arch->core_is_uarch;
-    cstring* p = &arch->phys;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(uarch_zhaoxin) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    FM(0, 7, 1, 11, *u = "WuDaoKou", *ciu = TRUE, *p = "28nm");
-    FM(0, 7, 3, 11, *u = "LuJiaZui", *ciu = TRUE, *p = "16nm");
-    DEFAULT((void)NULL);
+    return (const uarch_row_t*)lookup_signature(&index, val, NULL);
 }
 
-#undef ACT
+// return microarchitecture row = f(val, vendor, stash), include CPU vendor selection logic
+// val    = input value, processor TFMS signature, CPUID function 00000001h, register EAX output
+// vendor = vendor numeric id by enumeration
+// stash  = pointer to structure for accumulate processor information, NULL if rows
+//          with brand query must be skipped
+// return NULL if no row matched or no table for vendor
+static const uarch_row_t*
+lookup_uarch(unsigned int val, vendor_t vendor, const code_stash_t* stash)
+{
+    switch (vendor) {  // select appropriate vendor-specific table
+    case VENDOR_INTEL:     return lookup_uarch_intel(val);
+    case VENDOR_AMD:       return lookup_uarch_amd(val);
+    case VENDOR_CYRIX:     return lookup_uarch_cyrix(val);
+    case VENDOR_VIA:       return lookup_uarch_via(val, stash);
+    case VENDOR_TRANSMETA: return lookup_uarch_transmeta(val);
+    case VENDOR_UMC:       return lookup_uarch_umc(val);
+    case VENDOR_NEXGEN:    return lookup_uarch_nexgen(val);
+    case VENDOR_RISE:      return lookup_uarch_rise(val);
+    case VENDOR_SIS:       return lookup_uarch_sis(val);
+    case VENDOR_HYGON:     return lookup_uarch_hygon(val);
+    case VENDOR_ZHAOXIN:   return lookup_uarch_zhaoxin(val);
+    case VENDOR_NSC:       // vendor-specific tables yet absent for this vendors
+    case VENDOR_VORTEX:
+    case VENDOR_RDC:
+    case VENDOR_UNKNOWN:
+    default:
+        return NULL;
+    }
+}
 
 // detect vendor and decode microarchitecture for detected vendor
 // val    = input value, processor TFMS signature, CPUID function 00000001h, register EAX output
@@ -2536,47 +4040,14 @@ decode_uarch_zhaoxin(unsigned int val, arch_t* arch)
 static void
 decode_uarch(unsigned int val, vendor_t vendor, const code_stash_t* stash, arch_t* arch)
 {
-    init_arch(arch);   // pre-blank results
+    const uarch_row_t*  row = lookup_uarch(val, vendor, stash);
 
-    switch (vendor) {  // select appropriate vendor-specific decoder
-    case VENDOR_INTEL:
-        decode_uarch_intel(val, arch);
-        break;
-    case VENDOR_AMD:
-        decode_uarch_amd(val, arch);
-        break;
-    case VENDOR_CYRIX:
-        decode_uarch_cyrix(val, arch);
-        break;
-    case VENDOR_VIA:
-        decode_uarch_via(val, arch, stash);
-        break;
-    case VENDOR_TRANSMETA:
-        decode_uarch_transmeta(val, arch);
-        break;
-    case VENDOR_UMC:
-        decode_uarch_umc(val, arch);
-        break;
-    case VENDOR_NEXGEN:
-        decode_uarch_nexgen(val, arch);
-        break;
-    case VENDOR_RISE:
-        decode_uarch_rise(val, arch);
-        break;
-    case VENDOR_SIS:
-        decode_uarch_sis(val, arch);
-        break;
-    case VENDOR_HYGON:
-        decode_uarch_hygon(val, arch);
-        break;
-    case VENDOR_ZHAOXIN:
-        decode_uarch_zhaoxin(val, arch);
-        break;
-    case VENDOR_NSC:      // vendor-specific decoders yet absent for this vendors
-    case VENDOR_VORTEX:
-    case VENDOR_RDC:
-    case VENDOR_UNKNOWN:
-        break;
+    init_arch(arch);   // pre-blank results
+    if (row != NULL) {
+        arch->uarch = row->uarch;
+        arch->family = row->family;
+        arch->phys = row->phys;
+        arch->core_is_uarch = row->core_is_uarch;
     }
 }
 
@@ -2589,30 +4060,34 @@ print_uarch(const code_stash_t* stash)
     decode_uarch(stash->val_1_eax, stash->vendor, stash, &arch);
     if (arch.uarch != NULL || arch.family != NULL || arch.phys != NULL) {
         ccstring  vendor = decode_vendor(stash->vendor, stash);
-        printf("   (uarch synth) =");
+        emit("   (uarch synth) =");
         if (vendor != NULL) {
-            printf(" %s", vendor);
+            emit(" %s", vendor);
         }
         if (arch.uarch != NULL) {
-            printf(" %s", arch.uarch);
+            emit(" %s", arch.uarch);
         }
         if (arch.family != NULL) {
-            printf(" {%s}", arch.family);
+            emit(" {%s}", arch.family);
         }
         if (arch.phys != NULL) {
-            printf(", %s", arch.phys);
+            emit(", %s", arch.phys);
         }
-        printf("\n");
+        emit("\n");
     }
 }
 
+// size of buffer for synthesized processor name, see decode_synth()
+#define SYNTH_MAX  1024
+
 // build and return string with CPU microarchitecture and additional parameters
 // synth  = source string, some of details can be "unknown"
 // val    = processor TFMS signature
 // vendor = vendor numeric id by enumeration
+// buffer = buffer for build string
 // return string with CPU microarchitecture and additional parameters, add details to source string
 static cstring
-append_uarch(ccstring synth, unsigned int val, vendor_t vendor)
+append_uarch(ccstring synth, unsigned int val, vendor_t vendor, char buffer[SYNTH_MAX])
 {
     if (synth != NULL) {
         arch_t  arch;
@@ -2620,8 +4095,8 @@ append_uarch(ccstring synth, unsigned int val, vendor_t vendor)
         if ((arch.uarch != NULL && !arch.core_is_uarch)
             || arch.family != NULL
             || arch.phys != NULL) {
-            static char  buffer[1024];
-            char* ptr = buffer;
+            char   text[SYNTH_MAX];   // synth can be at buffer
+            char*  ptr = text;
 
             ptr += sprintf(ptr, "%s", synth);
 
@@ -2634,6 +4109,7 @@ append_uarch(ccstring synth, unsigned int val, vendor_t vendor)
             if (arch.phys != NULL) {
                 ptr += sprintf(ptr, ", %s", arch.phys);
             }
+            memcpy(buffer, text, ptr - text + 1);
             return buffer;
         }
     }
@@ -2647,8 +4123,8 @@ append_uarch(ccstring synth, unsigned int val, vendor_t vendor)
 static void
 debug_queries(const code_stash_t* stash)
 {
-#define DEBUGQ(q) printf("%s = %s\n", #q, (q)      ? "TRUE" : "FALSE")
-#define DEBUGF(f) printf("%s = %s\n", #f, f(stash) ? "TRUE" : "FALSE")
+#define DEBUGQ(q) emit("%s = %s\n", #q, (q)      ? "TRUE" : "FALSE")
+#define DEBUGF(f) emit("%s = %s\n", #f, f(stash) ? "TRUE" : "FALSE")
 
     DEBUGQ(is_intel);
     DEBUGQ(is_amd);
@@ -2742,635 +4218,608 @@ debug_queries(const code_stash_t* stash)
 #undef DEBUGF
 }
 
-#define ACT(str)  (result = (str))
+// row of synth table, processor name string for detection criteria
+typedef struct {
+    criteria_t  criteria;                        // detection criteria, must be first member
+    cstring     name;                            // processor name string, NULL if unknown
+} synth_row_t;
 
-// helper procedure, part of CPU signature detection for return CPU name string
-// can refactor: use criteria descriptors instead if-else sequence by FM and similar macro
+// return processor name string of first matched synth row = f(index, val, stash),
+// NULL if no row matched
+// index = signature index of synth tables
 // val   = CPU TFMS signature
 // stash = pointer to structure for accumulate processor information
 static cstring
-decode_synth_intel_part_1(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
+lookup_synth(const signature_index_t* index, unsigned int val, const code_stash_t* stash)
 {
-    cstring  result = NULL;
+    const criteria_t*  criteria = lookup_signature(index, val, stash);
 
-    START;
-    FM(0, 4, 0, 0, "Intel i80486DX-25/33, .18um"); // process from sandpile.org
-    FM(0, 4, 0, 1, "Intel i80486DX-50, .18um"); // process from sandpile.org
-    FM(0, 4, 0, 2, "Intel i80486SX, .18um"); // process from sandpile.org
-    FM(0, 4, 0, 3, "Intel i80486DX/2");
-    FM(0, 4, 0, 4, "Intel i80486SL, .8um");
-    FM(0, 4, 0, 5, "Intel i80486SX/2, .8um");
-    FM(0, 4, 0, 7, "Intel i80486DX/2-WB, .8um");
-    FM(0, 4, 0, 8, "Intel i80486DX/4, .6um");
-    FM(0, 4, 0, 9, "Intel i80486DX/4-WB, .6um");
-    F(0, 4, "Intel i80486 (unknown model)");
-    FM(0, 5, 0, 0, "Intel Pentium 60/66 A-step"); // no docs
+    return (criteria != NULL) ? ((const synth_row_t*)criteria)->name : NULL;
+}
+
+// signature table of INTEL processors, part 1, see decode_synth_intel()
+static constexpr synth_row_t  synth_intel_part_1[] = {
+    FM(0, 4, 0, 0, "Intel i80486DX-25/33, .18um"), // process from sandpile.org
+    FM(0, 4, 0, 1, "Intel i80486DX-50, .18um"), // process from sandpile.org
+    FM(0, 4, 0, 2, "Intel i80486SX, .18um"), // process from sandpile.org
+    FM(0, 4, 0, 3, "Intel i80486DX/2"),
+    FM(0, 4, 0, 4, "Intel i80486SL, .8um"),
+    FM(0, 4, 0, 5, "Intel i80486SX/2, .8um"),
+    FM(0, 4, 0, 7, "Intel i80486DX/2-WB, .8um"),
+    FM(0, 4, 0, 8, "Intel i80486DX/4, .6um"),
+    FM(0, 4, 0, 9, "Intel i80486DX/4-WB, .6um"),
+    F(0, 4, "Intel i80486 (unknown model)"),
+    FM(0, 5, 0, 0, "Intel Pentium 60/66 A-step"), // no docs
     // Intel docs (243326).
-    TFM(1, 0, 5, 0, 1, "Intel Pentium 60/66 OverDrive for P5");
-    FMS(0, 5, 0, 1, 3, "Intel Pentium 60/66 (B1)");
-    FMS(0, 5, 0, 1, 5, "Intel Pentium 60/66 (C1)");
-    FMS(0, 5, 0, 1, 7, "Intel Pentium 60/66 (D1)");
-    FM(0, 5, 0, 1, "Intel Pentium 60/66");
+    TFM(1, 0, 5, 0, 1, "Intel Pentium 60/66 OverDrive for P5"),
+    FMS(0, 5, 0, 1, 3, "Intel Pentium 60/66 (B1)"),
+    FMS(0, 5, 0, 1, 5, "Intel Pentium 60/66 (C1)"),
+    FMS(0, 5, 0, 1, 7, "Intel Pentium 60/66 (D1)"),
+    FM(0, 5, 0, 1, "Intel Pentium 60/66"),
     // Intel docs (242480).
-    TFM(1, 0, 5, 0, 2, "Intel Pentium 75 - 200 OverDrive for P54C");
-    FMS(0, 5, 0, 2, 1, "Intel Pentium P54C 75 - 200 (B1)");
-    FMS(0, 5, 0, 2, 2, "Intel Pentium P54C 75 - 200 (B3)");
-    FMS(0, 5, 0, 2, 4, "Intel Pentium P54C 75 - 200 (B5)");
-    FMS(0, 5, 0, 2, 5, "Intel Pentium P54C 75 - 200 (C2/mA1)");
-    FMS(0, 5, 0, 2, 6, "Intel Pentium P54C 75 - 200 (E0)");
-    FMS(0, 5, 0, 2, 11, "Intel Pentium P54C 75 - 200 (cB1)");
-    FMS(0, 5, 0, 2, 12, "Intel Pentium P54C 75 - 200 (cC0)");
-    FM(0, 5, 0, 2, "Intel Pentium P54C 75 - 200");
-    TFM(1, 0, 5, 0, 3, "Intel Pentium OverDrive for i486 (P24T)"); // no docs
+    TFM(1, 0, 5, 0, 2, "Intel Pentium 75 - 200 OverDrive for P54C"),
+    FMS(0, 5, 0, 2, 1, "Intel Pentium P54C 75 - 200 (B1)"),
+    FMS(0, 5, 0, 2, 2, "Intel Pentium P54C 75 - 200 (B3)"),
+    FMS(0, 5, 0, 2, 4, "Intel Pentium P54C 75 - 200 (B5)"),
+    FMS(0, 5, 0, 2, 5, "Intel Pentium P54C 75 - 200 (C2/mA1)"),
+    FMS(0, 5, 0, 2, 6, "Intel Pentium P54C 75 - 200 (E0)"),
+    FMS(0, 5, 0, 2, 11, "Intel Pentium P54C 75 - 200 (cB1)"),
+    FMS(0, 5, 0, 2, 12, "Intel Pentium P54C 75 - 200 (cC0)"),
+    FM(0, 5, 0, 2, "Intel Pentium P54C 75 - 200"),
+    TFM(1, 0, 5, 0, 3, "Intel Pentium OverDrive for i486 (P24T)"), // no docs
     // Intel docs (242480).
-    TFM(1, 0, 5, 0, 4, "Intel Pentium OverDrive for P54C");
-    FMS(0, 5, 0, 4, 3, "Intel Pentium MMX P55C (B1)");
-    FMS(0, 5, 0, 4, 4, "Intel Pentium MMX P55C (A3)");
-    FM(0, 5, 0, 4, "Intel Pentium MMX P55C");
+    TFM(1, 0, 5, 0, 4, "Intel Pentium OverDrive for P54C"),
+    FMS(0, 5, 0, 4, 3, "Intel Pentium MMX P55C (B1)"),
+    FMS(0, 5, 0, 4, 4, "Intel Pentium MMX P55C (A3)"),
+    FM(0, 5, 0, 4, "Intel Pentium MMX P55C"),
     // Intel docs (242480).
-    FMS(0, 5, 0, 7, 0, "Intel Pentium MMX P54C 75 - 200 (A4)");
-    FM(0, 5, 0, 7, "Intel Pentium MMX P54C 75 - 200");
+    FMS(0, 5, 0, 7, 0, "Intel Pentium MMX P54C 75 - 200 (A4)"),
+    FM(0, 5, 0, 7, "Intel Pentium MMX P54C 75 - 200"),
     // Intel docs (242480).
-    FMS(0, 5, 0, 8, 1, "Intel Pentium MMX P55C (Tillamook A0)");
-    FMS(0, 5, 0, 8, 2, "Intel Pentium MMX P55C (Tillamook B2)");
-    FM(0, 5, 0, 8, "Intel Pentium MMX P55C (Tillamook)");
+    FMS(0, 5, 0, 8, 1, "Intel Pentium MMX P55C (Tillamook A0)"),
+    FMS(0, 5, 0, 8, 2, "Intel Pentium MMX P55C (Tillamook B2)"),
+    FM(0, 5, 0, 8, "Intel Pentium MMX P55C (Tillamook)"),
     // Intel docs (329676) provides stepping names, but no numbers.
     // However, A0 is the only name.
-    FM(0, 5, 0, 9, "Intel Quark X1000 / D1000 / D2000 / C1000 (Lakemont)");
-    F(0, 5, "Intel Pentium (unknown model)");
-    FM(0, 6, 0, 0, "Intel Pentium Pro A-step");
+    FM(0, 5, 0, 9, "Intel Quark X1000 / D1000 / D2000 / C1000 (Lakemont)"),
+    F(0, 5, "Intel Pentium (unknown model)"),
+    FM(0, 6, 0, 0, "Intel Pentium Pro A-step"),
     // Intel docs (242689).
-    FMS(0, 6, 0, 1, 1, "Intel Pentium Pro (B0)");
-    FMS(0, 6, 0, 1, 2, "Intel Pentium Pro (C0)");
-    FMS(0, 6, 0, 1, 6, "Intel Pentium Pro (sA0)");
-    FMS(0, 6, 0, 1, 7, "Intel Pentium Pro (sA1), .35um");
-    FMS(0, 6, 0, 1, 9, "Intel Pentium Pro (sB1), .35um");
-    FM(0, 6, 0, 1, "Intel Pentium Pro");
+    FMS(0, 6, 0, 1, 1, "Intel Pentium Pro (B0)"),
+    FMS(0, 6, 0, 1, 2, "Intel Pentium Pro (C0)"),
+    FMS(0, 6, 0, 1, 6, "Intel Pentium Pro (sA0)"),
+    FMS(0, 6, 0, 1, 7, "Intel Pentium Pro (sA1), .35um"),
+    FMS(0, 6, 0, 1, 9, "Intel Pentium Pro (sB1), .35um"),
+    FM(0, 6, 0, 1, "Intel Pentium Pro"),
     // Intel docs (243337)
-    TFM(1, 0, 6, 0, 3, "Intel Pentium II OverDrive");
-    FMS(0, 6, 0, 3, 3, "Intel Pentium II (Klamath C0)");
-    FMS(0, 6, 0, 3, 4, "Intel Pentium II (Klamath C1)");
-    FM(0, 6, 0, 3, "Intel Pentium II (Klamath)");
-    FM(0, 6, 0, 4, "Intel Pentium P55CT OverDrive (Deschutes)");
+    TFM(1, 0, 6, 0, 3, "Intel Pentium II OverDrive"),
+    FMS(0, 6, 0, 3, 3, "Intel Pentium II (Klamath C0)"),
+    FMS(0, 6, 0, 3, 4, "Intel Pentium II (Klamath C1)"),
+    FM(0, 6, 0, 3, "Intel Pentium II (Klamath)"),
+    FM(0, 6, 0, 4, "Intel Pentium P55CT OverDrive (Deschutes)"),
     // Intel docs (243337, 243748, 243776, 243887).
-    FMSQ(0, 6, 0, 5, 0, xD, "Intel Pentium II Xeon (Deschutes A0)");
-    FMSQ(0, 6, 0, 5, 0, mD, "Intel Mobile Pentium II (Deschutes A0)");
-    FMSQ(0, 6, 0, 5, 0, cD, "Intel Celeron (Deschutes A0)");
-    FMS(0, 6, 0, 5, 0, "Intel Pentium II (unknown type) (Deschutes A0)");
-    FMSQ(0, 6, 0, 5, 1, xD, "Intel Pentium II Xeon (Deschutes A1)");
-    FMSQ(0, 6, 0, 5, 1, cD, "Intel Celeron (Deschutes A1)");
-    FMS(0, 6, 0, 5, 1, "Intel Pentium II (unknown type) (Deschutes A1)");
-    FMSQ(0, 6, 0, 5, 2, xD, "Intel Pentium II Xeon (Deschutes B0)");
-    FMSQ(0, 6, 0, 5, 2, mD, "Intel Mobile Pentium II (Deschutes B0)");
-    FMSQ(0, 6, 0, 5, 2, cD, "Intel Celeron (Deschutes B0)");
-    FMS(0, 6, 0, 5, 2, "Intel Pentium II (unknown type) (Deschutes B0)");
-    FMSQ(0, 6, 0, 5, 3, xD, "Intel Pentium II Xeon (Deschutes B1)");
-    FMSQ(0, 6, 0, 5, 3, cD, "Intel Celeron (Deschutes B1)");
-    FMS(0, 6, 0, 5, 3, "Intel Pentium II (unknown type) (Deschutes B1)");
-    FMQ(0, 6, 0, 5, xD, "Intel Pentium II Xeon (Deschutes)");
-    FMQ(0, 6, 0, 5, mD, "Intel Mobile Pentium II (Deschutes)");
-    FMQ(0, 6, 0, 5, cD, "Intel Celeron (Deschutes)");
-    FM(0, 6, 0, 5, "Intel Pentium II (unknown type) (Deschutes)");
+    FMSQ(0, 6, 0, 5, 0, xD, "Intel Pentium II Xeon (Deschutes A0)"),
+    FMSQ(0, 6, 0, 5, 0, mD, "Intel Mobile Pentium II (Deschutes A0)"),
+    FMSQ(0, 6, 0, 5, 0, cD, "Intel Celeron (Deschutes A0)"),
+    FMS(0, 6, 0, 5, 0, "Intel Pentium II (unknown type) (Deschutes A0)"),
+    FMSQ(0, 6, 0, 5, 1, xD, "Intel Pentium II Xeon (Deschutes A1)"),
+    FMSQ(0, 6, 0, 5, 1, cD, "Intel Celeron (Deschutes A1)"),
+    FMS(0, 6, 0, 5, 1, "Intel Pentium II (unknown type) (Deschutes A1)"),
+    FMSQ(0, 6, 0, 5, 2, xD, "Intel Pentium II Xeon (Deschutes B0)"),
+    FMSQ(0, 6, 0, 5, 2, mD, "Intel Mobile Pentium II (Deschutes B0)"),
+    FMSQ(0, 6, 0, 5, 2, cD, "Intel Celeron (Deschutes B0)"),
+    FMS(0, 6, 0, 5, 2, "Intel Pentium II (unknown type) (Deschutes B0)"),
+    FMSQ(0, 6, 0, 5, 3, xD, "Intel Pentium II Xeon (Deschutes B1)"),
+    FMSQ(0, 6, 0, 5, 3, cD, "Intel Celeron (Deschutes B1)"),
+    FMS(0, 6, 0, 5, 3, "Intel Pentium II (unknown type) (Deschutes B1)"),
+    FMQ(0, 6, 0, 5, xD, "Intel Pentium II Xeon (Deschutes)"),
+    FMQ(0, 6, 0, 5, mD, "Intel Mobile Pentium II (Deschutes)"),
+    FMQ(0, 6, 0, 5, cD, "Intel Celeron (Deschutes)"),
+    FM(0, 6, 0, 5, "Intel Pentium II (unknown type) (Deschutes)"),
     // Intel docs (243748, 243887, 244444).
-    FMSQ(0, 6, 0, 6, 0, dP, "Intel Pentium II (Mendocino A0)");
-    FMSQ(0, 6, 0, 6, 0, dC, "Intel Celeron (Mendocino A0)");
-    FMS(0, 6, 0, 6, 0, "Intel Pentium II (unknown type) (Mendocino A0)");
-    FMSQ(0, 6, 0, 6, 5, dC, "Intel Celeron (Mendocino B0)");
-    FMSQ(0, 6, 0, 6, 5, dP, "Intel Pentium II (Mendocino B0)");
-    FMS(0, 6, 0, 6, 5, "Intel Pentium II (unknown type) (Mendocino B0)");
-    FMS(0, 6, 0, 6, 10, "Intel Mobile Pentium II (Mendocino A0)");
-    FM(0, 6, 0, 6, "Intel Pentium II (Mendocino)");
+    FMSQ(0, 6, 0, 6, 0, dP, "Intel Pentium II (Mendocino A0)"),
+    FMSQ(0, 6, 0, 6, 0, dC, "Intel Celeron (Mendocino A0)"),
+    FMS(0, 6, 0, 6, 0, "Intel Pentium II (unknown type) (Mendocino A0)"),
+    FMSQ(0, 6, 0, 6, 5, dC, "Intel Celeron (Mendocino B0)"),
+    FMSQ(0, 6, 0, 6, 5, dP, "Intel Pentium II (Mendocino B0)"),
+    FMS(0, 6, 0, 6, 5, "Intel Pentium II (unknown type) (Mendocino B0)"),
+    FMS(0, 6, 0, 6, 10, "Intel Mobile Pentium II (Mendocino A0)"),
+    FM(0, 6, 0, 6, "Intel Pentium II (Mendocino)"),
     // Intel docs (244453, 244460).
-    FMSQ(0, 6, 0, 7, 2, pK, "Intel Pentium III (Katmai B0)");
-    FMSQ(0, 6, 0, 7, 2, xK, "Intel Pentium III Xeon (Katmai B0)");
-    FMS(0, 6, 0, 7, 2, "Intel Pentium III (unknown type) (Katmai B0)");
-    FMSQ(0, 6, 0, 7, 3, pK, "Intel Pentium III (Katmai C0)");
-    FMSQ(0, 6, 0, 7, 3, xK, "Intel Pentium III Xeon (Katmai C0)");
-    FMS(0, 6, 0, 7, 3, "Intel Pentium III (unknown type) (Katmai C0)");
-    FMQ(0, 6, 0, 7, pK, "Intel Pentium III (Katmai)");
-    FMQ(0, 6, 0, 7, xK, "Intel Pentium III Xeon (Katmai)");
-    FM(0, 6, 0, 7, "Intel Pentium III (unknown type) (Katmai)");
+    FMSQ(0, 6, 0, 7, 2, pK, "Intel Pentium III (Katmai B0)"),
+    FMSQ(0, 6, 0, 7, 2, xK, "Intel Pentium III Xeon (Katmai B0)"),
+    FMS(0, 6, 0, 7, 2, "Intel Pentium III (unknown type) (Katmai B0)"),
+    FMSQ(0, 6, 0, 7, 3, pK, "Intel Pentium III (Katmai C0)"),
+    FMSQ(0, 6, 0, 7, 3, xK, "Intel Pentium III Xeon (Katmai C0)"),
+    FMS(0, 6, 0, 7, 3, "Intel Pentium III (unknown type) (Katmai C0)"),
+    FMQ(0, 6, 0, 7, pK, "Intel Pentium III (Katmai)"),
+    FMQ(0, 6, 0, 7, xK, "Intel Pentium III Xeon (Katmai)"),
+    FM(0, 6, 0, 7, "Intel Pentium III (unknown type) (Katmai)"),
     // Intel docs (243748, 244453, 244460, 245306, 245421).
-    FMSQ(0, 6, 0, 8, 1, sX, "Intel Pentium III Xeon (Coppermine A2)");
-    FMSQ(0, 6, 0, 8, 1, MC, "Intel Mobile Celeron (Coppermine A2)");
-    FMSQ(0, 6, 0, 8, 1, dC, "Intel Celeron (Coppermine A2)");
-    FMSQ(0, 6, 0, 8, 1, MP, "Intel Mobile Pentium III (Coppermine A2)");
-    FMSQ(0, 6, 0, 8, 1, dP, "Intel Pentium III (Coppermine A2)");
-    FMS(0, 6, 0, 8, 1, "Intel Pentium III (unknown type) (Coppermine A2)");
-    FMSQ(0, 6, 0, 8, 3, sX, "Intel Pentium III Xeon (Coppermine B0)");
-    FMSQ(0, 6, 0, 8, 3, MC, "Intel Mobile Celeron (Coppermine B0)");
-    FMSQ(0, 6, 0, 8, 3, dC, "Intel Celeron (Coppermine B0)");
-    FMSQ(0, 6, 0, 8, 3, MP, "Intel Mobile Pentium III (Coppermine B0)");
-    FMSQ(0, 6, 0, 8, 3, dP, "Intel Pentium III (Coppermine B0)");
-    FMS(0, 6, 0, 8, 3, "Intel Pentium III (unknown type) (Coppermine B0)");
-    FMSQ(0, 6, 0, 8, 6, sX, "Intel Pentium III Xeon (Coppermine C0)");
-    FMSQ(0, 6, 0, 8, 6, MC, "Intel Mobile Celeron (Coppermine C0)");
-    FMSQ(0, 6, 0, 8, 6, dC, "Intel Celeron (Coppermine C0)");
-    FMSQ(0, 6, 0, 8, 6, MP, "Intel Mobile Pentium III (Coppermine C0)");
-    FMSQ(0, 6, 0, 8, 6, dP, "Intel Pentium III (Coppermine C0)");
-    FMS(0, 6, 0, 8, 6, "Intel Pentium III (unknown type) (Coppermine C0)");
-    FMSQ(0, 6, 0, 8, 10, sX, "Intel Pentium III Xeon (Coppermine D0)");
-    FMSQ(0, 6, 0, 8, 10, MC, "Intel Mobile Celeron (Coppermine D0)");
-    FMSQ(0, 6, 0, 8, 10, dC, "Intel Celeron (Coppermine D0)");
-    FMSQ(0, 6, 0, 8, 10, MP, "Intel Mobile Pentium III (Coppermine D0)");
-    FMSQ(0, 6, 0, 8, 10, dP, "Intel Pentium III (Coppermine D0)");
-    FMS(0, 6, 0, 8, 10, "Intel Pentium III (unknown type) (Coppermine D0)");
-    FMQ(0, 6, 0, 8, sX, "Intel Pentium III Xeon (Coppermine)");
-    FMQ(0, 6, 0, 8, MC, "Intel Mobile Celeron (Coppermine)");
-    FMQ(0, 6, 0, 8, dC, "Intel Celeron (Coppermine)");
-    FMQ(0, 6, 0, 8, MP, "Intel Mobile Pentium III (Coppermine)");
-    FMQ(0, 6, 0, 8, dP, "Intel Pentium III (Coppermine)");
-    FM(0, 6, 0, 8, "Intel Pentium III (unknown type) (Coppermine)");
+    FMSQ(0, 6, 0, 8, 1, sX, "Intel Pentium III Xeon (Coppermine A2)"),
+    FMSQ(0, 6, 0, 8, 1, MC, "Intel Mobile Celeron (Coppermine A2)"),
+    FMSQ(0, 6, 0, 8, 1, dC, "Intel Celeron (Coppermine A2)"),
+    FMSQ(0, 6, 0, 8, 1, MP, "Intel Mobile Pentium III (Coppermine A2)"),
+    FMSQ(0, 6, 0, 8, 1, dP, "Intel Pentium III (Coppermine A2)"),
+    FMS(0, 6, 0, 8, 1, "Intel Pentium III (unknown type) (Coppermine A2)"),
+    FMSQ(0, 6, 0, 8, 3, sX, "Intel Pentium III Xeon (Coppermine B0)"),
+    FMSQ(0, 6, 0, 8, 3, MC, "Intel Mobile Celeron (Coppermine B0)"),
+    FMSQ(0, 6, 0, 8, 3, dC, "Intel Celeron (Coppermine B0)"),
+    FMSQ(0, 6, 0, 8, 3, MP, "Intel Mobile Pentium III (Coppermine B0)"),
+    FMSQ(0, 6, 0, 8, 3, dP, "Intel Pentium III (Coppermine B0)"),
+    FMS(0, 6, 0, 8, 3, "Intel Pentium III (unknown type) (Coppermine B0)"),
+    FMSQ(0, 6, 0, 8, 6, sX, "Intel Pentium III Xeon (Coppermine C0)"),
+    FMSQ(0, 6, 0, 8, 6, MC, "Intel Mobile Celeron (Coppermine C0)"),
+    FMSQ(0, 6, 0, 8, 6, dC, "Intel Celeron (Coppermine C0)"),
+    FMSQ(0, 6, 0, 8, 6, MP, "Intel Mobile Pentium III (Coppermine C0)"),
+    FMSQ(0, 6, 0, 8, 6, dP, "Intel Pentium III (Coppermine C0)"),
+    FMS(0, 6, 0, 8, 6, "Intel Pentium III (unknown type) (Coppermine C0)"),
+    FMSQ(0, 6, 0, 8, 10, sX, "Intel Pentium III Xeon (Coppermine D0)"),
+    FMSQ(0, 6, 0, 8, 10, MC, "Intel Mobile Celeron (Coppermine D0)"),
+    FMSQ(0, 6, 0, 8, 10, dC, "Intel Celeron (Coppermine D0)"),
+    FMSQ(0, 6, 0, 8, 10, MP, "Intel Mobile Pentium III (Coppermine D0)"),
+    FMSQ(0, 6, 0, 8, 10, dP, "Intel Pentium III (Coppermine D0)"),
+    FMS(0, 6, 0, 8, 10, "Intel Pentium III (unknown type) (Coppermine D0)"),
+    FMQ(0, 6, 0, 8, sX, "Intel Pentium III Xeon (Coppermine)"),
+    FMQ(0, 6, 0, 8, MC, "Intel Mobile Celeron (Coppermine)"),
+    FMQ(0, 6, 0, 8, dC, "Intel Celeron (Coppermine)"),
+    FMQ(0, 6, 0, 8, MP, "Intel Mobile Pentium III (Coppermine)"),
+    FMQ(0, 6, 0, 8, dP, "Intel Pentium III (Coppermine)"),
+    FM(0, 6, 0, 8, "Intel Pentium III (unknown type) (Coppermine)"),
     // Intel docs (252665, 300303).
-    FMSQ(0, 6, 0, 9, 5, dC, "Intel Celeron M (Banias B1)");
-    FMSQ(0, 6, 0, 9, 5, dP, "Intel Pentium M (Banias B1)");
-    FMS(0, 6, 0, 9, 5, "Intel Pentium M (unknown type) (Banias B1)");
-    FMQ(0, 6, 0, 9, dC, "Intel Celeron M (Banias)");
-    FMQ(0, 6, 0, 9, dP, "Intel Pentium M (Banias)");
-    FM(0, 6, 0, 9, "Intel Pentium M (unknown type) (Banias)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_intel_part_2(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
-{
-    cstring  result = NULL;
+    FMSQ(0, 6, 0, 9, 5, dC, "Intel Celeron M (Banias B1)"),
+    FMSQ(0, 6, 0, 9, 5, dP, "Intel Pentium M (Banias B1)"),
+    FMS(0, 6, 0, 9, 5, "Intel Pentium M (unknown type) (Banias B1)"),
+    FMQ(0, 6, 0, 9, dC, "Intel Celeron M (Banias)"),
+    FMQ(0, 6, 0, 9, dP, "Intel Pentium M (Banias)"),
+    FM(0, 6, 0, 9, "Intel Pentium M (unknown type) (Banias)"),
+};
+CHECK_SIGNATURES(synth_intel_part_1);
 
-    START;
+// signature table of INTEL processors, part 2, see decode_synth_intel()
+static constexpr synth_row_t  synth_intel_part_2[] = {
     // Intel docs (244460).
-    FMS(0, 6, 0, 10, 0, "Intel Pentium III Xeon (Cascades A0)");
-    FMS(0, 6, 0, 10, 1, "Intel Pentium III Xeon (Cascades A1)");
-    FMS(0, 6, 0, 10, 4, "Intel Pentium III Xeon (Cascades B0)");
-    FM(0, 6, 0, 10, "Intel Pentium III Xeon (Cascades)");
+    FMS(0, 6, 0, 10, 0, "Intel Pentium III Xeon (Cascades A0)"),
+    FMS(0, 6, 0, 10, 1, "Intel Pentium III Xeon (Cascades A1)"),
+    FMS(0, 6, 0, 10, 4, "Intel Pentium III Xeon (Cascades B0)"),
+    FM(0, 6, 0, 10, "Intel Pentium III Xeon (Cascades)"),
     // Intel docs (243748, 244453, 245306, 245421).
-    FMSQ(0, 6, 0, 11, 1, dC, "Intel Celeron (Tualatin A1)");
-    FMSQ(0, 6, 0, 11, 1, MC, "Intel Mobile Celeron (Tualatin A1)");
-    FMSQ(0, 6, 0, 11, 1, dP, "Intel Pentium III (Tualatin A1)");
-    FMS(0, 6, 0, 11, 1, "Intel Pentium III (unknown type) (Tualatin A1)");
-    FMSQ(0, 6, 0, 11, 4, dC, "Intel Celeron (Tualatin B1)");
-    FMSQ(0, 6, 0, 11, 4, MC, "Intel Mobile Celeron (Tualatin B1)");
-    FMSQ(0, 6, 0, 11, 4, dP, "Intel Pentium III (Tualatin B1)");
-    FMS(0, 6, 0, 11, 4, "Intel Pentium III (unknown type) (Tualatin B1)");
-    FMQ(0, 6, 0, 11, dC, "Intel Celeron (Tualatin)");
-    FMQ(0, 6, 0, 11, MC, "Intel Mobile Celeron (Tualatin)");
-    FMQ(0, 6, 0, 11, dP, "Intel Pentium III (Tualatin)");
-    FM(0, 6, 0, 11, "Intel Pentium III (unknown type) (Tualatin)");
+    FMSQ(0, 6, 0, 11, 1, dC, "Intel Celeron (Tualatin A1)"),
+    FMSQ(0, 6, 0, 11, 1, MC, "Intel Mobile Celeron (Tualatin A1)"),
+    FMSQ(0, 6, 0, 11, 1, dP, "Intel Pentium III (Tualatin A1)"),
+    FMS(0, 6, 0, 11, 1, "Intel Pentium III (unknown type) (Tualatin A1)"),
+    FMSQ(0, 6, 0, 11, 4, dC, "Intel Celeron (Tualatin B1)"),
+    FMSQ(0, 6, 0, 11, 4, MC, "Intel Mobile Celeron (Tualatin B1)"),
+    FMSQ(0, 6, 0, 11, 4, dP, "Intel Pentium III (Tualatin B1)"),
+    FMS(0, 6, 0, 11, 4, "Intel Pentium III (unknown type) (Tualatin B1)"),
+    FMQ(0, 6, 0, 11, dC, "Intel Celeron (Tualatin)"),
+    FMQ(0, 6, 0, 11, MC, "Intel Mobile Celeron (Tualatin)"),
+    FMQ(0, 6, 0, 11, dP, "Intel Pentium III (Tualatin)"),
+    FM(0, 6, 0, 11, "Intel Pentium III (unknown type) (Tualatin)"),
     // Intel docs (300303, 302209).
-    FMSQ(0, 6, 0, 13, 6, dC, "Intel Celeron M (Dothan B1), 90nm");
-    FMSQ(0, 6, 0, 13, 6, dP, "Intel Pentium M (Dothan B1), 90nm");
-    FMS(0, 6, 0, 13, 6, "Intel Pentium M (unknown type) (Dothan B1), 90nm");
-    FMSQ(0, 6, 0, 13, 8, dC, "Intel Celeron M (Dothan C0), 90nm/65nm");
-    FMSQ(0, 6, 0, 13, 8, MP, "Intel Processor A100/A110 (Stealey C0) / Pentium M (Crofton C0), 90nm");
-    FMSQ(0, 6, 0, 13, 8, dP, "Intel Pentium M (Dothan C0), 90nm");
-    FMS(0, 6, 0, 13, 8, "Intel Pentium M (unknown type) (Dothan/Stealey/Crofton C0), 90nm/65nm");
-    FMQ(0, 6, 0, 13, dC, "Intel Celeron M (Dothan)");
-    FMQ(0, 6, 0, 13, MP, "Intel Processor A100/A110 (Stealey)");
-    FMQ(0, 6, 0, 13, dP, "Intel Pentium M (Dothan)");
-    FM(0, 6, 0, 13, "Intel Pentium M (unknown type) (Dothan/Crofton)");
+    FMSQ(0, 6, 0, 13, 6, dC, "Intel Celeron M (Dothan B1), 90nm"),
+    FMSQ(0, 6, 0, 13, 6, dP, "Intel Pentium M (Dothan B1), 90nm"),
+    FMS(0, 6, 0, 13, 6, "Intel Pentium M (unknown type) (Dothan B1), 90nm"),
+    FMSQ(0, 6, 0, 13, 8, dC, "Intel Celeron M (Dothan C0), 90nm/65nm"),
+    FMSQ(0, 6, 0, 13, 8, MP, "Intel Processor A100/A110 (Stealey C0) / Pentium M (Crofton C0), 90nm"),
+    FMSQ(0, 6, 0, 13, 8, dP, "Intel Pentium M (Dothan C0), 90nm"),
+    FMS(0, 6, 0, 13, 8, "Intel Pentium M (unknown type) (Dothan/Stealey/Crofton C0), 90nm/65nm"),
+    FMQ(0, 6, 0, 13, dC, "Intel Celeron M (Dothan)"),
+    FMQ(0, 6, 0, 13, MP, "Intel Processor A100/A110 (Stealey)"),
+    FMQ(0, 6, 0, 13, dP, "Intel Pentium M (Dothan)"),
+    FM(0, 6, 0, 13, "Intel Pentium M (unknown type) (Dothan/Crofton)"),
     // Intel docs (300303, 309222, 311392, 316515).
-    FMSQ(0, 6, 0, 14, 8, sX, "Intel Xeon Processor LV (Sossaman C0)");
-    FMSQ(0, 6, 0, 14, 8, dC, "Intel Celeron (Yonah C0)");
-    FMSQ(0, 6, 0, 14, 8, DG, "Intel Core Duo (Yonah C0)");
-    FMSQ(0, 6, 0, 14, 8, dG, "Intel Core Solo (Yonah C0)");
-    FMS(0, 6, 0, 14, 8, "Intel Core (unknown type) (Yonah/Sossaman C0)");
-    FMSQ(0, 6, 0, 14, 12, sX, "Intel Xeon Processor LV (Sossaman D0)");
-    FMSQ(0, 6, 0, 14, 12, dC, "Intel Celeron M (Yonah D0)");
-    FMSQ(0, 6, 0, 14, 12, MP, "Intel Pentium Dual-Core Mobile T2000 (Yonah D0)");
-    FMSQ(0, 6, 0, 14, 12, DG, "Intel Core Duo (Yonah D0)");
-    FMSQ(0, 6, 0, 14, 12, dG, "Intel Core Solo (Yonah D0)");
-    FMS(0, 6, 0, 14, 12, "Intel Core (unknown type) (Yonah/Sossaman D0)");
-    FMS(0, 6, 0, 14, 13, "Intel Pentium Dual-Core Mobile T2000 (Yonah M0)");
-    FMQ(0, 6, 0, 14, sX, "Intel Xeon Processor LV (Sossaman)");
-    FMQ(0, 6, 0, 14, dC, "Intel Celeron (Yonah)");
-    FMQ(0, 6, 0, 14, MP, "Intel Pentium Dual-Core Mobile (Yonah)");
-    FMQ(0, 6, 0, 14, DG, "Intel Core Duo (Yonah)");
-    FMQ(0, 6, 0, 14, dG, "Intel Core Solo (Yonah)");
-    FM(0, 6, 0, 14, "Intel Core (unknown type) (Yonah/Sossaman)");
+    FMSQ(0, 6, 0, 14, 8, sX, "Intel Xeon Processor LV (Sossaman C0)"),
+    FMSQ(0, 6, 0, 14, 8, dC, "Intel Celeron (Yonah C0)"),
+    FMSQ(0, 6, 0, 14, 8, DG, "Intel Core Duo (Yonah C0)"),
+    FMSQ(0, 6, 0, 14, 8, dG, "Intel Core Solo (Yonah C0)"),
+    FMS(0, 6, 0, 14, 8, "Intel Core (unknown type) (Yonah/Sossaman C0)"),
+    FMSQ(0, 6, 0, 14, 12, sX, "Intel Xeon Processor LV (Sossaman D0)"),
+    FMSQ(0, 6, 0, 14, 12, dC, "Intel Celeron M (Yonah D0)"),
+    FMSQ(0, 6, 0, 14, 12, MP, "Intel Pentium Dual-Core Mobile T2000 (Yonah D0)"),
+    FMSQ(0, 6, 0, 14, 12, DG, "Intel Core Duo (Yonah D0)"),
+    FMSQ(0, 6, 0, 14, 12, dG, "Intel Core Solo (Yonah D0)"),
+    FMS(0, 6, 0, 14, 12, "Intel Core (unknown type) (Yonah/Sossaman D0)"),
+    FMS(0, 6, 0, 14, 13, "Intel Pentium Dual-Core Mobile T2000 (Yonah M0)"),
+    FMQ(0, 6, 0, 14, sX, "Intel Xeon Processor LV (Sossaman)"),
+    FMQ(0, 6, 0, 14, dC, "Intel Celeron (Yonah)"),
+    FMQ(0, 6, 0, 14, MP, "Intel Pentium Dual-Core Mobile (Yonah)"),
+    FMQ(0, 6, 0, 14, DG, "Intel Core Duo (Yonah)"),
+    FMQ(0, 6, 0, 14, dG, "Intel Core Solo (Yonah)"),
+    FM(0, 6, 0, 14, "Intel Core (unknown type) (Yonah/Sossaman)"),
     // Intel docs (313279, 313356, 314079, 314916, 315338, 315593, 316134,
     // 316515, 316982, 317667, 318081, 318925, 319735).
-    FMSQ(0, 6, 0, 15, 2, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe L2)");
-    FMSQ(0, 6, 0, 15, 2, Mc, "Intel Core Duo Mobile (Merom L2)");
-    FMSQ(0, 6, 0, 15, 2, dc, "Intel Core Duo (Conroe L2)");
-    FMSQ(0, 6, 0, 15, 2, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale L2)");
-    FMS(0, 6, 0, 15, 2, "Intel Core (unknown type) (Conroe/Merom/Allendale L2)");
-    FMS(0, 6, 0, 15, 4, "Intel Core 2 Duo (Conroe B0) / Xeon Processor 5100 (Woodcrest B0) (pre-production)");
-    FMSQ(0, 6, 0, 15, 5, QW, "Intel Dual-Core Xeon Processor 5100 (Woodcrest B1) (pre-production)");
-    FMSQ(0, 6, 0, 15, 5, XE, "Intel Core 2 Extreme Processor (Conroe B1)");
-    FMSQ(0, 6, 0, 15, 5, dL, "Intel Core 2 Duo (Allendale B1)");
-    FMSQ(0, 6, 0, 15, 5, dc, "Intel Core 2 Duo (Conroe B1)");
-    FMS(0, 6, 0, 15, 5, "Intel Core 2 (unknown type) (Conroe/Allendale B1)");
-    FMSQ(0, 6, 0, 15, 6, Xc, "Intel Core 2 Extreme Processor (Conroe B2)");
-    FMSQ(0, 6, 0, 15, 6, Mc, "Intel Core 2 Duo Mobile (Merom B2)");
-    FMSQ(0, 6, 0, 15, 6, dL, "Intel Core 2 Duo (Allendale B2)");
-    FMSQ(0, 6, 0, 15, 6, dc, "Intel Core 2 Duo (Conroe B2)");
-    FMSQ(0, 6, 0, 15, 6, dC, "Intel Celeron M (Conroe B2)");
-    FMSQ(0, 6, 0, 15, 6, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe B2) / Dual-Core Xeon Processor 5100 (Woodcrest B2)");
-    FMS(0, 6, 0, 15, 6, "Intel Core 2 (unknown type) (Conroe/Allendale/Woodcrest B2)");
-    FMSQ(0, 6, 0, 15, 7, sX, "Intel Quad-Core Xeon Processor 3200 (Kentsfield B3) / Quad-Core Xeon Processor 5300 (Clovertown B3)");
-    FMSQ(0, 6, 0, 15, 7, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield B3)");
-    FMS(0, 6, 0, 15, 7, "Intel Core 2 (unknown type) (Kentsfield/Clovertown B3)");
-    FMSQ(0, 6, 0, 15, 10, Mc, "Intel Core 2 Duo Mobile (Merom E1)");
-    FMSQ(0, 6, 0, 15, 10, dC, "Intel Celeron Processor 500 (Merom E1)");
-    FMS(0, 6, 0, 15, 10, "Intel Core 2 (unknown type) (Merom E1)");
-    FMSQ(0, 6, 0, 15, 11, sQ, "Intel Quad-Core Xeon Processor 5300 (Clovertown G0)");
-    FMSQ(0, 6, 0, 15, 11, sX, "Intel Xeon Processor 3000 (Conroe G0) / Xeon Processor 3200 (Kentsfield G0) / Xeon Processor 7200/7300 (Tigerton G0)");
-    FMSQ(0, 6, 0, 15, 11, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield G0)");
-    FMSQ(0, 6, 0, 15, 11, Mc, "Intel Core 2 Duo Mobile (Merom G2)");
-    FMSQ(0, 6, 0, 15, 11, Qc, "Intel Core 2 Quad (Conroe G0)");
-    FMSQ(0, 6, 0, 15, 11, dc, "Intel Core 2 Duo (Conroe G0)");
-    FMS(0, 6, 0, 15, 11, "Intel Core 2 (unknown type) (Merom/Conroe/Kentsfield/Clovertown/Tigerton G0)");
-    FMSQ(0, 6, 0, 15, 13, Mc, "Intel Core 2 Duo Mobile (Merom M1) / Celeron Processor 500 (Merom E1)");
-    FMSQ(0, 6, 0, 15, 13, Qc, "Intel Core 2 Quad (Conroe M0)");
-    FMSQ(0, 6, 0, 15, 13, dc, "Intel Core 2 Duo (Conroe M0)");
-    FMSQ(0, 6, 0, 15, 13, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale M0)");
-    FMSQ(0, 6, 0, 15, 13, dC, "Intel Celeron Dual-Core E1000 (Allendale M0) / Celeron Dual-Core T1000 (Merom M0)");
-    FMS(0, 6, 0, 15, 13, "Intel Core 2 (unknown type) (Merom/Conroe/Allendale M0 / Merom E1)");
-    FMQ(0, 6, 0, 15, sQ, "Intel Quad-Core Xeon (Woodcrest)");
-    FMQ(0, 6, 0, 15, sX, "Intel Dual-Core Xeon (Conroe / Woodcrest) / Quad-Core Xeon (Kentsfield / Clovertown) / Xeon (Tigerton G0)");
-    FMQ(0, 6, 0, 15, Xc, "Intel Core 2 Extreme Processor (Conroe) / Core 2 Extreme Quad-Core (Kentsfield)");
-    FMQ(0, 6, 0, 15, Mc, "Intel Core Duo Mobile / Core 2 Duo Mobile (Merom) / Celeron (Merom)");
-    FMQ(0, 6, 0, 15, Qc, "Intel Core 2 Quad (Conroe)");
-    FMQ(0, 6, 0, 15, dc, "Intel Core Duo / Core 2 Duo (Conroe)");
-    FMQ(0, 6, 0, 15, dP, "Intel Pentium Dual-Core (Allendale)");
-    FMQ(0, 6, 0, 15, dC, "Intel Celeron M (Conroe) / Celeron (Merom) / Celeron Dual-Core (Allendale)");
-    FM(0, 6, 0, 15, "Intel Core 2 (unknown type) (Merom/Conroe/Allendale/Kentsfield/Allendale/Clovertown/Woodcrest/Tigerton)");
+    FMSQ(0, 6, 0, 15, 2, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe L2)"),
+    FMSQ(0, 6, 0, 15, 2, Mc, "Intel Core Duo Mobile (Merom L2)"),
+    FMSQ(0, 6, 0, 15, 2, dc, "Intel Core Duo (Conroe L2)"),
+    FMSQ(0, 6, 0, 15, 2, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale L2)"),
+    FMS(0, 6, 0, 15, 2, "Intel Core (unknown type) (Conroe/Merom/Allendale L2)"),
+    FMS(0, 6, 0, 15, 4, "Intel Core 2 Duo (Conroe B0) / Xeon Processor 5100 (Woodcrest B0) (pre-production)"),
+    FMSQ(0, 6, 0, 15, 5, QW, "Intel Dual-Core Xeon Processor 5100 (Woodcrest B1) (pre-production)"),
+    FMSQ(0, 6, 0, 15, 5, XE, "Intel Core 2 Extreme Processor (Conroe B1)"),
+    FMSQ(0, 6, 0, 15, 5, dL, "Intel Core 2 Duo (Allendale B1)"),
+    FMSQ(0, 6, 0, 15, 5, dc, "Intel Core 2 Duo (Conroe B1)"),
+    FMS(0, 6, 0, 15, 5, "Intel Core 2 (unknown type) (Conroe/Allendale B1)"),
+    FMSQ(0, 6, 0, 15, 6, Xc, "Intel Core 2 Extreme Processor (Conroe B2)"),
+    FMSQ(0, 6, 0, 15, 6, Mc, "Intel Core 2 Duo Mobile (Merom B2)"),
+    FMSQ(0, 6, 0, 15, 6, dL, "Intel Core 2 Duo (Allendale B2)"),
+    FMSQ(0, 6, 0, 15, 6, dc, "Intel Core 2 Duo (Conroe B2)"),
+    FMSQ(0, 6, 0, 15, 6, dC, "Intel Celeron M (Conroe B2)"),
+    FMSQ(0, 6, 0, 15, 6, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe B2) / Dual-Core Xeon Processor 5100 (Woodcrest B2)"),
+    FMS(0, 6, 0, 15, 6, "Intel Core 2 (unknown type) (Conroe/Allendale/Woodcrest B2)"),
+    FMSQ(0, 6, 0, 15, 7, sX, "Intel Quad-Core Xeon Processor 3200 (Kentsfield B3) / Quad-Core Xeon Processor 5300 (Clovertown B3)"),
+    FMSQ(0, 6, 0, 15, 7, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield B3)"),
+    FMS(0, 6, 0, 15, 7, "Intel Core 2 (unknown type) (Kentsfield/Clovertown B3)"),
+    FMSQ(0, 6, 0, 15, 10, Mc, "Intel Core 2 Duo Mobile (Merom E1)"),
+    FMSQ(0, 6, 0, 15, 10, dC, "Intel Celeron Processor 500 (Merom E1)"),
+    FMS(0, 6, 0, 15, 10, "Intel Core 2 (unknown type) (Merom E1)"),
+    FMSQ(0, 6, 0, 15, 11, sQ, "Intel Quad-Core Xeon Processor 5300 (Clovertown G0)"),
+    FMSQ(0, 6, 0, 15, 11, sX, "Intel Xeon Processor 3000 (Conroe G0) / Xeon Processor 3200 (Kentsfield G0) / Xeon Processor 7200/7300 (Tigerton G0)"),
+    FMSQ(0, 6, 0, 15, 11, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield G0)"),
+    FMSQ(0, 6, 0, 15, 11, Mc, "Intel Core 2 Duo Mobile (Merom G2)"),
+    FMSQ(0, 6, 0, 15, 11, Qc, "Intel Core 2 Quad (Conroe G0)"),
+    FMSQ(0, 6, 0, 15, 11, dc, "Intel Core 2 Duo (Conroe G0)"),
+    FMS(0, 6, 0, 15, 11, "Intel Core 2 (unknown type) (Merom/Conroe/Kentsfield/Clovertown/Tigerton G0)"),
+    FMSQ(0, 6, 0, 15, 13, Mc, "Intel Core 2 Duo Mobile (Merom M1) / Celeron Processor 500 (Merom E1)"),
+    FMSQ(0, 6, 0, 15, 13, Qc, "Intel Core 2 Quad (Conroe M0)"),
+    FMSQ(0, 6, 0, 15, 13, dc, "Intel Core 2 Duo (Conroe M0)"),
+    FMSQ(0, 6, 0, 15, 13, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale M0)"),
+    FMSQ(0, 6, 0, 15, 13, dC, "Intel Celeron Dual-Core E1000 (Allendale M0) / Celeron Dual-Core T1000 (Merom M0)"),
+    FMS(0, 6, 0, 15, 13, "Intel Core 2 (unknown type) (Merom/Conroe/Allendale M0 / Merom E1)"),
+    FMQ(0, 6, 0, 15, sQ, "Intel Quad-Core Xeon (Woodcrest)"),
+    FMQ(0, 6, 0, 15, sX, "Intel Dual-Core Xeon (Conroe / Woodcrest) / Quad-Core Xeon (Kentsfield / Clovertown) / Xeon (Tigerton G0)"),
+    FMQ(0, 6, 0, 15, Xc, "Intel Core 2 Extreme Processor (Conroe) / Core 2 Extreme Quad-Core (Kentsfield)"),
+    FMQ(0, 6, 0, 15, Mc, "Intel Core Duo Mobile / Core 2 Duo Mobile (Merom) / Celeron (Merom)"),
+    FMQ(0, 6, 0, 15, Qc, "Intel Core 2 Quad (Conroe)"),
+    FMQ(0, 6, 0, 15, dc, "Intel Core Duo / Core 2 Duo (Conroe)"),
+    FMQ(0, 6, 0, 15, dP, "Intel Pentium Dual-Core (Allendale)"),
+    FMQ(0, 6, 0, 15, dC, "Intel Celeron M (Conroe) / Celeron (Merom) / Celeron Dual-Core (Allendale)"),
+    FM(0, 6, 0, 15, "Intel Core 2 (unknown type) (Merom/Conroe/Allendale/Kentsfield/Allendale/Clovertown/Woodcrest/Tigerton)"),
     // Intel docs (320257).
-    FMS(0, 6, 1, 5, 0, "Intel EP80579 (Tolapai B0)");
+    FMS(0, 6, 1, 5, 0, "Intel EP80579 (Tolapai B0)"),
     // Intel docs (314079, 316964, 317667, 318547).
-    FMSQ(0, 6, 1, 6, 1, MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L A1)");
-    FMSQ(0, 6, 1, 6, 1, dC, "Intel Celeron M (Merom-L A1)");
-    FMSQ(0, 6, 1, 6, 1, Mc, "Intel Core 2 Duo Mobile (Merom A1)");
-    FMS(0, 6, 1, 6, 1, "Intel Core 2 (unknown type) (Merom/Conroe A1)");
-    FMQ(0, 6, 1, 6, MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L)");
-    FMQ(0, 6, 1, 6, dC, "Intel Celeron M (Merom-L)");
-    FMQ(0, 6, 1, 6, Mc, "Intel Core 2 Duo Mobile (Merom)");
-    FM(0, 6, 1, 6, "Intel Core 2 (unknown type) (Merom/Conroe)");
+    FMSQ(0, 6, 1, 6, 1, MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L A1)"),
+    FMSQ(0, 6, 1, 6, 1, dC, "Intel Celeron M (Merom-L A1)"),
+    FMSQ(0, 6, 1, 6, 1, Mc, "Intel Core 2 Duo Mobile (Merom A1)"),
+    FMS(0, 6, 1, 6, 1, "Intel Core 2 (unknown type) (Merom/Conroe A1)"),
+    FMQ(0, 6, 1, 6, MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L)"),
+    FMQ(0, 6, 1, 6, dC, "Intel Celeron M (Merom-L)"),
+    FMQ(0, 6, 1, 6, Mc, "Intel Core 2 Duo Mobile (Merom)"),
+    FM(0, 6, 1, 6, "Intel Core 2 (unknown type) (Merom/Conroe)"),
     // Intel docs (318585, 318586, 318727, 318733, 318915, 319006, 319007,
     // 319129, 320121, 320468, 320469, 322568).
-    FMSQ(0, 6, 1, 7, 6, sQ, "Intel Xeon Processor 3300 (Yorkfield C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)");
-    FMSQ(0, 6, 1, 7, 6, sX, "Intel Xeon Processor 3100 (Wolfdale C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)");
-    FMSQ(0, 6, 1, 7, 6, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C0)");
-    FMSQ(0, 6, 1, 7, 6, Me, "Intel Mobile Core 2 Duo (Penryn C0)");
-    FMSQ(0, 6, 1, 7, 6, Mc, "Intel Mobile Core 2 Duo (Penryn M0)");
-    FMSQ(0, 6, 1, 7, 6, de, "Intel Core 2 Duo (Wolfdale C0)");
-    FMSQ(0, 6, 1, 7, 6, dc, "Intel Core 2 Duo (Wolfdale M0)");
-    FMSQ(0, 6, 1, 7, 6, dP, "Intel Pentium Dual-Core Processor E5000 (Wolfdale M0)");
-    FMS(0, 6, 1, 7, 6, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C0/M0)");
-    FMSQ(0, 6, 1, 7, 7, sQ, "Intel Xeon Processor 3300 (Yorkfield C1)");
-    FMSQ(0, 6, 1, 7, 7, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C1)");
-    FMSQ(0, 6, 1, 7, 7, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield C1)");
-    FMSQ(0, 6, 1, 7, 7, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield M1)");
-    FMS(0, 6, 1, 7, 7, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C1/M1)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_intel_part_3(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FMSQ(0, 6, 1, 7, 10, Me, "Intel Mobile Core 2 (Penryn E0)");
-    FMSQ(0, 6, 1, 7, 10, Mc, "Intel Mobile Core 2 (Penryn R0)");
-    FMSQ(0, 6, 1, 7, 10, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield E0)");
-    FMSQ(0, 6, 1, 7, 10, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield R0)");
-    FMSQ(0, 6, 1, 7, 10, de, "Intel Core 2 Duo (Wolfdale E0)");
-    FMSQ(0, 6, 1, 7, 10, dc, "Intel Core 2 Duo (Wolfdale R0)");
-    FMSQ(0, 6, 1, 7, 10, dP, "Intel Pentium Dual-Core Processor E5000/E6000 / Pentium T4000 (Wolfdale R0)");
-    FMSQ(0, 6, 1, 7, 10, dC, "Intel Celeron E3000 / T3000 / 900 / SU2300 (Wolfdale R0)"); // T3000 & 900 names from MRG* 2018-03-06
-    FMSQ(0, 6, 1, 7, 10, MC, "Intel Celeron M ULV 700 (Penryn R0)");
-    FMSQ(0, 6, 1, 7, 10, se, "Intel Xeon Processor 3300 (Yorkfield E0)");
-    FMSQ(0, 6, 1, 7, 10, sQ, "Intel Xeon Processor 3300 (Yorkfield R0)");
-    FMSQ(0, 6, 1, 7, 10, sX, "Intel Xeon Processor 3100 (Wolfdale E0) / Xeon Processor 3300 (Yorkfield R0) / Xeon Processor 5200 (Wolfdale E0) / Xeon Processor 5400 (Harpertown E0)");
-    FMS(0, 6, 1, 7, 10, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown E0/R0)");
-    FMQ(0, 6, 1, 7, se, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)");
-    FMQ(0, 6, 1, 7, sQ, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)");
-    FMQ(0, 6, 1, 7, sX, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)");
-    FMQ(0, 6, 1, 7, Mc, "Intel Mobile Core 2 (Penryn)");
-    FMQ(0, 6, 1, 7, Xc, "Intel Core 2 Extreme (Yorkfield)");
-    FMQ(0, 6, 1, 7, Qc, "Intel Core 2 Quad-Core (Yorkfield)");
-    FMQ(0, 6, 1, 7, dc, "Intel Core 2 Duo (Wolfdale)");
-    FMQ(0, 6, 1, 7, dC, "Intel Celeron (Wolfdale)");
-    FMQ(0, 6, 1, 7, MC, "Intel Celeron M ULV (Penryn)");
-    FMQ(0, 6, 1, 7, dP, "Intel Pentium (Wolfdale)");
-    FM(0, 6, 1, 7, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown)");
+    FMSQ(0, 6, 1, 7, 6, sQ, "Intel Xeon Processor 3300 (Yorkfield C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)"),
+    FMSQ(0, 6, 1, 7, 6, sX, "Intel Xeon Processor 3100 (Wolfdale C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)"),
+    FMSQ(0, 6, 1, 7, 6, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C0)"),
+    FMSQ(0, 6, 1, 7, 6, Me, "Intel Mobile Core 2 Duo (Penryn C0)"),
+    FMSQ(0, 6, 1, 7, 6, Mc, "Intel Mobile Core 2 Duo (Penryn M0)"),
+    FMSQ(0, 6, 1, 7, 6, de, "Intel Core 2 Duo (Wolfdale C0)"),
+    FMSQ(0, 6, 1, 7, 6, dc, "Intel Core 2 Duo (Wolfdale M0)"),
+    FMSQ(0, 6, 1, 7, 6, dP, "Intel Pentium Dual-Core Processor E5000 (Wolfdale M0)"),
+    FMS(0, 6, 1, 7, 6, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C0/M0)"),
+    FMSQ(0, 6, 1, 7, 7, sQ, "Intel Xeon Processor 3300 (Yorkfield C1)"),
+    FMSQ(0, 6, 1, 7, 7, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C1)"),
+    FMSQ(0, 6, 1, 7, 7, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield C1)"),
+    FMSQ(0, 6, 1, 7, 7, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield M1)"),
+    FMS(0, 6, 1, 7, 7, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C1/M1)"),
+};
+CHECK_SIGNATURES(synth_intel_part_2);
+
+// signature table of INTEL processors, part 3, see decode_synth_intel()
+static constexpr synth_row_t  synth_intel_part_3[] = {
+    FMSQ(0, 6, 1, 7, 10, Me, "Intel Mobile Core 2 (Penryn E0)"),
+    FMSQ(0, 6, 1, 7, 10, Mc, "Intel Mobile Core 2 (Penryn R0)"),
+    FMSQ(0, 6, 1, 7, 10, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield E0)"),
+    FMSQ(0, 6, 1, 7, 10, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield R0)"),
+    FMSQ(0, 6, 1, 7, 10, de, "Intel Core 2 Duo (Wolfdale E0)"),
+    FMSQ(0, 6, 1, 7, 10, dc, "Intel Core 2 Duo (Wolfdale R0)"),
+    FMSQ(0, 6, 1, 7, 10, dP, "Intel Pentium Dual-Core Processor E5000/E6000 / Pentium T4000 (Wolfdale R0)"),
+    FMSQ(0, 6, 1, 7, 10, dC, "Intel Celeron E3000 / T3000 / 900 / SU2300 (Wolfdale R0)"), // T3000 & 900 names from MRG* 2018-03-06
+    FMSQ(0, 6, 1, 7, 10, MC, "Intel Celeron M ULV 700 (Penryn R0)"),
+    FMSQ(0, 6, 1, 7, 10, se, "Intel Xeon Processor 3300 (Yorkfield E0)"),
+    FMSQ(0, 6, 1, 7, 10, sQ, "Intel Xeon Processor 3300 (Yorkfield R0)"),
+    FMSQ(0, 6, 1, 7, 10, sX, "Intel Xeon Processor 3100 (Wolfdale E0) / Xeon Processor 3300 (Yorkfield R0) / Xeon Processor 5200 (Wolfdale E0) / Xeon Processor 5400 (Harpertown E0)"),
+    FMS(0, 6, 1, 7, 10, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown E0/R0)"),
+    FMQ(0, 6, 1, 7, se, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)"),
+    FMQ(0, 6, 1, 7, sQ, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)"),
+    FMQ(0, 6, 1, 7, sX, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)"),
+    FMQ(0, 6, 1, 7, Mc, "Intel Mobile Core 2 (Penryn)"),
+    FMQ(0, 6, 1, 7, Xc, "Intel Core 2 Extreme (Yorkfield)"),
+    FMQ(0, 6, 1, 7, Qc, "Intel Core 2 Quad-Core (Yorkfield)"),
+    FMQ(0, 6, 1, 7, dc, "Intel Core 2 Duo (Wolfdale)"),
+    FMQ(0, 6, 1, 7, dC, "Intel Celeron (Wolfdale)"),
+    FMQ(0, 6, 1, 7, MC, "Intel Celeron M ULV (Penryn)"),
+    FMQ(0, 6, 1, 7, dP, "Intel Pentium (Wolfdale)"),
+    FM(0, 6, 1, 7, "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown)"),
     // Intel docs (320836, 321324, 321333).
-    FMS(0, 6, 1, 10, 4, "Intel Core i7-900 (Bloomfield C0)");
-    FMSQ(0, 6, 1, 10, 5, dc, "Intel Core i7-900 (Bloomfield D0)");
-    FMSQ(0, 6, 1, 10, 5, sX, "Intel Xeon Processor 3500 (Bloomfield D0) / Xeon Processor 5500 (Gainestown D0)");
-    FMS(0, 6, 1, 10, 5, "Intel Core (unknown type) (Bloomfield/Gainestown D0)");
-    FMQ(0, 6, 1, 10, dc, "Intel Core (Bloomfield)");
-    FMQ(0, 6, 1, 10, sX, "Intel Xeon (Bloomfield / Gainestown)");
-    FM(0, 6, 1, 10, "Intel Core (unknown type) (Bloomfield / Gainestown)");
+    FMS(0, 6, 1, 10, 4, "Intel Core i7-900 (Bloomfield C0)"),
+    FMSQ(0, 6, 1, 10, 5, dc, "Intel Core i7-900 (Bloomfield D0)"),
+    FMSQ(0, 6, 1, 10, 5, sX, "Intel Xeon Processor 3500 (Bloomfield D0) / Xeon Processor 5500 (Gainestown D0)"),
+    FMS(0, 6, 1, 10, 5, "Intel Core (unknown type) (Bloomfield/Gainestown D0)"),
+    FMQ(0, 6, 1, 10, dc, "Intel Core (Bloomfield)"),
+    FMQ(0, 6, 1, 10, sX, "Intel Xeon (Bloomfield / Gainestown)"),
+    FM(0, 6, 1, 10, "Intel Core (unknown type) (Bloomfield / Gainestown)"),
     // Intel docs (319536, 319974, 320047, 320529, 322861, 322862, 322849,
     // 324341).
-    FMS(0, 6, 1, 12, 1, "Intel Atom N270 (Diamondville B0)");
-    FMS(0, 6, 1, 12, 2, "Intel Atom 200/N200/300 (Diamondville C0) / Atom Z500 (Silverthorne C0)");
-    FMS(0, 6, 1, 12, 10, "Intel Atom D400/N400 (Pineview A0) / Atom D500/N500 (Pineview B0)");
-    FM(0, 6, 1, 12, "Intel Atom (Diamondville / Silverthorne / Pineview)");
+    FMS(0, 6, 1, 12, 1, "Intel Atom N270 (Diamondville B0)"),
+    FMS(0, 6, 1, 12, 2, "Intel Atom 200/N200/300 (Diamondville C0) / Atom Z500 (Silverthorne C0)"),
+    FMS(0, 6, 1, 12, 10, "Intel Atom D400/N400 (Pineview A0) / Atom D500/N500 (Pineview B0)"),
+    FM(0, 6, 1, 12, "Intel Atom (Diamondville / Silverthorne / Pineview)"),
     // Intel docs (320336).
-    FMS(0, 6, 1, 13, 1, "Intel Xeon Processor 7400 (Dunnington A1)");
-    FM(0, 6, 1, 13, "Intel Xeon (unknown type) (Dunnington)");
+    FMS(0, 6, 1, 13, 1, "Intel Xeon Processor 7400 (Dunnington A1)"),
+    FM(0, 6, 1, 13, "Intel Xeon (unknown type) (Dunnington)"),
     // Intel docs (320767, 322166, 322373, 323105).
-    FMSQ(0, 6, 1, 14, 4, sX, "Intel Xeon Processor EC3500/EC5500 (Jasper Forest B0)"); // EC names from MRG* 2018-03-06
-    FMSQ(0, 6, 1, 14, 4, dC, "Intel Celeron P1053 (Jasper Forest B0)");
-    FMS(0, 6, 1, 14, 4, "Intel Xeon (unknown type) (Jasper Forest B0)");
-    FMSQ(0, 6, 1, 14, 5, sX, "Intel Xeon Processor 3400 (Lynnfield B1)");
-    FMSQ(0, 6, 1, 14, 5, Mc, "Intel Core i7-700/800/900 Mobile (Clarksfield B1)");
-    FMSQ(0, 6, 1, 14, 5, dc, "Intel Core i*-700/800/900 (Lynnfield B1)"); // 900 from MRG* 2018-03-06
-    FMS(0, 6, 1, 14, 5, "Intel Core (unknown type) (Lynnfield/Clarksfield B1)");
-    FMQ(0, 6, 1, 14, sX, "Intel Xeon (Lynnfield) / Xeon (Jasper Forest)");
-    FMQ(0, 6, 1, 14, dC, "Intel Celeron (Jasper Forest)");
-    FMQ(0, 6, 1, 14, Mc, "Intel Core Mobile (Clarksfield)");
-    FMQ(0, 6, 1, 14, dc, "Intel Core (Lynnfield)");
-    FM(0, 6, 1, 14, "Intel Core (unknown type) (Lynnfield/Clarksfield)");
-    FM(0, 6, 1, 15, "Intel (unknown model) (Havendale/Auburndale)");
+    FMSQ(0, 6, 1, 14, 4, sX, "Intel Xeon Processor EC3500/EC5500 (Jasper Forest B0)"), // EC names from MRG* 2018-03-06
+    FMSQ(0, 6, 1, 14, 4, dC, "Intel Celeron P1053 (Jasper Forest B0)"),
+    FMS(0, 6, 1, 14, 4, "Intel Xeon (unknown type) (Jasper Forest B0)"),
+    FMSQ(0, 6, 1, 14, 5, sX, "Intel Xeon Processor 3400 (Lynnfield B1)"),
+    FMSQ(0, 6, 1, 14, 5, Mc, "Intel Core i7-700/800/900 Mobile (Clarksfield B1)"),
+    FMSQ(0, 6, 1, 14, 5, dc, "Intel Core i*-700/800/900 (Lynnfield B1)"), // 900 from MRG* 2018-03-06
+    FMS(0, 6, 1, 14, 5, "Intel Core (unknown type) (Lynnfield/Clarksfield B1)"),
+    FMQ(0, 6, 1, 14, sX, "Intel Xeon (Lynnfield) / Xeon (Jasper Forest)"),
+    FMQ(0, 6, 1, 14, dC, "Intel Celeron (Jasper Forest)"),
+    FMQ(0, 6, 1, 14, Mc, "Intel Core Mobile (Clarksfield)"),
+    FMQ(0, 6, 1, 14, dc, "Intel Core (Lynnfield)"),
+    FM(0, 6, 1, 14, "Intel Core (unknown type) (Lynnfield/Clarksfield)"),
+    FM(0, 6, 1, 15, "Intel (unknown model) (Havendale/Auburndale)"),
     // Intel docs (322814, 322911, 323179, 323847, 323056, 324456).
-    FMSQ(0, 6, 2, 5, 2, sX, "Intel Xeon Processor L3406 (Clarkdale C2)");
-    FMSQ(0, 6, 2, 5, 2, MC, "Intel Celeron Mobile P4500 (Arrandale C2)");
-    FMSQ(0, 6, 2, 5, 2, MP, "Intel Pentium P6000 Mobile (Arrandale C2)");
-    FMSQ(0, 6, 2, 5, 2, dP, "Intel Pentium G6900 / P4500 (Clarkdale C2)");
-    FMSQ(0, 6, 2, 5, 2, Mc, "Intel Core i*-300/400/500/600 Mobile (Arrandale C2)");
-    FMSQ(0, 6, 2, 5, 2, dc, "Intel Core i*-300/500/600 (Clarkdale C2)");
-    FMS(0, 6, 2, 5, 2, "Intel Core (unknown type) (Clarkdale/Arrandale C2)");
-    FMSQ(0, 6, 2, 5, 5, MC, "Intel Celeron Mobile U3400 (Arrandale K0) / Celeron Mobile P4600 (Arrandale K0)");
-    FMSQ(0, 6, 2, 5, 5, MP, "Intel Pentium U5000 Mobile (Arrandale K0)");
-    FMSQ(0, 6, 2, 5, 5, dP, "Intel Pentium P4500 / U3400 / G6900 (Clarkdale K0)"); // G6900 only from MRG* 2018-03-06
-    FMSQ(0, 6, 2, 5, 5, dc, "Intel Core i*-300/400/500/600 (Clarkdale K0)");
-    FMS(0, 6, 2, 5, 5, "Intel Core (unknown type) (Clarkdale/Arrandale K0)");
-    FMQ(0, 6, 2, 5, sX, "Intel Xeon Processor L3406 (Clarkdale)");
-    FMQ(0, 6, 2, 5, MC, "Intel Celeron Mobile (Arrandale)");
-    FMQ(0, 6, 2, 5, MP, "Intel Pentium Mobile (Arrandale)");
-    FMQ(0, 6, 2, 5, dP, "Intel Pentium (Clarkdale)");
-    FMQ(0, 6, 2, 5, Mc, "Intel Core Mobile (Arrandale)");
-    FMQ(0, 6, 2, 5, dc, "Intel Core (Clarkdale)");
-    FM(0, 6, 2, 5, "Intel Core (unknown type) (Clarkdale/Arrandale)");
+    FMSQ(0, 6, 2, 5, 2, sX, "Intel Xeon Processor L3406 (Clarkdale C2)"),
+    FMSQ(0, 6, 2, 5, 2, MC, "Intel Celeron Mobile P4500 (Arrandale C2)"),
+    FMSQ(0, 6, 2, 5, 2, MP, "Intel Pentium P6000 Mobile (Arrandale C2)"),
+    FMSQ(0, 6, 2, 5, 2, dP, "Intel Pentium G6900 / P4500 (Clarkdale C2)"),
+    FMSQ(0, 6, 2, 5, 2, Mc, "Intel Core i*-300/400/500/600 Mobile (Arrandale C2)"),
+    FMSQ(0, 6, 2, 5, 2, dc, "Intel Core i*-300/500/600 (Clarkdale C2)"),
+    FMS(0, 6, 2, 5, 2, "Intel Core (unknown type) (Clarkdale/Arrandale C2)"),
+    FMSQ(0, 6, 2, 5, 5, MC, "Intel Celeron Mobile U3400 (Arrandale K0) / Celeron Mobile P4600 (Arrandale K0)"),
+    FMSQ(0, 6, 2, 5, 5, MP, "Intel Pentium U5000 Mobile (Arrandale K0)"),
+    FMSQ(0, 6, 2, 5, 5, dP, "Intel Pentium P4500 / U3400 / G6900 (Clarkdale K0)"), // G6900 only from MRG* 2018-03-06
+    FMSQ(0, 6, 2, 5, 5, dc, "Intel Core i*-300/400/500/600 (Clarkdale K0)"),
+    FMS(0, 6, 2, 5, 5, "Intel Core (unknown type) (Clarkdale/Arrandale K0)"),
+    FMQ(0, 6, 2, 5, sX, "Intel Xeon Processor L3406 (Clarkdale)"),
+    FMQ(0, 6, 2, 5, MC, "Intel Celeron Mobile (Arrandale)"),
+    FMQ(0, 6, 2, 5, MP, "Intel Pentium Mobile (Arrandale)"),
+    FMQ(0, 6, 2, 5, dP, "Intel Pentium (Clarkdale)"),
+    FMQ(0, 6, 2, 5, Mc, "Intel Core Mobile (Arrandale)"),
+    FMQ(0, 6, 2, 5, dc, "Intel Core (Clarkdale)"),
+    FM(0, 6, 2, 5, "Intel Core (unknown type) (Clarkdale/Arrandale)"),
     // Intel docs (324209, 325307, 325309, 325630).
-    FMS(0, 6, 2, 6, 1, "Intel Atom Z600 (Lincroft C0) / Atom E600 (Tunnel Creek B0/B1)");
-    FM(0, 6, 2, 6, "Intel Atom Z600 (Lincroft) / Atom E600 (Tunnel Creek B0/B1)");
-    FM(0, 6, 2, 7, "Intel Atom Z2000 (Medfield)"); // no spec update, only instlatx64 example (stepping 1)
+    FMS(0, 6, 2, 6, 1, "Intel Atom Z600 (Lincroft C0) / Atom E600 (Tunnel Creek B0/B1)"),
+    FM(0, 6, 2, 6, "Intel Atom Z600 (Lincroft) / Atom E600 (Tunnel Creek B0/B1)"),
+    FM(0, 6, 2, 7, "Intel Atom Z2000 (Medfield)"), // no spec update, only instlatx64 example (stepping 1)
     // Intel docs (327335) omit stepping numbers, but (324643, 324827, 324972)
     // provide some.  An instlatx64 stepping 6 example has been spoted, but it
     // isn't known which stepping name that is.
-    FMSQ(0, 6, 2, 10, 7, Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge D2/J1/Q0)");
-    FMSQ(0, 6, 2, 10, 7, Mc, "Intel Mobile Core i*-2000 (Sandy Bridge D2/J1/Q0)");
-    FMSQ(0, 6, 2, 10, 7, dc, "Intel Core i*-2000 (Sandy Bridge D2/J1/Q0)");
-    FMSQ(0, 6, 2, 10, 7, MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge J1/Q0)");
-    FMSQ(0, 6, 2, 10, 7, sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge D2/J1/Q0)");
-    FMSQ(0, 6, 2, 10, 7, dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge Q0)");
-    FMS(0, 6, 2, 10, 7, "Intel Core (unknown type) (Sandy Bridge D2/J1/Q0)");
-    FMQ(0, 6, 2, 10, Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge)");
-    FMQ(0, 6, 2, 10, Mc, "Intel Mobile Core i*-2000 (Sandy Bridge)");
-    FMQ(0, 6, 2, 10, dc, "Intel Core i*-2000 (Sandy Bridge)");
-    FMQ(0, 6, 2, 10, MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge)");
-    FMQ(0, 6, 2, 10, sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge)");
-    FMQ(0, 6, 2, 10, dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge)");
-    FM(0, 6, 2, 10, "Intel Core (unknown type) (Sandy Bridge)");
+    FMSQ(0, 6, 2, 10, 7, Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge D2/J1/Q0)"),
+    FMSQ(0, 6, 2, 10, 7, Mc, "Intel Mobile Core i*-2000 (Sandy Bridge D2/J1/Q0)"),
+    FMSQ(0, 6, 2, 10, 7, dc, "Intel Core i*-2000 (Sandy Bridge D2/J1/Q0)"),
+    FMSQ(0, 6, 2, 10, 7, MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge J1/Q0)"),
+    FMSQ(0, 6, 2, 10, 7, sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge D2/J1/Q0)"),
+    FMSQ(0, 6, 2, 10, 7, dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge Q0)"),
+    FMS(0, 6, 2, 10, 7, "Intel Core (unknown type) (Sandy Bridge D2/J1/Q0)"),
+    FMQ(0, 6, 2, 10, Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge)"),
+    FMQ(0, 6, 2, 10, Mc, "Intel Mobile Core i*-2000 (Sandy Bridge)"),
+    FMQ(0, 6, 2, 10, dc, "Intel Core i*-2000 (Sandy Bridge)"),
+    FMQ(0, 6, 2, 10, MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge)"),
+    FMQ(0, 6, 2, 10, sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge)"),
+    FMQ(0, 6, 2, 10, dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge)"),
+    FM(0, 6, 2, 10, "Intel Core (unknown type) (Sandy Bridge)"),
     // Intel docs (323254: i7-900, 323338: Xeon 3600, 323372: Xeon 5600).
     // https://en.wikipedia.org/wiki/Westmere_(microarchitecture) provided
     // A0 & B0 stepping values.
-    FMSQ(0, 6, 2, 12, 0, dc, "Intel Core i7-900 / Core i7-980X (Gulftown A0)");
-    FMSQ(0, 6, 2, 12, 0, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP A0)");
-    FMS(0, 6, 2, 12, 0, "Intel Core (unknown type) (Gulftown/Westmere-EP A0)");
-    FMSQ(0, 6, 2, 12, 1, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B0)");
-    FMSQ(0, 6, 2, 12, 1, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B0)");
-    FMS(0, 6, 2, 12, 1, "Intel Core (unknown type) (Gulftown/Westmere-EP B0)");
-    FMSQ(0, 6, 2, 12, 2, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B1)");
-    FMSQ(0, 6, 2, 12, 2, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B1)");
-    FMS(0, 6, 2, 12, 2, "Intel Core (unknown type) (Gulftown/Westmere-EP B1)");
-    FMQ(0, 6, 2, 12, dc, "Intel Core (unknown type) (Gulftown)");
-    FMQ(0, 6, 2, 12, sX, "Intel Xeon (unknown type) (Westmere-EP)");
-    FM(0, 6, 2, 12, "Intel (unknown type) (Gulftown/Westmere-EP)");
+    FMSQ(0, 6, 2, 12, 0, dc, "Intel Core i7-900 / Core i7-980X (Gulftown A0)"),
+    FMSQ(0, 6, 2, 12, 0, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP A0)"),
+    FMS(0, 6, 2, 12, 0, "Intel Core (unknown type) (Gulftown/Westmere-EP A0)"),
+    FMSQ(0, 6, 2, 12, 1, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B0)"),
+    FMSQ(0, 6, 2, 12, 1, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B0)"),
+    FMS(0, 6, 2, 12, 1, "Intel Core (unknown type) (Gulftown/Westmere-EP B0)"),
+    FMSQ(0, 6, 2, 12, 2, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B1)"),
+    FMSQ(0, 6, 2, 12, 2, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B1)"),
+    FMS(0, 6, 2, 12, 2, "Intel Core (unknown type) (Gulftown/Westmere-EP B1)"),
+    FMQ(0, 6, 2, 12, dc, "Intel Core (unknown type) (Gulftown)"),
+    FMQ(0, 6, 2, 12, sX, "Intel Xeon (unknown type) (Westmere-EP)"),
+    FM(0, 6, 2, 12, "Intel (unknown type) (Gulftown/Westmere-EP)"),
     // Intel docs (326198, 326510).
-    FMSQ(0, 6, 2, 13, 6, sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E C1/M0)");
-    FMSQ(0, 6, 2, 13, 6, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C1)");
-    FMS(0, 6, 2, 13, 6, "Intel Core (unknown type) (Sandy Bridge-E C1)");
-    FMSQ(0, 6, 2, 13, 7, sX, "Intel Xeon E5-1600/2600/4600 (Sandy Bridge-E C2/M1)");
-    FMSQ(0, 6, 2, 13, 7, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C2)");
-    FMSQ(0, 6, 2, 13, 7, dP, "Intel Pentium 1405 (Sandy Bridge-E C1)"); // MRG* 2018-03-06
-    FMS(0, 6, 2, 13, 7, "Intel Core (unknown type) (Sandy Bridge-E C2/M1)");
-    FMQ(0, 6, 2, 13, sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E)");
-    FMQ(0, 6, 2, 13, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E)");
-    FMQ(0, 6, 2, 13, dP, "Intel Pentium 1405 (Sandy Bridge-E)"); // MRG* 2018-03-06
-    FM(0, 6, 2, 13, "Intel Core (unknown type) (Sandy Bridge-E)");
+    FMSQ(0, 6, 2, 13, 6, sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E C1/M0)"),
+    FMSQ(0, 6, 2, 13, 6, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C1)"),
+    FMS(0, 6, 2, 13, 6, "Intel Core (unknown type) (Sandy Bridge-E C1)"),
+    FMSQ(0, 6, 2, 13, 7, sX, "Intel Xeon E5-1600/2600/4600 (Sandy Bridge-E C2/M1)"),
+    FMSQ(0, 6, 2, 13, 7, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C2)"),
+    FMSQ(0, 6, 2, 13, 7, dP, "Intel Pentium 1405 (Sandy Bridge-E C1)"), // MRG* 2018-03-06
+    FMS(0, 6, 2, 13, 7, "Intel Core (unknown type) (Sandy Bridge-E C2/M1)"),
+    FMQ(0, 6, 2, 13, sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E)"),
+    FMQ(0, 6, 2, 13, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E)"),
+    FMQ(0, 6, 2, 13, dP, "Intel Pentium 1405 (Sandy Bridge-E)"), // MRG* 2018-03-06
+    FM(0, 6, 2, 13, "Intel Core (unknown type) (Sandy Bridge-E)"),
     // Intel docs (323344) are inconsistent.  Using Table 2 information.
     // instlatx64 samples have steppings 4 & 5, but no idea which stepping names
     // those are.
-    FMS(0, 6, 2, 14, 6, "Intel Xeon Processor 6500 / 7500 (Beckton D0)");
-    FM(0, 6, 2, 14, "Intel Xeon Processor 6500 / 7500 (Beckton)");
+    FMS(0, 6, 2, 14, 6, "Intel Xeon Processor 6500 / 7500 (Beckton D0)"),
+    FM(0, 6, 2, 14, "Intel Xeon Processor 6500 / 7500 (Beckton)"),
     // Intel docs (325122).
-    FMS(0, 6, 2, 15, 2, "Intel Xeon E7-8800 / Xeon E7-4800 / Xeon E7-2800 (Westmere-EX A2)");
-    FM(0, 6, 2, 15, "Intel Xeon (unknown type) (Westmere-EX)");
+    FMS(0, 6, 2, 15, 2, "Intel Xeon E7-8800 / Xeon E7-4800 / Xeon E7-2800 (Westmere-EX A2)"),
+    FM(0, 6, 2, 15, "Intel Xeon (unknown type) (Westmere-EX)"),
     // Intel docs (332067) omit stepping numbers for D1, but (328105) provide
     // some.
-    FMS(0, 6, 3, 5, 1, "Intel Atom Z2760 (Clover Trail C0) / Z8000 (Cherry Trail C0)");
-    FM(0, 6, 3, 5, "Intel Atom Z2760 (Clover Trail) / Z8000 (Cherry Trail)");
+    FMS(0, 6, 3, 5, 1, "Intel Atom Z2760 (Clover Trail C0) / Z8000 (Cherry Trail C0)"),
+    FM(0, 6, 3, 5, "Intel Atom Z2760 (Clover Trail) / Z8000 (Cherry Trail)"),
     // Intel docs (326140) for Cedarview
     // Intel docs (328198) do not provide any FMS for Centerton, but an example
     // from jhladky@redhat.com does.
     // instlatx64 has example with stepping 9, but no idea what stepping name
     // that is.
-    FMS(0, 6, 3, 6, 1, "Intel Atom D2000/N2000 (Cedarview B1/B2/B3) / S1200 (Centerton B1)");
-    FM(0, 6, 3, 6, "Intel Atom D2000/N2000 (Cedarview) / S1200 (Centerton)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_intel_part_4(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
-{
-    cstring  result = NULL;
+    FMS(0, 6, 3, 6, 1, "Intel Atom D2000/N2000 (Cedarview B1/B2/B3) / S1200 (Centerton B1)"),
+    FM(0, 6, 3, 6, "Intel Atom D2000/N2000 (Cedarview) / S1200 (Centerton)"),
+};
+CHECK_SIGNATURES(synth_intel_part_3);
 
-    START;
+// signature table of INTEL processors, part 4, see decode_synth_intel()
+static constexpr synth_row_t  synth_intel_part_4[] = {
     // Intel docs (329475, 329671, 329901, 600827).
-    FMS(0, 6, 3, 7, 1, "Intel Atom Z3000 (Bay Trail-T A0)");
-    FMSQ(0, 6, 3, 7, 2, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M B0/B1)");
-    FMSQ(0, 6, 3, 7, 2, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B0/B1)");
-    FMS(0, 6, 3, 7, 2, "Intel Atom (unknown type) (Bay Trail-M B0/B1)");
-    FMSQ(0, 6, 3, 7, 3, dC, "Intel Celeron N1700 / N1800 / N2800 / N2900 / J1700 / J1800 / J1900 (Bay Trail-M B2/B3)");
-    FMSQ(0, 6, 3, 7, 3, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B2/B3) / Atom E3800 (Bay Trail-I B3)");
-    FMSQ(0, 6, 3, 7, 3, da, "Intel Atom E3800 / Z3700 (Bay Trail-I B3)"); // Z3700 only from MRG* 2019-08-31
-    FMS(0, 6, 3, 7, 3, "Intel Atom (unknown type) (Bay Trail B2/B3)");
-    FMSQ(0, 6, 3, 7, 4, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M C0)");
-    FMSQ(0, 6, 3, 7, 4, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M C0)");
-    FMS(0, 6, 3, 7, 4, "Intel Atom (unknown type) (Bay Trail-M C0 / Bay Trail-T B2/B3)");
-    FMSQ(0, 6, 3, 7, 8, da, "Intel Atom Z3700 (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-    FMSQ(0, 6, 3, 7, 8, dC, "Intel Celeron N2800 / N2900 (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-    FMSQ(0, 6, 3, 7, 8, dP, "Intel Pentium N3500 (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-    FMS(0, 6, 3, 7, 8, "Intel Atom (unknown type) (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-    FMSQ(0, 6, 3, 7, 9, da, "Intel Atom E3800 (Bay Trail-I D0)");
-    FMSQ(0, 6, 3, 7, 9, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M/D D0/D1)"); // only MRG* 2018-03-06
-    FMSQ(0, 6, 3, 7, 9, dP, "Intel Pentium J1800 / J1900 (Bay Trail-M/D D0/D1)"); // only MRG* 2018-03-06
-    FMS(0, 6, 3, 7, 9, "Intel Atom (unknown type) (Bay Trail D0)");
-    FM(0, 6, 3, 7, "Intel Atom (unknown type) (Bay Trail-M / Bay Trail-T / Bay Trail-I)");
+    FMS(0, 6, 3, 7, 1, "Intel Atom Z3000 (Bay Trail-T A0)"),
+    FMSQ(0, 6, 3, 7, 2, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M B0/B1)"),
+    FMSQ(0, 6, 3, 7, 2, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B0/B1)"),
+    FMS(0, 6, 3, 7, 2, "Intel Atom (unknown type) (Bay Trail-M B0/B1)"),
+    FMSQ(0, 6, 3, 7, 3, dC, "Intel Celeron N1700 / N1800 / N2800 / N2900 / J1700 / J1800 / J1900 (Bay Trail-M B2/B3)"),
+    FMSQ(0, 6, 3, 7, 3, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B2/B3) / Atom E3800 (Bay Trail-I B3)"),
+    FMSQ(0, 6, 3, 7, 3, da, "Intel Atom E3800 / Z3700 (Bay Trail-I B3)"), // Z3700 only from MRG* 2019-08-31
+    FMS(0, 6, 3, 7, 3, "Intel Atom (unknown type) (Bay Trail B2/B3)"),
+    FMSQ(0, 6, 3, 7, 4, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M C0)"),
+    FMSQ(0, 6, 3, 7, 4, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M C0)"),
+    FMS(0, 6, 3, 7, 4, "Intel Atom (unknown type) (Bay Trail-M C0 / Bay Trail-T B2/B3)"),
+    FMSQ(0, 6, 3, 7, 8, da, "Intel Atom Z3700 (Bay Trail)"), // only MRG* 2019-08-31 (unknown stepping name)
+    FMSQ(0, 6, 3, 7, 8, dC, "Intel Celeron N2800 / N2900 (Bay Trail)"), // only MRG* 2019-08-31 (unknown stepping name)
+    FMSQ(0, 6, 3, 7, 8, dP, "Intel Pentium N3500 (Bay Trail)"), // only MRG* 2019-08-31 (unknown stepping name)
+    FMS(0, 6, 3, 7, 8, "Intel Atom (unknown type) (Bay Trail)"), // only MRG* 2019-08-31 (unknown stepping name)
+    FMSQ(0, 6, 3, 7, 9, da, "Intel Atom E3800 (Bay Trail-I D0)"),
+    FMSQ(0, 6, 3, 7, 9, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M/D D0/D1)"), // only MRG* 2018-03-06
+    FMSQ(0, 6, 3, 7, 9, dP, "Intel Pentium J1800 / J1900 (Bay Trail-M/D D0/D1)"), // only MRG* 2018-03-06
+    FMS(0, 6, 3, 7, 9, "Intel Atom (unknown type) (Bay Trail D0)"),
+    FM(0, 6, 3, 7, "Intel Atom (unknown type) (Bay Trail-M / Bay Trail-T / Bay Trail-I)"),
     // Intel docs (326766, 326770, 326774, 329376).
     // How to differentiate Gladden from Ivy Bridge here?
-    FMSQ(0, 6, 3, 10, 9, Mc, "Intel Mobile Core i*-3000 (Ivy Bridge E1/L1) / Pentium 900/1000/2000/2100 (P0)");
-    FMSQ(0, 6, 3, 10, 9, dc, "Intel Core i*-3000 (Ivy Bridge E1/N0/L1)");
-    FMSQ(0, 6, 3, 10, 9, sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge E1/N0/L1)");
-    FMSQ(0, 6, 3, 10, 9, dC, "Intel Celeron 1000 / G1600 (Ivy Bridge P0)"); // only MRG 2019-08-31
-    FMSQ(0, 6, 3, 10, 9, dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge P0)");
-    FMS(0, 6, 3, 10, 9, "Intel Core (unknown type) (Ivy Bridge E1/N0/L1/P0)");
-    FMQ(0, 6, 3, 10, Mc, "Intel Mobile Core i*-3000 (Ivy Bridge) / Pentium 900/1000/2000/2100");
-    FMQ(0, 6, 3, 10, dc, "Intel Core i*-3000 (Ivy Bridge)");
-    FMQ(0, 6, 3, 10, sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge)");
-    FMQ(0, 6, 3, 10, dC, "Intel Celeron 1000 / G1600 (Ivy Bridge)"); // only MRG 2019-08-31
-    FMQ(0, 6, 3, 10, dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge)");
-    FM(0, 6, 3, 10, "Intel Core (unknown type) (Ivy Bridge)");
+    FMSQ(0, 6, 3, 10, 9, Mc, "Intel Mobile Core i*-3000 (Ivy Bridge E1/L1) / Pentium 900/1000/2000/2100 (P0)"),
+    FMSQ(0, 6, 3, 10, 9, dc, "Intel Core i*-3000 (Ivy Bridge E1/N0/L1)"),
+    FMSQ(0, 6, 3, 10, 9, sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge E1/N0/L1)"),
+    FMSQ(0, 6, 3, 10, 9, dC, "Intel Celeron 1000 / G1600 (Ivy Bridge P0)"), // only MRG 2019-08-31
+    FMSQ(0, 6, 3, 10, 9, dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge P0)"),
+    FMS(0, 6, 3, 10, 9, "Intel Core (unknown type) (Ivy Bridge E1/N0/L1/P0)"),
+    FMQ(0, 6, 3, 10, Mc, "Intel Mobile Core i*-3000 (Ivy Bridge) / Pentium 900/1000/2000/2100"),
+    FMQ(0, 6, 3, 10, dc, "Intel Core i*-3000 (Ivy Bridge)"),
+    FMQ(0, 6, 3, 10, sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge)"),
+    FMQ(0, 6, 3, 10, dC, "Intel Celeron 1000 / G1600 (Ivy Bridge)"), // only MRG 2019-08-31
+    FMQ(0, 6, 3, 10, dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge)"),
+    FM(0, 6, 3, 10, "Intel Core (unknown type) (Ivy Bridge)"),
     // Intel docs (328899, 328903, 328908) omit the stepping numbers for (0,6),(3,12) C0 & D0.
     // MRG* 2018-03-06 mentions (0,6),(3,12),3, but doesn't specify which stepping name it is.
     // Coreboot* identifies the steppings.
-    FMSQ(0, 6, 3, 12, 1, sX, "Intel Xeon E3-1200 v3 (Haswell A0)");
-    FMSQ(0, 6, 3, 12, 1, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell A0)");
-    FMSQ(0, 6, 3, 12, 1, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell A0)");
-    FMSQ(0, 6, 3, 12, 1, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell A0)");
-    FMSQ(0, 6, 3, 12, 1, dC, "Intel Celeron G1800 / G2000 (Haswell A0)"); // G2000 only from MRG* 2019-08-31
-    FMSQ(0, 6, 3, 12, 1, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell A0)");
-    FMSQ(0, 6, 3, 12, 1, dP, "Intel Pentium G3000 (Haswell A0)");
-    FMS(0, 6, 3, 12, 1, "Intel Core (unknown type) (Haswell A0)");
-    FMSQ(0, 6, 3, 12, 2, sX, "Intel Xeon E3-1200 v3 (Haswell B0)");
-    FMSQ(0, 6, 3, 12, 2, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell B0)");
-    FMSQ(0, 6, 3, 12, 2, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell B0)");
-    FMSQ(0, 6, 3, 12, 2, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell B0)");
-    FMSQ(0, 6, 3, 12, 2, dC, "Intel Celeron G1800 / G2000 (Haswell B0)"); // G2000 only from MRG* 2019-08-31
-    FMSQ(0, 6, 3, 12, 2, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell B0)");
-    FMSQ(0, 6, 3, 12, 2, dP, "Intel Pentium G3000 (Haswell B0)");
-    FMS(0, 6, 3, 12, 2, "Intel Core (unknown type) (Haswell B0)");
-    FMSQ(0, 6, 3, 12, 3, sX, "Intel Xeon E3-1200 v3 (Haswell C0)");
-    FMSQ(0, 6, 3, 12, 3, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell C0)");
-    FMSQ(0, 6, 3, 12, 3, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell C0)");
-    FMSQ(0, 6, 3, 12, 3, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell C0)");
-    FMSQ(0, 6, 3, 12, 3, dC, "Intel Celeron G1800 / G2000 (Haswell C0)"); // G2000 only from MRG* 2019-08-31
-    FMSQ(0, 6, 3, 12, 3, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell C0)");
-    FMSQ(0, 6, 3, 12, 3, dP, "Intel Pentium G3000 (Haswell C0)");
-    FMS(0, 6, 3, 12, 3, "Intel Core (unknown type) (Haswell C0)");
-    FMQ(0, 6, 3, 12, sX, "Intel Xeon E3-1200 v3 (Haswell)");
-    FMQ(0, 6, 3, 12, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell)");
-    FMQ(0, 6, 3, 12, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell)");
-    FMQ(0, 6, 3, 12, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell)");
-    FMQ(0, 6, 3, 12, dC, "Intel Celeron G1800 / G2000 (Haswell)"); // G2000 only from MRG* 2019-08-31
-    FMQ(0, 6, 3, 12, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell)");
-    FMQ(0, 6, 3, 12, dP, "Intel Pentium G3000 (Haswell)");
-    FM(0, 6, 3, 12, "Intel Core (unknown type) (Haswell)");
+    FMSQ(0, 6, 3, 12, 1, sX, "Intel Xeon E3-1200 v3 (Haswell A0)"),
+    FMSQ(0, 6, 3, 12, 1, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell A0)"),
+    FMSQ(0, 6, 3, 12, 1, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell A0)"),
+    FMSQ(0, 6, 3, 12, 1, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell A0)"),
+    FMSQ(0, 6, 3, 12, 1, dC, "Intel Celeron G1800 / G2000 (Haswell A0)"), // G2000 only from MRG* 2019-08-31
+    FMSQ(0, 6, 3, 12, 1, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell A0)"),
+    FMSQ(0, 6, 3, 12, 1, dP, "Intel Pentium G3000 (Haswell A0)"),
+    FMS(0, 6, 3, 12, 1, "Intel Core (unknown type) (Haswell A0)"),
+    FMSQ(0, 6, 3, 12, 2, sX, "Intel Xeon E3-1200 v3 (Haswell B0)"),
+    FMSQ(0, 6, 3, 12, 2, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell B0)"),
+    FMSQ(0, 6, 3, 12, 2, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell B0)"),
+    FMSQ(0, 6, 3, 12, 2, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell B0)"),
+    FMSQ(0, 6, 3, 12, 2, dC, "Intel Celeron G1800 / G2000 (Haswell B0)"), // G2000 only from MRG* 2019-08-31
+    FMSQ(0, 6, 3, 12, 2, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell B0)"),
+    FMSQ(0, 6, 3, 12, 2, dP, "Intel Pentium G3000 (Haswell B0)"),
+    FMS(0, 6, 3, 12, 2, "Intel Core (unknown type) (Haswell B0)"),
+    FMSQ(0, 6, 3, 12, 3, sX, "Intel Xeon E3-1200 v3 (Haswell C0)"),
+    FMSQ(0, 6, 3, 12, 3, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell C0)"),
+    FMSQ(0, 6, 3, 12, 3, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell C0)"),
+    FMSQ(0, 6, 3, 12, 3, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell C0)"),
+    FMSQ(0, 6, 3, 12, 3, dC, "Intel Celeron G1800 / G2000 (Haswell C0)"), // G2000 only from MRG* 2019-08-31
+    FMSQ(0, 6, 3, 12, 3, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell C0)"),
+    FMSQ(0, 6, 3, 12, 3, dP, "Intel Pentium G3000 (Haswell C0)"),
+    FMS(0, 6, 3, 12, 3, "Intel Core (unknown type) (Haswell C0)"),
+    FMQ(0, 6, 3, 12, sX, "Intel Xeon E3-1200 v3 (Haswell)"),
+    FMQ(0, 6, 3, 12, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell)"),
+    FMQ(0, 6, 3, 12, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell)"),
+    FMQ(0, 6, 3, 12, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell)"),
+    FMQ(0, 6, 3, 12, dC, "Intel Celeron G1800 / G2000 (Haswell)"), // G2000 only from MRG* 2019-08-31
+    FMQ(0, 6, 3, 12, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell)"),
+    FMQ(0, 6, 3, 12, dP, "Intel Pentium G3000 (Haswell)"),
+    FM(0, 6, 3, 12, "Intel Core (unknown type) (Haswell)"),
     // Intel docs (330836) omit the stepping numbers for (0,6),(3,13) E0 & F0.
     // MRG* 2019-08-31 mentions stepping 4, but doesn't specify which stepping name it is.
     // Coreboot* identifies the steppings.
-    FMSQ(0, 6, 3, 13, 2, dc, "Intel Core i*-5000 (Broadwell-U C0) / Core M (Broadwell-Y C0)");
-    FMSQ(0, 6, 3, 13, 2, MC, "Intel Mobile Celeron 3000 (Broadwell-U C0)");
-    FMSQ(0, 6, 3, 13, 2, dC, "Intel Celeron 3000 (Broadwell-U C0)");
-    FMSQ(0, 6, 3, 13, 2, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U C0)"); // only MRG* 2018-03-06, 2019-08-31
-    FMS(0, 6, 3, 13, 2, "Intel Core (unknown type) (Broadwell-U/Y C0)");
-    FMSQ(0, 6, 3, 13, 3, dc, "Intel Core i*-5000 (Broadwell-U D0) / Core M (Broadwell-Y D0)");
-    FMSQ(0, 6, 3, 13, 3, MC, "Intel Mobile Celeron 3000 (Broadwell-U D0)");
-    FMSQ(0, 6, 3, 13, 3, dC, "Intel Celeron 3000 (Broadwell-U D0)");
-    FMSQ(0, 6, 3, 13, 3, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U D0)"); // only MRG* 2018-03-06, 2019-08-31
-    FMS(0, 6, 3, 13, 3, "Intel Core (unknown type) (Broadwell-U/Y D0)");
-    FMSQ(0, 6, 3, 13, 4, dc, "Intel Core i*-5000 (Broadwell-U E0) / Core M (Broadwell-Y E0)");
-    FMSQ(0, 6, 3, 13, 4, MC, "Intel Mobile Celeron 3000 (Broadwell-U E0)");
-    FMSQ(0, 6, 3, 13, 4, dC, "Intel Celeron 3000 (Broadwell-U E0)");
-    FMSQ(0, 6, 3, 13, 4, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U E0)"); // only MRG* 2018-03-06, 2019-08-31
-    FMS(0, 6, 3, 13, 4, "Intel Core (unknown type) (Broadwell-U/Y E0)");
-    FMQ(0, 6, 3, 13, dc, "Intel Core i*-5000 (Broadwell-U) / Core M (Broadwell-Y)");
-    FMQ(0, 6, 3, 13, MC, "Intel Mobile Celeron 3000 (Broadwell-U)");
-    FMQ(0, 6, 3, 13, dC, "Intel Celeron 3000 (Broadwell-U)");
-    FMQ(0, 6, 3, 13, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U)"); // only MRG* 2018-03-06, 2019-08-31
-    FM(0, 6, 3, 13, "Intel Core (unknown type) (Broadwell-U/Y)");
+    FMSQ(0, 6, 3, 13, 2, dc, "Intel Core i*-5000 (Broadwell-U C0) / Core M (Broadwell-Y C0)"),
+    FMSQ(0, 6, 3, 13, 2, MC, "Intel Mobile Celeron 3000 (Broadwell-U C0)"),
+    FMSQ(0, 6, 3, 13, 2, dC, "Intel Celeron 3000 (Broadwell-U C0)"),
+    FMSQ(0, 6, 3, 13, 2, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U C0)"), // only MRG* 2018-03-06, 2019-08-31
+    FMS(0, 6, 3, 13, 2, "Intel Core (unknown type) (Broadwell-U/Y C0)"),
+    FMSQ(0, 6, 3, 13, 3, dc, "Intel Core i*-5000 (Broadwell-U D0) / Core M (Broadwell-Y D0)"),
+    FMSQ(0, 6, 3, 13, 3, MC, "Intel Mobile Celeron 3000 (Broadwell-U D0)"),
+    FMSQ(0, 6, 3, 13, 3, dC, "Intel Celeron 3000 (Broadwell-U D0)"),
+    FMSQ(0, 6, 3, 13, 3, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U D0)"), // only MRG* 2018-03-06, 2019-08-31
+    FMS(0, 6, 3, 13, 3, "Intel Core (unknown type) (Broadwell-U/Y D0)"),
+    FMSQ(0, 6, 3, 13, 4, dc, "Intel Core i*-5000 (Broadwell-U E0) / Core M (Broadwell-Y E0)"),
+    FMSQ(0, 6, 3, 13, 4, MC, "Intel Mobile Celeron 3000 (Broadwell-U E0)"),
+    FMSQ(0, 6, 3, 13, 4, dC, "Intel Celeron 3000 (Broadwell-U E0)"),
+    FMSQ(0, 6, 3, 13, 4, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U E0)"), // only MRG* 2018-03-06, 2019-08-31
+    FMS(0, 6, 3, 13, 4, "Intel Core (unknown type) (Broadwell-U/Y E0)"),
+    FMQ(0, 6, 3, 13, dc, "Intel Core i*-5000 (Broadwell-U) / Core M (Broadwell-Y)"),
+    FMQ(0, 6, 3, 13, MC, "Intel Mobile Celeron 3000 (Broadwell-U)"),
+    FMQ(0, 6, 3, 13, dC, "Intel Celeron 3000 (Broadwell-U)"),
+    FMQ(0, 6, 3, 13, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U)"), // only MRG* 2018-03-06, 2019-08-31
+    FM(0, 6, 3, 13, "Intel Core (unknown type) (Broadwell-U/Y)"),
     // Intel docs (329189, 329368, 329597).
-    FMSQ(0, 6, 3, 14, 4, sX, "Intel Xeon E5-1600/E5-2600 v2 (Ivy Bridge-EP C1/M1/S1)");
-    FMSQ(0, 6, 3, 14, 4, dc, "Intel Core i*-4000 (Ivy Bridge-E S1)");
-    FMS(0, 6, 3, 14, 4, "Intel Core (unknown type) (Ivy Bridge-EP C1/M1/S1)");
-    FMSQ(0, 6, 3, 14, 7, sX, "Intel Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 v2 (Ivy Bridge-EX D1)"); // E5-4600 names from MRG* 2018-03-06, 2019-08-31
-    FMS(0, 6, 3, 14, 7, "Intel Xeon (unknown type) (Ivy Bridge-EX D1)");
-    FMQ(0, 6, 3, 14, sX, "Intel Xeon E5-1600 / E5-2600 v2 (Ivy Bridge-EP) / Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 (Ivy Bridge-EX)");
-    FMQ(0, 6, 3, 14, dc, "Intel Core i9-4000 (Ivy Bridge-E)");
-    FM(0, 6, 3, 14, "Intel Core (unknown type) (Ivy Bridge-E / Ivy Bridge-EP / Ivy Bridge-EX)");
+    FMSQ(0, 6, 3, 14, 4, sX, "Intel Xeon E5-1600/E5-2600 v2 (Ivy Bridge-EP C1/M1/S1)"),
+    FMSQ(0, 6, 3, 14, 4, dc, "Intel Core i*-4000 (Ivy Bridge-E S1)"),
+    FMS(0, 6, 3, 14, 4, "Intel Core (unknown type) (Ivy Bridge-EP C1/M1/S1)"),
+    FMSQ(0, 6, 3, 14, 7, sX, "Intel Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 v2 (Ivy Bridge-EX D1)"), // E5-4600 names from MRG* 2018-03-06, 2019-08-31
+    FMS(0, 6, 3, 14, 7, "Intel Xeon (unknown type) (Ivy Bridge-EX D1)"),
+    FMQ(0, 6, 3, 14, sX, "Intel Xeon E5-1600 / E5-2600 v2 (Ivy Bridge-EP) / Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 (Ivy Bridge-EX)"),
+    FMQ(0, 6, 3, 14, dc, "Intel Core i9-4000 (Ivy Bridge-E)"),
+    FM(0, 6, 3, 14, "Intel Core (unknown type) (Ivy Bridge-E / Ivy Bridge-EP / Ivy Bridge-EX)"),
     // Intel docs (330785, 330841, 332317).
-    FMSQ(0, 6, 3, 15, 2, dc, "Intel Core i7-5000 Extreme Edition (Haswell-E R2)");
-    FMSQ(0, 6, 3, 15, 2, sX, "Intel Xeon E5-x600 v3 (Haswell-EP C1/M1/R2)");
-    FMS(0, 6, 3, 15, 2, "Intel (unknown type) (Haswell C1/M1/R2)");
-    FMS(0, 6, 3, 15, 4, "Intel Xeon E7-4800 / E7-8800 v3 (Haswell-EP E0)");
-    FM(0, 6, 3, 15, "Intel Core (unknown type) (Haswell R2 / Haswell-EP)");
+    FMSQ(0, 6, 3, 15, 2, dc, "Intel Core i7-5000 Extreme Edition (Haswell-E R2)"),
+    FMSQ(0, 6, 3, 15, 2, sX, "Intel Xeon E5-x600 v3 (Haswell-EP C1/M1/R2)"),
+    FMS(0, 6, 3, 15, 2, "Intel (unknown type) (Haswell C1/M1/R2)"),
+    FMS(0, 6, 3, 15, 4, "Intel Xeon E7-4800 / E7-8800 v3 (Haswell-EP E0)"),
+    FM(0, 6, 3, 15, "Intel Core (unknown type) (Haswell R2 / Haswell-EP)"),
     // Intel docs (328903) omit the stepping numbers for (0,6),(4,5) C0 & D0.
     // MRG* 2019-08-31 mentions stepping 1, but doesn't specify which stepping name it is.
     // Coreboot* identifies the 0 stepping as B0, but not what the 1 stepping is.
-    FMSQ(0, 6, 4, 5, 0, dc, "Intel Core i*-4000U (Haswell-ULT B0)"); // no docs, but example from Brice Goglin
-    FMSQ(0, 6, 4, 5, 0, Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT B0)");
-    FMSQ(0, 6, 4, 5, 0, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT B0)");
-    FMSQ(0, 6, 4, 5, 0, MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT B0)");
-    FMS(0, 6, 4, 5, 0, "Intel Core (unknown type) (Haswell-ULT B0)");
-    FMQ(0, 6, 4, 5, dc, "Intel Core i*-4000U (Haswell-ULT)"); // no docs, but example from Brice Goglin
-    FMQ(0, 6, 4, 5, Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT)");
-    FMQ(0, 6, 4, 5, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT)");
-    FMQ(0, 6, 4, 5, MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT)");
-    FM(0, 6, 4, 5, "Intel Core (unknown type) (Haswell-ULT)");
+    FMSQ(0, 6, 4, 5, 0, dc, "Intel Core i*-4000U (Haswell-ULT B0)"), // no docs, but example from Brice Goglin
+    FMSQ(0, 6, 4, 5, 0, Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT B0)"),
+    FMSQ(0, 6, 4, 5, 0, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT B0)"),
+    FMSQ(0, 6, 4, 5, 0, MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT B0)"),
+    FMS(0, 6, 4, 5, 0, "Intel Core (unknown type) (Haswell-ULT B0)"),
+    FMQ(0, 6, 4, 5, dc, "Intel Core i*-4000U (Haswell-ULT)"), // no docs, but example from Brice Goglin
+    FMQ(0, 6, 4, 5, Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT)"),
+    FMQ(0, 6, 4, 5, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT)"),
+    FMQ(0, 6, 4, 5, MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT)"),
+    FM(0, 6, 4, 5, "Intel Core (unknown type) (Haswell-ULT)"),
     // Intel docs (328899,328903) omit the stepping numbers for (0,6),(4,6) C0 & D0.
     // MRG* mentions (0,6),(4,6),1, but doesn't specify which stepping name it is.
-    FMQ(0, 6, 4, 6, Mc, "Intel Mobile Core i*-4000Y (Mobile H) (Crystal Well)");
-    FMQ(0, 6, 4, 6, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Desktop R) (Crystal Well)");
-    FMQ(0, 6, 4, 6, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile H) (Crystal Well)");
-    FMQ(0, 6, 4, 6, dC, "Intel Celeron G1800 (Desktop R) (Crystal Well)");
-    FMQ(0, 6, 4, 6, MC, "Intel Mobile Celeron 2900U (Mobile H) (Crystal Well)");
-    FMQ(0, 6, 4, 6, dP, "Intel Pentium G3000 (Desktop R) (Crystal Well)");
-    FM(0, 6, 4, 6, "Intel Core (unknown type) (Crystal Well)");
+    FMQ(0, 6, 4, 6, Mc, "Intel Mobile Core i*-4000Y (Mobile H) (Crystal Well)"),
+    FMQ(0, 6, 4, 6, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Desktop R) (Crystal Well)"),
+    FMQ(0, 6, 4, 6, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile H) (Crystal Well)"),
+    FMQ(0, 6, 4, 6, dC, "Intel Celeron G1800 (Desktop R) (Crystal Well)"),
+    FMQ(0, 6, 4, 6, MC, "Intel Mobile Celeron 2900U (Mobile H) (Crystal Well)"),
+    FMQ(0, 6, 4, 6, dP, "Intel Pentium G3000 (Desktop R) (Crystal Well)"),
+    FM(0, 6, 4, 6, "Intel Core (unknown type) (Crystal Well)"),
     // So far, all these (0,6),(4,7) processors are stepping G0, but the
     // Intel docs (332381, 332382) omit the stepping number for G0.
     // MRG* 2018-03-06 describes Broadwell H 43e.
-    FMSQ(0, 6, 4, 7, 1, dc, "Intel Core i*-5000 (Broadwell G0)");
-    FMSQ(0, 6, 4, 7, 1, Mc, "Intel Mobile Core i7-5000 (Broadwell G0)");
-    FMSQ(0, 6, 4, 7, 1, sX, "Intel Xeon E3-1200 v4 (Broadwell G0)");
-    FMS(0, 6, 4, 7, 1, "Intel (unknown type) (Broadwell-H G0)");
-    FMQ(0, 6, 4, 7, dc, "Intel Core i7-5000 (Broadwell)");
-    FMQ(0, 6, 4, 7, Mc, "Intel Mobile Core i7-5000 (Broadwell)");
-    FMQ(0, 6, 4, 7, sX, "Intel Xeon E3-1200 v4 (Broadwell)");
-    FM(0, 6, 4, 7, "Intel Core (unknown type) (Broadwell)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_intel_part_5(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
-{
-    cstring  result = NULL;
+    FMSQ(0, 6, 4, 7, 1, dc, "Intel Core i*-5000 (Broadwell G0)"),
+    FMSQ(0, 6, 4, 7, 1, Mc, "Intel Mobile Core i7-5000 (Broadwell G0)"),
+    FMSQ(0, 6, 4, 7, 1, sX, "Intel Xeon E3-1200 v4 (Broadwell G0)"),
+    FMS(0, 6, 4, 7, 1, "Intel (unknown type) (Broadwell-H G0)"),
+    FMQ(0, 6, 4, 7, dc, "Intel Core i7-5000 (Broadwell)"),
+    FMQ(0, 6, 4, 7, Mc, "Intel Mobile Core i7-5000 (Broadwell)"),
+    FMQ(0, 6, 4, 7, sX, "Intel Xeon E3-1200 v4 (Broadwell)"),
+    FM(0, 6, 4, 7, "Intel Core (unknown type) (Broadwell)"),
+};
+CHECK_SIGNATURES(synth_intel_part_4);
 
-    START;
+// signature table of INTEL processors, part 5, see decode_synth_intel()
+static constexpr synth_row_t  synth_intel_part_5[] = {
     // no spec update; only MSR_CPUID_table* so far
     // MRG* 2018-03-06 mentions steppings 8 and 9, but without names for either.
-    FM(0, 6, 4, 10, "Intel Atom Z3400 (Merrifield)");
+    FM(0, 6, 4, 10, "Intel Atom Z3400 (Merrifield)"),
     // Intel docs (332095).
-    FMSQ(0, 6, 4, 12, 3, dC, "Intel Celeron N3000 / J3000 (Braswell C0)");
-    FMSQ(0, 6, 4, 12, 3, dP, "Intel Pentium N3000 / J3000 (Braswell C0)");
-    FMSQ(0, 6, 4, 12, 3, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail C0)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
-    FMS(0, 6, 4, 12, 3, "Intel Atom (unknown type) (Braswell/Cherry Trail C0)");
-    FMSQ(0, 6, 4, 12, 4, dC, "Intel Celeron N3000 / J3000 (Braswell D1)");
-    FMSQ(0, 6, 4, 12, 4, dP, "Intel Pentium N3000 / J3000 (Braswell D1)");
-    FMSQ(0, 6, 4, 12, 4, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail D1)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
-    FMS(0, 6, 4, 12, 4, "Intel Atom (unknown type) (Braswell/Cherry Trail D1)");
-    FMQ(0, 6, 4, 12, dC, "Intel Celeron N3000 / J3000 (Braswell)");
-    FMQ(0, 6, 4, 12, dP, "Intel Pentium N3000 / J3000 (Braswell)");
-    FMQ(0, 6, 4, 12, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
-    FM(0, 6, 4, 12, "Intel Atom (unknown type) (Braswell/Cherry Trail)");
+    FMSQ(0, 6, 4, 12, 3, dC, "Intel Celeron N3000 / J3000 (Braswell C0)"),
+    FMSQ(0, 6, 4, 12, 3, dP, "Intel Pentium N3000 / J3000 (Braswell C0)"),
+    FMSQ(0, 6, 4, 12, 3, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail C0)"), // no spec update; only MRG* 2018-03-06, 2019-08-31
+    FMS(0, 6, 4, 12, 3, "Intel Atom (unknown type) (Braswell/Cherry Trail C0)"),
+    FMSQ(0, 6, 4, 12, 4, dC, "Intel Celeron N3000 / J3000 (Braswell D1)"),
+    FMSQ(0, 6, 4, 12, 4, dP, "Intel Pentium N3000 / J3000 (Braswell D1)"),
+    FMSQ(0, 6, 4, 12, 4, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail D1)"), // no spec update; only MRG* 2018-03-06, 2019-08-31
+    FMS(0, 6, 4, 12, 4, "Intel Atom (unknown type) (Braswell/Cherry Trail D1)"),
+    FMQ(0, 6, 4, 12, dC, "Intel Celeron N3000 / J3000 (Braswell)"),
+    FMQ(0, 6, 4, 12, dP, "Intel Pentium N3000 / J3000 (Braswell)"),
+    FMQ(0, 6, 4, 12, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail)"), // no spec update; only MRG* 2018-03-06, 2019-08-31
+    FM(0, 6, 4, 12, "Intel Atom (unknown type) (Braswell/Cherry Trail)"),
     // Intel docs (329460, 330061).
-    FMS(0, 6, 4, 13, 0, "Intel Atom C2000 (Avoton A0/A1)");
-    FMS(0, 6, 4, 13, 8, "Intel Atom C2000 (Avoton/Rangeley B0/C0)");
-    FM(0, 6, 4, 13, "Intel Atom C2000 (Avoton)");
+    FMS(0, 6, 4, 13, 0, "Intel Atom C2000 (Avoton A0/A1)"),
+    FMS(0, 6, 4, 13, 8, "Intel Atom C2000 (Avoton/Rangeley B0/C0)"),
+    FM(0, 6, 4, 13, "Intel Atom C2000 (Avoton)"),
     // Intel docs (332689) omit the stepping numbers for (0,6),(4,14) D1 & K1.
     // MRG* 2018-03-06 mentions (0,6),(4,14),3, but doesn't specify which
     // stepping name it is.
@@ -3378,29 +4827,29 @@ decode_synth_intel_part_5(unsigned int val,  /* val_1_eax */ const code_stash_t*
     // mentioned in (332689).
     // Coreboot* identifies stepping 8 as (Kaby Lake G0). Perhaps they were just
     // early engineering samples of Kaby Lake.
-    FMSQ(0, 6, 4, 14, 2, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake C0)");
-    FMSQ(0, 6, 4, 14, 2, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake C0)");
-    FMSQ(0, 6, 4, 14, 2, dC, "Intel Celeron 3800U / 39000U (Skylake C0)");
-    FMSQ(0, 6, 4, 14, 2, sX, "Intel Xeon E3-1500m (Skylake C0)"); // no spec update; only MSR_CPUID_table* so far
-    FMS(0, 6, 4, 14, 2, "Intel Core (unknown type) (Skylake C0)");
-    FMSQ(0, 6, 4, 14, 3, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake D0)");
-    FMSQ(0, 6, 4, 14, 3, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake D0)");
-    FMSQ(0, 6, 4, 14, 3, dC, "Intel Celeron 3800U / 39000U (Skylake D0)");
-    FMSQ(0, 6, 4, 14, 3, sX, "Intel Xeon E3-1500m (Skylake D0)"); // no spec update; only MSR_CPUID_table* so far
-    FMS(0, 6, 4, 14, 3, "Intel Core (unknown type) (Skylake D0)");
-    FMS(0, 6, 4, 14, 8, "Intel Core (unknown type) (Kaby Lake G0)"); // Coreboot*
-    FMQ(0, 6, 4, 14, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake)");
-    FMQ(0, 6, 4, 14, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake)");
-    FMQ(0, 6, 4, 14, dC, "Intel Celeron 3800U / 39000U (Skylake)");
-    FMQ(0, 6, 4, 14, sX, "Intel Xeon E3-1500m (Skylake)"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 4, 14, "Intel Core (unknown type) (Skylake)");
+    FMSQ(0, 6, 4, 14, 2, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake C0)"),
+    FMSQ(0, 6, 4, 14, 2, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake C0)"),
+    FMSQ(0, 6, 4, 14, 2, dC, "Intel Celeron 3800U / 39000U (Skylake C0)"),
+    FMSQ(0, 6, 4, 14, 2, sX, "Intel Xeon E3-1500m (Skylake C0)"), // no spec update; only MSR_CPUID_table* so far
+    FMS(0, 6, 4, 14, 2, "Intel Core (unknown type) (Skylake C0)"),
+    FMSQ(0, 6, 4, 14, 3, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake D0)"),
+    FMSQ(0, 6, 4, 14, 3, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake D0)"),
+    FMSQ(0, 6, 4, 14, 3, dC, "Intel Celeron 3800U / 39000U (Skylake D0)"),
+    FMSQ(0, 6, 4, 14, 3, sX, "Intel Xeon E3-1500m (Skylake D0)"), // no spec update; only MSR_CPUID_table* so far
+    FMS(0, 6, 4, 14, 3, "Intel Core (unknown type) (Skylake D0)"),
+    FMS(0, 6, 4, 14, 8, "Intel Core (unknown type) (Kaby Lake G0)"), // Coreboot*
+    FMQ(0, 6, 4, 14, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake)"),
+    FMQ(0, 6, 4, 14, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake)"),
+    FMQ(0, 6, 4, 14, dC, "Intel Celeron 3800U / 39000U (Skylake)"),
+    FMQ(0, 6, 4, 14, sX, "Intel Xeon E3-1500m (Skylake)"), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 4, 14, "Intel Core (unknown type) (Skylake)"),
     // Intel docs (333811, 334165) omit the stepping numbers for (0,6),(4,15)
     // B0, M0 & R0, but (334208) provide some.
-    FMSQ(0, 6, 4, 15, 1, dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E R0)");
-    FMQ(0, 6, 4, 15, dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E)");
-    FMSQ(0, 6, 4, 15, 1, sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX B0)");
-    FMQ(0, 6, 4, 15, sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX)");
-    FM(0, 6, 4, 15, "Intel Core (unknown type) (Broadwell-E / Broadwell-EX)");
+    FMSQ(0, 6, 4, 15, 1, dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E R0)"),
+    FMQ(0, 6, 4, 15, dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E)"),
+    FMSQ(0, 6, 4, 15, 1, sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX B0)"),
+    FMQ(0, 6, 4, 15, sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX)"),
+    FM(0, 6, 4, 15, "Intel Core (unknown type) (Broadwell-E / Broadwell-EX)"),
     // Intel docs (335901) omit almost all details for the Core versions of
     // (0,6),(5,5).  But Intel docs (336065: Xeon Scalable steppings 2 & 4,
     // 338848: Xeon Scalable (2nd gen) stepping 7, and 338854: Xeon D-2000
@@ -3408,47 +4857,47 @@ decode_synth_intel_part_5(unsigned int val,  /* val_1_eax */ const code_stash_t*
     // MRG* 2019-11-13 mentions stepping 3, but doesn't mention stepping name.
     // geekbench.com has an "Intel Xeon Gold 6230" example of a stepping 5, but
     // no stepping name.
-    FMSQ(0, 6, 5, 5, 2, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake B0/L0)");
-    FMSQ(0, 6, 5, 5, 2, sX, "Intel Xeon W 2000 / D-2100 (Skylake B0/L0)");
-    FMSQ(0, 6, 5, 5, 4, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake H0/M0/U0)");
-    FMSQ(0, 6, 5, 5, 4, sX, "Intel Xeon W 2000 / D-2100 (Skylake H0/M0/U0)"); // D-2100 from MRG* 2018-03-06
-    FMSQ(0, 6, 5, 5, 4, dc, "Intel Core i9-7000X (Skylake-X H0/M0/U0)"); // only from MRG* 2018-03-06
-    FMSQ(0, 6, 5, 5, 6, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake)"); // no docs, but example from Greg Stewart
-    FMSQ(0, 6, 5, 5, 6, sX, "Intel Xeon W 2000 (Cascade Lake)"); // no docs, but example from Greg Stewart
-    FMSQ(0, 6, 5, 5, 7, dc, "Intel Core i*-10000X (Cascade Lake-X B1/L1/R1)"); // no docs, but instlatx64 example
-    FMSQ(0, 6, 5, 5, 7, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake B1/L1/R1)");
-    FMSQ(0, 6, 5, 5, 7, sX, "Intel Xeon W 2000 (Cascade Lake-W B1/L1/R1)");
-    FMS(0, 6, 5, 5, 10, "Intel (unknown type) (Cooper Lake)");
-    FMQ(0, 6, 5, 5, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake / Cascade Lake)");
-    FMQ(0, 6, 5, 5, sX, "Intel Xeon W 2000 / D-2100 (Skylake / Cascade Lake)");
-    FMQ(0, 6, 5, 5, dc, "Intel Core i*-6000X / i*-7000X (Skylake-X) / i*-10000X (Cascade Lake-X)");
-    FM(0, 6, 5, 5, "Intel Core (unknown type) (Skylake / Skylake-X / Cascade Lake / Cascade Lake-X)");
+    FMSQ(0, 6, 5, 5, 2, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake B0/L0)"),
+    FMSQ(0, 6, 5, 5, 2, sX, "Intel Xeon W 2000 / D-2100 (Skylake B0/L0)"),
+    FMSQ(0, 6, 5, 5, 4, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake H0/M0/U0)"),
+    FMSQ(0, 6, 5, 5, 4, sX, "Intel Xeon W 2000 / D-2100 (Skylake H0/M0/U0)"), // D-2100 from MRG* 2018-03-06
+    FMSQ(0, 6, 5, 5, 4, dc, "Intel Core i9-7000X (Skylake-X H0/M0/U0)"), // only from MRG* 2018-03-06
+    FMSQ(0, 6, 5, 5, 6, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake)"), // no docs, but example from Greg Stewart
+    FMSQ(0, 6, 5, 5, 6, sX, "Intel Xeon W 2000 (Cascade Lake)"), // no docs, but example from Greg Stewart
+    FMSQ(0, 6, 5, 5, 7, dc, "Intel Core i*-10000X (Cascade Lake-X B1/L1/R1)"), // no docs, but instlatx64 example
+    FMSQ(0, 6, 5, 5, 7, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake B1/L1/R1)"),
+    FMSQ(0, 6, 5, 5, 7, sX, "Intel Xeon W 2000 (Cascade Lake-W B1/L1/R1)"),
+    FMS(0, 6, 5, 5, 10, "Intel (unknown type) (Cooper Lake)"),
+    FMQ(0, 6, 5, 5, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake / Cascade Lake)"),
+    FMQ(0, 6, 5, 5, sX, "Intel Xeon W 2000 / D-2100 (Skylake / Cascade Lake)"),
+    FMQ(0, 6, 5, 5, dc, "Intel Core i*-6000X / i*-7000X (Skylake-X) / i*-10000X (Cascade Lake-X)"),
+    FM(0, 6, 5, 5, "Intel Core (unknown type) (Skylake / Skylake-X / Cascade Lake / Cascade Lake-X)"),
     // Intel docs (332054).
-    FMS(0, 6, 5, 6, 1, "Intel Xeon D-1500 (Broadwell-DE U0)");
-    FMS(0, 6, 5, 6, 2, "Intel Xeon D-1500 (Broadwell-DE V1)");
-    FMS(0, 6, 5, 6, 3, "Intel Xeon D-1500 (Broadwell-DE V2/V3)"); // V3 from MRG* 2018-03-06
-    FMS(0, 6, 5, 6, 4, "Intel Xeon D-1500 (Broadwell-DE Y0)");
-    FMS(0, 6, 5, 6, 5, "Intel Xeon D-1500N (Broadwell-DE A1)");
-    FM(0, 6, 5, 6, "Intel Xeon (unknown type) (Broadwell-DE)");
+    FMS(0, 6, 5, 6, 1, "Intel Xeon D-1500 (Broadwell-DE U0)"),
+    FMS(0, 6, 5, 6, 2, "Intel Xeon D-1500 (Broadwell-DE V1)"),
+    FMS(0, 6, 5, 6, 3, "Intel Xeon D-1500 (Broadwell-DE V2/V3)"), // V3 from MRG* 2018-03-06
+    FMS(0, 6, 5, 6, 4, "Intel Xeon D-1500 (Broadwell-DE Y0)"),
+    FMS(0, 6, 5, 6, 5, "Intel Xeon D-1500N (Broadwell-DE A1)"),
+    FM(0, 6, 5, 6, "Intel Xeon (unknown type) (Broadwell-DE)"),
     // Intel docs (334646) omit the stepping number for B0.  But as of Jan 2020,
     // it is the only stepping, and all examples seen have stepping number 1.
-    FMS(0, 6, 5, 7, 1, "Intel Xeon Phi x200 (Knights Landing B0)");
-    FM(0, 6, 5, 7, "Intel Xeon Phi x200 (Knights Landing)");
-    FM(0, 6, 5, 10, "Intel Atom Z3500 (Moorefield)"); // no spec update; only MSR_CPUID_table* & instlatx64 example so far
+    FMS(0, 6, 5, 7, 1, "Intel Xeon Phi x200 (Knights Landing B0)"),
+    FM(0, 6, 5, 7, "Intel Xeon Phi x200 (Knights Landing)"),
+    FM(0, 6, 5, 10, "Intel Atom Z3500 (Moorefield)"), // no spec update; only MSR_CPUID_table* & instlatx64 example so far
     // Intel docs (334820) & MRG* 2018-03-06
     // Coreboot* provides stepping 8 (A0).
-    FMS(0, 6, 5, 12, 2, "Intel Atom T5000 (Apollo Lake)"); // no spec update; only MRG* 2018-03-06
-    FMS(0, 6, 5, 12, 8, "Intel Atom (unknown type) (Apollo Lake A0)");
-    FMSQ(0, 6, 5, 12, 9, dP, "Intel Pentium N4000 / J4000 (Apollo Lake B0/B1/D0)");
-    FMSQ(0, 6, 5, 12, 9, dC, "Intel Celeron N3000 / J3000 (Apollo Lake B0/B1/D0)");
-    FMSQ(0, 6, 5, 12, 9, da, "Intel Atom x*-E3900 / x*-A3900 (Apollo Lake B0/B1/D0)"); // A3900 only from MRG* 2019-08-31
-    FMS(0, 6, 5, 12, 9, "Intel Atom (unknown type) (Apollo Lake B0/B1/D0)");
-    FMSQ(0, 6, 5, 12, 10, da, "Intel Atom x*-E3900 (Apollo Lake E0)");
-    FMS(0, 6, 5, 12, 10, "Intel Atom (unknown type) (Apollo Lake E0)");
-    FM(0, 6, 5, 12, "Intel Atom (unknown type) (Apollo Lake)"); // no spec update for Atom; only MSR_CPUID_table* so far
+    FMS(0, 6, 5, 12, 2, "Intel Atom T5000 (Apollo Lake)"), // no spec update; only MRG* 2018-03-06
+    FMS(0, 6, 5, 12, 8, "Intel Atom (unknown type) (Apollo Lake A0)"),
+    FMSQ(0, 6, 5, 12, 9, dP, "Intel Pentium N4000 / J4000 (Apollo Lake B0/B1/D0)"),
+    FMSQ(0, 6, 5, 12, 9, dC, "Intel Celeron N3000 / J3000 (Apollo Lake B0/B1/D0)"),
+    FMSQ(0, 6, 5, 12, 9, da, "Intel Atom x*-E3900 / x*-A3900 (Apollo Lake B0/B1/D0)"), // A3900 only from MRG* 2019-08-31
+    FMS(0, 6, 5, 12, 9, "Intel Atom (unknown type) (Apollo Lake B0/B1/D0)"),
+    FMSQ(0, 6, 5, 12, 10, da, "Intel Atom x*-E3900 (Apollo Lake E0)"),
+    FMS(0, 6, 5, 12, 10, "Intel Atom (unknown type) (Apollo Lake E0)"),
+    FM(0, 6, 5, 12, "Intel Atom (unknown type) (Apollo Lake)"), // no spec update for Atom; only MSR_CPUID_table* so far
     // No spec update; only MSR_CPUID_table* so far (and instlatx64 example)
     // MRG* 2018-03-06 mentions (0,6),(5,13),1 stepping, but doesn't mention stepping name.
-    FM(0, 6, 5, 13, "Intel Atom x3-C3000 (SoFIA)");
+    FM(0, 6, 5, 13, "Intel Atom x3-C3000 (SoFIA)"),
     // Intel docs (332689,333133) omit the stepping numbers for (0,6),(5,14)
     // R0 & S0.
     // MRG* 2018-03-06 mentions (0,6),(5,14),3, but doesn't specify which
@@ -3457,337 +4906,319 @@ decode_synth_intel_part_5(unsigned int val,  /* val_1_eax */ const code_stash_t*
     // stepping.
     // Coreboot* identifies stepping 8 as (Kaby Lake-H A0). Perhaps they were just
     // early engineering samples of Kaby Lake.
-    FMSQ(0, 6, 5, 14, 1, dc, "Intel Core i*-6000 (Skylake-H Q0)");
-    FMSQ(0, 6, 5, 14, 1, dP, "Intel Pentium G4000 (Skylake-H Q0)");
-    FMSQ(0, 6, 5, 14, 1, dC, "Intel Celeron G3900 (Skylake-H Q0)");
-    FMSQ(0, 6, 5, 14, 1, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H Q0)"); // E3-1500 only from MRG 2019-08-31
-    FMS(0, 6, 5, 14, 1, "Intel Core (unknown type) (Skylake-H Q0)");
-    FMSQ(0, 6, 5, 14, 3, dc, "Intel Core i*-6000 (Skylake-H R0)");
-    FMSQ(0, 6, 5, 14, 3, dP, "Intel Pentium G4000 (Skylake-H R0)");
-    FMSQ(0, 6, 5, 14, 3, dC, "Intel Celeron G3900 (Skylake-H R0)");
-    FMSQ(0, 6, 5, 14, 3, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H R0)"); // E3-1500 only from MRG 2019-08-31
-    FMS(0, 6, 5, 14, 3, "Intel Core (unknown type) (Skylake-H R0)");
-    FMS(0, 6, 4, 14, 8, "Intel Core (unknown type) (Kaby Lake-H A0)"); // Coreboot*
-    FMQ(0, 6, 5, 14, dc, "Intel Core i*-6000 (Skylake-H)");
-    FMQ(0, 6, 5, 14, dP, "Intel Pentium G4000 (Skylake-H)");
-    FMQ(0, 6, 5, 14, dC, "Intel Celeron G3900 (Skylake-H)");
-    FMQ(0, 6, 5, 14, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H)"); // E3-1500 only from MRG 2019-08-31
-    FM(0, 6, 5, 14, "Intel Core (unknown type) (Skylake-H)");
+    FMSQ(0, 6, 5, 14, 1, dc, "Intel Core i*-6000 (Skylake-H Q0)"),
+    FMSQ(0, 6, 5, 14, 1, dP, "Intel Pentium G4000 (Skylake-H Q0)"),
+    FMSQ(0, 6, 5, 14, 1, dC, "Intel Celeron G3900 (Skylake-H Q0)"),
+    FMSQ(0, 6, 5, 14, 1, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H Q0)"), // E3-1500 only from MRG 2019-08-31
+    FMS(0, 6, 5, 14, 1, "Intel Core (unknown type) (Skylake-H Q0)"),
+    FMSQ(0, 6, 5, 14, 3, dc, "Intel Core i*-6000 (Skylake-H R0)"),
+    FMSQ(0, 6, 5, 14, 3, dP, "Intel Pentium G4000 (Skylake-H R0)"),
+    FMSQ(0, 6, 5, 14, 3, dC, "Intel Celeron G3900 (Skylake-H R0)"),
+    FMSQ(0, 6, 5, 14, 3, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H R0)"), // E3-1500 only from MRG 2019-08-31
+    FMS(0, 6, 5, 14, 3, "Intel Core (unknown type) (Skylake-H R0)"),
+    FMS(0, 6, 5, 14, 8, "Intel Core (unknown type) (Kaby Lake-H A0)"), // Coreboot*
+    FMQ(0, 6, 5, 14, dc, "Intel Core i*-6000 (Skylake-H)"),
+    FMQ(0, 6, 5, 14, dP, "Intel Pentium G4000 (Skylake-H)"),
+    FMQ(0, 6, 5, 14, dC, "Intel Celeron G3900 (Skylake-H)"),
+    FMQ(0, 6, 5, 14, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H)"), // E3-1500 only from MRG 2019-08-31
+    FM(0, 6, 5, 14, "Intel Core (unknown type) (Skylake-H)"),
     // Intel docs (336345).
-    FMS(0, 6, 5, 15, 0, "Intel Atom C3000 (Denverton A0/A1)");
-    FMS(0, 6, 5, 15, 1, "Intel Atom C3000 (Denverton B0/B1)");
-    FM(0, 6, 5, 15, "Intel Atom C3000 (Denverton)");
-    FM(0, 6, 6, 5, "Intel XMM 7272 (SoFIA)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
+    FMS(0, 6, 5, 15, 0, "Intel Atom C3000 (Denverton A0/A1)"),
+    FMS(0, 6, 5, 15, 1, "Intel Atom C3000 (Denverton B0/B1)"),
+    FM(0, 6, 5, 15, "Intel Atom C3000 (Denverton)"),
+    FM(0, 6, 6, 5, "Intel XMM 7272 (SoFIA)"), // no spec update; only MRG* 2018-03-06, 2019-08-31
     // no spec update; only MSR_CPUID_table* & instlatx64 example so far
     // Coreboot* provides the steppings.
-    FMS(0, 6, 6, 6, 0, "Intel Core (Cannon Lake A0)");
-    FMS(0, 6, 6, 6, 1, "Intel Core (Cannon Lake B0)");
-    FMS(0, 6, 6, 6, 2, "Intel Core (Cannon Lake C0)");
-    FMS(0, 6, 6, 6, 3, "Intel Core (Cannon Lake D0)");
-    FM(0, 6, 6, 6, "Intel Core (Cannon Lake)");
-    FM(0, 6, 6, 10, "Intel Core (Ice Lake)"); // no spec update; only MSR_CPUID_table* so far
-    FM(0, 6, 6, 12, "Intel Core (Ice Lake)"); // no spec update; only MSR_CPUID_table* so far
+    FMS(0, 6, 6, 6, 0, "Intel Core (Cannon Lake A0)"),
+    FMS(0, 6, 6, 6, 1, "Intel Core (Cannon Lake B0)"),
+    FMS(0, 6, 6, 6, 2, "Intel Core (Cannon Lake C0)"),
+    FMS(0, 6, 6, 6, 3, "Intel Core (Cannon Lake D0)"),
+    FM(0, 6, 6, 6, "Intel Core (Cannon Lake)"),
+    FM(0, 6, 6, 10, "Intel Core (Ice Lake)"), // no spec update; only MSR_CPUID_table* so far
+    FM(0, 6, 6, 12, "Intel Core (Ice Lake)"), // no spec update; only MSR_CPUID_table* so far
     // No spec update; only MRG* 2018-03-06, 2019-08-31.  It is some sort of Atom,
     // but no idea which uarch or core.
-    FM(0, 6, 6, 14, "Intel Puma 7");
+    FM(0, 6, 6, 14, "Intel Puma 7"),
     // No spec update; only instlatx64 example.
-    FM(0, 6, 7, 5, "Intel Spreadtrum SC9853I-IA");
+    FM(0, 6, 7, 5, "Intel Spreadtrum SC9853I-IA"),
     // Intel docs (336562).
     // MRG* 2019-11-13 mentions stepping 8, but doesn't mention stepping name.
     // Coreboot* provides steppings 0 (A0) & 8 (R0).
-    FMSQ(0, 6, 7, 10, 0, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake A0)");
-    FMSQ(0, 6, 7, 10, 0, dC, "Intel Celeron N4000 / J4000 (Gemini Lake A0)");
-    FMS(0, 6, 7, 10, 0, "Intel (unknown type) (Gemini Lake A0)");
-    FMSQ(0, 6, 7, 10, 1, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake B0)");
-    FMSQ(0, 6, 7, 10, 1, dC, "Intel Celeron N4000 / J4000 (Gemini Lake B0)");
-    FMS(0, 6, 7, 10, 1, "Intel (unknown type) (Gemini Lake B0)");
-    FMSQ(0, 6, 7, 10, 8, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake R0)");
-    FMSQ(0, 6, 7, 10, 8, dC, "Intel Celeron N4000 / J4000 (Gemini Lake R0)");
-    FMS(0, 6, 7, 10, 8, "Intel (unknown type) (Gemini Lake R0)");
-    FMQ(0, 6, 7, 10, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake)");
-    FMQ(0, 6, 7, 10, dC, "Intel Celeron N4000 / J4000 (Gemini Lake)");
-    FM(0, 6, 7, 10, "Intel (unknown type) (Gemini Lake)");
-    FM(0, 6, 7, 13, "Intel Core i*-10000 (Ice Lake)"); // no spec update; only MSR_CPUID_table* so far
+    FMSQ(0, 6, 7, 10, 0, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake A0)"),
+    FMSQ(0, 6, 7, 10, 0, dC, "Intel Celeron N4000 / J4000 (Gemini Lake A0)"),
+    FMS(0, 6, 7, 10, 0, "Intel (unknown type) (Gemini Lake A0)"),
+    FMSQ(0, 6, 7, 10, 1, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake B0)"),
+    FMSQ(0, 6, 7, 10, 1, dC, "Intel Celeron N4000 / J4000 (Gemini Lake B0)"),
+    FMS(0, 6, 7, 10, 1, "Intel (unknown type) (Gemini Lake B0)"),
+    FMSQ(0, 6, 7, 10, 8, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake R0)"),
+    FMSQ(0, 6, 7, 10, 8, dC, "Intel Celeron N4000 / J4000 (Gemini Lake R0)"),
+    FMS(0, 6, 7, 10, 8, "Intel (unknown type) (Gemini Lake R0)"),
+    FMQ(0, 6, 7, 10, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake)"),
+    FMQ(0, 6, 7, 10, dC, "Intel Celeron N4000 / J4000 (Gemini Lake)"),
+    FM(0, 6, 7, 10, "Intel (unknown type) (Gemini Lake)"),
+    FM(0, 6, 7, 13, "Intel Core i*-10000 (Ice Lake)"), // no spec update; only MSR_CPUID_table* so far
     // Intel docs (341079) provide inconsistent information about stepping
     // numbers for (0,6),(7,14), and it contradicts actual samples, so I'm
     // ignoring it.
     // Currently there are no Ice Lake CPUs for Xeon/Pentium/Celeron.
     // Coreboot* provides steppings 0 (A0) & 1 (B0), but not for stepping 5,
     // seen in an instlatx64 sample.
-    FMS(0, 6, 7, 14, 0, "Intel Core i*-10000 (Ice Lake-U/Y A0)");
-    FMS(0, 6, 7, 14, 1, "Intel Core i*-10000 (Ice Lake-U/Y B0)");
-    FM(0, 6, 7, 14, "Intel Core i*-10000 (Ice Lake-U/Y)");
+    FMS(0, 6, 7, 14, 0, "Intel Core i*-10000 (Ice Lake-U/Y A0)"),
+    FMS(0, 6, 7, 14, 1, "Intel Core i*-10000 (Ice Lake-U/Y B0)"),
+    FM(0, 6, 7, 14, "Intel Core i*-10000 (Ice Lake-U/Y)"),
     // no spec update; only MSR_CPUID_table* so far
     // MRG* 2018-03-06 mentions stepping 0, but doesn't specify which stepping name it is.
-    FM(0, 6, 8, 5, "Intel Xeon Phi (Knights Mill)");
-    FM(0, 6, 8, 6, "Intel Atom (Elkhart Lake)");
-    FM(0, 6, 8, 10, "Intel Atom (Lakefield)"); // no spec update; LX*
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_intel_part_6(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
-{
-    cstring  result = NULL;
+    FM(0, 6, 8, 5, "Intel Xeon Phi (Knights Mill)"),
+    FM(0, 6, 8, 6, "Intel Atom (Elkhart Lake)"),
+    FM(0, 6, 8, 10, "Intel Atom (Lakefield)"), // no spec update; LX*
+};
+CHECK_SIGNATURES(synth_intel_part_5);
 
-    START;
+// signature table of INTEL processors, part 6, see decode_synth_intel()
+static constexpr synth_row_t  synth_intel_part_6[] = {
     // Coreboot* provides steppings.
-    FMS(0, 6, 8, 12, 0, "Intel Core (Tiger Lake-U A0)");
-    FMS(0, 6, 8, 12, 1, "Intel Core (Tiger Lake-U B0)");
-    FM(0, 6, 8, 12, "Intel Core (Tiger Lake-U)");
-    FM(0, 6, 8, 13, "Intel Core (Tiger Lake)"); // LX*
+    FMS(0, 6, 8, 12, 0, "Intel Core (Tiger Lake-U A0)"),
+    FMS(0, 6, 8, 12, 1, "Intel Core (Tiger Lake-U B0)"),
+    FM(0, 6, 8, 12, "Intel Core (Tiger Lake-U)"),
+    FM(0, 6, 8, 13, "Intel Core (Tiger Lake)"), // LX*
     // Intel docs (334663) omit the stepping numbers for (0,6),(8,14)
     // H0, J1 & Y0, but (338025, 615213) provide some.
     // Coreboot* provides the 9 (H0) & 10 (Y0) stepping, but not J1.
-    FMSQ(0, 6, 8, 14, 9, UC, "Intel Celeron 3x65U (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-    FMSQ(0, 6, 8, 14, 9, UP, "Intel Celeron 4415U (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-    FMSQ(0, 6, 8, 14, 9, YC, "Intel Celeron 3x65Y (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-    FMSQ(0, 6, 8, 14, 9, YP, "Intel Celeron 4410Y (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-    FMSQ(0, 6, 8, 14, 9, Y8, "Intel i*-8000Y / m*-8000Y (Amber Lake-Y H0)"); // no spec update; only MRG* 2019-08-31 & instlatx64 examples
-    FMSQ(0, 6, 8, 14, 9, LY, "Intel Core i*-7000Y (Kaby Lake H0)"); // no spec update; only MRG* 2019-08-31 & instlatx64 examples
-    FMSQ(0, 6, 8, 14, 9, dc, "Intel Core i*-7000U (Kaby Lake H0)"); // no docs on stepping; MRG* 2018-03-06, 2019-08-31
-    FMSQ(0, 6, 8, 14, 10, dc, "Intel Core i*-8000U (Kaby Lake Y0)"); // no docs on stepping; MRG* 2018-03-06
-    FMSQ(0, 6, 8, 14, 11, LU, "Intel Core i*-8000U (Whiskey Lake-U W0)");
-    FMSQ(0, 6, 8, 14, 11, LY, "Intel Core i*-8000Y (Amber Lake-Y W0)");
-    FMSQ(0, 6, 8, 14, 11, UC, "Intel Celeron 4205U (Whiskey Lake-U W0)");
-    FMSQ(0, 6, 8, 14, 11, UP, "Intel Pentium 5405U (Whiskey Lake-U W0)");
-    FMS(0, 6, 8, 14, 11, "Intel Core (unknown type) (Whiskey Lake-U W0 / Amber Lake-Y W0)");
-    FMSQ(0, 6, 8, 14, 12, UX, "Intel Core i*-10000U (Comet Lake-U V1)");
-    FMSQ(0, 6, 8, 14, 12, LU, "Intel Core i*-8000U (Whiskey Lake-U V0)");
-    FMSQ(0, 6, 8, 14, 12, LY, "Intel Core i*-8000Y / m*-8000Y / i*-10000Y (Amber Lake-Y V0)"); // m*-8000Y & i*-10000Y from MRG* 2019-11-13
-    FMSQ(0, 6, 8, 14, 12, dP, "Intel Pentium 6000U (Comet Lake-U V1)"); // MRG* 2019-08-31 pinned down stepping
-    FMSQ(0, 6, 8, 14, 12, dC, "Intel Celeron 5000U (Comet Lake-U V1)"); // MRG* 2019-08-31 pinned down stepping
-    FMS(0, 6, 8, 14, 12, "Intel (unknown type) (Whiskey Lake-U V0 / Comet Lake-U V1)");
-    FM(0, 6, 8, 14, "Intel Core (unknown type) (Kaby Lake / Amber Lake-Y / Whiskey Lake-U / Comet Lake-U)");
-    FM(0, 6, 8, 15, "Intel Xeon (unknown type) (Sapphire Rapids)"); // LX*
+    FMSQ(0, 6, 8, 14, 9, UC, "Intel Celeron 3x65U (Kaby Lake H0)"), // MRG* 2019-08-31 pinned down stepping
+    FMSQ(0, 6, 8, 14, 9, UP, "Intel Celeron 4415U (Kaby Lake H0)"), // MRG* 2019-08-31 pinned down stepping
+    FMSQ(0, 6, 8, 14, 9, YC, "Intel Celeron 3x65Y (Kaby Lake H0)"), // MRG* 2019-08-31 pinned down stepping
+    FMSQ(0, 6, 8, 14, 9, YP, "Intel Celeron 4410Y (Kaby Lake H0)"), // MRG* 2019-08-31 pinned down stepping
+    FMSQ(0, 6, 8, 14, 9, Y8, "Intel i*-8000Y / m*-8000Y (Amber Lake-Y H0)"), // no spec update; only MRG* 2019-08-31 & instlatx64 examples
+    FMSQ(0, 6, 8, 14, 9, LY, "Intel Core i*-7000Y (Kaby Lake H0)"), // no spec update; only MRG* 2019-08-31 & instlatx64 examples
+    FMSQ(0, 6, 8, 14, 9, dc, "Intel Core i*-7000U (Kaby Lake H0)"), // no docs on stepping; MRG* 2018-03-06, 2019-08-31
+    FMSQ(0, 6, 8, 14, 10, dc, "Intel Core i*-8000U (Kaby Lake Y0)"), // no docs on stepping; MRG* 2018-03-06
+    FMSQ(0, 6, 8, 14, 11, LU, "Intel Core i*-8000U (Whiskey Lake-U W0)"),
+    FMSQ(0, 6, 8, 14, 11, LY, "Intel Core i*-8000Y (Amber Lake-Y W0)"),
+    FMSQ(0, 6, 8, 14, 11, UC, "Intel Celeron 4205U (Whiskey Lake-U W0)"),
+    FMSQ(0, 6, 8, 14, 11, UP, "Intel Pentium 5405U (Whiskey Lake-U W0)"),
+    FMS(0, 6, 8, 14, 11, "Intel Core (unknown type) (Whiskey Lake-U W0 / Amber Lake-Y W0)"),
+    FMSQ(0, 6, 8, 14, 12, UX, "Intel Core i*-10000U (Comet Lake-U V1)"),
+    FMSQ(0, 6, 8, 14, 12, LU, "Intel Core i*-8000U (Whiskey Lake-U V0)"),
+    FMSQ(0, 6, 8, 14, 12, LY, "Intel Core i*-8000Y / m*-8000Y / i*-10000Y (Amber Lake-Y V0)"), // m*-8000Y & i*-10000Y from MRG* 2019-11-13
+    FMSQ(0, 6, 8, 14, 12, dP, "Intel Pentium 6000U (Comet Lake-U V1)"), // MRG* 2019-08-31 pinned down stepping
+    FMSQ(0, 6, 8, 14, 12, dC, "Intel Celeron 5000U (Comet Lake-U V1)"), // MRG* 2019-08-31 pinned down stepping
+    FMS(0, 6, 8, 14, 12, "Intel (unknown type) (Whiskey Lake-U V0 / Comet Lake-U V1)"),
+    FM(0, 6, 8, 14, "Intel Core (unknown type) (Kaby Lake / Amber Lake-Y / Whiskey Lake-U / Comet Lake-U)"),
+    FM(0, 6, 8, 15, "Intel Xeon (unknown type) (Sapphire Rapids)"), // LX*
     // LX*.  Coreboot* provides stepping.
-    FMS(0, 6, 9, 6, 0, "Intel Atom (Elkhart Lake A0)");
-    FMS(0, 6, 9, 6, 1, "Intel Atom (Elkhart Lake B0)");
-    FM(0, 6, 9, 6, "Intel Atom (Elkhart Lake)");
+    FMS(0, 6, 9, 6, 0, "Intel Atom (Elkhart Lake A0)"),
+    FMS(0, 6, 9, 6, 1, "Intel Atom (Elkhart Lake B0)"),
+    FM(0, 6, 9, 6, "Intel Atom (Elkhart Lake)"),
     // LX*.  Coreboot* provides stepping.
-    FMS(0, 6, 9, 7, 0, "Intel Atom (Alder Lake-S A0)");
-    FM(0, 6, 9, 7, "Intel Atom (Alder Lake-S)");
+    FMS(0, 6, 9, 7, 0, "Intel Atom (Alder Lake-S A0)"),
+    FM(0, 6, 9, 7, "Intel Atom (Alder Lake-S)"),
     // Coreboot*.  Coreboot* provides stepping.
-    FMS(0, 6, 9, 10, 0, "Intel Atom (Alder Lake-P A0)");
-    FM(0, 6, 9, 10, "Intel Atom (Alder Lake-P)");
+    FMS(0, 6, 9, 10, 0, "Intel Atom (Alder Lake-P A0)"),
+    FM(0, 6, 9, 10, "Intel Atom (Alder Lake-P)"),
     // LX*.  Coreboot* provides stepping.
-    FMS(0, 6, 9, 12, 0, "Intel Atom (Jasper Lake A0)");
-    FM(0, 6, 9, 12, "Intel Atom (Jasper Lake)");
-    FM(0, 6, 9, 13, "Intel NNP I-1000 (Spring Hill)"); // LX*
+    FMS(0, 6, 9, 12, 0, "Intel Atom (Jasper Lake A0)"),
+    FM(0, 6, 9, 12, "Intel Atom (Jasper Lake)"),
+    FM(0, 6, 9, 13, "Intel NNP I-1000 (Spring Hill)"), // LX*
     // Intel docs (334663, 335718, 336466, 338014) omit the stepping numbers for
     // (0,6),(9,14) B0, but (337346) provides some.
     // Coreboot* provides the 9 (B0) stepping.
     // WARNING: If adding new steppings here, also update decode_uarch_intel.
-    FMSQ(0, 6, 9, 14, 9, LG, "Intel Core i*-8700 (Kaby Lake-H B0)"); // no docs on stepping; only MRG* 2018-03-06, 2019-08-31
-    FMSQ(0, 6, 9, 14, 9, dc, "Intel Core i*-7700 (Kaby Lake-H B0)"); // no docs on stepping; only MRG* 2018-03-06 & instlatx64 examples
-    FMSQ(0, 6, 9, 14, 9, sX, "Intel Xeon E3-1200 v6 (Kaby Lake-H B0)"); // no docs on stepping; only MRG* 2018-03-06
-    FMSQ(0, 6, 9, 14, 9, dC, "Intel Celeron G3930 (Kaby Lake-H B0)"); // MRG* 2020-01-27 pinned down stepping
-    FMSQ(0, 6, 9, 14, 10, LU, "Intel Core i*-8000 U Line (Coffee Lake D0)");
-    FMSQ(0, 6, 9, 14, 10, dc, "Intel Core i*-8000 S/H Line (Coffee Lake U0)");
-    FMSQ(0, 6, 9, 14, 10, sX, "Intel Xeon E-2100 (Coffee Lake U0)"); // MRG* 2019-08-31
-    FMSQ(0, 6, 9, 14, 11, dc, "Intel Core i*-8000 S Line (Coffee Lake B0)");
-    FMSQ(0, 6, 9, 14, 11, dC, "Intel Celeron G4900 (Coffee Lake B0)"); // no spec update; MRG* 2020-01-27
-    FMSQ(0, 6, 9, 14, 11, dP, "Intel Pentium Gold G5000 (Coffee Lake B0)"); // MRG* 2020-01-27 pinned down stepping
-    FMSQ(0, 6, 9, 14, 12, dc, "Intel Core i*-9000 S Line (Coffee Lake P0)");
-    FMSQ(0, 6, 9, 14, 13, d1, "Intel CC150 (Coffee Lake R0)"); // no docs; only instlatx64 example
-    FMSQ(0, 6, 9, 14, 13, dc, "Intel Core i*-9000 H Line (Coffee Lake R0)");
-    FMSQ(0, 6, 9, 14, 13, sX, "Intel Xeon E-2200 (Coffee Lake R0)"); // no docs on stepping; only MRG 2019-11-13
-    FM(0, 6, 9, 14, "Intel (unknown type) (Kaby Lake / Coffee Lake)");
+    FMSQ(0, 6, 9, 14, 9, LG, "Intel Core i*-8700 (Kaby Lake-H B0)"), // no docs on stepping; only MRG* 2018-03-06, 2019-08-31
+    FMSQ(0, 6, 9, 14, 9, dc, "Intel Core i*-7700 (Kaby Lake-H B0)"), // no docs on stepping; only MRG* 2018-03-06 & instlatx64 examples
+    FMSQ(0, 6, 9, 14, 9, sX, "Intel Xeon E3-1200 v6 (Kaby Lake-H B0)"), // no docs on stepping; only MRG* 2018-03-06
+    FMSQ(0, 6, 9, 14, 9, dC, "Intel Celeron G3930 (Kaby Lake-H B0)"), // MRG* 2020-01-27 pinned down stepping
+    FMSQ(0, 6, 9, 14, 10, LU, "Intel Core i*-8000 U Line (Coffee Lake D0)"),
+    FMSQ(0, 6, 9, 14, 10, dc, "Intel Core i*-8000 S/H Line (Coffee Lake U0)"),
+    FMSQ(0, 6, 9, 14, 10, sX, "Intel Xeon E-2100 (Coffee Lake U0)"), // MRG* 2019-08-31
+    FMSQ(0, 6, 9, 14, 11, dc, "Intel Core i*-8000 S Line (Coffee Lake B0)"),
+    FMSQ(0, 6, 9, 14, 11, dC, "Intel Celeron G4900 (Coffee Lake B0)"), // no spec update; MRG* 2020-01-27
+    FMSQ(0, 6, 9, 14, 11, dP, "Intel Pentium Gold G5000 (Coffee Lake B0)"), // MRG* 2020-01-27 pinned down stepping
+    FMSQ(0, 6, 9, 14, 12, dc, "Intel Core i*-9000 S Line (Coffee Lake P0)"),
+    FMSQ(0, 6, 9, 14, 13, d1, "Intel CC150 (Coffee Lake R0)"), // no docs; only instlatx64 example
+    FMSQ(0, 6, 9, 14, 13, dc, "Intel Core i*-9000 H Line (Coffee Lake R0)"),
+    FMSQ(0, 6, 9, 14, 13, sX, "Intel Xeon E-2200 (Coffee Lake R0)"), // no docs on stepping; only MRG 2019-11-13
+    FM(0, 6, 9, 14, "Intel (unknown type) (Kaby Lake / Coffee Lake)"),
     // LX*.  Coreboot* provides more detail & steppings
     // (615213) mentions the (0,6),(10,5),2 and (0,6),(10,5),5 steppings, but
     // does not provide their names.
     // en.wikichip.org provides more details on stepping names.
-    FMSQ(0, 6, 10, 5, 0, dc, "Intel Core i*-10000 (Comet Lake-H/S G0)");
-    FMS(0, 6, 10, 5, 0, "Intel (unknown type) (Comet Lake-H/S G0)");
-    FMSQ(0, 6, 10, 5, 1, dc, "Intel Core i*-10000 (Comet Lake-H/S P0)");
-    FMS(0, 6, 10, 5, 1, "Intel (unknown type) (Comet Lake-H/S P0)");
-    FMSQ(0, 6, 10, 5, 2, dc, "Intel Core i*-10000 (Comet Lake-H/S R1)");
-    FMS(0, 6, 10, 5, 2, "Intel (unknown type) (Comet Lake-H/S R1)");
-    FMSQ(0, 6, 10, 5, 3, dc, "Intel Core i*-10000 (Comet Lake-H/S G1)");
-    FMS(0, 6, 10, 5, 3, "Intel (unknown type) (Comet Lake-H/S G1)");
-    FMSQ(0, 6, 10, 5, 4, dc, "Intel Core i*-10000 (Comet Lake-H/S P1)");
-    FMS(0, 6, 10, 5, 4, "Intel (unknown type) (Comet Lake-H/S P1)");
-    FMSQ(0, 6, 10, 5, 5, dc, "Intel Core i*-10000 (Comet Lake-H/S Q0)");
-    FMS(0, 6, 10, 5, 5, "Intel (unknown type) (Comet Lake-H/S Q0)");
-    FMQ(0, 6, 10, 5, dc, "Intel Core i*-10000 (Comet Lake-H/S)");
-    FM(0, 6, 10, 5, "Intel (unknown type) (Comet Lake-H/S)");
+    FMSQ(0, 6, 10, 5, 0, dc, "Intel Core i*-10000 (Comet Lake-H/S G0)"),
+    FMS(0, 6, 10, 5, 0, "Intel (unknown type) (Comet Lake-H/S G0)"),
+    FMSQ(0, 6, 10, 5, 1, dc, "Intel Core i*-10000 (Comet Lake-H/S P0)"),
+    FMS(0, 6, 10, 5, 1, "Intel (unknown type) (Comet Lake-H/S P0)"),
+    FMSQ(0, 6, 10, 5, 2, dc, "Intel Core i*-10000 (Comet Lake-H/S R1)"),
+    FMS(0, 6, 10, 5, 2, "Intel (unknown type) (Comet Lake-H/S R1)"),
+    FMSQ(0, 6, 10, 5, 3, dc, "Intel Core i*-10000 (Comet Lake-H/S G1)"),
+    FMS(0, 6, 10, 5, 3, "Intel (unknown type) (Comet Lake-H/S G1)"),
+    FMSQ(0, 6, 10, 5, 4, dc, "Intel Core i*-10000 (Comet Lake-H/S P1)"),
+    FMS(0, 6, 10, 5, 4, "Intel (unknown type) (Comet Lake-H/S P1)"),
+    FMSQ(0, 6, 10, 5, 5, dc, "Intel Core i*-10000 (Comet Lake-H/S Q0)"),
+    FMS(0, 6, 10, 5, 5, "Intel (unknown type) (Comet Lake-H/S Q0)"),
+    FMQ(0, 6, 10, 5, dc, "Intel Core i*-10000 (Comet Lake-H/S)"),
+    FM(0, 6, 10, 5, "Intel (unknown type) (Comet Lake-H/S)"),
     // (615213) provides steppings.
     // MRG* 2019-11-13 & instlatx64 example
     // Coreboot* provides steppings.
-    FMS(0, 6, 10, 6, 0, "Intel Core i*-10000 (Comet Lake-U A0)");
-    FMS(0, 6, 10, 6, 1, "Intel Core i*-10000 (Comet Lake-U K0/K1/S0)");
-    FMS(0, 6, 10, 6, 2, "Intel Core i*-10000 (Comet Lake-H R1)");
-    FMS(0, 6, 10, 6, 3, "Intel Core i*-10000 (Comet Lake-S G1)");
-    FMS(0, 6, 10, 6, 5, "Intel Core i*-10000 (Comet Lake-S Q0)");
-    FM(0, 6, 10, 6, "Intel Core i*-10000 (Comet Lake)");
-    FM(0, 6, 10, 7, "Intel (unknown type) (Rocket Lake)");
-    FQ(0, 6, sX, "Intel Xeon (unknown model)");
-    FQ(0, 6, se, "Intel Xeon (unknown model)");
-    FQ(0, 6, MC, "Intel Mobile Celeron (unknown model)");
-    FQ(0, 6, dC, "Intel Celeron (unknown model)");
-    FQ(0, 6, Xc, "Intel Core Extreme (unknown model)");
-    FQ(0, 6, Mc, "Intel Mobile Core (unknown model)");
-    FQ(0, 6, dc, "Intel Core (unknown model)");
-    FQ(0, 6, MP, "Intel Mobile Pentium (unknown model)");
-    FQ(0, 6, dP, "Intel Pentium (unknown model)");
-    F(0, 6, "Intel (unknown model)");
+    FMS(0, 6, 10, 6, 0, "Intel Core i*-10000 (Comet Lake-U A0)"),
+    FMS(0, 6, 10, 6, 1, "Intel Core i*-10000 (Comet Lake-U K0/K1/S0)"),
+    FMS(0, 6, 10, 6, 2, "Intel Core i*-10000 (Comet Lake-H R1)"),
+    FMS(0, 6, 10, 6, 3, "Intel Core i*-10000 (Comet Lake-S G1)"),
+    FMS(0, 6, 10, 6, 5, "Intel Core i*-10000 (Comet Lake-S Q0)"),
+    FM(0, 6, 10, 6, "Intel Core i*-10000 (Comet Lake)"),
+    FM(0, 6, 10, 7, "Intel (unknown type) (Rocket Lake)"),
+    FQ(0, 6, sX, "Intel Xeon (unknown model)"),
+    FQ(0, 6, se, "Intel Xeon (unknown model)"),
+    FQ(0, 6, MC, "Intel Mobile Celeron (unknown model)"),
+    FQ(0, 6, dC, "Intel Celeron (unknown model)"),
+    FQ(0, 6, Xc, "Intel Core Extreme (unknown model)"),
+    FQ(0, 6, Mc, "Intel Mobile Core (unknown model)"),
+    FQ(0, 6, dc, "Intel Core (unknown model)"),
+    FQ(0, 6, MP, "Intel Mobile Pentium (unknown model)"),
+    FQ(0, 6, dP, "Intel Pentium (unknown model)"),
+    F(0, 6, "Intel (unknown model)"),
     // Intel docs (249720).
-    FMS(0, 7, 0, 0, 6, "Intel Itanium (Merced C0)");
-    FMS(0, 7, 0, 0, 7, "Intel Itanium (Merced C1)");
-    FMS(0, 7, 0, 0, 8, "Intel Itanium (Merced C2)");
-    F(0, 7, "Intel Itanium (unknown model)");
-    FM(0, 11, 0, 0, "Intel Xeon Phi x100 Coprocessor (Knights Ferry)"); // found only on en.wikichip.org
+    FMS(0, 7, 0, 0, 6, "Intel Itanium (Merced C0)"),
+    FMS(0, 7, 0, 0, 7, "Intel Itanium (Merced C1)"),
+    FMS(0, 7, 0, 0, 8, "Intel Itanium (Merced C2)"),
+    F(0, 7, "Intel Itanium (unknown model)"),
+    FM(0, 11, 0, 0, "Intel Xeon Phi x100 Coprocessor (Knights Ferry)"), // found only on en.wikichip.org
     // Intel docs (328205).
-    FMS(0, 11, 0, 1, 1, "Intel Xeon Phi x100 Coprocessor (Knights Corner B0)");
-    FMS(0, 11, 0, 1, 3, "Intel Xeon Phi x100 Coprocessor (Knights Corner B1)");
-    FMS(0, 11, 0, 1, 4, "Intel Xeon Phi x100 Coprocessor (Knights Corner C0)");
-    FM(0, 11, 0, 1, "Intel Xeon Phi x100 Coprocessor (Knights Corner)");
+    FMS(0, 11, 0, 1, 1, "Intel Xeon Phi x100 Coprocessor (Knights Corner B0)"),
+    FMS(0, 11, 0, 1, 3, "Intel Xeon Phi x100 Coprocessor (Knights Corner B1)"),
+    FMS(0, 11, 0, 1, 4, "Intel Xeon Phi x100 Coprocessor (Knights Corner C0)"),
+    FM(0, 11, 0, 1, "Intel Xeon Phi x100 Coprocessor (Knights Corner)"),
     // Intel docs (249199, 249678).
-    FMS(0, 15, 0, 0, 7, "Intel Pentium 4 (Willamette B2)");
-    FMSQ(0, 15, 0, 0, 10, dP, "Intel Pentium 4 (Willamette C1)");
-    FMSQ(0, 15, 0, 0, 10, sX, "Intel Xeon (Foster C1)");
-    FMS(0, 15, 0, 0, 10, "Intel Pentium 4 (unknown type) 4 (Willamette/Foster C1)");
-    FMQ(0, 15, 0, 0, dP, "Intel Pentium 4 (Willamette)");
-    FMQ(0, 15, 0, 0, sX, "Intel Xeon (Foster)");
-    FM(0, 15, 0, 0, "Intel Pentium 4 (unknown type) (Willamette/Foster)");
+    FMS(0, 15, 0, 0, 7, "Intel Pentium 4 (Willamette B2)"),
+    FMSQ(0, 15, 0, 0, 10, dP, "Intel Pentium 4 (Willamette C1)"),
+    FMSQ(0, 15, 0, 0, 10, sX, "Intel Xeon (Foster C1)"),
+    FMS(0, 15, 0, 0, 10, "Intel Pentium 4 (unknown type) 4 (Willamette/Foster C1)"),
+    FMQ(0, 15, 0, 0, dP, "Intel Pentium 4 (Willamette)"),
+    FMQ(0, 15, 0, 0, sX, "Intel Xeon (Foster)"),
+    FM(0, 15, 0, 0, "Intel Pentium 4 (unknown type) (Willamette/Foster)"),
     // Intel docs (249199, 249678, 290741, 290749).
-    FMS(0, 15, 0, 1, 1, "Intel Xeon MP (Foster C0)");
-    FMSQ(0, 15, 0, 1, 2, dP, "Intel Pentium 4 (Willamette D0)");
-    FMSQ(0, 15, 0, 1, 2, sX, "Intel Xeon (Foster D0)");
-    FMS(0, 15, 0, 1, 2, "Intel Pentium 4 (unknown type) (Willamette/Foster D0)");
-    FMSQ(0, 15, 0, 1, 3, dP, "Intel Pentium 4(Willamette E0)");
-    FMSQ(0, 15, 0, 1, 3, dC, "Intel Celeron 478-pin (Willamette E0)");
-    FMS(0, 15, 0, 1, 3, "Intel Pentium 4 (unknown type) (Willamette/Foster E0)");
-    FMQ(0, 15, 0, 1, dP, "Intel Pentium 4 (Willamette)");
-    FMQ(0, 15, 0, 1, sX, "Intel Xeon (Foster)");
-    FM(0, 15, 0, 1, "Intel Pentium 4 (unknown type) (Willamette/Foster)");
+    FMS(0, 15, 0, 1, 1, "Intel Xeon MP (Foster C0)"),
+    FMSQ(0, 15, 0, 1, 2, dP, "Intel Pentium 4 (Willamette D0)"),
+    FMSQ(0, 15, 0, 1, 2, sX, "Intel Xeon (Foster D0)"),
+    FMS(0, 15, 0, 1, 2, "Intel Pentium 4 (unknown type) (Willamette/Foster D0)"),
+    FMSQ(0, 15, 0, 1, 3, dP, "Intel Pentium 4(Willamette E0)"),
+    FMSQ(0, 15, 0, 1, 3, dC, "Intel Celeron 478-pin (Willamette E0)"),
+    FMS(0, 15, 0, 1, 3, "Intel Pentium 4 (unknown type) (Willamette/Foster E0)"),
+    FMQ(0, 15, 0, 1, dP, "Intel Pentium 4 (Willamette)"),
+    FMQ(0, 15, 0, 1, sX, "Intel Xeon (Foster)"),
+    FM(0, 15, 0, 1, "Intel Pentium 4 (unknown type) (Willamette/Foster)"),
     // Intel docs (249199, 249678, 250721, 251309, 253176, 290741, 290749).
-    FMS(0, 15, 0, 2, 2, "Intel Xeon MP (Gallatin A0)");
-    FMSQ(0, 15, 0, 2, 4, sX, "Intel Xeon (Prestonia B0)");
-    FMSQ(0, 15, 0, 2, 4, MM, "Intel Mobile Pentium 4 Processor-M (Northwood B0)");
-    FMSQ(0, 15, 0, 2, 4, MC, "Intel Mobile Celeron (Northwood B0)");
-    FMSQ(0, 15, 0, 2, 4, dP, "Intel Pentium 4 (Northwood B0)");
-    FMS(0, 15, 0, 2, 4, "Intel Pentium 4 (unknown type) (Northwood/Prestonia B0)");
-    FMSQ(0, 15, 0, 2, 5, dP, "Intel Pentium 4 (Northwood B1/M0)");
-    FMSQ(0, 15, 0, 2, 5, sM, "Intel Xeon MP (Gallatin B1)");
-    FMSQ(0, 15, 0, 2, 5, sX, "Intel Xeon (Prestonia B1)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_intel_part_7(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FMS(0, 15, 0, 2, 5, "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin B1/M0)");
-    FMS(0, 15, 0, 2, 6, "Intel Xeon MP (Gallatin C0)");
-    FMSQ(0, 15, 0, 2, 7, sX, "Intel Xeon (Prestonia C1)");
-    FMSQ(0, 15, 0, 2, 7, dC, "Intel Celeron 478-pin (Northwood C1)");
-    FMSQ(0, 15, 0, 2, 7, MC, "Intel Mobile Celeron (Northwood C1)");
-    FMSQ(0, 15, 0, 2, 7, MM, "Intel Mobile Pentium 4 Processor-M (Northwood C1)");
-    FMSQ(0, 15, 0, 2, 7, dP, "Intel Pentium 4 (Northwood C1)");
-    FMS(0, 15, 0, 2, 7, "Intel Pentium 4 (unknown type) (Northwood/Prestonia C1)");
-    FMSQ(0, 15, 0, 2, 9, sX, "Intel Xeon (Prestonia D1)");
-    FMSQ(0, 15, 0, 2, 9, dC, "Intel Celeron 478-pin (Northwood D1)");
-    FMSQ(0, 15, 0, 2, 9, MC, "Intel Mobile Celeron (Northwood D1)");
-    FMSQ(0, 15, 0, 2, 9, MM, "Intel Mobile Pentium 4 Processor-M (Northwood D1)");
-    FMSQ(0, 15, 0, 2, 9, MP, "Intel Mobile Pentium 4 (Northwood D1)");
-    FMSQ(0, 15, 0, 2, 9, dP, "Intel Pentium 4 (Northwood D1)");
-    FMS(0, 15, 0, 2, 9, "Intel Pentium 4 (unknown type) (Northwood/Prestonia D1)");
-    FMQ(0, 15, 0, 2, dP, "Intel Pentium 4 (Northwood)");
-    FMQ(0, 15, 0, 2, sM, "Intel Xeon MP (Gallatin)");
-    FMQ(0, 15, 0, 2, sX, "Intel Xeon (Prestonia)");
-    FM(0, 15, 0, 2, "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin)");
+    FMS(0, 15, 0, 2, 2, "Intel Xeon MP (Gallatin A0)"),
+    FMSQ(0, 15, 0, 2, 4, sX, "Intel Xeon (Prestonia B0)"),
+    FMSQ(0, 15, 0, 2, 4, MM, "Intel Mobile Pentium 4 Processor-M (Northwood B0)"),
+    FMSQ(0, 15, 0, 2, 4, MC, "Intel Mobile Celeron (Northwood B0)"),
+    FMSQ(0, 15, 0, 2, 4, dP, "Intel Pentium 4 (Northwood B0)"),
+    FMS(0, 15, 0, 2, 4, "Intel Pentium 4 (unknown type) (Northwood/Prestonia B0)"),
+    FMSQ(0, 15, 0, 2, 5, dP, "Intel Pentium 4 (Northwood B1/M0)"),
+    FMSQ(0, 15, 0, 2, 5, sM, "Intel Xeon MP (Gallatin B1)"),
+    FMSQ(0, 15, 0, 2, 5, sX, "Intel Xeon (Prestonia B1)"),
+};
+CHECK_SIGNATURES(synth_intel_part_6);
+
+// signature table of INTEL processors, part 7, see decode_synth_intel()
+static constexpr synth_row_t  synth_intel_part_7[] = {
+    FMS(0, 15, 0, 2, 5, "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin B1/M0)"),
+    FMS(0, 15, 0, 2, 6, "Intel Xeon MP (Gallatin C0)"),
+    FMSQ(0, 15, 0, 2, 7, sX, "Intel Xeon (Prestonia C1)"),
+    FMSQ(0, 15, 0, 2, 7, dC, "Intel Celeron 478-pin (Northwood C1)"),
+    FMSQ(0, 15, 0, 2, 7, MC, "Intel Mobile Celeron (Northwood C1)"),
+    FMSQ(0, 15, 0, 2, 7, MM, "Intel Mobile Pentium 4 Processor-M (Northwood C1)"),
+    FMSQ(0, 15, 0, 2, 7, dP, "Intel Pentium 4 (Northwood C1)"),
+    FMS(0, 15, 0, 2, 7, "Intel Pentium 4 (unknown type) (Northwood/Prestonia C1)"),
+    FMSQ(0, 15, 0, 2, 9, sX, "Intel Xeon (Prestonia D1)"),
+    FMSQ(0, 15, 0, 2, 9, dC, "Intel Celeron 478-pin (Northwood D1)"),
+    FMSQ(0, 15, 0, 2, 9, MC, "Intel Mobile Celeron (Northwood D1)"),
+    FMSQ(0, 15, 0, 2, 9, MM, "Intel Mobile Pentium 4 Processor-M (Northwood D1)"),
+    FMSQ(0, 15, 0, 2, 9, MP, "Intel Mobile Pentium 4 (Northwood D1)"),
+    FMSQ(0, 15, 0, 2, 9, dP, "Intel Pentium 4 (Northwood D1)"),
+    FMS(0, 15, 0, 2, 9, "Intel Pentium 4 (unknown type) (Northwood/Prestonia D1)"),
+    FMQ(0, 15, 0, 2, dP, "Intel Pentium 4 (Northwood)"),
+    FMQ(0, 15, 0, 2, sM, "Intel Xeon MP (Gallatin)"),
+    FMQ(0, 15, 0, 2, sX, "Intel Xeon (Prestonia)"),
+    FM(0, 15, 0, 2, "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin)"),
     // Intel docs (302352, 302402, 302403, 302441).
-    FMSQ(0, 15, 0, 3, 3, dP, "Intel Pentium 4 (Prescott C0)");
-    FMSQ(0, 15, 0, 3, 3, dC, "Intel Celeron D (Prescott C0)");
-    FMS(0, 15, 0, 3, 3, "Intel Pentium 4 (unknown type) (Prescott C0)");
-    FMSQ(0, 15, 0, 3, 4, sX, "Intel Xeon (Nocona D0)");
-    FMSQ(0, 15, 0, 3, 4, dC, "Intel Celeron D (Prescott D0)");
-    FMSQ(0, 15, 0, 3, 4, MP, "Intel Mobile Pentium 4 (Prescott D0)");
-    FMSQ(0, 15, 0, 3, 4, dP, "Intel Pentium 4 (Prescott D0)");
-    FMS(0, 15, 0, 3, 4, "Intel Pentium 4 (unknown type) (Prescott/Nocona D0)");
-    FMQ(0, 15, 0, 3, sX, "Intel Xeon (Nocona)");
-    FMQ(0, 15, 0, 3, dC, "Intel Celeron D (Prescott)");
-    FMQ(0, 15, 0, 3, MP, "Intel Mobile Pentium 4 (Prescott)");
-    FMQ(0, 15, 0, 3, dP, "Intel Pentium 4 (Prescott)");
-    FM(0, 15, 0, 3, "Intel Pentium 4 (unknown type) (Prescott/Nocona)");
+    FMSQ(0, 15, 0, 3, 3, dP, "Intel Pentium 4 (Prescott C0)"),
+    FMSQ(0, 15, 0, 3, 3, dC, "Intel Celeron D (Prescott C0)"),
+    FMS(0, 15, 0, 3, 3, "Intel Pentium 4 (unknown type) (Prescott C0)"),
+    FMSQ(0, 15, 0, 3, 4, sX, "Intel Xeon (Nocona D0)"),
+    FMSQ(0, 15, 0, 3, 4, dC, "Intel Celeron D (Prescott D0)"),
+    FMSQ(0, 15, 0, 3, 4, MP, "Intel Mobile Pentium 4 (Prescott D0)"),
+    FMSQ(0, 15, 0, 3, 4, dP, "Intel Pentium 4 (Prescott D0)"),
+    FMS(0, 15, 0, 3, 4, "Intel Pentium 4 (unknown type) (Prescott/Nocona D0)"),
+    FMQ(0, 15, 0, 3, sX, "Intel Xeon (Nocona)"),
+    FMQ(0, 15, 0, 3, dC, "Intel Celeron D (Prescott)"),
+    FMQ(0, 15, 0, 3, MP, "Intel Mobile Pentium 4 (Prescott)"),
+    FMQ(0, 15, 0, 3, dP, "Intel Pentium 4 (Prescott)"),
+    FM(0, 15, 0, 3, "Intel Pentium 4 (unknown type) (Prescott/Nocona)"),
     // Intel docs (302354, 306752, 306757, 306832, 309159, 309627).
-    FMSQ(0, 15, 0, 4, 1, sP, "Intel Xeon MP (Potomac C0)");
-    FMSQ(0, 15, 0, 4, 1, sM, "Intel Xeon MP (Cranford A0)");
-    FMSQ(0, 15, 0, 4, 1, sX, "Intel Xeon (Nocona E0)");
-    FMSQ(0, 15, 0, 4, 1, dC, "Intel Celeron D (Prescott E0)");
-    FMSQ(0, 15, 0, 4, 1, MP, "Intel Mobile Pentium 4 (Prescott E0)");
-    FMSQ(0, 15, 0, 4, 1, dP, "Intel Pentium 4 (Prescott E0)");
-    FMS(0, 15, 0, 4, 1, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Cranford/Potomac E0)");
-    FMSQ(0, 15, 0, 4, 3, sI, "Intel Xeon (Irwindale N0)");
-    FMSQ(0, 15, 0, 4, 3, sX, "Intel Xeon (Nocona N0)");
-    FMSQ(0, 15, 0, 4, 3, dP, "Intel Pentium 4 (Prescott N0)");
-    FMS(0, 15, 0, 4, 3, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale N0)");
-    FMSQ(0, 15, 0, 4, 4, dd, "Intel Pentium D Processor 8x0 (Smithfield A0)");
-    FMSQ(0, 15, 0, 4, 4, dG, "Intel Pentium Extreme Edition Processor 840 (Smithfield A0)");
-    FMS(0, 15, 0, 4, 4, "Intel Pentium D (unknown type) (Smithfield A0)");
-    FMSQ(0, 15, 0, 4, 7, dd, "Intel Pentium D Processor 8x0 (Smithfield B0)");
-    FMSQ(0, 15, 0, 4, 7, dG, "Pentium Extreme Edition Processor 840 (Smithfield B0)");
-    FMS(0, 15, 0, 4, 7, "Intel Pentium D (unknown type) (Smithfield B0)");
-    FMSQ(0, 15, 0, 4, 8, s7, "Intel Dual-Core Xeon Processor 7000 (Paxville A0)");
-    FMSQ(0, 15, 0, 4, 8, sX, "Intel Dual-Core Xeon (Paxville A0)");
-    FMS(0, 15, 0, 4, 8, "Intel Dual-Core Xeon (unknown type) (Paxville A0)");
-    FMSQ(0, 15, 0, 4, 9, sM, "Intel Xeon MP (Cranford B0)");
-    FMSQ(0, 15, 0, 4, 9, dC, "Intel Celeron D (Prescott G1)");
-    FMSQ(0, 15, 0, 4, 9, dP, "Intel Pentium 4 (Prescott G1)");
-    FMS(0, 15, 0, 4, 9, "Intel Pentium 4 (unknown type) (Prescott/Cranford G1)");
-    FMSQ(0, 15, 0, 4, 10, sI, "Intel Xeon (Irwindale R0)");
-    FMSQ(0, 15, 0, 4, 10, sX, "Intel Xeon (Nocona R0)");
-    FMSQ(0, 15, 0, 4, 10, dP, "Intel Pentium 4 (Prescott R0)");
-    FMS(0, 15, 0, 4, 10, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale R0)");
-    FMQ(0, 15, 0, 4, sM, "Intel Xeon MP (Nocona/Potomac)");
-    FMQ(0, 15, 0, 4, sX, "Intel Xeon (Nocona/Irwindale)");
-    FMQ(0, 15, 0, 4, dC, "Intel Celeron D (Prescott)");
-    FMQ(0, 15, 0, 4, MP, "Intel Mobile Pentium 4 (Prescott)");
-    FMQ(0, 15, 0, 4, dd, "Intel Pentium D (Smithfield A0)");
-    FMQ(0, 15, 0, 4, dP, "Intel Pentium 4 (Prescott) / Pentium Extreme Edition (Smithfield A0)");
-    FM(0, 15, 0, 4, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale/Smithfield/Cranford/Potomac)");
+    FMSQ(0, 15, 0, 4, 1, sP, "Intel Xeon MP (Potomac C0)"),
+    FMSQ(0, 15, 0, 4, 1, sM, "Intel Xeon MP (Cranford A0)"),
+    FMSQ(0, 15, 0, 4, 1, sX, "Intel Xeon (Nocona E0)"),
+    FMSQ(0, 15, 0, 4, 1, dC, "Intel Celeron D (Prescott E0)"),
+    FMSQ(0, 15, 0, 4, 1, MP, "Intel Mobile Pentium 4 (Prescott E0)"),
+    FMSQ(0, 15, 0, 4, 1, dP, "Intel Pentium 4 (Prescott E0)"),
+    FMS(0, 15, 0, 4, 1, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Cranford/Potomac E0)"),
+    FMSQ(0, 15, 0, 4, 3, sI, "Intel Xeon (Irwindale N0)"),
+    FMSQ(0, 15, 0, 4, 3, sX, "Intel Xeon (Nocona N0)"),
+    FMSQ(0, 15, 0, 4, 3, dP, "Intel Pentium 4 (Prescott N0)"),
+    FMS(0, 15, 0, 4, 3, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale N0)"),
+    FMSQ(0, 15, 0, 4, 4, dd, "Intel Pentium D Processor 8x0 (Smithfield A0)"),
+    FMSQ(0, 15, 0, 4, 4, dG, "Intel Pentium Extreme Edition Processor 840 (Smithfield A0)"),
+    FMS(0, 15, 0, 4, 4, "Intel Pentium D (unknown type) (Smithfield A0)"),
+    FMSQ(0, 15, 0, 4, 7, dd, "Intel Pentium D Processor 8x0 (Smithfield B0)"),
+    FMSQ(0, 15, 0, 4, 7, dG, "Pentium Extreme Edition Processor 840 (Smithfield B0)"),
+    FMS(0, 15, 0, 4, 7, "Intel Pentium D (unknown type) (Smithfield B0)"),
+    FMSQ(0, 15, 0, 4, 8, s7, "Intel Dual-Core Xeon Processor 7000 (Paxville A0)"),
+    FMSQ(0, 15, 0, 4, 8, sX, "Intel Dual-Core Xeon (Paxville A0)"),
+    FMS(0, 15, 0, 4, 8, "Intel Dual-Core Xeon (unknown type) (Paxville A0)"),
+    FMSQ(0, 15, 0, 4, 9, sM, "Intel Xeon MP (Cranford B0)"),
+    FMSQ(0, 15, 0, 4, 9, dC, "Intel Celeron D (Prescott G1)"),
+    FMSQ(0, 15, 0, 4, 9, dP, "Intel Pentium 4 (Prescott G1)"),
+    FMS(0, 15, 0, 4, 9, "Intel Pentium 4 (unknown type) (Prescott/Cranford G1)"),
+    FMSQ(0, 15, 0, 4, 10, sI, "Intel Xeon (Irwindale R0)"),
+    FMSQ(0, 15, 0, 4, 10, sX, "Intel Xeon (Nocona R0)"),
+    FMSQ(0, 15, 0, 4, 10, dP, "Intel Pentium 4 (Prescott R0)"),
+    FMS(0, 15, 0, 4, 10, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale R0)"),
+    FMQ(0, 15, 0, 4, sM, "Intel Xeon MP (Nocona/Potomac)"),
+    FMQ(0, 15, 0, 4, sX, "Intel Xeon (Nocona/Irwindale)"),
+    FMQ(0, 15, 0, 4, dC, "Intel Celeron D (Prescott)"),
+    FMQ(0, 15, 0, 4, MP, "Intel Mobile Pentium 4 (Prescott)"),
+    FMQ(0, 15, 0, 4, dd, "Intel Pentium D (Smithfield A0)"),
+    FMQ(0, 15, 0, 4, dP, "Intel Pentium 4 (Prescott) / Pentium Extreme Edition (Smithfield A0)"),
+    FM(0, 15, 0, 4, "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale/Smithfield/Cranford/Potomac)"),
     // Intel docs (310307, 310309, 311827, 313065, 314554).
-    FMSQ(0, 15, 0, 6, 2, dd, "Intel Pentium D Processor 9xx (Presler B1)");
-    FMSQ(0, 15, 0, 6, 2, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill B1) / Pentium Extreme Edition Processor 955 (Presler B1)");
-    FMS(0, 15, 0, 6, 2, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler B1)");
-    FMSQ(0, 15, 0, 6, 4, dd, "Intel Pentium D Processor 9xx (Presler C1)");
-    FMSQ(0, 15, 0, 6, 4, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill C1) / Pentium Extreme Edition Processor 955 (Presler C1)");
-    FMSQ(0, 15, 0, 6, 4, dC, "Intel Celeron D Processor 34x/35x (Cedar Mill C1)");
-    FMSQ(0, 15, 0, 6, 4, sX, "Intel Xeon Processor 5000 (Dempsey C1)");
-    FMS(0, 15, 0, 6, 4, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey C1)");
-    FMSQ(0, 15, 0, 6, 5, dC, "Intel Celeron D Processor 36x (Cedar Mill D0)");
-    FMSQ(0, 15, 0, 6, 5, dd, "Intel Pentium D Processor 9xx (Presler D0)");
-    FMSQ(0, 15, 0, 6, 5, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill D0) / Pentium Extreme Edition Processor 955 (Presler D0)");
-    FMS(0, 15, 0, 6, 5, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler D0)");
-    FMS(0, 15, 0, 6, 8, "Intel Xeon Processor 71x0 (Tulsa B0)");
-    FMQ(0, 15, 0, 6, dd, "Intel Pentium D (Presler)");
-    FMQ(0, 15, 0, 6, dP, "Intel Pentium 4 (Cedar Mill) / Pentium Extreme Edition (Presler)");
-    FMQ(0, 15, 0, 6, dC, "Intel Celeron D (Cedar Mill)");
-    FMQ(0, 15, 0, 6, sX, "Intel Xeon (Dempsey / Tulsa)");
-    FM(0, 15, 0, 6, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey/Tulsa)");
-    FQ(0, 15, sM, "Intel Xeon MP (unknown model)");
-    FQ(0, 15, sX, "Intel Xeon (unknown model)");
-    FQ(0, 15, MC, "Intel Mobile Celeron (unknown model)");
-    FQ(0, 15, MC, "Intel Mobile Pentium 4 (unknown model)");
-    FQ(0, 15, MM, "Intel Mobile Pentium 4 Processor-M (unknown model)");
-    FQ(0, 15, dC, "Intel Celeron (unknown model)");
-    FQ(0, 15, dd, "Intel Pentium D (unknown model)");
-    FQ(0, 15, dP, "Intel Pentium 4 (unknown model)");
-    FQ(0, 15, dc, "Intel Pentium (unknown model)");
-    F(0, 15, "Intel Pentium 4 / Pentium D / Xeon / Xeon MP / Celeron / Celeron D (unknown model)");
+    FMSQ(0, 15, 0, 6, 2, dd, "Intel Pentium D Processor 9xx (Presler B1)"),
+    FMSQ(0, 15, 0, 6, 2, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill B1) / Pentium Extreme Edition Processor 955 (Presler B1)"),
+    FMS(0, 15, 0, 6, 2, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler B1)"),
+    FMSQ(0, 15, 0, 6, 4, dd, "Intel Pentium D Processor 9xx (Presler C1)"),
+    FMSQ(0, 15, 0, 6, 4, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill C1) / Pentium Extreme Edition Processor 955 (Presler C1)"),
+    FMSQ(0, 15, 0, 6, 4, dC, "Intel Celeron D Processor 34x/35x (Cedar Mill C1)"),
+    FMSQ(0, 15, 0, 6, 4, sX, "Intel Xeon Processor 5000 (Dempsey C1)"),
+    FMS(0, 15, 0, 6, 4, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey C1)"),
+    FMSQ(0, 15, 0, 6, 5, dC, "Intel Celeron D Processor 36x (Cedar Mill D0)"),
+    FMSQ(0, 15, 0, 6, 5, dd, "Intel Pentium D Processor 9xx (Presler D0)"),
+    FMSQ(0, 15, 0, 6, 5, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill D0) / Pentium Extreme Edition Processor 955 (Presler D0)"),
+    FMS(0, 15, 0, 6, 5, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler D0)"),
+    FMS(0, 15, 0, 6, 8, "Intel Xeon Processor 71x0 (Tulsa B0)"),
+    FMQ(0, 15, 0, 6, dd, "Intel Pentium D (Presler)"),
+    FMQ(0, 15, 0, 6, dP, "Intel Pentium 4 (Cedar Mill) / Pentium Extreme Edition (Presler)"),
+    FMQ(0, 15, 0, 6, dC, "Intel Celeron D (Cedar Mill)"),
+    FMQ(0, 15, 0, 6, sX, "Intel Xeon (Dempsey / Tulsa)"),
+    FM(0, 15, 0, 6, "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey/Tulsa)"),
+    FQ(0, 15, sM, "Intel Xeon MP (unknown model)"),
+    FQ(0, 15, sX, "Intel Xeon (unknown model)"),
+    FQ(0, 15, MC, "Intel Mobile Celeron (unknown model)"),
+    FQ(0, 15, MP, "Intel Mobile Pentium 4 (unknown model)"),
+    FQ(0, 15, MM, "Intel Mobile Pentium 4 Processor-M (unknown model)"),
+    FQ(0, 15, dC, "Intel Celeron (unknown model)"),
+    FQ(0, 15, dd, "Intel Pentium D (unknown model)"),
+    FQ(0, 15, dP, "Intel Pentium 4 (unknown model)"),
+    FQ(0, 15, dc, "Intel Pentium (unknown model)"),
+    F(0, 15, "Intel Pentium 4 / Pentium D / Xeon / Xeon MP / Celeron / Celeron D (unknown model)"),
     // NOTE: Intel spec updates describe CPUID in Itanium Register 3 format:
     //    AAFFMMSSNN
     //    AA = archrev (not reported via CPUID instruction)
@@ -3796,892 +5227,828 @@ decode_synth_intel_part_7(unsigned int val,  /* val_1_eax */ const code_stash_t*
     //    SS = revision/stepping
     //    NN = number (not reported via CPUID instruction)
     // Intel docs (251141).
-    FMS(1, 15, 0, 0, 7, "Intel Itanium2 (McKinley B3)");
-    FM(1, 15, 0, 0, "Intel Itanium2 (McKinley)");
+    FMS(1, 15, 0, 0, 7, "Intel Itanium2 (McKinley B3)"),
+    FM(1, 15, 0, 0, "Intel Itanium2 (McKinley)"),
     // Intel docs (251141).
-    FMS(1, 15, 0, 1, 5, "Intel Itanium2 (Madison/Deerfield/Hondo B1)");
-    FM(1, 15, 0, 1, "Intel Itanium2 (Madison/Deerfield/Hondo)");
+    FMS(1, 15, 0, 1, 5, "Intel Itanium2 (Madison/Deerfield/Hondo B1)"),
+    FM(1, 15, 0, 1, "Intel Itanium2 (Madison/Deerfield/Hondo)"),
     // Intel docs (251141).
-    FMS(1, 15, 0, 2, 1, "Intel Itanium2 (Madison 9M/Fanwood A1)");
-    FMS(1, 15, 0, 2, 2, "Intel Itanium2 (Madison 9M/Fanwood A2)");
-    FM(1, 15, 0, 2, "Intel Itanium2 (Madison)");
-    F(1, 15, "Intel Itanium2 (unknown model)");
+    FMS(1, 15, 0, 2, 1, "Intel Itanium2 (Madison 9M/Fanwood A1)"),
+    FMS(1, 15, 0, 2, 2, "Intel Itanium2 (Madison 9M/Fanwood A2)"),
+    FM(1, 15, 0, 2, "Intel Itanium2 (Madison)"),
+    F(1, 15, "Intel Itanium2 (unknown model)"),
     // Intel docs (251141).
-    FMS(2, 0, 0, 0, 5, "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C1), 90nm");
-    FMS(2, 0, 0, 0, 7, "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C2), 90nm");
-    FM(2, 0, 0, 0, "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington), 90nm");
+    FMS(2, 0, 0, 0, 5, "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C1), 90nm"),
+    FMS(2, 0, 0, 0, 7, "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C2), 90nm"),
+    FM(2, 0, 0, 0, "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington), 90nm"),
     // Intel docs (251141).
-    FMS(2, 0, 0, 1, 1, "Intel Itanium2 Dual-Core Processor 9100 (Montvale A1), 90nm");
-    FM(2, 0, 0, 1, "Intel Itanium2 Dual-Core Processor 9100 (Montvale), 90nm");
+    FMS(2, 0, 0, 1, 1, "Intel Itanium2 Dual-Core Processor 9100 (Montvale A1), 90nm"),
+    FM(2, 0, 0, 1, "Intel Itanium2 Dual-Core Processor 9100 (Montvale), 90nm"),
     // Intel docs (323169).
-    FMS(2, 0, 0, 2, 4, "Intel Itanium2 Processor 9300 (Tukwila E0), 65nm");
-    FM(2, 0, 0, 2, "Intel Itanium2 Processor 9300 (Tukwila), 65nm");
-    F(2, 0, "Intel Itanium2 (unknown model)");
+    FMS(2, 0, 0, 2, 4, "Intel Itanium2 Processor 9300 (Tukwila E0), 65nm"),
+    FM(2, 0, 0, 2, "Intel Itanium2 Processor 9300 (Tukwila), 65nm"),
+    F(2, 0, "Intel Itanium2 (unknown model)"),
     // Intel docs (323169).
-    FMS(2, 1, 0, 0, 4, "Intel Itanium2 Processor 9500 (Poulson D0), 32nm");
-    FMS(2, 1, 0, 0, 5, "Intel Itanium2 Processor 9700 (Kittson E0), 22nm");
-    FM(2, 1, 0, 0, "Intel Itanium2 (unknown model) (Poulson/Kittson)");
-    F(2, 1, "Intel Itanium2 (unknown model)");
-    DEFAULT(NULL);
-
-    return result;
-}
+    FMS(2, 1, 0, 0, 4, "Intel Itanium2 Processor 9500 (Poulson D0), 32nm"),
+    FMS(2, 1, 0, 0, 5, "Intel Itanium2 Processor 9700 (Kittson E0), 22nm"),
+    FM(2, 1, 0, 0, "Intel Itanium2 (unknown model) (Poulson/Kittson)"),
+    F(2, 1, "Intel Itanium2 (unknown model)"),
+};
+CHECK_SIGNATURES(synth_intel_part_7);
 
 // return processor name string = f(val, stash), for INTEL
-// can refactor: use criteria descriptors instead if-else sequence by FM and similar macro
+// parts are looked up in order, as one table
 // val   = CPU TFMS signature
 // stash = pointer to structure for accumulate processor information
 static cstring
 decode_synth_intel(unsigned int val,  /* val_1_eax */ const code_stash_t* stash)
 {
-    cstring  result = NULL;
-
-    result = decode_synth_intel_part_1(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_intel_part_2(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_intel_part_3(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_intel_part_4(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_intel_part_5(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_intel_part_6(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_intel_part_7(val, stash);
-    if (result != NULL) return result;
-    return "unknown";
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// can refactor: use criteria descriptors instead if-else sequence by FM and similar macro
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_amd_part_1(unsigned int val, const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FM(0, 4, 0, 3, "AMD 80486DX2");
-    FM(0, 4, 0, 7, "AMD 80486DX2WB");
-    FM(0, 4, 0, 8, "AMD 80486DX4");
-    FM(0, 4, 0, 9, "AMD 80486DX4WB");
-    FM(0, 4, 0, 10, "AMD Elan SC400"); // sandpile.org
-    FM(0, 4, 0, 14, "AMD 5x86");
-    FM(0, 4, 0, 15, "AMD 5xWB");
-    F(0, 4, "AMD 80486 / 5x (unknown model)");
-    FM(0, 5, 0, 0, "AMD SSA5 (PR75, PR90, PR100)");
-    FM(0, 5, 0, 1, "AMD 5k86 (PR120, PR133)");
-    FM(0, 5, 0, 2, "AMD 5k86 (PR166)");
-    FM(0, 5, 0, 3, "AMD 5k86 (PR200)");
-    FM(0, 5, 0, 5, "AMD Geode GX");
-    FM(0, 5, 0, 6, "AMD K6");
-    FM(0, 5, 0, 7, "AMD K6 (Little Foot)");
-    FMS(0, 5, 0, 8, 0, "AMD K6-2 (Chomper A)");
-    FMS(0, 5, 0, 8, 12, "AMD K6-2 (Chomper A)");
-    FM(0, 5, 0, 8, "AMD K6-2 (Chomper)");
-    FMS(0, 5, 0, 9, 1, "AMD K6-III (Sharptooth B)");
-    FM(0, 5, 0, 9, "AMD K6-III (Sharptooth)");
-    FM(0, 5, 0, 10, "AMD Geode LX");
-    FM(0, 5, 0, 13, "AMD K6-2+, K6-III+");
-    F(0, 5, "AMD 5k86 / K6 / Geode (unknown model)");
-    FM(0, 6, 0, 1, "AMD Athlon (Argon)");
-    FM(0, 6, 0, 2, "AMD Athlon (K75 / Pluto / Orion)");
-    FMS(0, 6, 0, 3, 0, "AMD Duron / mobile Duron (Spitfire A0)");
-    FMS(0, 6, 0, 3, 1, "AMD Duron / mobile Duron (Spitfire A2)");
-    FM(0, 6, 0, 3, "AMD Duron / mobile Duron (Spitfire)");
-    FMS(0, 6, 0, 4, 2, "AMD Athlon (Thunderbird A4-A7)");
-    FMS(0, 6, 0, 4, 4, "AMD Athlon (Thunderbird A9)");
-    FM(0, 6, 0, 4, "AMD Athlon (Thunderbird)");
-    FMSQ(0, 6, 0, 6, 0, sA, "AMD Athlon MP (Palomino A0)");
-    FMSQ(0, 6, 0, 6, 0, dA, "AMD Athlon (Palomino A0)");
-    FMSQ(0, 6, 0, 6, 0, MA, "AMD mobile Athlon 4 (Palomino A0)");
-    FMSQ(0, 6, 0, 6, 0, sD, "AMD Duron MP (Palomino A0)");
-    FMSQ(0, 6, 0, 6, 0, MD, "AMD mobile Duron (Palomino A0)");
-    FMS(0, 6, 0, 6, 0, "AMD Athlon (unknown type)  (Palomino A0)");
-    FMSQ(0, 6, 0, 6, 1, sA, "AMD Athlon MP (Palomino A2)");
-    FMSQ(0, 6, 0, 6, 1, dA, "AMD Athlon (Palomino A2)");
-    FMSQ(0, 6, 0, 6, 1, MA, "AMD mobile Athlon 4 (Palomino A2)");
-    FMSQ(0, 6, 0, 6, 1, sD, "AMD Duron MP (Palomino A2)");
-    FMSQ(0, 6, 0, 6, 1, MD, "AMD mobile Duron (Palomino A2)");
-    FMSQ(0, 6, 0, 6, 1, dD, "AMD Duron (Palomino A2)");
-    FMS(0, 6, 0, 6, 1, "AMD Athlon (unknown type) (Palomino A2)");
-    FMSQ(0, 6, 0, 6, 2, sA, "AMD Athlon MP (Palomino A5)");
-    FMSQ(0, 6, 0, 6, 2, dX, "AMD Athlon XP (Palomino A5)");
-    FMSQ(0, 6, 0, 6, 2, MA, "AMD mobile Athlon 4 (Palomino A5)");
-    FMSQ(0, 6, 0, 6, 2, sD, "AMD Duron MP (Palomino A5)");
-    FMSQ(0, 6, 0, 6, 2, MD, "AMD mobile Duron (Palomino A5)");
-    FMSQ(0, 6, 0, 6, 2, dD, "AMD Duron (Palomino A5)");
-    FMS(0, 6, 0, 6, 2, "AMD Athlon (unknown type) (Palomino A5)");
-    FMQ(0, 6, 0, 6, MD, "AMD mobile Duron (Palomino)");
-    FMQ(0, 6, 0, 6, dD, "AMD Duron (Palomino)");
-    FMQ(0, 6, 0, 6, MA, "AMD mobile Athlon (Palomino)");
-    FMQ(0, 6, 0, 6, dX, "AMD Athlon XP (Palomino)");
-    FMQ(0, 6, 0, 6, dA, "AMD Athlon (Palomino)");
-    FM(0, 6, 0, 6, "AMD Athlon (unknown type) (Palomino)");
-    FMSQ(0, 6, 0, 7, 0, sD, "AMD Duron MP (Morgan A0)");
-    FMSQ(0, 6, 0, 7, 0, MD, "AMD mobile Duron (Morgan A0)");
-    FMSQ(0, 6, 0, 7, 0, dD, "AMD Duron (Morgan A0)");
-    FMS(0, 6, 0, 7, 0, "AMD Duron (unknown type)  (Morgan A0)");
-    FMSQ(0, 6, 0, 7, 1, sD, "AMD Duron MP (Morgan A1)");
-    FMSQ(0, 6, 0, 7, 1, MD, "AMD mobile Duron (Morgan A1)");
-    FMSQ(0, 6, 0, 7, 1, dD, "AMD Duron (Morgan A1)");
-    FMS(0, 6, 0, 7, 1, "AMD Duron (unknown type)  (Morgan A1)");
-    FMQ(0, 6, 0, 7, sD, "AMD Duron MP (Morgan)");
-    FMQ(0, 6, 0, 7, MD, "AMD mobile Duron (Morgan)");
-    FMQ(0, 6, 0, 7, dD, "AMD Duron (Morgan)");
-    FM(0, 6, 0, 7, "AMD Duron (unknown type)  (Morgan)");
-    FMSQ(0, 6, 0, 8, 0, dS, "AMD Sempron (Thoroughbred A0)");
-    FMSQ(0, 6, 0, 8, 0, sD, "AMD Duron MP (Applebred A0)");
-    FMSQ(0, 6, 0, 8, 0, dD, "AMD Duron (Applebred A0)");
-    FMSQ(0, 6, 0, 8, 0, MX, "AMD mobile Athlon XP (Thoroughbred A0)");
-    FMSQ(0, 6, 0, 8, 0, sA, "AMD Athlon MP (Thoroughbred A0)");
-    FMSQ(0, 6, 0, 8, 0, dX, "AMD Athlon XP (Thoroughbred A0)");
-    FMSQ(0, 6, 0, 8, 0, dA, "AMD Athlon (Thoroughbred A0)");
-    FMS(0, 6, 0, 8, 0, "AMD Athlon (unknown type) (Thoroughbred A0)");
-    FMSQ(0, 6, 0, 8, 1, MG, "AMD Geode NX (Thoroughbred B0)");
-    FMSQ(0, 6, 0, 8, 1, dS, "AMD Sempron (Thoroughbred B0)");
-    FMSQ(0, 6, 0, 8, 1, sD, "AMD Duron MP (Applebred B0)");
-    FMSQ(0, 6, 0, 8, 1, dD, "AMD Duron (Applebred B0)");
-    FMSQ(0, 6, 0, 8, 1, sA, "AMD Athlon MP (Thoroughbred B0)");
-    FMSQ(0, 6, 0, 8, 1, dX, "AMD Athlon XP (Thoroughbred B0)");
-    FMSQ(0, 6, 0, 8, 1, dA, "AMD Athlon (Thoroughbred B0)");
-    FMS(0, 6, 0, 8, 1, "AMD Athlon (unknown type) (Thoroughbred B0)");
-    FMQ(0, 6, 0, 8, MG, "AMD Geode NX (Thoroughbred)");
-    FMQ(0, 6, 0, 8, dS, "AMD Sempron (Thoroughbred)");
-    FMQ(0, 6, 0, 8, sD, "AMD Duron MP (Thoroughbred)");
-    FMQ(0, 6, 0, 8, dD, "AMD Duron (Thoroughbred)");
-    FMQ(0, 6, 0, 8, MX, "AMD mobile Athlon XP (Thoroughbred)");
-    FMQ(0, 6, 0, 8, sA, "AMD Athlon MP (Thoroughbred)");
-    FMQ(0, 6, 0, 8, dX, "AMD Athlon XP (Thoroughbred)");
-    FMQ(0, 6, 0, 8, dA, "AMD Athlon XP (Thoroughbred)");
-    FM(0, 6, 0, 8, "AMD Athlon (unknown type) (Thoroughbred)");
-    FMSQ(0, 6, 0, 10, 0, dS, "AMD Sempron (Barton A2)");
-    FMSQ(0, 6, 0, 10, 0, ML, "AMD mobile Athlon XP-M (LV) (Barton A2)");
-    FMSQ(0, 6, 0, 10, 0, MX, "AMD mobile Athlon XP-M (Barton A2)");
-    FMSQ(0, 6, 0, 10, 0, dt, "AMD Athlon XP (Thorton A2)");
-    FMSQ(0, 6, 0, 10, 0, sA, "AMD Athlon MP (Barton A2)");
-    FMSQ(0, 6, 0, 10, 0, dX, "AMD Athlon XP (Barton A2)");
-    FMS(0, 6, 0, 10, 0, "AMD Athlon (unknown type) (Barton A2)");
-    FMQ(0, 6, 0, 10, dS, "AMD Sempron (Barton)");
-    FMQ(0, 6, 0, 10, ML, "AMD mobile Athlon XP-M (LV) (Barton)");
-    FMQ(0, 6, 0, 10, MX, "AMD mobile Athlon XP-M (Barton)");
-    FMQ(0, 6, 0, 10, sA, "AMD Athlon MP (Barton)");
-    FMQ(0, 6, 0, 10, dX, "AMD Athlon XP (Barton)");
-    FM(0, 6, 0, 10, "AMD Athlon (unknown type) (Barton)");
-    F(0, 6, "AMD Athlon (unknown model)");
-    F(0, 7, "AMD Opteron (unknown model)");
-    FMS(0, 15, 0, 4, 0, "AMD Athlon 64 (SledgeHammer SH7-B0)");
-    FMSQ(0, 15, 0, 4, 8, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-C0)");
-    FMSQ(0, 15, 0, 4, 8, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-C0)");
-    FMSQ(0, 15, 0, 4, 8, dA, "AMD Athlon 64 (SledgeHammer SH7-C0)");
-    FMS(0, 15, 0, 4, 8, "AMD Athlon 64 (unknown type) (SledgeHammer SH7-C0)");
-    FMSQ(0, 15, 0, 4, 10, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-CG)");
-    FMSQ(0, 15, 0, 4, 10, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-CG)");
-    FMSQ(0, 15, 0, 4, 10, dA, "AMD Athlon 64 (SledgeHammer SH7-CG)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_amd_part_2(unsigned int val, const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FMS(0, 15, 0, 4, 10, "AMD Athlon 64 (unknown type) (SledgeHammer SH7-CG)");
-    FMQ(0, 15, 0, 4, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7)");
-    FMQ(0, 15, 0, 4, MA, "AMD mobile Athlon 64 (SledgeHammer SH7)");
-    FMQ(0, 15, 0, 4, dA, "AMD Athlon 64 (SledgeHammer SH7)");
-    FM(0, 15, 0, 4, "AMD Athlon 64 (unknown type) (SledgeHammer SH7)");
-    FMS(0, 15, 0, 5, 0, "AMD Opteron (DP SledgeHammer SH7-B0)");
-    FMS(0, 15, 0, 5, 1, "AMD Opteron (DP SledgeHammer SH7-B3)");
-    FMSQ(0, 15, 0, 5, 8, sO, "AMD Opteron (DP SledgeHammer SH7-C0)");
-    FMSQ(0, 15, 0, 5, 8, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-C0)");
-    FMS(0, 15, 0, 5, 8, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-C0)");
-    FMSQ(0, 15, 0, 5, 10, sO, "AMD Opteron (DP SledgeHammer SH7-CG)");
-    FMSQ(0, 15, 0, 5, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)");
-    FMS(0, 15, 0, 5, 10, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)");
-    FMQ(0, 15, 0, 5, sO, "AMD Opteron (SledgeHammer SH7)");
-    FMQ(0, 15, 0, 5, dF, "AMD Athlon 64 FX (SledgeHammer SH7)");
-    FM(0, 15, 0, 5, "AMD Athlon 64 (unknown type) (SledgeHammer SH7) FX");
-    FMSQ(0, 15, 0, 7, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)");
-    FMSQ(0, 15, 0, 7, 10, dA, "AMD Athlon 64 (DP SledgeHammer SH7-CG)");
-    FMS(0, 15, 0, 7, 10, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)");
-    FMQ(0, 15, 0, 7, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7)");
-    FMQ(0, 15, 0, 7, dA, "AMD Athlon 64 (DP SledgeHammer SH7)");
-    FM(0, 15, 0, 7, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7)");
-    FMSQ(0, 15, 0, 8, 2, MS, "AMD mobile Sempron (ClawHammer CH7-CG)");
-    FMSQ(0, 15, 0, 8, 2, MX, "AMD mobile Athlon XP-M (ClawHammer CH7-CG)");
-    FMSQ(0, 15, 0, 8, 2, MA, "AMD mobile Athlon 64 (Odessa CH7-CG)");
-    FMSQ(0, 15, 0, 8, 2, dA, "AMD Athlon 64 (ClawHammer CH7-CG)");
-    FMS(0, 15, 0, 8, 2, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7-CG)");
-    FMQ(0, 15, 0, 8, MS, "AMD mobile Sempron (Odessa CH7)");
-    FMQ(0, 15, 0, 8, MX, "AMD mobile Athlon XP-M (Odessa CH7)");
-    FMQ(0, 15, 0, 8, MA, "AMD mobile Athlon 64 (Odessa CH7)");
-    FMQ(0, 15, 0, 8, dA, "AMD Athlon 64 (ClawHammer CH7)");
-    FM(0, 15, 0, 8, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7)");
-    FMS(0, 15, 0, 11, 2, "AMD Athlon 64 (ClawHammer CH7-CG)");
-    FM(0, 15, 0, 11, "AMD Athlon 64 (ClawHammer CH7)");
-    FMSQ(0, 15, 0, 12, 0, MS, "AMD mobile Sempron (Dublin DH7-CG)");
-    FMSQ(0, 15, 0, 12, 0, dS, "AMD Sempron (Paris DH7-CG)");
-    FMSQ(0, 15, 0, 12, 0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)");
-    FMSQ(0, 15, 0, 12, 0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)");
-    FMSQ(0, 15, 0, 12, 0, dA, "AMD Athlon 64 (NewCastle DH7-CG)");
-    FMS(0, 15, 0, 12, 0, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)");
-    FMQ(0, 15, 0, 12, MS, "AMD mobile Sempron (Dublin DH7)");
-    FMQ(0, 15, 0, 12, dS, "AMD Sempron (Paris DH7)");
-    FMQ(0, 15, 0, 12, MX, "AMD mobile Athlon XP-M (NewCastle DH7)");
-    FMQ(0, 15, 0, 12, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)");
-    FMQ(0, 15, 0, 12, dA, "AMD Athlon 64 (NewCastle DH7)");
-    FM(0, 15, 0, 12, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)");
-    FMSQ(0, 15, 0, 14, 0, MS, "AMD mobile Sempron (Dublin DH7-CG)");
-    FMSQ(0, 15, 0, 14, 0, dS, "AMD Sempron (Paris DH7-CG)");
-    FMSQ(0, 15, 0, 14, 0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)");
-    FMSQ(0, 15, 0, 14, 0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)");
-    FMSQ(0, 15, 0, 14, 0, dA, "AMD Athlon 64 (NewCastle DH7-CG)");
-    FMS(0, 15, 0, 14, 0, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)");
-    FMQ(0, 15, 0, 14, dS, "AMD Sempron (Paris DH7)");
-    FMQ(0, 15, 0, 14, MS, "AMD mobile Sempron (Dublin DH7)");
-    FMQ(0, 15, 0, 14, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7)");
-    FMQ(0, 15, 0, 14, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)");
-    FMQ(0, 15, 0, 14, dA, "AMD Athlon 64 (NewCastle DH7)");
-    FM(0, 15, 0, 14, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)");
-    FMSQ(0, 15, 0, 15, 0, dS, "AMD Sempron (Paris DH7-CG)");
-    FMSQ(0, 15, 0, 15, 0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)");
-    FMSQ(0, 15, 0, 15, 0, dA, "AMD Athlon 64 (NewCastle DH7-CG)");
-    FMS(0, 15, 0, 15, 0, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7-CG)");
-    FMQ(0, 15, 0, 15, dS, "AMD Sempron (Paris DH7)");
-    FMQ(0, 15, 0, 15, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)");
-    FMQ(0, 15, 0, 15, dA, "AMD Athlon 64 (NewCastle DH7)");
-    FM(0, 15, 0, 15, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7)");
-    FMSQ(0, 15, 1, 4, 0, MX, "AMD mobile Athlon XP-M (Oakville SH7-D0)");
-    FMSQ(0, 15, 1, 4, 0, MA, "AMD mobile Athlon 64 (Oakville SH7-D0)");
-    FMSQ(0, 15, 1, 4, 0, dA, "AMD Athlon 64 (Winchester SH7-D0)");
-    FMS(0, 15, 1, 4, 0, "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7-D0)");
-    FMQ(0, 15, 1, 4, MX, "AMD mobile Athlon XP-M (Oakville SH7)");
-    FMQ(0, 15, 1, 4, MA, "AMD mobile Athlon 64 (Oakville SH7)");
-    FMQ(0, 15, 1, 4, dA, "AMD Athlon 64 (Winchester SH7)");
-    FM(0, 15, 1, 4, "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7)");
-    FMSQ(0, 15, 1, 5, 0, sO, "AMD Opteron (Winchester SH7-D0)");
-    FMSQ(0, 15, 1, 5, 0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)");
-    FMS(0, 15, 1, 5, 0, "AMD Athlon 64 (unknown type) (Winchester SH7-D0)");
-    FMQ(0, 15, 1, 5, sO, "AMD Opteron (Winchester SH7)");
-    FMQ(0, 15, 1, 5, dF, "AMD Athlon 64 FX (Winchester SH7)");
-    FM(0, 15, 1, 5, "AMD Athlon 64 (unknown type) (Winchester SH7)");
-    FMSQ(0, 15, 1, 7, 0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)");
-    FMSQ(0, 15, 1, 7, 0, dA, "AMD Athlon 64 (Winchester SH7-D0)");
-    FMS(0, 15, 1, 7, 0, "AMD Athlon 64 (unknown type) (Winchester SH7-D0)");
-    FMQ(0, 15, 1, 7, dF, "AMD Athlon 64 FX (Winchester SH7)");
-    FMQ(0, 15, 1, 7, dA, "AMD Athlon 64 (Winchester SH7)");
-    FM(0, 15, 1, 7, "AMD Athlon 64 (unknown type) (Winchester SH7)");
-    FMSQ(0, 15, 1, 8, 0, MS, "AMD mobile Sempron (Georgetown/Sonora CH-D0)");
-    FMSQ(0, 15, 1, 8, 0, MX, "AMD mobile Athlon XP-M (Oakville CH-D0)");
-    FMSQ(0, 15, 1, 8, 0, MA, "AMD mobile Athlon 64 (Oakville CH-D0)");
-    FMSQ(0, 15, 1, 8, 0, dA, "AMD Athlon 64 (Winchester CH-D0)");
-    FMS(0, 15, 1, 8, 0, "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH-D0)");
-    FMQ(0, 15, 1, 8, MS, "AMD mobile Sempron (Georgetown/Sonora CH)");
-    FMQ(0, 15, 1, 8, MX, "AMD mobile Athlon XP-M (Oakville CH)");
-    FMQ(0, 15, 1, 8, MA, "AMD mobile Athlon 64 (Oakville CH)");
-    FMQ(0, 15, 1, 8, dA, "AMD Athlon 64 (Winchester CH)");
-    FM(0, 15, 1, 8, "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH)");
-    FMS(0, 15, 1, 11, 0, "AMD Athlon 64 (Winchester CH-D0)");
-    FM(0, 15, 1, 11, "AMD Athlon 64 (Winchester CH)");
-    FMSQ(0, 15, 1, 12, 0, MS, "AMD mobile Sempron (Georgetown/Sonora DH8-D0)");
-    FMSQ(0, 15, 1, 12, 0, dS, "AMD Sempron (Palermo DH8-D0)");
-    FMSQ(0, 15, 1, 12, 0, MX, "AMD Athlon XP-M (Winchester DH8-D0)");
-    FMSQ(0, 15, 1, 12, 0, MA, "AMD mobile Athlon 64 (Oakville DH8-D0)");
-    FMSQ(0, 15, 1, 12, 0, dA, "AMD Athlon 64 (Winchester DH8-D0)");
-    FMS(0, 15, 1, 12, 0, "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora/Palermo DH8-D0)");
-    FMQ(0, 15, 1, 12, MS, "AMD mobile Sempron (Georgetown/Sonora DH8)");
-    FMQ(0, 15, 1, 12, dS, "AMD Sempron (Palermo DH8)");
-    FMQ(0, 15, 1, 12, MX, "AMD Athlon XP-M (Winchester DH8)");
-    FMQ(0, 15, 1, 12, MA, "AMD mobile Athlon 64 (Oakville DH8)");
-    FMQ(0, 15, 1, 12, dA, "AMD Athlon 64 (Winchester DH8)");
-    FM(0, 15, 1, 12, "AMD Athlon 64 (Winchester/Oakville/Georgetown/Sonora/Palermo DH8)");
-    FMSQ(0, 15, 1, 15, 0, dS, "AMD Sempron (Palermo DH8-D0)");
-    FMSQ(0, 15, 1, 15, 0, dA, "AMD Athlon 64 (Winchester DH8-D0)");
-    FMS(0, 15, 1, 15, 0, "AMD Athlon 64 (Winchester DH8-D0) / Sempron (Palermo DH8-D0)");
-    FMQ(0, 15, 1, 15, dS, "AMD Sempron (Palermo DH8)");
-    FMQ(0, 15, 1, 15, dA, "AMD Athlon 64 (Winchester DH8)");
-    FM(0, 15, 1, 15, "AMD Athlon 64 (unknown type) (Winchester/Palermo DH8)");
-    FMSQ(0, 15, 2, 1, 0, s8, "AMD Dual Core Opteron (Egypt JH-E1)");
-    FMSQ(0, 15, 2, 1, 0, sO, "AMD Dual Core Opteron (Italy JH-E1)");
-    FMS(0, 15, 2, 1, 0, "AMD Dual Core Opteron (Italy/Egypt JH-E1)");
-    FMSQ(0, 15, 2, 1, 2, s8, "AMD Dual Core Opteron (Egypt JH-E6)");
-    FMSQ(0, 15, 2, 1, 2, sO, "AMD Dual Core Opteron (Italy JH-E6)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_amd_part_3(unsigned int val, const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FMS(0, 15, 2, 1, 2, "AMD Dual Core Opteron (Italy/Egypt JH-E6)");
-    FMQ(0, 15, 2, 1, s8, "AMD Dual Core Opteron (Egypt JH)");
-    FMQ(0, 15, 2, 1, sO, "AMD Dual Core Opteron (Italy JH)");
-    FM(0, 15, 2, 1, "AMD Dual Core Opteron (Italy/Egypt JH)");
-    FMSQ(0, 15, 2, 3, 2, DO, "AMD Dual Core Opteron (Denmark JH-E6)");
-    FMSQ(0, 15, 2, 3, 2, dF, "AMD Athlon 64 FX (Toledo JH-E6)");
-    FMSQ(0, 15, 2, 3, 2, dm, "AMD Athlon 64 X2 (Manchester JH-E6)");
-    FMSQ(0, 15, 2, 3, 2, dA, "AMD Athlon 64 X2 (Toledo JH-E6)");
-    FMS(0, 15, 2, 3, 2, "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH-E6)");
-    FMQ(0, 15, 2, 3, sO, "AMD Dual Core Opteron (Denmark JH)");
-    FMQ(0, 15, 2, 3, dF, "AMD Athlon 64 FX (Toledo JH)");
-    FMQ(0, 15, 2, 3, dm, "AMD Athlon 64 X2 (Manchester JH)");
-    FMQ(0, 15, 2, 3, dA, "AMD Athlon 64 X2 (Toledo JH)");
-    FM(0, 15, 2, 3, "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH)");
-    FMSQ(0, 15, 2, 4, 2, MA, "AMD mobile Athlon 64 (Newark SH-E5)");
-    FMSQ(0, 15, 2, 4, 2, MT, "AMD mobile Turion (Lancaster/Richmond SH-E5)");
-    FMS(0, 15, 2, 4, 2, "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH-E5)");
-    FMQ(0, 15, 2, 4, MA, "AMD mobile Athlon 64 (Newark SH)");
-    FMQ(0, 15, 2, 4, MT, "AMD mobile Turion (Lancaster/Richmond SH)");
-    FM(0, 15, 2, 4, "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH)");
-    FMQ(0, 15, 2, 5, s8, "AMD Opteron (Athens SH-E4)");
-    FMQ(0, 15, 2, 5, sO, "AMD Opteron (Troy SH-E4)");
-    FM(0, 15, 2, 5, "AMD Opteron (Troy/Athens SH-E4)");
-    FMSQ(0, 15, 2, 7, 1, sO, "AMD Opteron (Venus SH-E4)");
-    FMSQ(0, 15, 2, 7, 1, dF, "AMD Athlon 64 FX (San Diego SH-E4)");
-    FMSQ(0, 15, 2, 7, 1, dA, "AMD Athlon 64 (San Diego SH-E4)");
-    FMS(0, 15, 2, 7, 1, "AMD Athlon 64 (unknown type) (Venus/San Diego SH-E4)");
-    FMQ(0, 15, 2, 7, sO, "AMD Opteron (San Diego SH)");
-    FMQ(0, 15, 2, 7, dF, "AMD Athlon 64 FX (San Diego SH)");
-    FMQ(0, 15, 2, 7, dA, "AMD Athlon 64 (San Diego SH)");
-    FM(0, 15, 2, 7, "AMD Athlon 64 (unknown type) (San Diego SH)");
-    FM(0, 15, 2, 11, "AMD Athlon 64 X2 (Manchester BH-E4)");
-    FMS(0, 15, 2, 12, 0, "AMD Sempron (Palermo DH-E3)");
-    FMSQ(0, 15, 2, 12, 2, MS, "AMD mobile Sempron (Albany/Roma DH-E6)");
-    FMSQ(0, 15, 2, 12, 2, dS, "AMD Sempron (Palermo DH-E6)");
-    FMSQ(0, 15, 2, 12, 2, dA, "AMD Athlon 64 (Venice DH-E6)");
-    FMS(0, 15, 2, 12, 2, "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH-E6)");
-    FMQ(0, 15, 2, 12, MS, "AMD mobile Sempron (Albany/Roma DH)");
-    FMQ(0, 15, 2, 12, dS, "AMD Sempron (Palermo DH)");
-    FMQ(0, 15, 2, 12, dA, "AMD Athlon 64 (Venice DH)");
-    FM(0, 15, 2, 12, "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH)");
-    FMSQ(0, 15, 2, 15, 0, dS, "AMD Sempron (Palermo DH-E3)");
-    FMSQ(0, 15, 2, 15, 0, dA, "AMD Athlon 64 (Venice DH-E3)");
-    FMS(0, 15, 2, 15, 0, "AMD Athlon 64 (Venice/Palermo DH-E3)");
-    FMSQ(0, 15, 2, 15, 2, dS, "AMD Sempron (Palermo DH-E6)");
-    FMSQ(0, 15, 2, 15, 2, dA, "AMD Athlon 64 (Venice DH-E6)");
-    FMS(0, 15, 2, 15, 2, "AMD Athlon 64 (Venice/Palermo DH-E6)");
-    FMQ(0, 15, 2, 15, dS, "AMD Sempron (Palermo DH)");
-    FMQ(0, 15, 2, 15, dA, "AMD Athlon 64 (Venice DH)");
-    FM(0, 15, 2, 15, "AMD Athlon 64 (Venice/Palermo DH)");
-    FMS(0, 15, 4, 1, 2, "AMD Dual-Core Opteron (Santa Rosa JH-F2)");
-    FMS(0, 15, 4, 1, 3, "AMD Dual-Core Opteron (Santa Rosa JH-F3)");
-    FM(0, 15, 4, 1, "AMD Dual-Core Opteron (Santa Rosa)");
-    FMSQ(0, 15, 4, 3, 2, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F2)");
-    FMSQ(0, 15, 4, 3, 2, sO, "AMD Opteron (Santa Rosa JH-F2)");
-    FMSQ(0, 15, 4, 3, 2, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F2)");
-    FMSQ(0, 15, 4, 3, 2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F2)");
-    FMS(0, 15, 4, 3, 2, "AMD Athlon 64 (unknown type) (Windsor JH-F2)");
-    FMSQ(0, 15, 4, 3, 3, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F3)");
-    FMSQ(0, 15, 4, 3, 3, sO, "AMD Opteron (Santa Rosa JH-F3)");
-    FMSQ(0, 15, 4, 3, 3, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)");
-    FMSQ(0, 15, 4, 3, 3, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F3)");
-    FMS(0, 15, 4, 3, 3, "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa JH-F3)");
-    FMQ(0, 15, 4, 3, DO, "AMD Dual-Core Opteron (Santa Rosa)");
-    FMQ(0, 15, 4, 3, sO, "AMD Opteron (Santa Rosa)");
-    FMQ(0, 15, 4, 3, dF, "AMD Athlon 64 FX Dual-Core (Windsor)");
-    FMQ(0, 15, 4, 3, dA, "AMD Athlon 64 X2 Dual-Core (Windsor)");
-    FM(0, 15, 4, 3, "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa)");
-    FMSQ(0, 15, 4, 8, 2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)");
-    FMSQ(0, 15, 4, 8, 2, Mt, "AMD Turion 64 X2 (Trinidad BH-F2)");
-    FMSQ(0, 15, 4, 8, 2, MT, "AMD Turion 64 X2 (Taylor BH-F2)");
-    FMS(0, 15, 4, 8, 2, "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad BH-F2)");
-    FMQ(0, 15, 4, 8, dA, "AMD Athlon 64 X2 Dual-Core (Windsor)");
-    FMQ(0, 15, 4, 8, Mt, "AMD Turion 64 X2 (Trinidad)");
-    FMQ(0, 15, 4, 8, MT, "AMD Turion 64 X2 (Taylor)");
-    FM(0, 15, 4, 8, "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad)");
-    FMS(0, 15, 4, 11, 2, "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)");
-    FM(0, 15, 4, 11, "AMD Athlon 64 X2 Dual-Core (Windsor)");
-    FMSQ(0, 15, 4, 12, 2, MS, "AMD mobile Sempron (Keene BH-F2)");
-    FMSQ(0, 15, 4, 12, 2, dS, "AMD Sempron (Manila BH-F2)");
-    FMSQ(0, 15, 4, 12, 2, Mt, "AMD Turion (Trinidad BH-F2)");
-    FMSQ(0, 15, 4, 12, 2, MT, "AMD Turion (Taylor BH-F2)");
-    FMSQ(0, 15, 4, 12, 2, dA, "AMD Athlon 64 (Orleans BH-F2)");
-    FMS(0, 15, 4, 12, 2, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad BH-F2)");
-    FMQ(0, 15, 4, 12, MS, "AMD mobile Sempron (Keene)");
-    FMQ(0, 15, 4, 12, dS, "AMD Sempron (Manila)");
-    FMQ(0, 15, 4, 12, Mt, "AMD Turion (Trinidad)");
-    FMQ(0, 15, 4, 12, MT, "AMD Turion (Taylor)");
-    FMQ(0, 15, 4, 12, dA, "AMD Athlon 64 (Orleans)");
-    FM(0, 15, 4, 12, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad)");
-    FMSQ(0, 15, 4, 15, 2, MS, "AMD mobile Sempron (Keene DH-F2)");
-    FMSQ(0, 15, 4, 15, 2, dS, "AMD Sempron (Manila DH-F2)");
-    FMSQ(0, 15, 4, 15, 2, dA, "AMD Athlon 64 (Orleans DH-F2)");
-    FMS(0, 15, 4, 15, 2, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)");
-    FMQ(0, 15, 4, 15, MS, "AMD mobile Sempron (Keene)");
-    FMQ(0, 15, 4, 15, dS, "AMD Sempron (Manila)");
-    FMQ(0, 15, 4, 15, dA, "AMD Athlon 64 (Orleans)");
-    FM(0, 15, 4, 15, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)");
-    FMS(0, 15, 5, 13, 3, "AMD Opteron (Santa Rosa JH-F3)");
-    FM(0, 15, 5, 13, "AMD Opteron (Santa Rosa)");
-    FMSQ(0, 15, 5, 15, 2, MS, "AMD mobile Sempron (Keene DH-F2)");
-    FMSQ(0, 15, 5, 15, 2, dS, "AMD Sempron (Manila DH-F2)");
-    FMSQ(0, 15, 5, 15, 2, dA, "AMD Athlon 64 (Orleans DH-F2)");
-    FMS(0, 15, 5, 15, 2, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)");
-    FMS(0, 15, 5, 15, 3, "AMD Athlon 64 (Orleans DH-F3)");
-    FMQ(0, 15, 5, 15, MS, "AMD mobile Sempron (Keene)");
-    FMQ(0, 15, 5, 15, dS, "AMD Sempron (Manila)");
-    FMQ(0, 15, 5, 15, dA, "AMD Athlon 64 (Orleans)");
-    FM(0, 15, 5, 15, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)");
-    FM(0, 15, 5, 15, "AMD Athlon 64 (Orleans)");
-    FMS(0, 15, 6, 8, 1, "AMD Turion 64 X2 (Tyler BH-G1)");
-    FMSQ(0, 15, 6, 8, 2, MT, "AMD Turion 64 X2 (Tyler BH-G2)");
-    FMSQ(0, 15, 6, 8, 2, dS, "AMD Sempron Dual-Core (Tyler BH-G2)");
-    FMS(0, 15, 6, 8, 2, "AMD Turion 64 (unknown type) (Tyler BH-G2)");
-    FMQ(0, 15, 6, 8, MT, "AMD Turion 64 X2 (Tyler)");
-    FMQ(0, 15, 6, 8, dS, "AMD Sempron Dual-Core (Tyler)");
-    FM(0, 15, 6, 8, "AMD Turion 64 (unknown type) (Tyler)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_amd_part_4(unsigned int val, const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FMSQ(0, 15, 6, 11, 1, dS, "AMD Sempron Dual-Core (Sparta BH-G1)");
-    FMSQ(0, 15, 6, 11, 1, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G1)");
-    FMS(0, 15, 6, 11, 1, "AMD Athlon 64 (unknown type) (Brisbane/Sparta BH-G1)");
-    FMSQ(0, 15, 6, 11, 2, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G2)");
-    FMSQ(0, 15, 6, 11, 2, Mn, "AMD Turion Neo X2 Dual-Core (Huron BH-G2)");
-    FMSQ(0, 15, 6, 11, 2, MN, "AMD Athlon Neo X2 (Huron BH-G2)");
-    FMS(0, 15, 6, 11, 2, "AMD Athlon 64 (unknown type) (Brisbane/Huron BH-G2)");
-    FMQ(0, 15, 6, 11, dS, "AMD Sempron Dual-Core (Sparta)");
-    FMQ(0, 15, 6, 11, Mn, "AMD Turion Neo X2 Dual-Core (Huron)");
-    FMQ(0, 15, 6, 11, MN, "AMD Athlon Neo X2 (Huron)");
-    FMQ(0, 15, 6, 11, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane)");
-    FM(0, 15, 6, 11, "AMD Athlon 64 (unknown type) (Brisbane/Sparta/Huron)");
-    FMSQ(0, 15, 6, 12, 2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-    FMSQ(0, 15, 6, 12, 2, dS, "AMD Sempron (Sparta DH-G2)");
-    FMSQ(0, 15, 6, 12, 2, dA, "AMD Athlon 64 (Lima DH-G2)");
-    FMS(0, 15, 6, 12, 2, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G2)");
-    FMQ(0, 15, 6, 12, MS, "AMD mobile Sempron (Sherman)");
-    FMQ(0, 15, 6, 12, dS, "AMD Sempron (Sparta)");
-    FMQ(0, 15, 6, 12, dA, "AMD Athlon 64 (Lima)");
-    FM(0, 15, 6, 12, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman)");
-    FMSQ(0, 15, 6, 15, 2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-    FMSQ(0, 15, 6, 15, 2, dS, "AMD Sempron (Sparta DH-G2)");
-    FMSQ(0, 15, 6, 15, 2, MN, "AMD Athlon Neo (Huron DH-G2)");
-    FMS(0, 15, 6, 15, 2, "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman DH-G2)");
-    FMQ(0, 15, 6, 15, MS, "AMD mobile Sempron (Sherman)");
-    FMQ(0, 15, 6, 15, dS, "AMD Sempron (Sparta)");
-    FMQ(0, 15, 6, 15, MN, "AMD Athlon Neo (Huron)");
-    FM(0, 15, 6, 15, "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman)");
-    FMSQ(0, 15, 7, 12, 2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-    FMSQ(0, 15, 7, 12, 2, dS, "AMD Sempron (Sparta DH-G2)");
-    FMSQ(0, 15, 7, 12, 2, dA, "AMD Athlon (Lima DH-G2)");
-    FMS(0, 15, 7, 12, 2, "AMD Athlon (unknown type) (Lima/Sparta/Sherman DH-G2)");
-    FMQ(0, 15, 7, 12, MS, "AMD mobile Sempron (Sherman)");
-    FMQ(0, 15, 7, 12, dS, "AMD Sempron (Sparta)");
-    FMQ(0, 15, 7, 12, dA, "AMD Athlon (Lima)");
-    FM(0, 15, 7, 12, "AMD Athlon (unknown type) (Lima/Sparta/Sherman)");
-    FMSQ(0, 15, 7, 15, 1, MS, "AMD mobile Sempron (Sherman DH-G1)");
-    FMSQ(0, 15, 7, 15, 1, dS, "AMD Sempron (Sparta DH-G1)");
-    FMSQ(0, 15, 7, 15, 1, dA, "AMD Athlon 64 (Lima DH-G1)");
-    FMS(0, 15, 7, 15, 1, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G1)");
-    FMSQ(0, 15, 7, 15, 2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-    FMSQ(0, 15, 7, 15, 2, dS, "AMD Sempron (Sparta DH-G2)");
-    FMSQ(0, 15, 7, 15, 2, MN, "AMD Athlon Neo (Huron DH-G2)");
-    FMSQ(0, 15, 7, 15, 2, dA, "AMD Athlon 64 (Lima DH-G2)");
-    FMS(0, 15, 7, 15, 2, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron DH-G2)");
-    FMQ(0, 15, 7, 15, MS, "AMD mobile Sempron (Sherman)");
-    FMQ(0, 15, 7, 15, dS, "AMD Sempron (Sparta)");
-    FMQ(0, 15, 7, 15, MN, "AMD Athlon Neo (Huron)");
-    FMQ(0, 15, 7, 15, dA, "AMD Athlon 64 (Lima)");
-    FM(0, 15, 7, 15, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron)");
-    FMS(0, 15, 12, 1, 3, "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)");
-    FM(0, 15, 12, 1, "AMD Athlon 64 FX Dual-Core (Windsor)");
-    F(0, 15, "AMD (unknown model)");
-    FMS(1, 15, 0, 0, 0, "AMD (unknown type) (Barcelona DR-A0)"); // sandpile.org
-    FMS(1, 15, 0, 0, 1, "AMD (unknown type) (Barcelona DR-A1)"); // sandpile.org
-    FMS(1, 15, 0, 0, 2, "AMD (unknown type) (Barcelona DR-A2)"); // sandpile.org
-    FMS(1, 15, 0, 2, 0, "AMD (unknown type) (Barcelona DR-B0)"); // sandpile.org
-    FMSQ(1, 15, 0, 2, 1, sO, "AMD Quad-Core Opteron (Barcelona DR-B1)");
-    FMS(1, 15, 0, 2, 1, "AMD (unknown type) (Barcelona DR-B1)");
-    FMSQ(1, 15, 0, 2, 2, EO, "AMD Embedded Opteron (Barcelona DR-B2)");
-    FMSQ(1, 15, 0, 2, 2, sO, "AMD Quad-Core Opteron (Barcelona DR-B2)");
-    FMSQ(1, 15, 0, 2, 2, Tp, "AMD Phenom Triple-Core (Toliman DR-B2)");
-    FMSQ(1, 15, 0, 2, 2, Qp, "AMD Phenom Quad-Core (Agena DR-B2)");
-    FMS(1, 15, 0, 2, 2, "AMD (unknown type) (Barcelona/Toliman/Agena DR-B2)");
-    FMSQ(1, 15, 0, 2, 3, EO, "AMD Embedded Opteron (Barcelona DR-B3)");
-    FMSQ(1, 15, 0, 2, 3, sO, "AMD Quad-Core Opteron (Barcelona DR-B3)");
-    FMSQ(1, 15, 0, 2, 3, Tp, "AMD Phenom Triple-Core (Toliman DR-B3)");
-    FMSQ(1, 15, 0, 2, 3, Qp, "AMD Phenom Quad-Core (Agena DR-B3)");
-    FMSQ(1, 15, 0, 2, 3, dA, "AMD Athlon Dual-Core (Kuma DR-B3)");
-    FMS(1, 15, 0, 2, 3, "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma DR-B3)");
-    FMS(1, 15, 0, 2, 10, "AMD Quad-Core Opteron (Barcelona DR-BA)");
-    FMQ(1, 15, 0, 2, EO, "AMD Embedded Opteron (Barcelona)");
-    FMQ(1, 15, 0, 2, sO, "AMD Quad-Core Opteron (Barcelona)");
-    FMQ(1, 15, 0, 2, Tp, "AMD Phenom Triple-Core (Toliman)");
-    FMQ(1, 15, 0, 2, Qp, "AMD Phenom Quad-Core (Agena)");
-    FMQ(1, 15, 0, 2, dA, "AMD Athlon Dual-Core (Kuma)");
-    FM(1, 15, 0, 2, "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma)");
-    FMS(1, 15, 0, 4, 0, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C0)"); // sandpile.org
-    FMS(1, 15, 0, 4, 1, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C1)"); // sandpile.org
-    FMSQ(1, 15, 0, 4, 2, EO, "AMD Embedded Opteron (Shanghai RB-C2)");
-    FMSQ(1, 15, 0, 4, 2, sO, "AMD Quad-Core Opteron (Shanghai RB-C2)");
-    FMSQ(1, 15, 0, 4, 2, dr, "AMD Athlon Dual-Core (Propus RB-C2)");
-    FMSQ(1, 15, 0, 4, 2, dA, "AMD Athlon Dual-Core (Regor RB-C2)");
-    FMSQ(1, 15, 0, 4, 2, Dp, "AMD Phenom II X2 (Callisto RB-C2)");
-    FMSQ(1, 15, 0, 4, 2, Tp, "AMD Phenom II X3 (Heka RB-C2)");
-    FMSQ(1, 15, 0, 4, 2, Qp, "AMD Phenom II X4 (Deneb RB-C2)");
-    FMS(1, 15, 0, 4, 2, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C2)");
-    FMSQ(1, 15, 0, 4, 3, Dp, "AMD Phenom II X2 (Callisto RB-C3)");
-    FMSQ(1, 15, 0, 4, 3, Tp, "AMD Phenom II X3 (Heka RB-C3)");
-    FMSQ(1, 15, 0, 4, 3, Qp, "AMD Phenom II X4 (Deneb RB-C3)");
-    FMS(1, 15, 0, 4, 3, "AMD Phenom II (unknown type) (Callisto/Heka/Deneb RB-C3)");
-    FMQ(1, 15, 0, 4, EO, "AMD Embedded Opteron (Shanghai)");
-    FMQ(1, 15, 0, 4, sO, "AMD Quad-Core Opteron (Shanghai)");
-    FMQ(1, 15, 0, 4, dr, "AMD Athlon Dual-Core (Propus)");
-    FMQ(1, 15, 0, 4, dA, "AMD Athlon Dual-Core (Regor)");
-    FMQ(1, 15, 0, 4, Dp, "AMD Phenom II X2 (Callisto)");
-    FMQ(1, 15, 0, 4, Tp, "AMD Phenom II X3 (Heka)");
-    FMQ(1, 15, 0, 4, Qp, "AMD Phenom II X4 (Deneb)");
-    FM(1, 15, 0, 4, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb)");
-    FMS(1, 15, 0, 5, 0, "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C0)"); // sandpile.org
-    FMS(1, 15, 0, 5, 1, "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C1)"); // sandpile.org
-    FMSQ(1, 15, 0, 5, 2, DA, "AMD Athlon II X2 (Regor BL-C2)");
-    FMSQ(1, 15, 0, 5, 2, TA, "AMD Athlon II X3 (Rana BL-C2)");
-    FMSQ(1, 15, 0, 5, 2, QA, "AMD Athlon II X4 (Propus BL-C2)");
-    FMS(1, 15, 0, 5, 2, "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C2)");
-    FMSQ(1, 15, 0, 5, 3, TA, "AMD Athlon II X3 (Rana BL-C3)");
-    FMSQ(1, 15, 0, 5, 3, QA, "AMD Athlon II X4 (Propus BL-C3)");
-    FMSQ(1, 15, 0, 5, 3, Tp, "AMD Phenom II Triple-Core (Heka BL-C3)");
-    FMSQ(1, 15, 0, 5, 3, Qp, "AMD Phenom II Quad-Core (Deneb BL-C3)");
-    FMS(1, 15, 0, 5, 3, "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb BL-C3)");
-    FMQ(1, 15, 0, 5, DA, "AMD Athlon II X2 (Regor)");
-    FMQ(1, 15, 0, 5, TA, "AMD Athlon II X3 (Rana)");
-    FMQ(1, 15, 0, 5, QA, "AMD Athlon II X4 (Propus)");
-    FMQ(1, 15, 0, 5, Tp, "AMD Phenom II Triple-Core (Heka)");
-    FMQ(1, 15, 0, 5, Qp, "AMD Phenom II Quad-Core (Deneb)");
-    FM(1, 15, 0, 5, "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb)");
-    FMS(1, 15, 0, 6, 0, "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C0)");
-    FMS(1, 15, 0, 6, 1, "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C1)");
-    DEFAULT(NULL);
-
-    return result;
-}
-
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_amd_part_5(unsigned int val, const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FMSQ(1, 15, 0, 6, 2, MS, "AMD Sempron Mobile (Sargas DA-C2)");
-    FMSQ(1, 15, 0, 6, 2, dS, "AMD Sempron II (Sargas DA-C2)");
-    FMSQ(1, 15, 0, 6, 2, MT, "AMD Turion II Dual-Core Mobile (Caspian DA-C2)");
-    FMSQ(1, 15, 0, 6, 2, MA, "AMD Athlon II Dual-Core Mobile (Regor DA-C2)");
-    FMSQ(1, 15, 0, 6, 2, DA, "AMD Athlon II X2 (Regor DA-C2)");
-    FMSQ(1, 15, 0, 6, 2, dA, "AMD Athlon II (Sargas DA-C2)");
-    FMS(1, 15, 0, 6, 2, "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C2)");
-    FMSQ(1, 15, 0, 6, 3, Ms, "AMD V-Series Mobile (Champlain DA-C3)");
-    FMSQ(1, 15, 0, 6, 3, DS, "AMD Sempron II X2 (Regor DA-C3)");
-    FMSQ(1, 15, 0, 6, 3, dS, "AMD Sempron II (Sargas DA-C3)");
-    FMSQ(1, 15, 0, 6, 3, MT, "AMD Turion II Dual-Core Mobile (Champlain DA-C3)");
-    FMSQ(1, 15, 0, 6, 3, Mp, "AMD Phenom II Dual-Core Mobile (Champlain DA-C3)");
-    FMSQ(1, 15, 0, 6, 3, MA, "AMD Athlon II Dual-Core Mobile (Champlain DA-C3)");
-    FMSQ(1, 15, 0, 6, 3, DA, "AMD Athlon II X2 (Regor DA-C3)");
-    FMSQ(1, 15, 0, 6, 3, dA, "AMD Athlon II (Sargas DA-C3)");
-    FMS(1, 15, 0, 6, 3, "AMD Athlon (unknown type) (Regor/Sargas/Champlain DA-C3)");
-    FMQ(1, 15, 0, 6, Ms, "AMD V-Series Mobile (Champlain)");
-    FMQ(1, 15, 0, 6, MS, "AMD Sempron Mobile (Sargas)");
-    FMQ(1, 15, 0, 6, DS, "AMD Sempron II X2 (Regor)");
-    FMQ(1, 15, 0, 6, dS, "AMD Sempron II (Sargas)");
-    FMQ(1, 15, 0, 6, MT, "AMD Turion II Dual-Core Mobile (Caspian / Champlain)");
-    FMQ(1, 15, 0, 6, Mp, "AMD Phenom II Dual-Core Mobile (Champlain)");
-    FMQ(1, 15, 0, 6, MA, "AMD Athlon II Dual-Core Mobile (Regor / Champlain)");
-    FMQ(1, 15, 0, 6, DA, "AMD Athlon II X2 (Regor)");
-    FMQ(1, 15, 0, 6, dA, "AMD Athlon II (Sargas)");
-    FM(1, 15, 0, 6, "AMD Athlon (unknown type) (Regor/Sargas/Caspian/Champlain)");
-    FMSQ(1, 15, 0, 8, 0, SO, "AMD Six-Core Opteron (Istanbul HY-D0)");
-    FMSQ(1, 15, 0, 8, 0, sO, "AMD Opteron 4100 (Lisbon HY-D0)");
-    FMS(1, 15, 0, 8, 0, "AMD Opteron (unknown type) (Lisbon/Istanbul HY-D0)");
-    FMS(1, 15, 0, 8, 1, "AMD Opteron 4100 (Lisbon HY-D1)");
-    FMQ(1, 15, 0, 8, SO, "AMD Six-Core Opteron (Istanbul)");
-    FMQ(1, 15, 0, 8, sO, "AMD Opteron 4100 (Lisbon)");
-    FM(1, 15, 0, 8, "AMD Opteron (unknown type) (Lisbon/Istanbul)");
-    FMS(1, 15, 0, 9, 0, "AMD Opteron 6100 (Magny-Cours HY-D0)"); // sandpile.org
-    FMS(1, 15, 0, 9, 1, "AMD Opteron 6100 (Magny-Cours HY-D1)");
-    FM(1, 15, 0, 9, "AMD Opteron 6100 (Magny-Cours)");
-    FMSQ(1, 15, 0, 10, 0, Qp, "AMD Phenom II X4 (Zosma PH-E0)");
-    FMSQ(1, 15, 0, 10, 0, Sp, "AMD Phenom II X6 (Thuban PH-E0)");
-    FMS(1, 15, 0, 10, 0, "AMD Phenom II (unknown type) (Zosma/Thuban PH-E0)");
-    FMQ(1, 15, 0, 10, Qp, "AMD Phenom II X4 (Zosma)");
-    FMQ(1, 15, 0, 10, Sp, "AMD Phenom II X6 (Thuban)");
-    FM(1, 15, 0, 10, "AMD Phenom II (unknown type) (Zosma/Thuban)");
-    F(1, 15, "AMD (unknown model)");
-    FMSQ(2, 15, 0, 3, 1, MU, "AMD Turion X2 Ultra Dual-Core Mobile (Griffin LG-B1)");
-    FMSQ(2, 15, 0, 3, 1, MT, "AMD Turion X2 Dual-Core Mobile (Lion LG-B1)");
-    FMSQ(2, 15, 0, 3, 1, DS, "AMD Sempron X2 Dual-Core (Sable LG-B1)");
-    FMSQ(2, 15, 0, 3, 1, dS, "AMD Sempron (Sable LG-B1)");
-    FMSQ(2, 15, 0, 3, 1, DA, "AMD Athlon X2 Dual-Core (Lion LG-B1)");
-    FMSQ(2, 15, 0, 3, 1, dA, "AMD Athlon (Lion LG-B1)");
-    FMS(2, 15, 0, 3, 1, "AMD Athlon (unknown type) (Lion/Sable LG-B1)");
-    FMQ(2, 15, 0, 3, MU, "AMD Turion X2 Ultra (Griffin)");
-    FMQ(2, 15, 0, 3, MT, "AMD Turion X2 (Lion)");
-    FMQ(2, 15, 0, 3, DS, "AMD Sempron X2 Dual-Core (Sable)");
-    FMQ(2, 15, 0, 3, dS, "AMD Sempron (Sable)");
-    FMQ(2, 15, 0, 3, DA, "AMD Athlon X2 Dual-Core (Lion)");
-    FMQ(2, 15, 0, 3, dA, "AMD Athlon (Lion)");
-    FM(2, 15, 0, 3, "AMD Athlon (unknown type) (Lion/Sable)");
-    F(2, 15, "AMD (unknown model)");
-    FMS(3, 15, 0, 0, 0, "AMD Athlon (unknown type) (Llano LN-A0)"); // sandpile.org
-    FMS(3, 15, 0, 0, 1, "AMD Athlon (unknown type) (Llano LN-A1)"); // sandpile.org
-    FMSQ(3, 15, 0, 1, 0, dS, "AMD Sempron Dual-Core (Llano LN-B0)");
-    FMSQ(3, 15, 0, 1, 0, dA, "AMD Athlon II Dual-Core (Llano LN-B0)");
-    FMSQ(3, 15, 0, 1, 0, Sa, "AMD A-Series (Llano LN-B0)");
-    FMSQ(3, 15, 0, 1, 0, Se, "AMD E2-Series (Llano LN-B0)");
-    FMS(3, 15, 0, 1, 0, "AMD Athlon (unknown type) (Llano LN-B0)");
-    FMQ(3, 15, 0, 1, dS, "AMD Sempron Dual-Core (Llano)");
-    FMQ(3, 15, 0, 1, dA, "AMD Athlon II Dual-Core (Llano)");
-    FMQ(3, 15, 0, 1, Sa, "AMD A-Series (Llano)");
-    FMQ(3, 15, 0, 1, Se, "AMD E2-Series (Llano)");
-    FM(3, 15, 0, 1, "AMD Athlon (unknown type) (Llano)");
-    FMS(3, 15, 0, 2, 0, "AMD Athlon (unknown type) (Llano LN-B0)"); // sandpile.org
-    F(3, 15, "AMD (unknown model) (Llano)");
-    FMSQ(5, 15, 0, 1, 0, Sc, "AMD C-Series (Ontario ON-B0)");
-    FMSQ(5, 15, 0, 1, 0, Se, "AMD E-Series (Zacate ON-B0)");
-    FMSQ(5, 15, 0, 1, 0, Sg, "AMD G-Series (Ontario/Zacate ON-B0)");
-    FMSQ(5, 15, 0, 1, 0, Sz, "AMD Z-Series (Desna ON-B0)");
-    FMS(5, 15, 0, 1, 0, "AMD (unknown type) (Ontario/Zacate/Desna ON-B0)");
-    FM(5, 15, 0, 1, "AMD (unknown type) (Ontario/Zacate/Desna)");
-    FMSQ(5, 15, 0, 2, 0, Sc, "AMD C-Series (Ontario ON-C0)");
-    FMSQ(5, 15, 0, 2, 0, Se, "AMD E-Series (Zacate ON-C0)");
-    FMSQ(5, 15, 0, 2, 0, Sg, "AMD G-Series (Ontario/Zacate ON-C0)");
-    FMSQ(5, 15, 0, 2, 0, Sz, "AMD Z-Series (Desna ON-C0)");
-    FMS(5, 15, 0, 2, 0, "AMD (unknown type) (Ontario/Zacate/Desna ON-C0)");
-    FM(5, 15, 0, 2, "AMD (unknown type) (Ontario/Zacate/Desna)");
-    F(5, 15, "AMD (unknown model)");
-    FMS(6, 15, 0, 0, 0, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A0)"); // sandpile.org
-    FMS(6, 15, 0, 0, 1, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A1)"); // sandpile.org
-    FMS(6, 15, 0, 1, 0, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B0)"); // sandpile.org
-    FMS(6, 15, 0, 1, 1, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B1)"); // sandpile.org
-    FMSQ(6, 15, 0, 1, 2, sO, "AMD Opteron 6200 (Interlagos OR-B2) / Opteron 4200 (Valencia OR-B2) / Opteron 3200 (Zurich OR-B2)");
-    FMSQ(6, 15, 0, 1, 2, df, "AMD FX-Series (Zambezi OR-B2)");
-    FMS(6, 15, 0, 1, 2, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B2)");
-    FMQ(6, 15, 0, 1, sO, "AMD Opteron 6200 (Interlagos) / Opteron 4200 (Valencia) / Opteron 3200 (Zurich)");
-    FMQ(6, 15, 0, 1, df, "AMD FX-Series (Zambezi)");
-    FM(6, 15, 0, 1, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi)");
-    FMSQ(6, 15, 0, 2, 0, sO, "AMD Opteron 6300 (Abu Dhabi OR-C0) / Opteron 4300 (Seoul OR-C0) / Opteron 3300 (Delhi OR-C0)");
-    FMSQ(6, 15, 0, 2, 0, df, "AMD FX-Series (Vishera OR-C0)");
-    FMS(6, 15, 0, 2, 0, "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera OR-C0)");
-    FMQ(6, 15, 0, 2, sO, "AMD Opteron 6300 (Abu Dhabi) / Opteron 4300 (Seoul) / Opteron 3300 (Delhi)");
-    FMQ(6, 15, 0, 2, df, "AMD FX-Series (Vishera)");
-    FM(6, 15, 0, 2, "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera)");
-    FMSQ(6, 15, 1, 0, 1, Sa, "AMD A-Series (Trinity TN-A1)");
-    FMSQ(6, 15, 1, 0, 1, Sr, "AMD R-Series (Trinity TN-A1)");
-    FMSQ(6, 15, 1, 0, 1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity TN-A1)");
-    FMSQ(6, 15, 1, 0, 1, dS, "AMD Sempron Dual-Core (Trinity TN-A1)");
-    FMSQ(6, 15, 1, 0, 1, dI, "AMD FirePro (Trinity TN-A1)");
-    FMS(6, 15, 1, 0, 1, "AMD (unknown type) (Trinity TN-A1)");
-    FMQ(6, 15, 1, 0, Sa, "AMD A-Series (Trinity)");
-    FMQ(6, 15, 1, 0, Sr, "AMD R-Series (Trinity)");
-    FMQ(6, 15, 1, 0, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity)");
-    FMQ(6, 15, 1, 0, dS, "AMD Sempron Dual-Core (Trinity)");
-    FMQ(6, 15, 1, 0, dI, "AMD FirePro (Trinity)");
-    FM(6, 15, 1, 0, "AMD (unknown type) (Trinity TN-A1)");
-    FMSQ(6, 15, 1, 3, 1, Sa, "AMD A-Series (Richland RL-A1)");
-    FMSQ(6, 15, 1, 3, 1, Sr, "AMD R-Series (Richland RL-A1)");
-    FMSQ(6, 15, 1, 3, 1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland RL-A1)");
-    FMSQ(6, 15, 1, 3, 1, dS, "AMD Sempron Dual-Core (Richland RL-A1)");
-    FMSQ(6, 15, 1, 3, 1, dI, "AMD FirePro (Richland RL-A1)");
-    FMS(6, 15, 1, 3, 1, "AMD (unknown type) (Richland RL-A1)");
-    DEFAULT(NULL);
+    static const signature_table_t  tables[] = {
+        SIGNATURE_TABLE(synth_intel_part_1),
+        SIGNATURE_TABLE(synth_intel_part_2),
+        SIGNATURE_TABLE(synth_intel_part_3),
+        SIGNATURE_TABLE(synth_intel_part_4),
+        SIGNATURE_TABLE(synth_intel_part_5),
+        SIGNATURE_TABLE(synth_intel_part_6),
+        SIGNATURE_TABLE(synth_intel_part_7),
+    };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
+    cstring                         result = lookup_synth(&index, val, stash);
 
-    return result;
+    return (result != NULL) ? result : "unknown";
 }
 
-// helper procedure, part of CPU signature detection for return CPU name string
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_amd_part_6(unsigned int val, const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FMQ(6, 15, 1, 3, Sa, "AMD A-Series (Richland)");
-    FMQ(6, 15, 1, 3, Sr, "AMD R-Series (Richland)");
-    FMQ(6, 15, 1, 3, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland)");
-    FMQ(6, 15, 1, 3, dS, "AMD Sempron Dual-Core (Richland)");
-    FMQ(6, 15, 1, 3, dI, "AMD FirePro (Richland)");
-    FM(6, 15, 1, 3, "AMD (unknown type) (Richland)");
-    FMS(6, 15, 3, 0, 0, "AMD (unknown type) (Kaveri KV-A0)");
-    FMSQ(6, 15, 3, 0, 1, Sa, "AMD Elite Performance A-Series (Kaveri KV-A1)");
-    FMSQ(6, 15, 3, 0, 1, Mr, "AMD Mobile R-Series (Kaveri KV-A1)");
-    FMSQ(6, 15, 3, 0, 1, sO, "AMD Opteron X1200 / X2200 (Kaveri KV-A1)");
-    FMS(6, 15, 3, 0, 1, "AMD (unknown type) (Kaveri KV-A1)");
-    FMQ(6, 15, 3, 0, Sa, "AMD Elite Performance A-Series (Kaveri)");
-    FMQ(6, 15, 3, 0, Mr, "AMD Mobile R-Series (Kaveri)");
-    FMQ(6, 15, 3, 0, sO, "AMD Opteron X1200 / X2200 (Kaveri)");
-    FM(6, 15, 3, 0, "AMD (unknown type) (Kaveri)");
-    FMSQ(6, 15, 3, 8, 1, Sa, "AMD A-Series (Godavari A1)"); // sandpile.org
-    FMS(6, 15, 3, 8, 1, "AMD (unknown type) (Godavari A1)"); // sandpile.org
-    FMQ(6, 15, 3, 8, Sa, "AMD A-Series (Godavari)");
-    FM(6, 15, 3, 8, "AMD (unknown type) (Godavari)");
-    FMS(6, 15, 6, 0, 0, "AMD (unknown type) (Carrizo/Toronto CZ-A0)"); // sandpile.org
-    FMSQ(6, 15, 6, 0, 1, sO, "AMD Opteron (Toronto CZ-A1)"); // undocumented, but instlatx64 sample
-    FMSQ(6, 15, 6, 0, 1, df, "AMD FX-Series (Carrizo CZ-A1)"); // undocumented, but instlatx64 sample
-    FMS(6, 15, 6, 0, 1, "AMD (unknown type) (Carrizo/Toronto CZ-A1)"); // undocumented, but instlatx64 sample
-    FMQ(6, 15, 6, 0, sO, "AMD Opteron (Toronto)"); // undocumented, but instlatx64 sample
-    FMQ(6, 15, 6, 0, df, "AMD FX-Series (Carrizo)"); // undocumented, but instlatx64 sample
-    FM(6, 15, 6, 0, "AMD (unknown type) (Carrizo/Toronto)"); // undocumented, but instlatx64 sample
-    FMSQ(6, 15, 6, 5, 1, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge CZ-A1/BR-A1)"); // undocumented, but samples from Alexandros Couloumbis & instlatx64; sandpile.org stepping
-    FMSQ(6, 15, 6, 5, 1, Se, "AMD E-Series (Stoney Ridge CZ-A1/BR-A1)"); // undocumented; sandpile.org stepping
-    FMSQ(6, 15, 6, 5, 1, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon CZ-A1/BR-A1)"); // undocumented; sandpile.org stepping
-    FMSQ(6, 15, 6, 5, 1, Sr, "AMD R-Series (Merlin Falcon CZ-A1/BR-A1)"); // undocumented; sandpile.org stepping
-    FMS(6, 15, 6, 5, 1, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon CZ-A1/BR-A1)"); // sandpile.org
-    FMQ(6, 15, 6, 5, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)"); // undocumented, but samples from Alexandros Couloumbis & instlatx64
-    FMQ(6, 15, 6, 5, Se, "AMD E-Series (Stoney Ridge)"); // undocumented
-    FMQ(6, 15, 6, 5, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)"); // undocumented
-    FMQ(6, 15, 6, 5, Sr, "AMD R-Series (Merlin Falcon)"); // undocumented
-    FM(6, 15, 6, 5, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)"); // undocumented, but sample from Alexandros Couloumbis
-    FMSQ(6, 15, 7, 0, 0, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge ST-A0)");
-    FMSQ(6, 15, 7, 0, 0, Se, "AMD E-Series (Stoney Ridge ST-A0)");
-    FMSQ(6, 15, 7, 0, 0, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon ST-A0)");
-    FMSQ(6, 15, 7, 0, 0, Sr, "AMD R-Series (Merlin Falcon ST-A0)");
-    FMS(6, 15, 7, 0, 0, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon ST-A0)");
-    FMQ(6, 15, 7, 0, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)");
-    FMQ(6, 15, 7, 0, Se, "AMD E-Series (Stoney Ridge)");
-    FMQ(6, 15, 7, 0, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)");
-    FMQ(6, 15, 7, 0, Sr, "AMD R-Series (Merlin Falcon)");
-    FM(6, 15, 7, 0, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)");
-    F(6, 15, "AMD (unknown model)");
-    FMS(7, 15, 0, 0, 0, "AMD (unknown type) (Kabini/Temash/Kyoto KB-A0)"); // sandpile.org
-    FMSQ(7, 15, 0, 0, 1, dA, "AMD Athlon (Kabini KB-A1)");
-    FMSQ(7, 15, 0, 0, 1, Sa, "AMD A-Series (Kabini/Temash KB-A1)");
-    FMSQ(7, 15, 0, 0, 1, Se, "AMD E-Series (Kabini KB-A1)");
-    FMSQ(7, 15, 0, 0, 1, Sg, "AMD G-Series (Kabini KB-A1)");
-    FMSQ(7, 15, 0, 0, 1, sO, "AMD Opteron X1100/X2100 Series (Kyoto KB-A1)");
-    FMS(7, 15, 0, 0, 1, "AMD (unknown type) (Kabini/Temash/Kyoto KB-A1)");
-    FMQ(7, 15, 0, 0, dA, "AMD Athlon (Kabini)");
-    FMQ(7, 15, 0, 0, Sa, "AMD A-Series (Kabini/Temash)");
-    FMQ(7, 15, 0, 0, Se, "AMD E-Series (Kabini)");
-    FMQ(7, 15, 0, 0, Sg, "AMD G-Series (Kabini)");
-    FMQ(7, 15, 0, 0, sO, "AMD Opteron X1100/X2100 Series (Kyoto)");
-    FM(7, 15, 0, 0, "AMD (unknown type) (Kabini/Temash/Kyoto)");
-    FM(7, 15, 2, 6, "AMD (unknown type) (Cato)"); // undocumented; instlatx64 sample; engr sample?
+// signature table of AMD processors, part 1, see decode_synth_amd_helper()
+static constexpr synth_row_t  synth_amd_part_1[] = {
+    FM(0, 4, 0, 3, "AMD 80486DX2"),
+    FM(0, 4, 0, 7, "AMD 80486DX2WB"),
+    FM(0, 4, 0, 8, "AMD 80486DX4"),
+    FM(0, 4, 0, 9, "AMD 80486DX4WB"),
+    FM(0, 4, 0, 10, "AMD Elan SC400"), // sandpile.org
+    FM(0, 4, 0, 14, "AMD 5x86"),
+    FM(0, 4, 0, 15, "AMD 5xWB"),
+    F(0, 4, "AMD 80486 / 5x (unknown model)"),
+    FM(0, 5, 0, 0, "AMD SSA5 (PR75, PR90, PR100)"),
+    FM(0, 5, 0, 1, "AMD 5k86 (PR120, PR133)"),
+    FM(0, 5, 0, 2, "AMD 5k86 (PR166)"),
+    FM(0, 5, 0, 3, "AMD 5k86 (PR200)"),
+    FM(0, 5, 0, 5, "AMD Geode GX"),
+    FM(0, 5, 0, 6, "AMD K6"),
+    FM(0, 5, 0, 7, "AMD K6 (Little Foot)"),
+    FMS(0, 5, 0, 8, 0, "AMD K6-2 (Chomper A)"),
+    FMS(0, 5, 0, 8, 12, "AMD K6-2 (Chomper A)"),
+    FM(0, 5, 0, 8, "AMD K6-2 (Chomper)"),
+    FMS(0, 5, 0, 9, 1, "AMD K6-III (Sharptooth B)"),
+    FM(0, 5, 0, 9, "AMD K6-III (Sharptooth)"),
+    FM(0, 5, 0, 10, "AMD Geode LX"),
+    FM(0, 5, 0, 13, "AMD K6-2+, K6-III+"),
+    F(0, 5, "AMD 5k86 / K6 / Geode (unknown model)"),
+    FM(0, 6, 0, 1, "AMD Athlon (Argon)"),
+    FM(0, 6, 0, 2, "AMD Athlon (K75 / Pluto / Orion)"),
+    FMS(0, 6, 0, 3, 0, "AMD Duron / mobile Duron (Spitfire A0)"),
+    FMS(0, 6, 0, 3, 1, "AMD Duron / mobile Duron (Spitfire A2)"),
+    FM(0, 6, 0, 3, "AMD Duron / mobile Duron (Spitfire)"),
+    FMS(0, 6, 0, 4, 2, "AMD Athlon (Thunderbird A4-A7)"),
+    FMS(0, 6, 0, 4, 4, "AMD Athlon (Thunderbird A9)"),
+    FM(0, 6, 0, 4, "AMD Athlon (Thunderbird)"),
+    FMSQ(0, 6, 0, 6, 0, sA, "AMD Athlon MP (Palomino A0)"),
+    FMSQ(0, 6, 0, 6, 0, dA, "AMD Athlon (Palomino A0)"),
+    FMSQ(0, 6, 0, 6, 0, MA, "AMD mobile Athlon 4 (Palomino A0)"),
+    FMSQ(0, 6, 0, 6, 0, sD, "AMD Duron MP (Palomino A0)"),
+    FMSQ(0, 6, 0, 6, 0, MD, "AMD mobile Duron (Palomino A0)"),
+    FMS(0, 6, 0, 6, 0, "AMD Athlon (unknown type)  (Palomino A0)"),
+    FMSQ(0, 6, 0, 6, 1, sA, "AMD Athlon MP (Palomino A2)"),
+    FMSQ(0, 6, 0, 6, 1, dA, "AMD Athlon (Palomino A2)"),
+    FMSQ(0, 6, 0, 6, 1, MA, "AMD mobile Athlon 4 (Palomino A2)"),
+    FMSQ(0, 6, 0, 6, 1, sD, "AMD Duron MP (Palomino A2)"),
+    FMSQ(0, 6, 0, 6, 1, MD, "AMD mobile Duron (Palomino A2)"),
+    FMSQ(0, 6, 0, 6, 1, dD, "AMD Duron (Palomino A2)"),
+    FMS(0, 6, 0, 6, 1, "AMD Athlon (unknown type) (Palomino A2)"),
+    FMSQ(0, 6, 0, 6, 2, sA, "AMD Athlon MP (Palomino A5)"),
+    FMSQ(0, 6, 0, 6, 2, dX, "AMD Athlon XP (Palomino A5)"),
+    FMSQ(0, 6, 0, 6, 2, MA, "AMD mobile Athlon 4 (Palomino A5)"),
+    FMSQ(0, 6, 0, 6, 2, sD, "AMD Duron MP (Palomino A5)"),
+    FMSQ(0, 6, 0, 6, 2, MD, "AMD mobile Duron (Palomino A5)"),
+    FMSQ(0, 6, 0, 6, 2, dD, "AMD Duron (Palomino A5)"),
+    FMS(0, 6, 0, 6, 2, "AMD Athlon (unknown type) (Palomino A5)"),
+    FMQ(0, 6, 0, 6, MD, "AMD mobile Duron (Palomino)"),
+    FMQ(0, 6, 0, 6, dD, "AMD Duron (Palomino)"),
+    FMQ(0, 6, 0, 6, MA, "AMD mobile Athlon (Palomino)"),
+    FMQ(0, 6, 0, 6, dX, "AMD Athlon XP (Palomino)"),
+    FMQ(0, 6, 0, 6, dA, "AMD Athlon (Palomino)"),
+    FM(0, 6, 0, 6, "AMD Athlon (unknown type) (Palomino)"),
+    FMSQ(0, 6, 0, 7, 0, sD, "AMD Duron MP (Morgan A0)"),
+    FMSQ(0, 6, 0, 7, 0, MD, "AMD mobile Duron (Morgan A0)"),
+    FMSQ(0, 6, 0, 7, 0, dD, "AMD Duron (Morgan A0)"),
+    FMS(0, 6, 0, 7, 0, "AMD Duron (unknown type)  (Morgan A0)"),
+    FMSQ(0, 6, 0, 7, 1, sD, "AMD Duron MP (Morgan A1)"),
+    FMSQ(0, 6, 0, 7, 1, MD, "AMD mobile Duron (Morgan A1)"),
+    FMSQ(0, 6, 0, 7, 1, dD, "AMD Duron (Morgan A1)"),
+    FMS(0, 6, 0, 7, 1, "AMD Duron (unknown type)  (Morgan A1)"),
+    FMQ(0, 6, 0, 7, sD, "AMD Duron MP (Morgan)"),
+    FMQ(0, 6, 0, 7, MD, "AMD mobile Duron (Morgan)"),
+    FMQ(0, 6, 0, 7, dD, "AMD Duron (Morgan)"),
+    FM(0, 6, 0, 7, "AMD Duron (unknown type)  (Morgan)"),
+    FMSQ(0, 6, 0, 8, 0, dS, "AMD Sempron (Thoroughbred A0)"),
+    FMSQ(0, 6, 0, 8, 0, sD, "AMD Duron MP (Applebred A0)"),
+    FMSQ(0, 6, 0, 8, 0, dD, "AMD Duron (Applebred A0)"),
+    FMSQ(0, 6, 0, 8, 0, MX, "AMD mobile Athlon XP (Thoroughbred A0)"),
+    FMSQ(0, 6, 0, 8, 0, sA, "AMD Athlon MP (Thoroughbred A0)"),
+    FMSQ(0, 6, 0, 8, 0, dX, "AMD Athlon XP (Thoroughbred A0)"),
+    FMSQ(0, 6, 0, 8, 0, dA, "AMD Athlon (Thoroughbred A0)"),
+    FMS(0, 6, 0, 8, 0, "AMD Athlon (unknown type) (Thoroughbred A0)"),
+    FMSQ(0, 6, 0, 8, 1, MG, "AMD Geode NX (Thoroughbred B0)"),
+    FMSQ(0, 6, 0, 8, 1, dS, "AMD Sempron (Thoroughbred B0)"),
+    FMSQ(0, 6, 0, 8, 1, sD, "AMD Duron MP (Applebred B0)"),
+    FMSQ(0, 6, 0, 8, 1, dD, "AMD Duron (Applebred B0)"),
+    FMSQ(0, 6, 0, 8, 1, sA, "AMD Athlon MP (Thoroughbred B0)"),
+    FMSQ(0, 6, 0, 8, 1, dX, "AMD Athlon XP (Thoroughbred B0)"),
+    FMSQ(0, 6, 0, 8, 1, dA, "AMD Athlon (Thoroughbred B0)"),
+    FMS(0, 6, 0, 8, 1, "AMD Athlon (unknown type) (Thoroughbred B0)"),
+    FMQ(0, 6, 0, 8, MG, "AMD Geode NX (Thoroughbred)"),
+    FMQ(0, 6, 0, 8, dS, "AMD Sempron (Thoroughbred)"),
+    FMQ(0, 6, 0, 8, sD, "AMD Duron MP (Thoroughbred)"),
+    FMQ(0, 6, 0, 8, dD, "AMD Duron (Thoroughbred)"),
+    FMQ(0, 6, 0, 8, MX, "AMD mobile Athlon XP (Thoroughbred)"),
+    FMQ(0, 6, 0, 8, sA, "AMD Athlon MP (Thoroughbred)"),
+    FMQ(0, 6, 0, 8, dX, "AMD Athlon XP (Thoroughbred)"),
+    FMQ(0, 6, 0, 8, dA, "AMD Athlon XP (Thoroughbred)"),
+    FM(0, 6, 0, 8, "AMD Athlon (unknown type) (Thoroughbred)"),
+    FMSQ(0, 6, 0, 10, 0, dS, "AMD Sempron (Barton A2)"),
+    FMSQ(0, 6, 0, 10, 0, ML, "AMD mobile Athlon XP-M (LV) (Barton A2)"),
+    FMSQ(0, 6, 0, 10, 0, MX, "AMD mobile Athlon XP-M (Barton A2)"),
+    FMSQ(0, 6, 0, 10, 0, dt, "AMD Athlon XP (Thorton A2)"),
+    FMSQ(0, 6, 0, 10, 0, sA, "AMD Athlon MP (Barton A2)"),
+    FMSQ(0, 6, 0, 10, 0, dX, "AMD Athlon XP (Barton A2)"),
+    FMS(0, 6, 0, 10, 0, "AMD Athlon (unknown type) (Barton A2)"),
+    FMQ(0, 6, 0, 10, dS, "AMD Sempron (Barton)"),
+    FMQ(0, 6, 0, 10, ML, "AMD mobile Athlon XP-M (LV) (Barton)"),
+    FMQ(0, 6, 0, 10, MX, "AMD mobile Athlon XP-M (Barton)"),
+    FMQ(0, 6, 0, 10, sA, "AMD Athlon MP (Barton)"),
+    FMQ(0, 6, 0, 10, dX, "AMD Athlon XP (Barton)"),
+    FM(0, 6, 0, 10, "AMD Athlon (unknown type) (Barton)"),
+    F(0, 6, "AMD Athlon (unknown model)"),
+    F(0, 7, "AMD Opteron (unknown model)"),
+    FMS(0, 15, 0, 4, 0, "AMD Athlon 64 (SledgeHammer SH7-B0)"),
+    FMSQ(0, 15, 0, 4, 8, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-C0)"),
+    FMSQ(0, 15, 0, 4, 8, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-C0)"),
+    FMSQ(0, 15, 0, 4, 8, dA, "AMD Athlon 64 (SledgeHammer SH7-C0)"),
+    FMS(0, 15, 0, 4, 8, "AMD Athlon 64 (unknown type) (SledgeHammer SH7-C0)"),
+    FMSQ(0, 15, 0, 4, 10, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-CG)"),
+    FMSQ(0, 15, 0, 4, 10, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-CG)"),
+    FMSQ(0, 15, 0, 4, 10, dA, "AMD Athlon 64 (SledgeHammer SH7-CG)"),
+};
+CHECK_SIGNATURES(synth_amd_part_1);
+
+// signature table of AMD processors, part 2, see decode_synth_amd_helper()
+static constexpr synth_row_t  synth_amd_part_2[] = {
+    FMS(0, 15, 0, 4, 10, "AMD Athlon 64 (unknown type) (SledgeHammer SH7-CG)"),
+    FMQ(0, 15, 0, 4, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7)"),
+    FMQ(0, 15, 0, 4, MA, "AMD mobile Athlon 64 (SledgeHammer SH7)"),
+    FMQ(0, 15, 0, 4, dA, "AMD Athlon 64 (SledgeHammer SH7)"),
+    FM(0, 15, 0, 4, "AMD Athlon 64 (unknown type) (SledgeHammer SH7)"),
+    FMS(0, 15, 0, 5, 0, "AMD Opteron (DP SledgeHammer SH7-B0)"),
+    FMS(0, 15, 0, 5, 1, "AMD Opteron (DP SledgeHammer SH7-B3)"),
+    FMSQ(0, 15, 0, 5, 8, sO, "AMD Opteron (DP SledgeHammer SH7-C0)"),
+    FMSQ(0, 15, 0, 5, 8, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-C0)"),
+    FMS(0, 15, 0, 5, 8, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-C0)"),
+    FMSQ(0, 15, 0, 5, 10, sO, "AMD Opteron (DP SledgeHammer SH7-CG)"),
+    FMSQ(0, 15, 0, 5, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)"),
+    FMS(0, 15, 0, 5, 10, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)"),
+    FMQ(0, 15, 0, 5, sO, "AMD Opteron (SledgeHammer SH7)"),
+    FMQ(0, 15, 0, 5, dF, "AMD Athlon 64 FX (SledgeHammer SH7)"),
+    FM(0, 15, 0, 5, "AMD Athlon 64 (unknown type) (SledgeHammer SH7) FX"),
+    FMSQ(0, 15, 0, 7, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)"),
+    FMSQ(0, 15, 0, 7, 10, dA, "AMD Athlon 64 (DP SledgeHammer SH7-CG)"),
+    FMS(0, 15, 0, 7, 10, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)"),
+    FMQ(0, 15, 0, 7, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7)"),
+    FMQ(0, 15, 0, 7, dA, "AMD Athlon 64 (DP SledgeHammer SH7)"),
+    FM(0, 15, 0, 7, "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7)"),
+    FMSQ(0, 15, 0, 8, 2, MS, "AMD mobile Sempron (ClawHammer CH7-CG)"),
+    FMSQ(0, 15, 0, 8, 2, MX, "AMD mobile Athlon XP-M (ClawHammer CH7-CG)"),
+    FMSQ(0, 15, 0, 8, 2, MA, "AMD mobile Athlon 64 (Odessa CH7-CG)"),
+    FMSQ(0, 15, 0, 8, 2, dA, "AMD Athlon 64 (ClawHammer CH7-CG)"),
+    FMS(0, 15, 0, 8, 2, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7-CG)"),
+    FMQ(0, 15, 0, 8, MS, "AMD mobile Sempron (Odessa CH7)"),
+    FMQ(0, 15, 0, 8, MX, "AMD mobile Athlon XP-M (Odessa CH7)"),
+    FMQ(0, 15, 0, 8, MA, "AMD mobile Athlon 64 (Odessa CH7)"),
+    FMQ(0, 15, 0, 8, dA, "AMD Athlon 64 (ClawHammer CH7)"),
+    FM(0, 15, 0, 8, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7)"),
+    FMS(0, 15, 0, 11, 2, "AMD Athlon 64 (ClawHammer CH7-CG)"),
+    FM(0, 15, 0, 11, "AMD Athlon 64 (ClawHammer CH7)"),
+    FMSQ(0, 15, 0, 12, 0, MS, "AMD mobile Sempron (Dublin DH7-CG)"),
+    FMSQ(0, 15, 0, 12, 0, dS, "AMD Sempron (Paris DH7-CG)"),
+    FMSQ(0, 15, 0, 12, 0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)"),
+    FMSQ(0, 15, 0, 12, 0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)"),
+    FMSQ(0, 15, 0, 12, 0, dA, "AMD Athlon 64 (NewCastle DH7-CG)"),
+    FMS(0, 15, 0, 12, 0, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)"),
+    FMQ(0, 15, 0, 12, MS, "AMD mobile Sempron (Dublin DH7)"),
+    FMQ(0, 15, 0, 12, dS, "AMD Sempron (Paris DH7)"),
+    FMQ(0, 15, 0, 12, MX, "AMD mobile Athlon XP-M (NewCastle DH7)"),
+    FMQ(0, 15, 0, 12, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)"),
+    FMQ(0, 15, 0, 12, dA, "AMD Athlon 64 (NewCastle DH7)"),
+    FM(0, 15, 0, 12, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)"),
+    FMSQ(0, 15, 0, 14, 0, MS, "AMD mobile Sempron (Dublin DH7-CG)"),
+    FMSQ(0, 15, 0, 14, 0, dS, "AMD Sempron (Paris DH7-CG)"),
+    FMSQ(0, 15, 0, 14, 0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)"),
+    FMSQ(0, 15, 0, 14, 0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)"),
+    FMSQ(0, 15, 0, 14, 0, dA, "AMD Athlon 64 (NewCastle DH7-CG)"),
+    FMS(0, 15, 0, 14, 0, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)"),
+    FMQ(0, 15, 0, 14, dS, "AMD Sempron (Paris DH7)"),
+    FMQ(0, 15, 0, 14, MS, "AMD mobile Sempron (Dublin DH7)"),
+    FMQ(0, 15, 0, 14, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7)"),
+    FMQ(0, 15, 0, 14, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)"),
+    FMQ(0, 15, 0, 14, dA, "AMD Athlon 64 (NewCastle DH7)"),
+    FM(0, 15, 0, 14, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)"),
+    FMSQ(0, 15, 0, 15, 0, dS, "AMD Sempron (Paris DH7-CG)"),
+    FMSQ(0, 15, 0, 15, 0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)"),
+    FMSQ(0, 15, 0, 15, 0, dA, "AMD Athlon 64 (NewCastle DH7-CG)"),
+    FMS(0, 15, 0, 15, 0, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7-CG)"),
+    FMQ(0, 15, 0, 15, dS, "AMD Sempron (Paris DH7)"),
+    FMQ(0, 15, 0, 15, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)"),
+    FMQ(0, 15, 0, 15, dA, "AMD Athlon 64 (NewCastle DH7)"),
+    FM(0, 15, 0, 15, "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7)"),
+    FMSQ(0, 15, 1, 4, 0, MX, "AMD mobile Athlon XP-M (Oakville SH7-D0)"),
+    FMSQ(0, 15, 1, 4, 0, MA, "AMD mobile Athlon 64 (Oakville SH7-D0)"),
+    FMSQ(0, 15, 1, 4, 0, dA, "AMD Athlon 64 (Winchester SH7-D0)"),
+    FMS(0, 15, 1, 4, 0, "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7-D0)"),
+    FMQ(0, 15, 1, 4, MX, "AMD mobile Athlon XP-M (Oakville SH7)"),
+    FMQ(0, 15, 1, 4, MA, "AMD mobile Athlon 64 (Oakville SH7)"),
+    FMQ(0, 15, 1, 4, dA, "AMD Athlon 64 (Winchester SH7)"),
+    FM(0, 15, 1, 4, "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7)"),
+    FMSQ(0, 15, 1, 5, 0, sO, "AMD Opteron (Winchester SH7-D0)"),
+    FMSQ(0, 15, 1, 5, 0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)"),
+    FMS(0, 15, 1, 5, 0, "AMD Athlon 64 (unknown type) (Winchester SH7-D0)"),
+    FMQ(0, 15, 1, 5, sO, "AMD Opteron (Winchester SH7)"),
+    FMQ(0, 15, 1, 5, dF, "AMD Athlon 64 FX (Winchester SH7)"),
+    FM(0, 15, 1, 5, "AMD Athlon 64 (unknown type) (Winchester SH7)"),
+    FMSQ(0, 15, 1, 7, 0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)"),
+    FMSQ(0, 15, 1, 7, 0, dA, "AMD Athlon 64 (Winchester SH7-D0)"),
+    FMS(0, 15, 1, 7, 0, "AMD Athlon 64 (unknown type) (Winchester SH7-D0)"),
+    FMQ(0, 15, 1, 7, dF, "AMD Athlon 64 FX (Winchester SH7)"),
+    FMQ(0, 15, 1, 7, dA, "AMD Athlon 64 (Winchester SH7)"),
+    FM(0, 15, 1, 7, "AMD Athlon 64 (unknown type) (Winchester SH7)"),
+    FMSQ(0, 15, 1, 8, 0, MS, "AMD mobile Sempron (Georgetown/Sonora CH-D0)"),
+    FMSQ(0, 15, 1, 8, 0, MX, "AMD mobile Athlon XP-M (Oakville CH-D0)"),
+    FMSQ(0, 15, 1, 8, 0, MA, "AMD mobile Athlon 64 (Oakville CH-D0)"),
+    FMSQ(0, 15, 1, 8, 0, dA, "AMD Athlon 64 (Winchester CH-D0)"),
+    FMS(0, 15, 1, 8, 0, "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH-D0)"),
+    FMQ(0, 15, 1, 8, MS, "AMD mobile Sempron (Georgetown/Sonora CH)"),
+    FMQ(0, 15, 1, 8, MX, "AMD mobile Athlon XP-M (Oakville CH)"),
+    FMQ(0, 15, 1, 8, MA, "AMD mobile Athlon 64 (Oakville CH)"),
+    FMQ(0, 15, 1, 8, dA, "AMD Athlon 64 (Winchester CH)"),
+    FM(0, 15, 1, 8, "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH)"),
+    FMS(0, 15, 1, 11, 0, "AMD Athlon 64 (Winchester CH-D0)"),
+    FM(0, 15, 1, 11, "AMD Athlon 64 (Winchester CH)"),
+    FMSQ(0, 15, 1, 12, 0, MS, "AMD mobile Sempron (Georgetown/Sonora DH8-D0)"),
+    FMSQ(0, 15, 1, 12, 0, dS, "AMD Sempron (Palermo DH8-D0)"),
+    FMSQ(0, 15, 1, 12, 0, MX, "AMD Athlon XP-M (Winchester DH8-D0)"),
+    FMSQ(0, 15, 1, 12, 0, MA, "AMD mobile Athlon 64 (Oakville DH8-D0)"),
+    FMSQ(0, 15, 1, 12, 0, dA, "AMD Athlon 64 (Winchester DH8-D0)"),
+    FMS(0, 15, 1, 12, 0, "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora/Palermo DH8-D0)"),
+    FMQ(0, 15, 1, 12, MS, "AMD mobile Sempron (Georgetown/Sonora DH8)"),
+    FMQ(0, 15, 1, 12, dS, "AMD Sempron (Palermo DH8)"),
+    FMQ(0, 15, 1, 12, MX, "AMD Athlon XP-M (Winchester DH8)"),
+    FMQ(0, 15, 1, 12, MA, "AMD mobile Athlon 64 (Oakville DH8)"),
+    FMQ(0, 15, 1, 12, dA, "AMD Athlon 64 (Winchester DH8)"),
+    FM(0, 15, 1, 12, "AMD Athlon 64 (Winchester/Oakville/Georgetown/Sonora/Palermo DH8)"),
+    FMSQ(0, 15, 1, 15, 0, dS, "AMD Sempron (Palermo DH8-D0)"),
+    FMSQ(0, 15, 1, 15, 0, dA, "AMD Athlon 64 (Winchester DH8-D0)"),
+    FMS(0, 15, 1, 15, 0, "AMD Athlon 64 (Winchester DH8-D0) / Sempron (Palermo DH8-D0)"),
+    FMQ(0, 15, 1, 15, dS, "AMD Sempron (Palermo DH8)"),
+    FMQ(0, 15, 1, 15, dA, "AMD Athlon 64 (Winchester DH8)"),
+    FM(0, 15, 1, 15, "AMD Athlon 64 (unknown type) (Winchester/Palermo DH8)"),
+    FMSQ(0, 15, 2, 1, 0, s8, "AMD Dual Core Opteron (Egypt JH-E1)"),
+    FMSQ(0, 15, 2, 1, 0, sO, "AMD Dual Core Opteron (Italy JH-E1)"),
+    FMS(0, 15, 2, 1, 0, "AMD Dual Core Opteron (Italy/Egypt JH-E1)"),
+    FMSQ(0, 15, 2, 1, 2, s8, "AMD Dual Core Opteron (Egypt JH-E6)"),
+    FMSQ(0, 15, 2, 1, 2, sO, "AMD Dual Core Opteron (Italy JH-E6)"),
+};
+CHECK_SIGNATURES(synth_amd_part_2);
+
+// signature table of AMD processors, part 3, see decode_synth_amd_helper()
+static constexpr synth_row_t  synth_amd_part_3[] = {
+    FMS(0, 15, 2, 1, 2, "AMD Dual Core Opteron (Italy/Egypt JH-E6)"),
+    FMQ(0, 15, 2, 1, s8, "AMD Dual Core Opteron (Egypt JH)"),
+    FMQ(0, 15, 2, 1, sO, "AMD Dual Core Opteron (Italy JH)"),
+    FM(0, 15, 2, 1, "AMD Dual Core Opteron (Italy/Egypt JH)"),
+    FMSQ(0, 15, 2, 3, 2, DO, "AMD Dual Core Opteron (Denmark JH-E6)"),
+    FMSQ(0, 15, 2, 3, 2, dF, "AMD Athlon 64 FX (Toledo JH-E6)"),
+    FMSQ(0, 15, 2, 3, 2, dm, "AMD Athlon 64 X2 (Manchester JH-E6)"),
+    FMSQ(0, 15, 2, 3, 2, dA, "AMD Athlon 64 X2 (Toledo JH-E6)"),
+    FMS(0, 15, 2, 3, 2, "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH-E6)"),
+    FMQ(0, 15, 2, 3, sO, "AMD Dual Core Opteron (Denmark JH)"),
+    FMQ(0, 15, 2, 3, dF, "AMD Athlon 64 FX (Toledo JH)"),
+    FMQ(0, 15, 2, 3, dm, "AMD Athlon 64 X2 (Manchester JH)"),
+    FMQ(0, 15, 2, 3, dA, "AMD Athlon 64 X2 (Toledo JH)"),
+    FM(0, 15, 2, 3, "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH)"),
+    FMSQ(0, 15, 2, 4, 2, MA, "AMD mobile Athlon 64 (Newark SH-E5)"),
+    FMSQ(0, 15, 2, 4, 2, MT, "AMD mobile Turion (Lancaster/Richmond SH-E5)"),
+    FMS(0, 15, 2, 4, 2, "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH-E5)"),
+    FMQ(0, 15, 2, 4, MA, "AMD mobile Athlon 64 (Newark SH)"),
+    FMQ(0, 15, 2, 4, MT, "AMD mobile Turion (Lancaster/Richmond SH)"),
+    FM(0, 15, 2, 4, "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH)"),
+    FMQ(0, 15, 2, 5, s8, "AMD Opteron (Athens SH-E4)"),
+    FMQ(0, 15, 2, 5, sO, "AMD Opteron (Troy SH-E4)"),
+    FM(0, 15, 2, 5, "AMD Opteron (Troy/Athens SH-E4)"),
+    FMSQ(0, 15, 2, 7, 1, sO, "AMD Opteron (Venus SH-E4)"),
+    FMSQ(0, 15, 2, 7, 1, dF, "AMD Athlon 64 FX (San Diego SH-E4)"),
+    FMSQ(0, 15, 2, 7, 1, dA, "AMD Athlon 64 (San Diego SH-E4)"),
+    FMS(0, 15, 2, 7, 1, "AMD Athlon 64 (unknown type) (Venus/San Diego SH-E4)"),
+    FMQ(0, 15, 2, 7, sO, "AMD Opteron (San Diego SH)"),
+    FMQ(0, 15, 2, 7, dF, "AMD Athlon 64 FX (San Diego SH)"),
+    FMQ(0, 15, 2, 7, dA, "AMD Athlon 64 (San Diego SH)"),
+    FM(0, 15, 2, 7, "AMD Athlon 64 (unknown type) (San Diego SH)"),
+    FM(0, 15, 2, 11, "AMD Athlon 64 X2 (Manchester BH-E4)"),
+    FMS(0, 15, 2, 12, 0, "AMD Sempron (Palermo DH-E3)"),
+    FMSQ(0, 15, 2, 12, 2, MS, "AMD mobile Sempron (Albany/Roma DH-E6)"),
+    FMSQ(0, 15, 2, 12, 2, dS, "AMD Sempron (Palermo DH-E6)"),
+    FMSQ(0, 15, 2, 12, 2, dA, "AMD Athlon 64 (Venice DH-E6)"),
+    FMS(0, 15, 2, 12, 2, "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH-E6)"),
+    FMQ(0, 15, 2, 12, MS, "AMD mobile Sempron (Albany/Roma DH)"),
+    FMQ(0, 15, 2, 12, dS, "AMD Sempron (Palermo DH)"),
+    FMQ(0, 15, 2, 12, dA, "AMD Athlon 64 (Venice DH)"),
+    FM(0, 15, 2, 12, "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH)"),
+    FMSQ(0, 15, 2, 15, 0, dS, "AMD Sempron (Palermo DH-E3)"),
+    FMSQ(0, 15, 2, 15, 0, dA, "AMD Athlon 64 (Venice DH-E3)"),
+    FMS(0, 15, 2, 15, 0, "AMD Athlon 64 (Venice/Palermo DH-E3)"),
+    FMSQ(0, 15, 2, 15, 2, dS, "AMD Sempron (Palermo DH-E6)"),
+    FMSQ(0, 15, 2, 15, 2, dA, "AMD Athlon 64 (Venice DH-E6)"),
+    FMS(0, 15, 2, 15, 2, "AMD Athlon 64 (Venice/Palermo DH-E6)"),
+    FMQ(0, 15, 2, 15, dS, "AMD Sempron (Palermo DH)"),
+    FMQ(0, 15, 2, 15, dA, "AMD Athlon 64 (Venice DH)"),
+    FM(0, 15, 2, 15, "AMD Athlon 64 (Venice/Palermo DH)"),
+    FMS(0, 15, 4, 1, 2, "AMD Dual-Core Opteron (Santa Rosa JH-F2)"),
+    FMS(0, 15, 4, 1, 3, "AMD Dual-Core Opteron (Santa Rosa JH-F3)"),
+    FM(0, 15, 4, 1, "AMD Dual-Core Opteron (Santa Rosa)"),
+    FMSQ(0, 15, 4, 3, 2, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F2)"),
+    FMSQ(0, 15, 4, 3, 2, sO, "AMD Opteron (Santa Rosa JH-F2)"),
+    FMSQ(0, 15, 4, 3, 2, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F2)"),
+    FMSQ(0, 15, 4, 3, 2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F2)"),
+    FMS(0, 15, 4, 3, 2, "AMD Athlon 64 (unknown type) (Windsor JH-F2)"),
+    FMSQ(0, 15, 4, 3, 3, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F3)"),
+    FMSQ(0, 15, 4, 3, 3, sO, "AMD Opteron (Santa Rosa JH-F3)"),
+    FMSQ(0, 15, 4, 3, 3, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)"),
+    FMSQ(0, 15, 4, 3, 3, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F3)"),
+    FMS(0, 15, 4, 3, 3, "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa JH-F3)"),
+    FMQ(0, 15, 4, 3, DO, "AMD Dual-Core Opteron (Santa Rosa)"),
+    FMQ(0, 15, 4, 3, sO, "AMD Opteron (Santa Rosa)"),
+    FMQ(0, 15, 4, 3, dF, "AMD Athlon 64 FX Dual-Core (Windsor)"),
+    FMQ(0, 15, 4, 3, dA, "AMD Athlon 64 X2 Dual-Core (Windsor)"),
+    FM(0, 15, 4, 3, "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa)"),
+    FMSQ(0, 15, 4, 8, 2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)"),
+    FMSQ(0, 15, 4, 8, 2, Mt, "AMD Turion 64 X2 (Trinidad BH-F2)"),
+    FMSQ(0, 15, 4, 8, 2, MT, "AMD Turion 64 X2 (Taylor BH-F2)"),
+    FMS(0, 15, 4, 8, 2, "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad BH-F2)"),
+    FMQ(0, 15, 4, 8, dA, "AMD Athlon 64 X2 Dual-Core (Windsor)"),
+    FMQ(0, 15, 4, 8, Mt, "AMD Turion 64 X2 (Trinidad)"),
+    FMQ(0, 15, 4, 8, MT, "AMD Turion 64 X2 (Taylor)"),
+    FM(0, 15, 4, 8, "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad)"),
+    FMS(0, 15, 4, 11, 2, "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)"),
+    FM(0, 15, 4, 11, "AMD Athlon 64 X2 Dual-Core (Windsor)"),
+    FMSQ(0, 15, 4, 12, 2, MS, "AMD mobile Sempron (Keene BH-F2)"),
+    FMSQ(0, 15, 4, 12, 2, dS, "AMD Sempron (Manila BH-F2)"),
+    FMSQ(0, 15, 4, 12, 2, Mt, "AMD Turion (Trinidad BH-F2)"),
+    FMSQ(0, 15, 4, 12, 2, MT, "AMD Turion (Taylor BH-F2)"),
+    FMSQ(0, 15, 4, 12, 2, dA, "AMD Athlon 64 (Orleans BH-F2)"),
+    FMS(0, 15, 4, 12, 2, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad BH-F2)"),
+    FMQ(0, 15, 4, 12, MS, "AMD mobile Sempron (Keene)"),
+    FMQ(0, 15, 4, 12, dS, "AMD Sempron (Manila)"),
+    FMQ(0, 15, 4, 12, Mt, "AMD Turion (Trinidad)"),
+    FMQ(0, 15, 4, 12, MT, "AMD Turion (Taylor)"),
+    FMQ(0, 15, 4, 12, dA, "AMD Athlon 64 (Orleans)"),
+    FM(0, 15, 4, 12, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad)"),
+    FMSQ(0, 15, 4, 15, 2, MS, "AMD mobile Sempron (Keene DH-F2)"),
+    FMSQ(0, 15, 4, 15, 2, dS, "AMD Sempron (Manila DH-F2)"),
+    FMSQ(0, 15, 4, 15, 2, dA, "AMD Athlon 64 (Orleans DH-F2)"),
+    FMS(0, 15, 4, 15, 2, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)"),
+    FMQ(0, 15, 4, 15, MS, "AMD mobile Sempron (Keene)"),
+    FMQ(0, 15, 4, 15, dS, "AMD Sempron (Manila)"),
+    FMQ(0, 15, 4, 15, dA, "AMD Athlon 64 (Orleans)"),
+    FM(0, 15, 4, 15, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)"),
+    FMS(0, 15, 5, 13, 3, "AMD Opteron (Santa Rosa JH-F3)"),
+    FM(0, 15, 5, 13, "AMD Opteron (Santa Rosa)"),
+    FMSQ(0, 15, 5, 15, 2, MS, "AMD mobile Sempron (Keene DH-F2)"),
+    FMSQ(0, 15, 5, 15, 2, dS, "AMD Sempron (Manila DH-F2)"),
+    FMSQ(0, 15, 5, 15, 2, dA, "AMD Athlon 64 (Orleans DH-F2)"),
+    FMS(0, 15, 5, 15, 2, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)"),
+    FMS(0, 15, 5, 15, 3, "AMD Athlon 64 (Orleans DH-F3)"),
+    FMQ(0, 15, 5, 15, MS, "AMD mobile Sempron (Keene)"),
+    FMQ(0, 15, 5, 15, dS, "AMD Sempron (Manila)"),
+    FMQ(0, 15, 5, 15, dA, "AMD Athlon 64 (Orleans)"),
+    FM(0, 15, 5, 15, "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)"),
+    FMS(0, 15, 6, 8, 1, "AMD Turion 64 X2 (Tyler BH-G1)"),
+    FMSQ(0, 15, 6, 8, 2, MT, "AMD Turion 64 X2 (Tyler BH-G2)"),
+    FMSQ(0, 15, 6, 8, 2, dS, "AMD Sempron Dual-Core (Tyler BH-G2)"),
+    FMS(0, 15, 6, 8, 2, "AMD Turion 64 (unknown type) (Tyler BH-G2)"),
+    FMQ(0, 15, 6, 8, MT, "AMD Turion 64 X2 (Tyler)"),
+    FMQ(0, 15, 6, 8, dS, "AMD Sempron Dual-Core (Tyler)"),
+    FM(0, 15, 6, 8, "AMD Turion 64 (unknown type) (Tyler)"),
+};
+CHECK_SIGNATURES(synth_amd_part_3);
+
+// signature table of AMD processors, part 4, see decode_synth_amd_helper()
+static constexpr synth_row_t  synth_amd_part_4[] = {
+    FMSQ(0, 15, 6, 11, 1, dS, "AMD Sempron Dual-Core (Sparta BH-G1)"),
+    FMSQ(0, 15, 6, 11, 1, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G1)"),
+    FMS(0, 15, 6, 11, 1, "AMD Athlon 64 (unknown type) (Brisbane/Sparta BH-G1)"),
+    FMSQ(0, 15, 6, 11, 2, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G2)"),
+    FMSQ(0, 15, 6, 11, 2, Mn, "AMD Turion Neo X2 Dual-Core (Huron BH-G2)"),
+    FMSQ(0, 15, 6, 11, 2, MN, "AMD Athlon Neo X2 (Huron BH-G2)"),
+    FMS(0, 15, 6, 11, 2, "AMD Athlon 64 (unknown type) (Brisbane/Huron BH-G2)"),
+    FMQ(0, 15, 6, 11, dS, "AMD Sempron Dual-Core (Sparta)"),
+    FMQ(0, 15, 6, 11, Mn, "AMD Turion Neo X2 Dual-Core (Huron)"),
+    FMQ(0, 15, 6, 11, MN, "AMD Athlon Neo X2 (Huron)"),
+    FMQ(0, 15, 6, 11, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane)"),
+    FM(0, 15, 6, 11, "AMD Athlon 64 (unknown type) (Brisbane/Sparta/Huron)"),
+    FMSQ(0, 15, 6, 12, 2, MS, "AMD mobile Sempron (Sherman DH-G2)"),
+    FMSQ(0, 15, 6, 12, 2, dS, "AMD Sempron (Sparta DH-G2)"),
+    FMSQ(0, 15, 6, 12, 2, dA, "AMD Athlon 64 (Lima DH-G2)"),
+    FMS(0, 15, 6, 12, 2, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G2)"),
+    FMQ(0, 15, 6, 12, MS, "AMD mobile Sempron (Sherman)"),
+    FMQ(0, 15, 6, 12, dS, "AMD Sempron (Sparta)"),
+    FMQ(0, 15, 6, 12, dA, "AMD Athlon 64 (Lima)"),
+    FM(0, 15, 6, 12, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman)"),
+    FMSQ(0, 15, 6, 15, 2, MS, "AMD mobile Sempron (Sherman DH-G2)"),
+    FMSQ(0, 15, 6, 15, 2, dS, "AMD Sempron (Sparta DH-G2)"),
+    FMSQ(0, 15, 6, 15, 2, MN, "AMD Athlon Neo (Huron DH-G2)"),
+    FMS(0, 15, 6, 15, 2, "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman DH-G2)"),
+    FMQ(0, 15, 6, 15, MS, "AMD mobile Sempron (Sherman)"),
+    FMQ(0, 15, 6, 15, dS, "AMD Sempron (Sparta)"),
+    FMQ(0, 15, 6, 15, MN, "AMD Athlon Neo (Huron)"),
+    FM(0, 15, 6, 15, "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman)"),
+    FMSQ(0, 15, 7, 12, 2, MS, "AMD mobile Sempron (Sherman DH-G2)"),
+    FMSQ(0, 15, 7, 12, 2, dS, "AMD Sempron (Sparta DH-G2)"),
+    FMSQ(0, 15, 7, 12, 2, dA, "AMD Athlon (Lima DH-G2)"),
+    FMS(0, 15, 7, 12, 2, "AMD Athlon (unknown type) (Lima/Sparta/Sherman DH-G2)"),
+    FMQ(0, 15, 7, 12, MS, "AMD mobile Sempron (Sherman)"),
+    FMQ(0, 15, 7, 12, dS, "AMD Sempron (Sparta)"),
+    FMQ(0, 15, 7, 12, dA, "AMD Athlon (Lima)"),
+    FM(0, 15, 7, 12, "AMD Athlon (unknown type) (Lima/Sparta/Sherman)"),
+    FMSQ(0, 15, 7, 15, 1, MS, "AMD mobile Sempron (Sherman DH-G1)"),
+    FMSQ(0, 15, 7, 15, 1, dS, "AMD Sempron (Sparta DH-G1)"),
+    FMSQ(0, 15, 7, 15, 1, dA, "AMD Athlon 64 (Lima DH-G1)"),
+    FMS(0, 15, 7, 15, 1, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G1)"),
+    FMSQ(0, 15, 7, 15, 2, MS, "AMD mobile Sempron (Sherman DH-G2)"),
+    FMSQ(0, 15, 7, 15, 2, dS, "AMD Sempron (Sparta DH-G2)"),
+    FMSQ(0, 15, 7, 15, 2, MN, "AMD Athlon Neo (Huron DH-G2)"),
+    FMSQ(0, 15, 7, 15, 2, dA, "AMD Athlon 64 (Lima DH-G2)"),
+    FMS(0, 15, 7, 15, 2, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron DH-G2)"),
+    FMQ(0, 15, 7, 15, MS, "AMD mobile Sempron (Sherman)"),
+    FMQ(0, 15, 7, 15, dS, "AMD Sempron (Sparta)"),
+    FMQ(0, 15, 7, 15, MN, "AMD Athlon Neo (Huron)"),
+    FMQ(0, 15, 7, 15, dA, "AMD Athlon 64 (Lima)"),
+    FM(0, 15, 7, 15, "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron)"),
+    FMS(0, 15, 12, 1, 3, "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)"),
+    FM(0, 15, 12, 1, "AMD Athlon 64 FX Dual-Core (Windsor)"),
+    F(0, 15, "AMD (unknown model)"),
+    FMS(1, 15, 0, 0, 0, "AMD (unknown type) (Barcelona DR-A0)"), // sandpile.org
+    FMS(1, 15, 0, 0, 1, "AMD (unknown type) (Barcelona DR-A1)"), // sandpile.org
+    FMS(1, 15, 0, 0, 2, "AMD (unknown type) (Barcelona DR-A2)"), // sandpile.org
+    FMS(1, 15, 0, 2, 0, "AMD (unknown type) (Barcelona DR-B0)"), // sandpile.org
+    FMSQ(1, 15, 0, 2, 1, sO, "AMD Quad-Core Opteron (Barcelona DR-B1)"),
+    FMS(1, 15, 0, 2, 1, "AMD (unknown type) (Barcelona DR-B1)"),
+    FMSQ(1, 15, 0, 2, 2, EO, "AMD Embedded Opteron (Barcelona DR-B2)"),
+    FMSQ(1, 15, 0, 2, 2, sO, "AMD Quad-Core Opteron (Barcelona DR-B2)"),
+    FMSQ(1, 15, 0, 2, 2, Tp, "AMD Phenom Triple-Core (Toliman DR-B2)"),
+    FMSQ(1, 15, 0, 2, 2, Qp, "AMD Phenom Quad-Core (Agena DR-B2)"),
+    FMS(1, 15, 0, 2, 2, "AMD (unknown type) (Barcelona/Toliman/Agena DR-B2)"),
+    FMSQ(1, 15, 0, 2, 3, EO, "AMD Embedded Opteron (Barcelona DR-B3)"),
+    FMSQ(1, 15, 0, 2, 3, sO, "AMD Quad-Core Opteron (Barcelona DR-B3)"),
+    FMSQ(1, 15, 0, 2, 3, Tp, "AMD Phenom Triple-Core (Toliman DR-B3)"),
+    FMSQ(1, 15, 0, 2, 3, Qp, "AMD Phenom Quad-Core (Agena DR-B3)"),
+    FMSQ(1, 15, 0, 2, 3, dA, "AMD Athlon Dual-Core (Kuma DR-B3)"),
+    FMS(1, 15, 0, 2, 3, "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma DR-B3)"),
+    FMS(1, 15, 0, 2, 10, "AMD Quad-Core Opteron (Barcelona DR-BA)"),
+    FMQ(1, 15, 0, 2, EO, "AMD Embedded Opteron (Barcelona)"),
+    FMQ(1, 15, 0, 2, sO, "AMD Quad-Core Opteron (Barcelona)"),
+    FMQ(1, 15, 0, 2, Tp, "AMD Phenom Triple-Core (Toliman)"),
+    FMQ(1, 15, 0, 2, Qp, "AMD Phenom Quad-Core (Agena)"),
+    FMQ(1, 15, 0, 2, dA, "AMD Athlon Dual-Core (Kuma)"),
+    FM(1, 15, 0, 2, "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma)"),
+    FMS(1, 15, 0, 4, 0, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C0)"), // sandpile.org
+    FMS(1, 15, 0, 4, 1, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C1)"), // sandpile.org
+    FMSQ(1, 15, 0, 4, 2, EO, "AMD Embedded Opteron (Shanghai RB-C2)"),
+    FMSQ(1, 15, 0, 4, 2, sO, "AMD Quad-Core Opteron (Shanghai RB-C2)"),
+    FMSQ(1, 15, 0, 4, 2, dr, "AMD Athlon Dual-Core (Propus RB-C2)"),
+    FMSQ(1, 15, 0, 4, 2, dA, "AMD Athlon Dual-Core (Regor RB-C2)"),
+    FMSQ(1, 15, 0, 4, 2, Dp, "AMD Phenom II X2 (Callisto RB-C2)"),
+    FMSQ(1, 15, 0, 4, 2, Tp, "AMD Phenom II X3 (Heka RB-C2)"),
+    FMSQ(1, 15, 0, 4, 2, Qp, "AMD Phenom II X4 (Deneb RB-C2)"),
+    FMS(1, 15, 0, 4, 2, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C2)"),
+    FMSQ(1, 15, 0, 4, 3, Dp, "AMD Phenom II X2 (Callisto RB-C3)"),
+    FMSQ(1, 15, 0, 4, 3, Tp, "AMD Phenom II X3 (Heka RB-C3)"),
+    FMSQ(1, 15, 0, 4, 3, Qp, "AMD Phenom II X4 (Deneb RB-C3)"),
+    FMS(1, 15, 0, 4, 3, "AMD Phenom II (unknown type) (Callisto/Heka/Deneb RB-C3)"),
+    FMQ(1, 15, 0, 4, EO, "AMD Embedded Opteron (Shanghai)"),
+    FMQ(1, 15, 0, 4, sO, "AMD Quad-Core Opteron (Shanghai)"),
+    FMQ(1, 15, 0, 4, dr, "AMD Athlon Dual-Core (Propus)"),
+    FMQ(1, 15, 0, 4, dA, "AMD Athlon Dual-Core (Regor)"),
+    FMQ(1, 15, 0, 4, Dp, "AMD Phenom II X2 (Callisto)"),
+    FMQ(1, 15, 0, 4, Tp, "AMD Phenom II X3 (Heka)"),
+    FMQ(1, 15, 0, 4, Qp, "AMD Phenom II X4 (Deneb)"),
+    FM(1, 15, 0, 4, "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb)"),
+    FMS(1, 15, 0, 5, 0, "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C0)"), // sandpile.org
+    FMS(1, 15, 0, 5, 1, "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C1)"), // sandpile.org
+    FMSQ(1, 15, 0, 5, 2, DA, "AMD Athlon II X2 (Regor BL-C2)"),
+    FMSQ(1, 15, 0, 5, 2, TA, "AMD Athlon II X3 (Rana BL-C2)"),
+    FMSQ(1, 15, 0, 5, 2, QA, "AMD Athlon II X4 (Propus BL-C2)"),
+    FMS(1, 15, 0, 5, 2, "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C2)"),
+    FMSQ(1, 15, 0, 5, 3, TA, "AMD Athlon II X3 (Rana BL-C3)"),
+    FMSQ(1, 15, 0, 5, 3, QA, "AMD Athlon II X4 (Propus BL-C3)"),
+    FMSQ(1, 15, 0, 5, 3, Tp, "AMD Phenom II Triple-Core (Heka BL-C3)"),
+    FMSQ(1, 15, 0, 5, 3, Qp, "AMD Phenom II Quad-Core (Deneb BL-C3)"),
+    FMS(1, 15, 0, 5, 3, "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb BL-C3)"),
+    FMQ(1, 15, 0, 5, DA, "AMD Athlon II X2 (Regor)"),
+    FMQ(1, 15, 0, 5, TA, "AMD Athlon II X3 (Rana)"),
+    FMQ(1, 15, 0, 5, QA, "AMD Athlon II X4 (Propus)"),
+    FMQ(1, 15, 0, 5, Tp, "AMD Phenom II Triple-Core (Heka)"),
+    FMQ(1, 15, 0, 5, Qp, "AMD Phenom II Quad-Core (Deneb)"),
+    FM(1, 15, 0, 5, "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb)"),
+    FMS(1, 15, 0, 6, 0, "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C0)"),
+    FMS(1, 15, 0, 6, 1, "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C1)"),
+};
+CHECK_SIGNATURES(synth_amd_part_4);
+
+// signature table of AMD processors, part 5, see decode_synth_amd_helper()
+static constexpr synth_row_t  synth_amd_part_5[] = {
+    FMSQ(1, 15, 0, 6, 2, MS, "AMD Sempron Mobile (Sargas DA-C2)"),
+    FMSQ(1, 15, 0, 6, 2, dS, "AMD Sempron II (Sargas DA-C2)"),
+    FMSQ(1, 15, 0, 6, 2, MT, "AMD Turion II Dual-Core Mobile (Caspian DA-C2)"),
+    FMSQ(1, 15, 0, 6, 2, MA, "AMD Athlon II Dual-Core Mobile (Regor DA-C2)"),
+    FMSQ(1, 15, 0, 6, 2, DA, "AMD Athlon II X2 (Regor DA-C2)"),
+    FMSQ(1, 15, 0, 6, 2, dA, "AMD Athlon II (Sargas DA-C2)"),
+    FMS(1, 15, 0, 6, 2, "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C2)"),
+    FMSQ(1, 15, 0, 6, 3, Ms, "AMD V-Series Mobile (Champlain DA-C3)"),
+    FMSQ(1, 15, 0, 6, 3, DS, "AMD Sempron II X2 (Regor DA-C3)"),
+    FMSQ(1, 15, 0, 6, 3, dS, "AMD Sempron II (Sargas DA-C3)"),
+    FMSQ(1, 15, 0, 6, 3, MT, "AMD Turion II Dual-Core Mobile (Champlain DA-C3)"),
+    FMSQ(1, 15, 0, 6, 3, Mp, "AMD Phenom II Dual-Core Mobile (Champlain DA-C3)"),
+    FMSQ(1, 15, 0, 6, 3, MA, "AMD Athlon II Dual-Core Mobile (Champlain DA-C3)"),
+    FMSQ(1, 15, 0, 6, 3, DA, "AMD Athlon II X2 (Regor DA-C3)"),
+    FMSQ(1, 15, 0, 6, 3, dA, "AMD Athlon II (Sargas DA-C3)"),
+    FMS(1, 15, 0, 6, 3, "AMD Athlon (unknown type) (Regor/Sargas/Champlain DA-C3)"),
+    FMQ(1, 15, 0, 6, Ms, "AMD V-Series Mobile (Champlain)"),
+    FMQ(1, 15, 0, 6, MS, "AMD Sempron Mobile (Sargas)"),
+    FMQ(1, 15, 0, 6, DS, "AMD Sempron II X2 (Regor)"),
+    FMQ(1, 15, 0, 6, dS, "AMD Sempron II (Sargas)"),
+    FMQ(1, 15, 0, 6, MT, "AMD Turion II Dual-Core Mobile (Caspian / Champlain)"),
+    FMQ(1, 15, 0, 6, Mp, "AMD Phenom II Dual-Core Mobile (Champlain)"),
+    FMQ(1, 15, 0, 6, MA, "AMD Athlon II Dual-Core Mobile (Regor / Champlain)"),
+    FMQ(1, 15, 0, 6, DA, "AMD Athlon II X2 (Regor)"),
+    FMQ(1, 15, 0, 6, dA, "AMD Athlon II (Sargas)"),
+    FM(1, 15, 0, 6, "AMD Athlon (unknown type) (Regor/Sargas/Caspian/Champlain)"),
+    FMSQ(1, 15, 0, 8, 0, SO, "AMD Six-Core Opteron (Istanbul HY-D0)"),
+    FMSQ(1, 15, 0, 8, 0, sO, "AMD Opteron 4100 (Lisbon HY-D0)"),
+    FMS(1, 15, 0, 8, 0, "AMD Opteron (unknown type) (Lisbon/Istanbul HY-D0)"),
+    FMS(1, 15, 0, 8, 1, "AMD Opteron 4100 (Lisbon HY-D1)"),
+    FMQ(1, 15, 0, 8, SO, "AMD Six-Core Opteron (Istanbul)"),
+    FMQ(1, 15, 0, 8, sO, "AMD Opteron 4100 (Lisbon)"),
+    FM(1, 15, 0, 8, "AMD Opteron (unknown type) (Lisbon/Istanbul)"),
+    FMS(1, 15, 0, 9, 0, "AMD Opteron 6100 (Magny-Cours HY-D0)"), // sandpile.org
+    FMS(1, 15, 0, 9, 1, "AMD Opteron 6100 (Magny-Cours HY-D1)"),
+    FM(1, 15, 0, 9, "AMD Opteron 6100 (Magny-Cours)"),
+    FMSQ(1, 15, 0, 10, 0, Qp, "AMD Phenom II X4 (Zosma PH-E0)"),
+    FMSQ(1, 15, 0, 10, 0, Sp, "AMD Phenom II X6 (Thuban PH-E0)"),
+    FMS(1, 15, 0, 10, 0, "AMD Phenom II (unknown type) (Zosma/Thuban PH-E0)"),
+    FMQ(1, 15, 0, 10, Qp, "AMD Phenom II X4 (Zosma)"),
+    FMQ(1, 15, 0, 10, Sp, "AMD Phenom II X6 (Thuban)"),
+    FM(1, 15, 0, 10, "AMD Phenom II (unknown type) (Zosma/Thuban)"),
+    F(1, 15, "AMD (unknown model)"),
+    FMSQ(2, 15, 0, 3, 1, MU, "AMD Turion X2 Ultra Dual-Core Mobile (Griffin LG-B1)"),
+    FMSQ(2, 15, 0, 3, 1, MT, "AMD Turion X2 Dual-Core Mobile (Lion LG-B1)"),
+    FMSQ(2, 15, 0, 3, 1, DS, "AMD Sempron X2 Dual-Core (Sable LG-B1)"),
+    FMSQ(2, 15, 0, 3, 1, dS, "AMD Sempron (Sable LG-B1)"),
+    FMSQ(2, 15, 0, 3, 1, DA, "AMD Athlon X2 Dual-Core (Lion LG-B1)"),
+    FMSQ(2, 15, 0, 3, 1, dA, "AMD Athlon (Lion LG-B1)"),
+    FMS(2, 15, 0, 3, 1, "AMD Athlon (unknown type) (Lion/Sable LG-B1)"),
+    FMQ(2, 15, 0, 3, MU, "AMD Turion X2 Ultra (Griffin)"),
+    FMQ(2, 15, 0, 3, MT, "AMD Turion X2 (Lion)"),
+    FMQ(2, 15, 0, 3, DS, "AMD Sempron X2 Dual-Core (Sable)"),
+    FMQ(2, 15, 0, 3, dS, "AMD Sempron (Sable)"),
+    FMQ(2, 15, 0, 3, DA, "AMD Athlon X2 Dual-Core (Lion)"),
+    FMQ(2, 15, 0, 3, dA, "AMD Athlon (Lion)"),
+    FM(2, 15, 0, 3, "AMD Athlon (unknown type) (Lion/Sable)"),
+    F(2, 15, "AMD (unknown model)"),
+    FMS(3, 15, 0, 0, 0, "AMD Athlon (unknown type) (Llano LN-A0)"), // sandpile.org
+    FMS(3, 15, 0, 0, 1, "AMD Athlon (unknown type) (Llano LN-A1)"), // sandpile.org
+    FMSQ(3, 15, 0, 1, 0, dS, "AMD Sempron Dual-Core (Llano LN-B0)"),
+    FMSQ(3, 15, 0, 1, 0, dA, "AMD Athlon II Dual-Core (Llano LN-B0)"),
+    FMSQ(3, 15, 0, 1, 0, Sa, "AMD A-Series (Llano LN-B0)"),
+    FMSQ(3, 15, 0, 1, 0, Se, "AMD E2-Series (Llano LN-B0)"),
+    FMS(3, 15, 0, 1, 0, "AMD Athlon (unknown type) (Llano LN-B0)"),
+    FMQ(3, 15, 0, 1, dS, "AMD Sempron Dual-Core (Llano)"),
+    FMQ(3, 15, 0, 1, dA, "AMD Athlon II Dual-Core (Llano)"),
+    FMQ(3, 15, 0, 1, Sa, "AMD A-Series (Llano)"),
+    FMQ(3, 15, 0, 1, Se, "AMD E2-Series (Llano)"),
+    FM(3, 15, 0, 1, "AMD Athlon (unknown type) (Llano)"),
+    FMS(3, 15, 0, 2, 0, "AMD Athlon (unknown type) (Llano LN-B0)"), // sandpile.org
+    F(3, 15, "AMD (unknown model) (Llano)"),
+    FMSQ(5, 15, 0, 1, 0, Sc, "AMD C-Series (Ontario ON-B0)"),
+    FMSQ(5, 15, 0, 1, 0, Se, "AMD E-Series (Zacate ON-B0)"),
+    FMSQ(5, 15, 0, 1, 0, Sg, "AMD G-Series (Ontario/Zacate ON-B0)"),
+    FMSQ(5, 15, 0, 1, 0, Sz, "AMD Z-Series (Desna ON-B0)"),
+    FMS(5, 15, 0, 1, 0, "AMD (unknown type) (Ontario/Zacate/Desna ON-B0)"),
+    FM(5, 15, 0, 1, "AMD (unknown type) (Ontario/Zacate/Desna)"),
+    FMSQ(5, 15, 0, 2, 0, Sc, "AMD C-Series (Ontario ON-C0)"),
+    FMSQ(5, 15, 0, 2, 0, Se, "AMD E-Series (Zacate ON-C0)"),
+    FMSQ(5, 15, 0, 2, 0, Sg, "AMD G-Series (Ontario/Zacate ON-C0)"),
+    FMSQ(5, 15, 0, 2, 0, Sz, "AMD Z-Series (Desna ON-C0)"),
+    FMS(5, 15, 0, 2, 0, "AMD (unknown type) (Ontario/Zacate/Desna ON-C0)"),
+    FM(5, 15, 0, 2, "AMD (unknown type) (Ontario/Zacate/Desna)"),
+    F(5, 15, "AMD (unknown model)"),
+    FMS(6, 15, 0, 0, 0, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A0)"), // sandpile.org
+    FMS(6, 15, 0, 0, 1, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A1)"), // sandpile.org
+    FMS(6, 15, 0, 1, 0, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B0)"), // sandpile.org
+    FMS(6, 15, 0, 1, 1, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B1)"), // sandpile.org
+    FMSQ(6, 15, 0, 1, 2, sO, "AMD Opteron 6200 (Interlagos OR-B2) / Opteron 4200 (Valencia OR-B2) / Opteron 3200 (Zurich OR-B2)"),
+    FMSQ(6, 15, 0, 1, 2, df, "AMD FX-Series (Zambezi OR-B2)"),
+    FMS(6, 15, 0, 1, 2, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B2)"),
+    FMQ(6, 15, 0, 1, sO, "AMD Opteron 6200 (Interlagos) / Opteron 4200 (Valencia) / Opteron 3200 (Zurich)"),
+    FMQ(6, 15, 0, 1, df, "AMD FX-Series (Zambezi)"),
+    FM(6, 15, 0, 1, "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi)"),
+    FMSQ(6, 15, 0, 2, 0, sO, "AMD Opteron 6300 (Abu Dhabi OR-C0) / Opteron 4300 (Seoul OR-C0) / Opteron 3300 (Delhi OR-C0)"),
+    FMSQ(6, 15, 0, 2, 0, df, "AMD FX-Series (Vishera OR-C0)"),
+    FMS(6, 15, 0, 2, 0, "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera OR-C0)"),
+    FMQ(6, 15, 0, 2, sO, "AMD Opteron 6300 (Abu Dhabi) / Opteron 4300 (Seoul) / Opteron 3300 (Delhi)"),
+    FMQ(6, 15, 0, 2, df, "AMD FX-Series (Vishera)"),
+    FM(6, 15, 0, 2, "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera)"),
+    FMSQ(6, 15, 1, 0, 1, Sa, "AMD A-Series (Trinity TN-A1)"),
+    FMSQ(6, 15, 1, 0, 1, Sr, "AMD R-Series (Trinity TN-A1)"),
+    FMSQ(6, 15, 1, 0, 1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity TN-A1)"),
+    FMSQ(6, 15, 1, 0, 1, dS, "AMD Sempron Dual-Core (Trinity TN-A1)"),
+    FMSQ(6, 15, 1, 0, 1, dI, "AMD FirePro (Trinity TN-A1)"),
+    FMS(6, 15, 1, 0, 1, "AMD (unknown type) (Trinity TN-A1)"),
+    FMQ(6, 15, 1, 0, Sa, "AMD A-Series (Trinity)"),
+    FMQ(6, 15, 1, 0, Sr, "AMD R-Series (Trinity)"),
+    FMQ(6, 15, 1, 0, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity)"),
+    FMQ(6, 15, 1, 0, dS, "AMD Sempron Dual-Core (Trinity)"),
+    FMQ(6, 15, 1, 0, dI, "AMD FirePro (Trinity)"),
+    FM(6, 15, 1, 0, "AMD (unknown type) (Trinity TN-A1)"),
+    FMSQ(6, 15, 1, 3, 1, Sa, "AMD A-Series (Richland RL-A1)"),
+    FMSQ(6, 15, 1, 3, 1, Sr, "AMD R-Series (Richland RL-A1)"),
+    FMSQ(6, 15, 1, 3, 1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland RL-A1)"),
+    FMSQ(6, 15, 1, 3, 1, dS, "AMD Sempron Dual-Core (Richland RL-A1)"),
+    FMSQ(6, 15, 1, 3, 1, dI, "AMD FirePro (Richland RL-A1)"),
+    FMS(6, 15, 1, 3, 1, "AMD (unknown type) (Richland RL-A1)"),
+};
+CHECK_SIGNATURES(synth_amd_part_5);
+
+// signature table of AMD processors, part 6, see decode_synth_amd_helper()
+static constexpr synth_row_t  synth_amd_part_6[] = {
+    FMQ(6, 15, 1, 3, Sa, "AMD A-Series (Richland)"),
+    FMQ(6, 15, 1, 3, Sr, "AMD R-Series (Richland)"),
+    FMQ(6, 15, 1, 3, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland)"),
+    FMQ(6, 15, 1, 3, dS, "AMD Sempron Dual-Core (Richland)"),
+    FMQ(6, 15, 1, 3, dI, "AMD FirePro (Richland)"),
+    FM(6, 15, 1, 3, "AMD (unknown type) (Richland)"),
+    FMS(6, 15, 3, 0, 0, "AMD (unknown type) (Kaveri KV-A0)"),
+    FMSQ(6, 15, 3, 0, 1, Sa, "AMD Elite Performance A-Series (Kaveri KV-A1)"),
+    FMSQ(6, 15, 3, 0, 1, Mr, "AMD Mobile R-Series (Kaveri KV-A1)"),
+    FMSQ(6, 15, 3, 0, 1, sO, "AMD Opteron X1200 / X2200 (Kaveri KV-A1)"),
+    FMS(6, 15, 3, 0, 1, "AMD (unknown type) (Kaveri KV-A1)"),
+    FMQ(6, 15, 3, 0, Sa, "AMD Elite Performance A-Series (Kaveri)"),
+    FMQ(6, 15, 3, 0, Mr, "AMD Mobile R-Series (Kaveri)"),
+    FMQ(6, 15, 3, 0, sO, "AMD Opteron X1200 / X2200 (Kaveri)"),
+    FM(6, 15, 3, 0, "AMD (unknown type) (Kaveri)"),
+    FMSQ(6, 15, 3, 8, 1, Sa, "AMD A-Series (Godavari A1)"), // sandpile.org
+    FMS(6, 15, 3, 8, 1, "AMD (unknown type) (Godavari A1)"), // sandpile.org
+    FMQ(6, 15, 3, 8, Sa, "AMD A-Series (Godavari)"),
+    FM(6, 15, 3, 8, "AMD (unknown type) (Godavari)"),
+    FMS(6, 15, 6, 0, 0, "AMD (unknown type) (Carrizo/Toronto CZ-A0)"), // sandpile.org
+    FMSQ(6, 15, 6, 0, 1, sO, "AMD Opteron (Toronto CZ-A1)"), // undocumented, but instlatx64 sample
+    FMSQ(6, 15, 6, 0, 1, df, "AMD FX-Series (Carrizo CZ-A1)"), // undocumented, but instlatx64 sample
+    FMS(6, 15, 6, 0, 1, "AMD (unknown type) (Carrizo/Toronto CZ-A1)"), // undocumented, but instlatx64 sample
+    FMQ(6, 15, 6, 0, sO, "AMD Opteron (Toronto)"), // undocumented, but instlatx64 sample
+    FMQ(6, 15, 6, 0, df, "AMD FX-Series (Carrizo)"), // undocumented, but instlatx64 sample
+    FM(6, 15, 6, 0, "AMD (unknown type) (Carrizo/Toronto)"), // undocumented, but instlatx64 sample
+    FMSQ(6, 15, 6, 5, 1, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge CZ-A1/BR-A1)"), // undocumented, but samples from Alexandros Couloumbis & instlatx64; sandpile.org stepping
+    FMSQ(6, 15, 6, 5, 1, Se, "AMD E-Series (Stoney Ridge CZ-A1/BR-A1)"), // undocumented; sandpile.org stepping
+    FMSQ(6, 15, 6, 5, 1, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon CZ-A1/BR-A1)"), // undocumented; sandpile.org stepping
+    FMSQ(6, 15, 6, 5, 1, Sr, "AMD R-Series (Merlin Falcon CZ-A1/BR-A1)"), // undocumented; sandpile.org stepping
+    FMS(6, 15, 6, 5, 1, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon CZ-A1/BR-A1)"), // sandpile.org
+    FMQ(6, 15, 6, 5, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)"), // undocumented, but samples from Alexandros Couloumbis & instlatx64
+    FMQ(6, 15, 6, 5, Se, "AMD E-Series (Stoney Ridge)"), // undocumented
+    FMQ(6, 15, 6, 5, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)"), // undocumented
+    FMQ(6, 15, 6, 5, Sr, "AMD R-Series (Merlin Falcon)"), // undocumented
+    FM(6, 15, 6, 5, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)"), // undocumented, but sample from Alexandros Couloumbis
+    FMSQ(6, 15, 7, 0, 0, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge ST-A0)"),
+    FMSQ(6, 15, 7, 0, 0, Se, "AMD E-Series (Stoney Ridge ST-A0)"),
+    FMSQ(6, 15, 7, 0, 0, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon ST-A0)"),
+    FMSQ(6, 15, 7, 0, 0, Sr, "AMD R-Series (Merlin Falcon ST-A0)"),
+    FMS(6, 15, 7, 0, 0, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon ST-A0)"),
+    FMQ(6, 15, 7, 0, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)"),
+    FMQ(6, 15, 7, 0, Se, "AMD E-Series (Stoney Ridge)"),
+    FMQ(6, 15, 7, 0, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)"),
+    FMQ(6, 15, 7, 0, Sr, "AMD R-Series (Merlin Falcon)"),
+    FM(6, 15, 7, 0, "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)"),
+    F(6, 15, "AMD (unknown model)"),
+    FMS(7, 15, 0, 0, 0, "AMD (unknown type) (Kabini/Temash/Kyoto KB-A0)"), // sandpile.org
+    FMSQ(7, 15, 0, 0, 1, dA, "AMD Athlon (Kabini KB-A1)"),
+    FMSQ(7, 15, 0, 0, 1, Sa, "AMD A-Series (Kabini/Temash KB-A1)"),
+    FMSQ(7, 15, 0, 0, 1, Se, "AMD E-Series (Kabini KB-A1)"),
+    FMSQ(7, 15, 0, 0, 1, Sg, "AMD G-Series (Kabini KB-A1)"),
+    FMSQ(7, 15, 0, 0, 1, sO, "AMD Opteron X1100/X2100 Series (Kyoto KB-A1)"),
+    FMS(7, 15, 0, 0, 1, "AMD (unknown type) (Kabini/Temash/Kyoto KB-A1)"),
+    FMQ(7, 15, 0, 0, dA, "AMD Athlon (Kabini)"),
+    FMQ(7, 15, 0, 0, Sa, "AMD A-Series (Kabini/Temash)"),
+    FMQ(7, 15, 0, 0, Se, "AMD E-Series (Kabini)"),
+    FMQ(7, 15, 0, 0, Sg, "AMD G-Series (Kabini)"),
+    FMQ(7, 15, 0, 0, sO, "AMD Opteron X1100/X2100 Series (Kyoto)"),
+    FM(7, 15, 0, 0, "AMD (unknown type) (Kabini/Temash/Kyoto)"),
+    FM(7, 15, 2, 6, "AMD (unknown type) (Cato)"), // undocumented; instlatx64 sample; engr sample?
     // sandpile.org mentions (7,15),(0,4) Jaguar-esque "BV" cores
     // (with stepping 1 = A1), but I have no idea of any such code name.
     // The AMD docs (53072) omit the CPUID entirely.  But if this sticks to the
     // recent AMD pattern, these must be (7,15),(3,0).
-    FMSQ(7, 15, 3, 0, 1, Sa, "AMD A-Series (Beema ML-A1)");
-    FMSQ(7, 15, 3, 0, 1, Se, "AMD E-Series (Beema ML-A1)");
-    FMSQ(7, 15, 3, 0, 1, Sg, "AMD G-Series (Steppe Eagle/Crowned Eagle ML-A1)"); // undocumented; instlatx64 sample
-    FMSQ(7, 15, 3, 0, 1, Ta, "AMD A-Series Micro (Mullins ML-A1)");
-    FMSQ(7, 15, 3, 0, 1, Te, "AMD E-Series Micro (Mullins ML-A1)");
-    FMS(7, 15, 3, 0, 1, "AMD (unknown type) (Beema/Mullins ML-A1)");
-    FMQ(7, 15, 3, 0, Sa, "AMD A-Series (Beema)");
-    FMQ(7, 15, 3, 0, Se, "AMD E-Series (Beema)");
-    FMQ(7, 15, 3, 0, Sg, "AMD E-Series (Steppe Eagle/Crowned Eagle)");
-    FMQ(7, 15, 3, 0, Ta, "AMD A-Series Micro (Mullins)");
-    FMQ(7, 15, 3, 0, Te, "AMD E-Series Micro (Mullins)");
-    FM(7, 15, 3, 0, "AMD (unknown type) (Beema/Mullins/Steppe Eagle/Crowned Eagle)");
+    FMSQ(7, 15, 3, 0, 1, Sa, "AMD A-Series (Beema ML-A1)"),
+    FMSQ(7, 15, 3, 0, 1, Se, "AMD E-Series (Beema ML-A1)"),
+    FMSQ(7, 15, 3, 0, 1, Sg, "AMD G-Series (Steppe Eagle/Crowned Eagle ML-A1)"), // undocumented; instlatx64 sample
+    FMSQ(7, 15, 3, 0, 1, Ta, "AMD A-Series Micro (Mullins ML-A1)"),
+    FMSQ(7, 15, 3, 0, 1, Te, "AMD E-Series Micro (Mullins ML-A1)"),
+    FMS(7, 15, 3, 0, 1, "AMD (unknown type) (Beema/Mullins ML-A1)"),
+    FMQ(7, 15, 3, 0, Sa, "AMD A-Series (Beema)"),
+    FMQ(7, 15, 3, 0, Se, "AMD E-Series (Beema)"),
+    FMQ(7, 15, 3, 0, Sg, "AMD E-Series (Steppe Eagle/Crowned Eagle)"),
+    FMQ(7, 15, 3, 0, Ta, "AMD A-Series Micro (Mullins)"),
+    FMQ(7, 15, 3, 0, Te, "AMD E-Series Micro (Mullins)"),
+    FM(7, 15, 3, 0, "AMD (unknown type) (Beema/Mullins/Steppe Eagle/Crowned Eagle)"),
     // sandpile.org mentions (7,15),(6,0) Puma-esque "NL" cores
     // (with stepping 1 = A1), but I have no idea of any such code name.
-    F(7, 15, "AMD (unknown model)");
-    FMS(8, 15, 0, 0, 1, "AMD (unknown type) (Summit Ridge/Naples ZP-A1)"); // sandpile.org
-    FMSQ(8, 15, 0, 1, 0, EE, "AMD EPYC (Snowy Owl ZP-B0)");
-    FMSQ(8, 15, 0, 1, 0, sE, "AMD EPYC (Naples ZP-B0)");
-    FMSQ(8, 15, 0, 1, 0, dR, "AMD Ryzen (Summit Ridge ZP-B0)");
-    FMS(8, 15, 0, 1, 0, "AMD (unknown type) (Summit Ridge/Naples ZP-B0)");
-    FMSQ(8, 15, 0, 1, 1, EE, "AMD EPYC (Snowy Owl ZP-B1)");
-    FMSQ(8, 15, 0, 1, 1, sE, "AMD EPYC (Naples ZP-B1)");
-    FMSQ(8, 15, 0, 1, 1, dR, "AMD Ryzen (Summit Ridge ZP-B1)");
-    FMS(8, 15, 0, 1, 1, "AMD (unknown type) (Summit Ridge/Naples ZP-B1)");
-    FMSQ(8, 15, 0, 1, 2, EE, "AMD EPYC (Snowy Owl ZP-B2)");
-    FMSQ(8, 15, 0, 1, 2, sE, "AMD EPYC (Naples ZP-B2)");
-    FMSQ(8, 15, 0, 1, 2, dR, "AMD Ryzen (Summit Ridge ZP-B2)");
-    FMS(8, 15, 0, 1, 2, "AMD (unknown type) (Summit Ridge/Naples ZP-B2)");
-    FMQ(8, 15, 0, 1, EE, "AMD EPYC (Snowy Owl)");
-    FMQ(8, 15, 0, 1, sE, "AMD EPYC (Naples)");
-    FMQ(8, 15, 0, 1, dR, "AMD Ryzen (Summit Ridge)");
-    FM(8, 15, 0, 1, "AMD (unknown type) (Summit Ridge/Naples)");
-    FMS(8, 15, 0, 8, 2, "AMD Ryzen (Pinnacle Ridge PiR-B2)");
-    FM(8, 15, 0, 8, "AMD Ryzen (Pinnacle Ridge)");
-    FMS(8, 15, 1, 0, 1, "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-A1)"); // found only on en.wikichip.org & instlatx64 examples; sandpile.org
-    FMSQ(8, 15, 1, 1, 0, ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel RV-B0)"); // only instlatx64 example; stepping from usual pattern
-    FMSQ(8, 15, 1, 1, 0, AR, "AMD Ryzen (Raven Ridge RV-B0)"); // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
-    FMS(8, 15, 1, 1, 0, "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-B0)"); // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
-    FMQ(8, 15, 1, 1, ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel)"); // only instlatx64 example
-    FMQ(8, 15, 1, 1, AR, "AMD Ryzen (Raven Ridge)"); // found only on en.wikichip.org & instlatx64 examples
-    FM(8, 15, 1, 1, "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel)"); // found only on en.wikichip.org & instlatx64 examples
-    FMS(8, 15, 1, 8, 1, "AMD Ryzen (Picasso A1)");
-    FM(8, 15, 1, 8, "AMD Ryzen (Picasso)");
-    FMS(8, 15, 2, 0, 1, "AMD Ryzen (Dali A1)");
-    FM(8, 15, 2, 0, "AMD Ryzen (Dali)");
-    FMSQ(8, 15, 3, 1, 0, dR, "AMD Ryzen (Castle Peak B0)");
-    FMQ(8, 15, 3, 1, dR, "AMD Ryzen (Castle Peak)");
-    FMSQ(8, 15, 3, 1, 0, sE, "AMD EPYC (Rome B0)");
-    FMQ(8, 15, 3, 1, sE, "AMD EPYC (Rome)");
-    FMS(8, 15, 3, 1, 0, "AMD Ryzen (Castle Peak B0) / EPYC (Rome B0)");
-    FM(8, 15, 3, 1, "AMD Ryzen (Castle Peak) / EPYC (Rome)");
-    FM(8, 15, 5, 0, "AMD DG02SRTBP4MFA (Fenghuang 15FF)"); // internal model, only instlatx64 example
-    FMS(8, 15, 6, 0, 1, "AMD Ryzen (Renoir A1)");
-    FM(8, 15, 6, 0, "AMD Ryzen (Renoir)");
-    FMS(8, 15, 7, 1, 0, "AMD Ryzen (Matisse B0)"); // undocumented, but samples from Steven Noonan
-    FM(8, 15, 7, 1, "AMD Ryzen (Matisse)"); // undocumented, but samples from Steven Noonan
-    F(8, 15, "AMD (unknown model)");
-    F(10, 15, "AMD (unknown model)"); // undocumented, but samples from Steven Noonan
-    DEFAULT(NULL);
-
-    return result;
-}
+    F(7, 15, "AMD (unknown model)"),
+    FMS(8, 15, 0, 0, 1, "AMD (unknown type) (Summit Ridge/Naples ZP-A1)"), // sandpile.org
+    FMSQ(8, 15, 0, 1, 0, EE, "AMD EPYC (Snowy Owl ZP-B0)"),
+    FMSQ(8, 15, 0, 1, 0, sE, "AMD EPYC (Naples ZP-B0)"),
+    FMSQ(8, 15, 0, 1, 0, dR, "AMD Ryzen (Summit Ridge ZP-B0)"),
+    FMS(8, 15, 0, 1, 0, "AMD (unknown type) (Summit Ridge/Naples ZP-B0)"),
+    FMSQ(8, 15, 0, 1, 1, EE, "AMD EPYC (Snowy Owl ZP-B1)"),
+    FMSQ(8, 15, 0, 1, 1, sE, "AMD EPYC (Naples ZP-B1)"),
+    FMSQ(8, 15, 0, 1, 1, dR, "AMD Ryzen (Summit Ridge ZP-B1)"),
+    FMS(8, 15, 0, 1, 1, "AMD (unknown type) (Summit Ridge/Naples ZP-B1)"),
+    FMSQ(8, 15, 0, 1, 2, EE, "AMD EPYC (Snowy Owl ZP-B2)"),
+    FMSQ(8, 15, 0, 1, 2, sE, "AMD EPYC (Naples ZP-B2)"),
+    FMSQ(8, 15, 0, 1, 2, dR, "AMD Ryzen (Summit Ridge ZP-B2)"),
+    FMS(8, 15, 0, 1, 2, "AMD (unknown type) (Summit Ridge/Naples ZP-B2)"),
+    FMQ(8, 15, 0, 1, EE, "AMD EPYC (Snowy Owl)"),
+    FMQ(8, 15, 0, 1, sE, "AMD EPYC (Naples)"),
+    FMQ(8, 15, 0, 1, dR, "AMD Ryzen (Summit Ridge)"),
+    FM(8, 15, 0, 1, "AMD (unknown type) (Summit Ridge/Naples)"),
+    FMS(8, 15, 0, 8, 2, "AMD Ryzen (Pinnacle Ridge PiR-B2)"),
+    FM(8, 15, 0, 8, "AMD Ryzen (Pinnacle Ridge)"),
+    FMS(8, 15, 1, 0, 1, "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-A1)"), // found only on en.wikichip.org & instlatx64 examples; sandpile.org
+    FMSQ(8, 15, 1, 1, 0, ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel RV-B0)"), // only instlatx64 example; stepping from usual pattern
+    FMSQ(8, 15, 1, 1, 0, AR, "AMD Ryzen (Raven Ridge RV-B0)"), // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
+    FMS(8, 15, 1, 1, 0, "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-B0)"), // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
+    FMQ(8, 15, 1, 1, ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel)"), // only instlatx64 example
+    FMQ(8, 15, 1, 1, AR, "AMD Ryzen (Raven Ridge)"), // found only on en.wikichip.org & instlatx64 examples
+    FM(8, 15, 1, 1, "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel)"), // found only on en.wikichip.org & instlatx64 examples
+    FMS(8, 15, 1, 8, 1, "AMD Ryzen (Picasso A1)"),
+    FM(8, 15, 1, 8, "AMD Ryzen (Picasso)"),
+    FMS(8, 15, 2, 0, 1, "AMD Ryzen (Dali A1)"),
+    FM(8, 15, 2, 0, "AMD Ryzen (Dali)"),
+    FMSQ(8, 15, 3, 1, 0, dR, "AMD Ryzen (Castle Peak B0)"),
+    FMQ(8, 15, 3, 1, dR, "AMD Ryzen (Castle Peak)"),
+    FMSQ(8, 15, 3, 1, 0, sE, "AMD EPYC (Rome B0)"),
+    FMQ(8, 15, 3, 1, sE, "AMD EPYC (Rome)"),
+    FMS(8, 15, 3, 1, 0, "AMD Ryzen (Castle Peak B0) / EPYC (Rome B0)"),
+    FM(8, 15, 3, 1, "AMD Ryzen (Castle Peak) / EPYC (Rome)"),
+    FM(8, 15, 5, 0, "AMD DG02SRTBP4MFA (Fenghuang 15FF)"), // internal model, only instlatx64 example
+    FMS(8, 15, 6, 0, 1, "AMD Ryzen (Renoir A1)"),
+    FM(8, 15, 6, 0, "AMD Ryzen (Renoir)"),
+    FMS(8, 15, 7, 1, 0, "AMD Ryzen (Matisse B0)"), // undocumented, but samples from Steven Noonan
+    FM(8, 15, 7, 1, "AMD Ryzen (Matisse)"), // undocumented, but samples from Steven Noonan
+    F(8, 15, "AMD (unknown model)"),
+    F(10, 15, "AMD (unknown model)"), // undocumented, but samples from Steven Noonan
+};
+CHECK_SIGNATURES(synth_amd_part_6);
 
 // helper for return processor name string = f(val, stash), for AMD
-// can refactor: use criteria descriptors instead if-else sequence by FM and similar macro
+// parts are looked up in order, as one table
 // val   = CPU TFMS signature
 // stash = pointer to structure for accumulate processor information
 static cstring
 decode_synth_amd_helper(unsigned int val, const code_stash_t* stash)
 {
-    cstring  result = NULL;
+    static const signature_table_t  tables[] = {
+        SIGNATURE_TABLE(synth_amd_part_1),
+        SIGNATURE_TABLE(synth_amd_part_2),
+        SIGNATURE_TABLE(synth_amd_part_3),
+        SIGNATURE_TABLE(synth_amd_part_4),
+        SIGNATURE_TABLE(synth_amd_part_5),
+        SIGNATURE_TABLE(synth_amd_part_6),
+    };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
+    cstring                         result = lookup_synth(&index, val, stash);
 
-    result = decode_synth_amd_part_1(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_amd_part_2(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_amd_part_3(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_amd_part_4(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_amd_part_5(val, stash);
-    if (result != NULL) return result;
-    result = decode_synth_amd_part_6(val, stash);
-    if (result != NULL) return result;
-    return "unknown";
+    return (result != NULL) ? result : "unknown";
 }
 
 // return processor name string = f(val, stash), for AMD
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
+// val    = CPU TFMS signature
+// stash  = pointer to structure for accumulate processor information
+// buffer = buffer for build string
 static cstring
-decode_synth_amd(unsigned int val, const code_stash_t* stash)
+decode_synth_amd(unsigned int val, const code_stash_t* stash, char buffer[SYNTH_MAX])
 {
     cstring  result = decode_synth_amd_helper(val, stash);
 
@@ -4690,7 +6057,6 @@ decode_synth_amd(unsigned int val, const code_stash_t* stash)
     char         proc[96];
     decode_amd_model(stash, &brand_pre, &brand_post, proc);
     if (proc[0] != '\0') {
-        static char  buffer[1024];
         sprintf(buffer, "%s %s", result, proc);
         return buffer;
     }
@@ -4698,72 +6064,69 @@ decode_synth_amd(unsigned int val, const code_stash_t* stash)
     return result;
 }
 
+// signature table of CYRIX processors, see decode_synth_cyrix()
+static constexpr synth_row_t  synth_cyrix[] = {
+    FM(0, 4, 0, 4, "Cyrix Media GX / GXm"),
+    FM(0, 4, 0, 9, "Cyrix 5x86"),
+    F(0, 4, "Cyrix 5x86 (unknown model)"),
+    FM(0, 5, 0, 2, "Cyrix M1 6x86"),
+    FMQ(0, 5, 0, 4, cm, "Cyrix MediaGX (C6)"),
+    FM(0, 5, 0, 4, "Cyrix M1 WinChip (C6)"),
+    FM(0, 5, 0, 8, "Cyrix M1 WinChip 2 (C6-2)"),
+    FM(0, 5, 0, 9, "Cyrix M1 WinChip 3 (C6-2)"),
+    F(0, 5, "Cyrix M1 (unknown model)"),
+    FM(0, 6, 0, 0, "Cyrix M2 6x86MX"),
+    FM(0, 6, 0, 5, "Cyrix M2"),
+    F(0, 6, "Cyrix M2 (unknown model)"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_cyrix);
+
 // return processor name string = f(val, stash), for CYRIX
 // val   = CPU TFMS signature
 // stash = pointer to structure for accumulate processor information
 static cstring
 decode_synth_cyrix(unsigned int val, const code_stash_t* stash)
 {
-    cstring  result = NULL;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_cyrix) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    FM(0, 4, 0, 4, "Cyrix Media GX / GXm");
-    FM(0, 4, 0, 9, "Cyrix 5x86");
-    F(0, 4, "Cyrix 5x86 (unknown model)");
-    FM(0, 5, 0, 2, "Cyrix M1 6x86");
-    FMQ(0, 5, 0, 4, cm, "Cyrix MediaGX (C6)");
-    FM(0, 5, 0, 4, "Cyrix M1 WinChip (C6)");
-    FM(0, 5, 0, 8, "Cyrix M1 WinChip 2 (C6-2)");
-    FM(0, 5, 0, 9, "Cyrix M1 WinChip 3 (C6-2)");
-    F(0, 5, "Cyrix M1 (unknown model)");
-    FM(0, 6, 0, 0, "Cyrix M2 6x86MX");
-    FM(0, 6, 0, 5, "Cyrix M2");
-    F(0, 6, "Cyrix M2 (unknown model)");
-    DEFAULT("unknown");
-
-    return result;
+    return lookup_synth(&index, val, stash);
 }
 
-// return processor name string = f(val, stash), for VIA
-// val   = CPU TFMS signature
-// stash = pointer to structure for accumulate processor information
-static cstring
-decode_synth_via(unsigned int val, const code_stash_t* stash)
-{
-    cstring  result = NULL;
-
-    START;
-    FM(0, 5, 0, 4, "VIA WinChip (C6)");
-    FM(0, 5, 0, 8, "VIA WinChip 2 (C6-2)");
-    FM(0, 6, 0, 6, "VIA C3 (Samuel C5A)");
-    FMS(0, 6, 0, 7, 0, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FMS(0, 6, 0, 7, 1, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FMS(0, 6, 0, 7, 2, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FMS(0, 6, 0, 7, 3, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FMS(0, 6, 0, 7, 4, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FMS(0, 6, 0, 7, 5, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FMS(0, 6, 0, 7, 6, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FMS(0, 6, 0, 7, 7, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um");
-    FM(0, 6, 0, 7, "VIA C3 (Ezra C5C), .13um");
-    FM(0, 6, 0, 8, "VIA C3 (Ezra-T C5N)");
-    FMS(0, 6, 0, 9, 0, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FMS(0, 6, 0, 9, 1, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FMS(0, 6, 0, 9, 2, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FMS(0, 6, 0, 9, 3, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FMS(0, 6, 0, 9, 4, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FMS(0, 6, 0, 9, 5, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FMS(0, 6, 0, 9, 6, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FMS(0, 6, 0, 9, 7, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)");
-    FM(0, 6, 0, 9, "VIA C3 / C3-M / Eden-N (Antaur C5P)");
+// signature table of VIA processors, see decode_synth_via()
+static constexpr synth_row_t  synth_via[] = {
+    FM(0, 5, 0, 4, "VIA WinChip (C6)"),
+    FM(0, 5, 0, 8, "VIA WinChip 2 (C6-2)"),
+    FM(0, 6, 0, 6, "VIA C3 (Samuel C5A)"),
+    FMS(0, 6, 0, 7, 0, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FMS(0, 6, 0, 7, 1, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FMS(0, 6, 0, 7, 2, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FMS(0, 6, 0, 7, 3, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FMS(0, 6, 0, 7, 4, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FMS(0, 6, 0, 7, 5, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FMS(0, 6, 0, 7, 6, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FMS(0, 6, 0, 7, 7, "VIA C3 (Samuel 2 C5B) / Eden ESP 4000/5000/6000, .15um"),
+    FM(0, 6, 0, 7, "VIA C3 (Ezra C5C), .13um"),
+    FM(0, 6, 0, 8, "VIA C3 (Ezra-T C5N)"),
+    FMS(0, 6, 0, 9, 0, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FMS(0, 6, 0, 9, 1, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FMS(0, 6, 0, 9, 2, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FMS(0, 6, 0, 9, 3, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FMS(0, 6, 0, 9, 4, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FMS(0, 6, 0, 9, 5, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FMS(0, 6, 0, 9, 6, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FMS(0, 6, 0, 9, 7, "VIA C3 / Eden ESP 7000/8000/10000 (Nehemiah C5XL)"),
+    FM(0, 6, 0, 9, "VIA C3 / C3-M / Eden-N (Antaur C5P)"),
     // VIA unpublished BIOS Guide for C7-D.
-    FM(0, 6, 0, 10, "VIA C7 / C7-M / C7-D / Eden (Esther C5J Model A)");
+    FM(0, 6, 0, 10, "VIA C7 / C7-M / C7-D / Eden (Esther C5J Model A)"),
     // VIA unpublished BIOS Guide for C7-D.
     // Brand string can be used to differentiate model D CPUs.
-    FMQ(0, 6, 0, 13, vM, "VIA C7-M (Esther C5J Model D)");
-    FMQ(0, 6, 0, 13, vD, "VIA C7-D (Esther C5J Model D)");
-    FMQ(0, 6, 0, 13, v7, "VIA C7 (Esther C5J Model D)");
-    FMQ(0, 6, 0, 13, vE, "VIA Eden (Esther C5J Model D)");
-    FM(0, 6, 0, 13, "VIA (unknown type) (Esther C5J Model D)");
+    FMQ(0, 6, 0, 13, vM, "VIA C7-M (Esther C5J Model D)"),
+    FMQ(0, 6, 0, 13, vD, "VIA C7-D (Esther C5J Model D)"),
+    FMQ(0, 6, 0, 13, v7, "VIA C7 (Esther C5J Model D)"),
+    FMQ(0, 6, 0, 13, vE, "VIA Eden (Esther C5J Model D)"),
+    FM(0, 6, 0, 13, "VIA (unknown type) (Esther C5J Model D)"),
     // VIA unpublished BIOS Guide for Nano, Eden (for steppings 3-14, other than
     // Zhaoxin).
     //
@@ -4775,238 +6138,297 @@ decode_synth_via(unsigned int val, const code_stash_t* stash)
     //    Isaiah    = 65nm, 40nm
     //    Isaiah II = 28nm
     //    ZhangJiang (Zhaoxin) = 28nm ?
-    FMS(0, 6, 0, 15, 0, "VIA Nano 1000/2000 (Isaiah CNA A0)"); // redray; instlatx64 example
-    FMS(0, 6, 0, 15, 1, "VIA Nano 1000/2000 (Isaiah CNA A1)"); // redray; model numbers assumed because of bracketing between 0 & 3
-    FMS(0, 6, 0, 15, 2, "VIA Nano 1000/2000 (Isaiah CNA A2)"); // redray; model numbers assumed because of bracketing between 0 & 3
-    FMS(0, 6, 0, 15, 3, "VIA Nano 1000/2000 (Isaiah CNA A3)");
-    FMS(0, 6, 0, 15, 8, "VIA Nano 3000 (Isaiah CNB A1)");
-    FMS(0, 6, 0, 15, 10, "VIA Nano 3000 (Isaiah CNC A2)");
-    FMS(0, 6, 0, 15, 12, "VIA Nano X2 4000 / QuadCore 4000 (Isaiah CNQ A1)");
-    FMS(0, 6, 0, 15, 13, "VIA Nano X2 4000 / QuadCore 4000 (Isaiah CNQ A2)");
-    FMSQ(0, 6, 0, 15, 14, vZ, "Zhaoxin KaiXian/Kaisheng ZX-C/ZX-C+");
-    FMS(0, 6, 0, 15, 14, "VIA Eden X4 4000 (Isaiah CNR)");
-    FM(0, 6, 0, 15, "VIA Nano / Eden (unknown type) (Isaiah)");
-    F(0, 6, "VIA C3 / C3-M / C7 / C7-M / Eden / Eden ESP 7000/8000/10000 / Nano (unknown model)");
-    FM(0, 7, 0, 11, "Zhaoxin KaiXian KX-5000 / Kaisheng KH-20000 (WuDaoKou)"); // geekbench.com example
-    FMQ(0, 7, 3, 11, vZ, "Zhaoxin KaiXian KX-6000 / Kaisheng KH-30000 (LuJiaZui)"); // instlatx64 example with CentaurHauls vendor!
-    DEFAULT("unknown");
+    FMS(0, 6, 0, 15, 0, "VIA Nano 1000/2000 (Isaiah CNA A0)"), // redray; instlatx64 example
+    FMS(0, 6, 0, 15, 1, "VIA Nano 1000/2000 (Isaiah CNA A1)"), // redray; model numbers assumed because of bracketing between 0 & 3
+    FMS(0, 6, 0, 15, 2, "VIA Nano 1000/2000 (Isaiah CNA A2)"), // redray; model numbers assumed because of bracketing between 0 & 3
+    FMS(0, 6, 0, 15, 3, "VIA Nano 1000/2000 (Isaiah CNA A3)"),
+    FMS(0, 6, 0, 15, 8, "VIA Nano 3000 (Isaiah CNB A1)"),
+    FMS(0, 6, 0, 15, 10, "VIA Nano 3000 (Isaiah CNC A2)"),
+    FMS(0, 6, 0, 15, 12, "VIA Nano X2 4000 / QuadCore 4000 (Isaiah CNQ A1)"),
+    FMS(0, 6, 0, 15, 13, "VIA Nano X2 4000 / QuadCore 4000 (Isaiah CNQ A2)"),
+    FMSQ(0, 6, 0, 15, 14, vZ, "Zhaoxin KaiXian/Kaisheng ZX-C/ZX-C+"),
+    FMS(0, 6, 0, 15, 14, "VIA Eden X4 4000 (Isaiah CNR)"),
+    FM(0, 6, 0, 15, "VIA Nano / Eden (unknown type) (Isaiah)"),
+    F(0, 6, "VIA C3 / C3-M / C7 / C7-M / Eden / Eden ESP 7000/8000/10000 / Nano (unknown model)"),
+    FM(0, 7, 0, 11, "Zhaoxin KaiXian KX-5000 / Kaisheng KH-20000 (WuDaoKou)"), // geekbench.com example
+    FMQ(0, 7, 3, 11, vZ, "Zhaoxin KaiXian KX-6000 / Kaisheng KH-30000 (LuJiaZui)"), // instlatx64 example with CentaurHauls vendor!
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_via);
 
-    return result;
+// return processor name string = f(val, stash), for VIA
+// val   = CPU TFMS signature
+// stash = pointer to structure for accumulate processor information
+static cstring
+decode_synth_via(unsigned int val, const code_stash_t* stash)
+{
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_via) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
+
+    return lookup_synth(&index, val, stash);
 }
 
+// signature table of UMC processors, see decode_synth_umc()
+static constexpr synth_row_t  synth_umc[] = {
+    FM(0, 4, 0, 1, "UMC U5D (486DX)"),
+    FMS(0, 4, 0, 2, 3, "UMC U5S (486SX)"),
+    FM(0, 4, 0, 2, "UMC U5S (486SX) (unknown stepping)"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_umc);
+
 // return processor name string = f(val), for UMC
 // val   = CPU TFMS signature
 static cstring
 decode_synth_umc(unsigned int val)
 {
-    cstring  result = NULL;
-
-    START;
-    FM(0, 4, 0, 1, "UMC U5D (486DX)");
-    FMS(0, 4, 0, 2, 3, "UMC U5S (486SX)");
-    FM(0, 4, 0, 2, "UMC U5S (486SX) (unknown stepping)");
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_umc) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of NEXGEN processors, see decode_synth_nexgen()
+static constexpr synth_row_t  synth_nexgen[] = {
+    FMS(0, 5, 0, 0, 4, "NexGen P100"),
+    FMS(0, 5, 0, 0, 6, "NexGen P120 (E2/C0)"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_nexgen);
+
 // return processor name string = f(val), for NEXGEN
 // val   = CPU TFMS signature
 static cstring
 decode_synth_nexgen(unsigned int val)
 {
-    cstring  result = NULL;
-
-    START;
-    FMS(0, 5, 0, 0, 4, "NexGen P100");
-    FMS(0, 5, 0, 0, 6, "NexGen P120 (E2/C0)");
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_nexgen) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of RISE processors, see decode_synth_rise()
+static constexpr synth_row_t  synth_rise[] = {
+    FM(0, 5, 0, 0, "Rise mP6 iDragon, .25u"),
+    FM(0, 5, 0, 2, "Rise mP6 iDragon, .18u"),
+    FM(0, 5, 0, 8, "Rise mP6 iDragon II, .25u"),
+    FM(0, 5, 0, 9, "Rise mP6 iDragon II, .18u"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_rise);
+
 // return processor name string = f(val), for RISE
 // val   = CPU TFMS signature
 static cstring
 decode_synth_rise(unsigned int val)
 {
-    cstring  result = NULL;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_rise) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    FM(0, 5, 0, 0, "Rise mP6 iDragon, .25u");
-    FM(0, 5, 0, 2, "Rise mP6 iDragon, .18u");
-    FM(0, 5, 0, 8, "Rise mP6 iDragon II, .25u");
-    FM(0, 5, 0, 9, "Rise mP6 iDragon II, .18u");
-    DEFAULT("unknown");
-
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of TRANSMETA processors, see decode_synth_transmeta()
+static constexpr synth_row_t  synth_transmeta[] = {
+    /* TODO: Add code-based detail for Transmeta Crusoe TM5700/TM5900 */
+    /* TODO: Add code-based detail for Transmeta Efficeon */
+    FMSQ(0, 5, 0, 4, 2, t2, "Transmeta Crusoe TM3200"),
+    FMS(0, 5, 0, 4, 2, "Transmeta Crusoe TM3x00 (unknown model)"),
+    FMSQ(0, 5, 0, 4, 3, t4, "Transmeta Crusoe TM5400"),
+    FMSQ(0, 5, 0, 4, 3, t5, "Transmeta Crusoe TM5500 / Crusoe SE TM55E"),
+    FMSQ(0, 5, 0, 4, 3, t6, "Transmeta Crusoe TM5600"),
+    FMSQ(0, 5, 0, 4, 3, t8, "Transmeta Crusoe TM5800 / Crusoe SE TM58E"),
+    FMS(0, 5, 0, 4, 3, "Transmeta Crusoe TM5x00 (unknown model)"),
+    FM(0, 5, 0, 4, "Transmeta Crusoe"),
+    F(0, 5, "Transmeta Crusoe (unknown model)"),
+    FM(0, 15, 0, 2, "Transmeta Efficeon TM8x00"),
+    FM(0, 15, 0, 3, "Transmeta Efficeon TM8x00"),
+    F(0, 15, "Transmeta Efficeon (unknown model)"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_transmeta);
+
 // return processor name string = f(val, stash), for TRANSMETA
 // val   = CPU TFMS signature
 // stash = pointer to structure for accumulate processor information
 static cstring
 decode_synth_transmeta(unsigned int val, const code_stash_t* stash)
 {
-    cstring  result = NULL;
-
-    /* TODO: Add code-based detail for Transmeta Crusoe TM5700/TM5900 */
-    /* TODO: Add code-based detail for Transmeta Efficeon */
-    START;
-    FMSQ(0, 5, 0, 4, 2, t2, "Transmeta Crusoe TM3200");
-    FMS(0, 5, 0, 4, 2, "Transmeta Crusoe TM3x00 (unknown model)");
-    FMSQ(0, 5, 0, 4, 3, t4, "Transmeta Crusoe TM5400");
-    FMSQ(0, 5, 0, 4, 3, t5, "Transmeta Crusoe TM5500 / Crusoe SE TM55E");
-    FMSQ(0, 5, 0, 4, 3, t6, "Transmeta Crusoe TM5600");
-    FMSQ(0, 5, 0, 4, 3, t8, "Transmeta Crusoe TM5800 / Crusoe SE TM58E");
-    FMS(0, 5, 0, 4, 3, "Transmeta Crusoe TM5x00 (unknown model)");
-    FM(0, 5, 0, 4, "Transmeta Crusoe");
-    F(0, 5, "Transmeta Crusoe (unknown model)");
-    FM(0, 15, 0, 2, "Transmeta Efficeon TM8x00");
-    FM(0, 15, 0, 3, "Transmeta Efficeon TM8x00");
-    F(0, 15, "Transmeta Efficeon (unknown model)");
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_transmeta) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, stash);
 }
 
+// signature table of SIS processors, see decode_synth_sis()
+static constexpr synth_row_t  synth_sis[] = {
+    FM(0, 5, 0, 0, "SiS 55x"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_sis);
+
 // return processor name string = f(val), for SIS
 // val   = CPU TFMS signature
 static cstring
 decode_synth_sis(unsigned int val)
 {
-    cstring  result = NULL;
-
-    START;
-    FM(0, 5, 0, 0, "SiS 55x");
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_sis) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of NSC processors, see decode_synth_nsc()
+static constexpr synth_row_t  synth_nsc[] = {
+    FM(0, 5, 0, 4, "NSC Geode GX1/GXLV/GXm"),
+    FM(0, 5, 0, 5, "NSC Geode GX2"),
+    FM(0, 5, 0, 10, "NSC Geode LX"), // sandpile.org
+    F(0, 5, "NSC Geode (unknown model)"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_nsc);
+
 // return processor name string = f(val), for NSC
 // val   = CPU TFMS signature
 static cstring
 decode_synth_nsc(unsigned int val)
 {
-    cstring  result = NULL;
-
-    START;
-    FM(0, 5, 0, 4, "NSC Geode GX1/GXLV/GXm");
-    FM(0, 5, 0, 5, "NSC Geode GX2");
-    FM(0, 5, 0, 10, "NSC Geode LX"); // sandpile.org
-    F(0, 5, "NSC Geode (unknown model)");
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_nsc) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of VORTEX processors, see decode_synth_vortex()
+static constexpr synth_row_t  synth_vortex[] = {
+    FM(0, 5, 0, 2, "Vortex86DX"),
+    FM(0, 5, 0, 8, "Vortex86MX"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_vortex);
+
 // return processor name string = f(val), for VORTEX
 // val   = CPU TFMS signature
 static cstring
 decode_synth_vortex(unsigned int val)
 {
-    cstring  result = NULL;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_vortex) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    FM(0, 5, 0, 2, "Vortex86DX");
-    FM(0, 5, 0, 8, "Vortex86MX");
-    DEFAULT("unknown");
-
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of RDC processors, see decode_synth_rdc()
+static constexpr synth_row_t  synth_rdc[] = {
+    FM(0, 5, 0, 8, "RDC IAD 100"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_rdc);
+
 // return processor name string = f(val), for RDC
 // val   = CPU TFMS signature
 static cstring
 decode_synth_rdc(unsigned int val)
 {
-    cstring  result = NULL;
-
-    START;
-    FM(0, 5, 0, 8, "RDC IAD 100");
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_rdc) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of HYGON processors, see decode_synth_hygon()
+static constexpr synth_row_t  synth_hygon[] = {
+    FMS(9, 15, 0, 0, 1, "Hygon Dhyana (A1)"),
+    FMS(9, 15, 0, 0, 2, "Hygon Dhyana (A2)"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_hygon);
+
 // return processor name string = f(val), for HYGON
 // val   = CPU TFMS signature
 static cstring
 decode_synth_hygon(unsigned int val)
 {
-    cstring  result = NULL;
-
-    START;
-    FMS(9, 15, 0, 0, 1, "Hygon Dhyana (A1)");
-    FMS(9, 15, 0, 0, 2, "Hygon Dhyana (A2)");
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_hygon) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of ZHAOXIN processors, see decode_synth_zhaoxin()
+static constexpr synth_row_t  synth_zhaoxin[] = {
+    FM(0, 7, 1, 11, "Zhaoxin KaiXian KX-5000 / Kaisheng KH-20000 (WuDaoKou)"),
+    FM(0, 7, 1, 15, "Zhaoxin KaiXian ZX-D (WuDaoKou)"), // geekbench.com example (steppings 12 & 14)
+    FM(0, 7, 3, 11, "Zhaoxin KaiXian KX-6000 / Kaisheng KH-30000 (LuJiaZui)"), // /proc/cpuinfo screenshot: KX-6840@3000MHz (stepping 0)
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(synth_zhaoxin);
+
 // return processor name string = f(val), for ZHAOXIN
 // val   = CPU TFMS signature
 static cstring
 decode_synth_zhaoxin(unsigned int val)
 {
-    cstring  result = NULL;
-
-    START;
-    FM(0, 7, 1, 11, "Zhaoxin KaiXian KX-5000 / Kaisheng KH-20000 (WuDaoKou)");
-    FM(0, 7, 1, 15, "Zhaoxin KaiXian ZX-D (WuDaoKou)"); // geekbench.com example (steppings 12 & 14)
-    FM(0, 7, 3, 11, "Zhaoxin KaiXian KX-6000 / Kaisheng KH-30000 (LuJiaZui)"); // /proc/cpuinfo screenshot: KX-6840@3000MHz (stepping 0)
-    DEFAULT("unknown");
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(synth_zhaoxin) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    return result;
+    return lookup_synth(&index, val, NULL);
 }
 
+// signature table of AMD processors models, see decode_x_synth_amd()
+static constexpr synth_row_t  x_synth_amd[] = {
+    FM(0, 5, 0, 0, "AMD SSA5 (PR75, PR90, PR100)"),
+    FM(0, 5, 0, 1, "AMD 5k86 (PR120, PR133)"),
+    FM(0, 5, 0, 2, "AMD 5k86 (PR166)"),
+    FM(0, 5, 0, 3, "AMD 5k86 (PR200)"),
+    F(0, 5, "AMD 5k86 (unknown model)"),
+    FM(0, 6, 0, 6, "AMD K6, .30um"),
+    FM(0, 6, 0, 7, "AMD K6 (Little Foot), .25um"),
+    FMS(0, 6, 0, 8, 0, "AMD K6-2 (Chomper A)"),
+    FMS(0, 6, 0, 8, 12, "AMD K6-2 (Chomper A)"),
+    FM(0, 6, 0, 8, "AMD K6-2 (Chomper)"),
+    FMS(0, 6, 0, 9, 1, "AMD K6-III (Sharptooth B)"),
+    FM(0, 6, 0, 9, "AMD K6-III (Sharptooth)"),
+    FM(0, 6, 0, 13, "AMD K6-2+, K6-III+"),
+    F(0, 6, "AMD K6 (unknown model)"),
+    FM(0, 7, 0, 1, "AMD Athlon, .25um"),
+    FM(0, 7, 0, 2, "AMD Athlon (K75 / Pluto / Orion), .18um"),
+    FMS(0, 7, 0, 3, 0, "AMD Duron / mobile Duron (Spitfire A0)"),
+    FMS(0, 7, 0, 3, 1, "AMD Duron / mobile Duron (Spitfire A2)"),
+    FM(0, 7, 0, 3, "AMD Duron / mobile Duron (Spitfire)"),
+    FMS(0, 7, 0, 4, 2, "AMD Athlon (Thunderbird A4-A7)"),
+    FMS(0, 7, 0, 4, 4, "AMD Athlon (Thunderbird A9)"),
+    FM(0, 7, 0, 4, "AMD Athlon (Thunderbird)"),
+    FMS(0, 7, 0, 6, 0, "AMD Athlon / Athlon MP mobile Athlon 4 / mobile Duron (Palomino A0)"),
+    FMS(0, 7, 0, 6, 1, "AMD Athlon / Athlon MP / Duron / mobile Athlon / mobile Duron (Palomino A2)"),
+    FMS(0, 7, 0, 6, 2, "AMD Athlon MP / Athlon XP / Duron / Duron MP / mobile Athlon / mobile Duron (Palomino A5)"),
+    FM(0, 7, 0, 6, "AMD Athlon / Athlon MP / Athlon XP / Duron / Duron MP / mobile Athlon / mobile Duron (Palomino)"),
+    FMS(0, 7, 0, 7, 0, "AMD Duron / Duron MP / mobile Duron (Morgan A0)"),
+    FMS(0, 7, 0, 7, 1, "AMD Duron / Duron MP / mobile Duron (Morgan A1)"),
+    FM(0, 7, 0, 7, "AMD Duron / Duron MP / mobile Duron (Morgan)"),
+    FMS(0, 7, 0, 8, 0, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP (Thoroughbred A0)"),
+    FMS(0, 7, 0, 8, 1, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP (Thoroughbred B0)"),
+    FM(0, 7, 0, 8, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP (Thoroughbred)"),
+    FMS(0, 7, 0, 10, 0, "AMD Athlon XP / Athlon MP / Sempron / mobile Athlon XP-M / mobile Athlon XP-M (LV) (Barton A2)"),
+    FM(0, 7, 0, 10, "AMD Athlon XP / Athlon MP / Sempron / mobile Athlon XP-M / mobile Athlon XP-M (LV) (Barton)"),
+    F(0, 7, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP / mobile Athlon / mobile Athlon XP-M / mobile Athlon XP-M (LV) / mobile Duron (unknown model)"),
+};
+CHECK_SIGNATURES(x_synth_amd);
+
 // return processor models name string = f(val), for AMD
-// val = CPU TFMS signature, extended CPUID function 80000001h, register EAX output
+// val    = CPU TFMS signature, extended CPUID function 80000001h, register EAX output
+// buffer = buffer for build string
 static cstring
-decode_x_synth_amd(unsigned int val)
+decode_x_synth_amd(unsigned int val, char buffer[SYNTH_MAX])
 {
-    cstring  result;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(x_synth_amd) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
+    cstring                         result = lookup_synth(&index, val, NULL);
 
-    START;
-    FM(0, 5, 0, 0, "AMD SSA5 (PR75, PR90, PR100)");
-    FM(0, 5, 0, 1, "AMD 5k86 (PR120, PR133)");
-    FM(0, 5, 0, 2, "AMD 5k86 (PR166)");
-    FM(0, 5, 0, 3, "AMD 5k86 (PR200)");
-    F(0, 5, "AMD 5k86 (unknown model)");
-    FM(0, 6, 0, 6, "AMD K6, .30um");
-    FM(0, 6, 0, 7, "AMD K6 (Little Foot), .25um");
-    FMS(0, 6, 0, 8, 0, "AMD K6-2 (Chomper A)");
-    FMS(0, 6, 0, 8, 12, "AMD K6-2 (Chomper A)");
-    FM(0, 6, 0, 8, "AMD K6-2 (Chomper)");
-    FMS(0, 6, 0, 9, 1, "AMD K6-III (Sharptooth B)");
-    FM(0, 6, 0, 9, "AMD K6-III (Sharptooth)");
-    FM(0, 6, 0, 13, "AMD K6-2+, K6-III+");
-    F(0, 6, "AMD K6 (unknown model)");
-    FM(0, 7, 0, 1, "AMD Athlon, .25um");
-    FM(0, 7, 0, 2, "AMD Athlon (K75 / Pluto / Orion), .18um");
-    FMS(0, 7, 0, 3, 0, "AMD Duron / mobile Duron (Spitfire A0)");
-    FMS(0, 7, 0, 3, 1, "AMD Duron / mobile Duron (Spitfire A2)");
-    FM(0, 7, 0, 3, "AMD Duron / mobile Duron (Spitfire)");
-    FMS(0, 7, 0, 4, 2, "AMD Athlon (Thunderbird A4-A7)");
-    FMS(0, 7, 0, 4, 4, "AMD Athlon (Thunderbird A9)");
-    FM(0, 7, 0, 4, "AMD Athlon (Thunderbird)");
-    FMS(0, 7, 0, 6, 0, "AMD Athlon / Athlon MP mobile Athlon 4 / mobile Duron (Palomino A0)");
-    FMS(0, 7, 0, 6, 1, "AMD Athlon / Athlon MP / Duron / mobile Athlon / mobile Duron (Palomino A2)");
-    FMS(0, 7, 0, 6, 2, "AMD Athlon MP / Athlon XP / Duron / Duron MP / mobile Athlon / mobile Duron (Palomino A5)");
-    FM(0, 7, 0, 6, "AMD Athlon / Athlon MP / Athlon XP / Duron / Duron MP / mobile Athlon / mobile Duron (Palomino)");
-    FMS(0, 7, 0, 7, 0, "AMD Duron / Duron MP / mobile Duron (Morgan A0)");
-    FMS(0, 7, 0, 7, 1, "AMD Duron / Duron MP / mobile Duron (Morgan A1)");
-    FM(0, 7, 0, 7, "AMD Duron / Duron MP / mobile Duron (Morgan)");
-    FMS(0, 7, 0, 8, 0, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP (Thoroughbred A0)");
-    FMS(0, 7, 0, 8, 1, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP (Thoroughbred B0)");
-    FM(0, 7, 0, 8, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP (Thoroughbred)");
-    FMS(0, 7, 0, 10, 0, "AMD Athlon XP / Athlon MP / Sempron / mobile Athlon XP-M / mobile Athlon XP-M (LV) (Barton A2)");
-    FM(0, 7, 0, 10, "AMD Athlon XP / Athlon MP / Sempron / mobile Athlon XP-M / mobile Athlon XP-M (LV) (Barton)");
-    F(0, 7, "AMD Athlon XP / Athlon MP / Sempron / Duron / Duron MP / mobile Athlon / mobile Athlon XP-M / mobile Athlon XP-M (LV) / mobile Duron (unknown model)");
-    FALLBACK({ result = append_uarch(decode_synth_amd(val, NULL), val, VENDOR_AMD); })
-
-        return result;
+    if (result == NULL) {
+        result = append_uarch(decode_synth_amd(val, NULL, buffer), val, VENDOR_AMD, buffer);
+    }
+    return result;
 }
 
 // print processor name string = f(val), for AMD
@@ -5014,26 +6436,23 @@ decode_x_synth_amd(unsigned int val)
 static void
 print_x_synth_amd(unsigned int val)
 {
-    ccstring  synth = decode_x_synth_amd(val);
+    char      buffer[SYNTH_MAX];
+    ccstring  synth = decode_x_synth_amd(val, buffer);
 
-    printf("      (simple synth)  = ");
+    emit("      (simple synth)  = ");
     if (synth != NULL) {
-        printf("%s", synth);
+        emit("%s", synth);
     }
-    printf("\n");
+    emit("\n");
 }
 
 // return processor name string = f(val), for HYGON
-// val = CPU TFMS signature, extended CPUID function 80000001h, register EAX output
+// val    = CPU TFMS signature, extended CPUID function 80000001h, register EAX output
+// buffer = buffer for build string
 static cstring
-decode_x_synth_hygon(unsigned int val)
+decode_x_synth_hygon(unsigned int val, char buffer[SYNTH_MAX])
 {
-    cstring  result;
-
-    START;
-    FALLBACK({ result = append_uarch(decode_synth_hygon(val), val, VENDOR_HYGON); })
-
-        return result;
+    return append_uarch(decode_synth_hygon(val), val, VENDOR_HYGON, buffer);
 }
 
 // print processor name string = f(val), for HYGON
@@ -5041,40 +6460,45 @@ decode_x_synth_hygon(unsigned int val)
 static void
 print_x_synth_hygon(unsigned int val)
 {
-    ccstring  synth = decode_x_synth_hygon(val);
+    char      buffer[SYNTH_MAX];
+    ccstring  synth = decode_x_synth_hygon(val, buffer);
 
-    printf("      (simple synth)  = ");
+    emit("      (simple synth)  = ");
     if (synth != NULL) {
-        printf("%s", synth);
+        emit("%s", synth);
     }
-    printf("\n");
+    emit("\n");
 }
 
+// signature table of VIA processors models, see decode_x_synth_via()
+static constexpr synth_row_t  x_synth_via[] = {
+    FM(0, 6, 0, 6, "VIA C3 (WinChip C5A)"),
+    FMS(0, 6, 0, 7, 0, "VIA C3 (WinChip C5B)"),
+    FMS(0, 6, 0, 7, 1, "VIA C3 (WinChip C5B)"),
+    FMS(0, 6, 0, 7, 2, "VIA C3 (WinChip C5B)"),
+    FMS(0, 6, 0, 7, 3, "VIA C3 (WinChip C5B)"),
+    FMS(0, 6, 0, 7, 4, "VIA C3 (WinChip C5B)"),
+    FMS(0, 6, 0, 7, 5, "VIA C3 (WinChip C5B)"),
+    FMS(0, 6, 0, 7, 6, "VIA C3 (WinChip C5B)"),
+    FMS(0, 6, 0, 7, 7, "VIA C3 (WinChip C5B)"),
+    FM(0, 6, 0, 7, "VIA C3 (WinChip C5C)"),
+    FM(0, 6, 0, 8, "VIA C3 (WinChip C5N)"),
+    FM(0, 6, 0, 9, "VIA C3 (WinChip C5XL)"),
+    F(0, 6, "VIA C3 (unknown model)"),
+    DEFAULT("unknown"),
+};
+CHECK_SIGNATURES(x_synth_via);
+
 // return processor name string = f(val), for VIA
-// val = CPU TFMS signature, extended CPUID function 80000001h, register EAX output
+// val    = CPU TFMS signature, extended CPUID function 80000001h, register EAX output
+// buffer = buffer for build string
 static cstring
-decode_x_synth_via(unsigned int val)
+decode_x_synth_via(unsigned int val, char buffer[SYNTH_MAX])
 {
-    cstring  result;
+    static const signature_table_t  tables[] = { SIGNATURE_TABLE(x_synth_via) };
+    static const signature_index_t  index = SIGNATURE_INDEX(tables);
 
-    START;
-    FM(0, 6, 0, 6, "VIA C3 (WinChip C5A)");
-    FM(0, 6, 0, 6, "VIA C3 (WinChip C5A)");
-    FMS(0, 6, 0, 7, 0, "VIA C3 (WinChip C5B)");
-    FMS(0, 6, 0, 7, 1, "VIA C3 (WinChip C5B)");
-    FMS(0, 6, 0, 7, 2, "VIA C3 (WinChip C5B)");
-    FMS(0, 6, 0, 7, 3, "VIA C3 (WinChip C5B)");
-    FMS(0, 6, 0, 7, 4, "VIA C3 (WinChip C5B)");
-    FMS(0, 6, 0, 7, 5, "VIA C3 (WinChip C5B)");
-    FMS(0, 6, 0, 7, 6, "VIA C3 (WinChip C5B)");
-    FMS(0, 6, 0, 7, 7, "VIA C3 (WinChip C5B)");
-    FM(0, 6, 0, 7, "VIA C3 (WinChip C5C)");
-    FM(0, 6, 0, 8, "VIA C3 (WinChip C5N)");
-    FM(0, 6, 0, 9, "VIA C3 (WinChip C5XL)");
-    F(0, 6, "VIA C3 (unknown model)");
-    DEFAULT("unknown");
-
-    return append_uarch(result, val, VENDOR_VIA);
+    return append_uarch(lookup_synth(&index, val, NULL), val, VENDOR_VIA, buffer);
 }
 
 // print processor name string = f(val), for VIA
@@ -5082,23 +6506,23 @@ decode_x_synth_via(unsigned int val)
 static void
 print_x_synth_via(unsigned int val)
 {
-    ccstring  synth = decode_x_synth_via(val);
+    char      buffer[SYNTH_MAX];
+    ccstring  synth = decode_x_synth_via(val, buffer);
 
-    printf("      (simple synth) = ");
+    emit("      (simple synth) = ");
     if (synth != NULL) {
-        printf("%s", synth);
+        emit("%s", synth);
     }
-    printf("\n");
+    emit("\n");
 }
 
-#undef ACT
-
 // return processor name string = f(val), include CPU vendor selection logic
 // val_eax = CPU TFMS signature
 // vendor  = processor vendor numeric id by enumeration
 // stash   = pointer to structure for accumulate processor information
+// buffer  = buffer for build string, returned string can be located at it
 static cstring
-decode_synth(unsigned int val_eax, vendor_t vendor, const code_stash_t* stash)
+decode_synth(unsigned int val_eax, vendor_t vendor, const code_stash_t* stash, char buffer[SYNTH_MAX])
 {
     cstring  synth = NULL;
 
@@ -5107,7 +6531,7 @@ decode_synth(unsigned int val_eax, vendor_t vendor, const code_stash_t* stash)
         synth = decode_synth_intel(val_eax, stash);
         break;
     case VENDOR_AMD:
-        synth = decode_synth_amd(val_eax, stash);
+        synth = decode_synth_amd(val_eax, stash, buffer);
         break;
     case VENDOR_CYRIX:
         synth = decode_synth_cyrix(val_eax, stash);
@@ -5150,7 +6574,7 @@ decode_synth(unsigned int val_eax, vendor_t vendor, const code_stash_t* stash)
         break;
     }
 
-    return append_uarch(synth, val_eax, vendor);
+    return append_uarch(synth, val_eax, vendor, buffer);
 }
 
 // print CPU name string with text prefix, not use stash information
@@ -5159,11 +6583,12 @@ decode_synth(unsigned int val_eax, vendor_t vendor, const code_stash_t* stash)
 static void
 print_synth_simple(unsigned int val_eax, vendor_t vendor)
 {
-    ccstring  synth = decode_synth(val_eax, vendor, NULL);
+    char      buffer[SYNTH_MAX];
+    ccstring  synth = decode_synth(val_eax, vendor, NULL, buffer);
     if (synth != NULL) {
-        printf("      (simple synth)  = %s", synth);
+        emit("      (simple synth)  = %s", synth);
     }
-    printf("\n");
+    emit("\n");
 }
 
 // print CPU name string with text prefix, use stash information
@@ -5171,9 +6596,10 @@ print_synth_simple(unsigned int val_eax, vendor_t vendor)
 static void
 print_synth(const code_stash_t* stash)
 {
-    ccstring  synth = decode_synth(stash->val_1_eax, stash->vendor, stash);
+    char      buffer[SYNTH_MAX];
+    ccstring  synth = decode_synth(stash->val_1_eax, stash->vendor, stash, buffer);
     if (synth != NULL) {
-        printf("   (synth) = %s\n", synth);
+        emit("   (synth) = %s\n", synth);
     }
 }
 
@@ -5336,27 +6762,27 @@ static void decode_mp_synth(code_stash_t* stash)
 // mp = pointer to structure 
 static void print_mp_synth(const struct mp* mp)
 {
-    printf("   (multi-processing synth) = ");
+    emit("   (multi-processing synth) = ");
     if (mp->method == NULL) {
-        printf("?");
+        emit("?");
     }
     else if (mp->cores > 1) {
         if (mp->hyperthreads > 1) {
-            printf("multi-core (c=%u), hyper-threaded (t=%u)",
+            emit("multi-core (c=%u), hyper-threaded (t=%u)",
                 mp->cores, mp->hyperthreads);
         }
         else {
-            printf("multi-core (c=%u)", mp->cores);
+            emit("multi-core (c=%u)", mp->cores);
         }
     }
     else if (mp->hyperthreads > 1) {
-        printf("hyper-threaded (t=%u)", mp->hyperthreads);
+        emit("hyper-threaded (t=%u)", mp->hyperthreads);
     }
     else {
-        printf("none");
+        emit("none");
     }
-    printf("\n");
-    printf("   (multi-processing method) = %s\n", mp->method);
+    emit("\n");
+    emit("   (multi-processing method) = %s\n", mp->method);
 }
 
 // this method changed
@@ -5382,9 +6808,22 @@ static int bits_needed(unsigned long  v)
 #define GET_V2_TOPO_WIDTH(val_1f_eax) \
    (BIT_EXTRACT_LE((val_1f_eax), 0, 5))
 
-// print multiprocessing topology (APIC, SMP, SMT) information
+// APIC ID widths and IDs of logical processor, see decode_apic_synth()
+typedef struct {
+    unsigned int  smt_width;    // APIC ID bits of thread
+    unsigned int  core_width;   // APIC ID bits of core
+    unsigned int  cu_width;     // APIC ID bits of compute unit, 0 if no compute units
+    unsigned int  pkg_id;       // package ID
+    unsigned int  cu_id;        // compute unit ID
+    unsigned int  core_id;      // core ID
+    unsigned int  smt_id;       // thread ID
+} apic_synth_t;
+
+// decode multiprocessing topology (APIC, SMP, SMT) information
 // stash = pointer to structure for accumulate processor information
-static void print_apic_synth(code_stash_t* stash)
+// apic  = pointer for return APIC ID widths and IDs
+// return TRUE if decoded, FALSE if vendor or CPUID functions not supported
+static intbool decode_apic_synth(const code_stash_t* stash, apic_synth_t* apic)
 {
     unsigned int  smt_width = 0;
     unsigned int  core_width = 0;
@@ -5426,7 +6865,7 @@ static void print_apic_synth(code_stash_t* stash)
             core_width = bits_needed(core_count);
         }
         else {
-            return;
+            return FALSE;
         }
         break;
     case VENDOR_AMD:
@@ -5475,25 +6914,17 @@ static void print_apic_synth(code_stash_t* stash)
             cu_width = bits_needed(cu_count);
         }
         else {
-            return;
+            return FALSE;
         }
         break;
     default:
-        return;
+        return FALSE;
     }
 
     // Possibly this should be expanded with Intel leaf 1f's module, tile, and
     // die levels.  They could be made into hidden architectural levels unless
     // actually present, much like the CU level.
 
-    printf("   (APIC widths synth):");
-    if (cu_width != 0) {
-        printf(" CU_width=%u", cu_width);
-    }
-    printf(" CORE_width=%u", core_width);
-    printf(" SMT_width=%u", smt_width);
-    printf("\n");
-
     unsigned int  smt_off = 24;
     unsigned int  smt_tail = smt_off + smt_width;
     unsigned int  core_off = smt_tail;
@@ -5503,16 +6934,44 @@ static void print_apic_synth(code_stash_t* stash)
     unsigned int  pkg_off = cu_tail;
     unsigned int  pkg_tail = 32;
 
-    printf("   (APIC synth):");
-    printf(" PKG_ID=%d", (pkg_off < pkg_tail
+    apic->smt_width = smt_width;
+    apic->core_width = core_width;
+    apic->cu_width = cu_width;
+    apic->pkg_id = (pkg_off < pkg_tail
         ? BIT_EXTRACT_LE(stash->val_1_ebx, pkg_off, pkg_tail)
-        : 0));
-    if (cu_width != 0) {
-        printf(" CU_ID=%d", BIT_EXTRACT_LE(stash->val_1_ebx, cu_off, cu_tail));
+        : 0);
+    apic->cu_id = BIT_EXTRACT_LE(stash->val_1_ebx, cu_off, cu_tail);
+    apic->core_id = BIT_EXTRACT_LE(stash->val_1_ebx, core_off, core_tail);
+    apic->smt_id = BIT_EXTRACT_LE(stash->val_1_ebx, smt_off, smt_tail);
+    return TRUE;
+}
+
+// print multiprocessing topology (APIC, SMP, SMT) information
+// stash = pointer to structure for accumulate processor information
+static void print_apic_synth(code_stash_t* stash)
+{
+    apic_synth_t  apic;
+
+    if (!decode_apic_synth(stash, &apic)) {
+        return;
     }
-    printf(" CORE_ID=%d", BIT_EXTRACT_LE(stash->val_1_ebx, core_off, core_tail));
-    printf(" SMT_ID=%d", BIT_EXTRACT_LE(stash->val_1_ebx, smt_off, smt_tail));
-    printf("\n");
+
+    emit("   (APIC widths synth):");
+    if (apic.cu_width != 0) {
+        emit(" CU_width=%u", apic.cu_width);
+    }
+    emit(" CORE_width=%u", apic.core_width);
+    emit(" SMT_width=%u", apic.smt_width);
+    emit("\n");
+
+    emit("   (APIC synth):");
+    emit(" PKG_ID=%d", apic.pkg_id);
+    if (apic.cu_width != 0) {
+        emit(" CU_ID=%d", apic.cu_id);
+    }
+    emit(" CORE_ID=%d", apic.core_id);
+    emit(" SMT_ID=%d", apic.smt_id);
+    emit("\n");
 }
 
 // print some features for AMD processors
@@ -5527,10 +6986,10 @@ static void print_instr_synth_amd(code_stash_t* stash)
         || BIT_EXTRACT_LE(stash->val_80000001_edx, 29, 30)
         || BIT_EXTRACT_LE(stash->val_80000001_edx, 31, 32));
 
-    printf("   (instruction supported synth):\n");
-    printf("      CMPXCHG8B                = %s\n", bools[cmpxchg8b]);
-    printf("      conditional move/compare = %s\n", bools[cond]);
-    printf("      PREFETCH/PREFETCHW       = %s\n", bools[prefetch]);
+    emit("   (instruction supported synth):\n");
+    emit("      CMPXCHG8B                = %s\n", bools[cmpxchg8b]);
+    emit("      conditional move/compare = %s\n", bools[cond]);
+    emit("      PREFETCH/PREFETCHW       = %s\n", bools[prefetch]);
 }
 
 // print some features, for AMD and HYGON processors
@@ -5585,7 +7044,7 @@ print_1_eax(unsigned int value, vendor_t vendor)
     static ccstring  processor[1 << 2] = { "primary processor (0)",
                                          "Intel OverDrive (1)",
                                          "secondary processor (2)" };
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "processor type"                          , 12, 13, processor },
             { "family"                                  ,  8, 11, NIL_IMAGES },
             { "model"                                   ,  4,  7, NIL_IMAGES },
@@ -5594,19 +7053,21 @@ print_1_eax(unsigned int value, vendor_t vendor)
             { "extended model"                          , 16, 19, NIL_IMAGES },
     };
 
-    printf("   version information (1/eax):\n");
-    print_names(value, names, LENGTH(names),
+    emit("   version information (1/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 15);
 
     unsigned int  synth_family = Synth_Family(value);
     unsigned int  synth_model = Synth_Model(value);
-    printf("      (family synth)  = 0x%x (%u)\n", synth_family, synth_family);
-    printf("      (model synth)   = 0x%x (%u)\n", synth_model, synth_model);
+    emit("      (family synth)  = 0x%x (%u)\n", synth_family, synth_family);
+    emit("      (model synth)   = 0x%x (%u)\n", synth_model, synth_model);
 
     print_synth_simple(value, vendor);
 }
 
-// macro for extract CPU TFMS (Type, Family, Model, Stepping) signature field
+// building blocks for brand id detection, sequence of if-else constructions
+#define START \
+   if (0)
 #define B(b,str)                                   \
    else if (   __B(val_ebx)   == _B(b))            \
       ACT(str)
@@ -5618,8 +7079,11 @@ print_1_eax(unsigned int value, vendor_t vendor)
    else if (   __FMS(val_eax) == _FMS(xf,f,xm,m,s) \
             && __B(val_ebx)   == _B(b))            \
       ACT(str)
+#define BDEFAULT(str)                              \
+   else                                            \
+      ACT(str)
 
-#define ACT(str)  (printf(str))
+#define ACT(str)  (emit(str))
 
 // print decoded CPU brand string, for INTEL processors
 // val_eax = CPUID function 00000001h, register EAX
@@ -5627,7 +7091,7 @@ print_1_eax(unsigned int value, vendor_t vendor)
 static void
 print_brand(unsigned int val_eax, unsigned int val_ebx)
 {
-    printf("   brand id = 0x%02x (%u): ", __B(val_ebx), __B(val_ebx));
+    emit("   brand id = 0x%02x (%u): ", __B(val_ebx), __B(val_ebx));
     START;
     B(1, "Intel Celeron, .18um");
     B(2, "Intel Pentium III, .18um");
@@ -5664,8 +7128,8 @@ print_brand(unsigned int val_eax, unsigned int val_ebx)
     B(21, "Mobile Genuine Intel");
     B(22, "Intel Pentium M, .13um");
     B(23, "Mobile Intel Celeron");
-    DEFAULT("unknown");
-    printf("\n");
+    BDEFAULT("unknown");
+    emit("\n");
 }
 
 #undef ACT
@@ -5675,16 +7139,16 @@ print_brand(unsigned int val_eax, unsigned int val_ebx)
 static void
 print_1_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "process local APIC physical ID"          , 24, 31, NIL_IMAGES },
             { "maximum IDs for CPUs in pkg"             , 16, 23, NIL_IMAGES },
             { "CLFLUSH line size"                       ,  8, 15, NIL_IMAGES },
             { "brand index"                             ,  0,  7, NIL_IMAGES },
     };
 
-    printf("   miscellaneous (1/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   miscellaneous (1/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000001h, register ECX = Standard features bitmap (1 of 2)
@@ -5692,7 +7156,7 @@ print_1_ebx(unsigned int value)
 static void
 print_1_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "PNI/SSE3: Prescott New Instructions"     ,  0,  0, bools },
             { "PCLMULDQ instruction"                    ,  1,  1, bools },
             { "DTES64: 64-bit debug store"              ,  2,  2, bools },
@@ -5725,10 +7189,11 @@ print_1_ecx(unsigned int value)
             { "RDRAND instruction"                      , 30, 30, bools },
             { "hypervisor guest status"                 , 31, 31, bools },
     };
+    static_assert(FEATURES_NAMED(names, 0x01, 0, WORD_ECX), "cpuid_features.h differs from 1/ecx names");
 
-    printf("   feature information (1/ecx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   feature information (1/ecx):\n");
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000001h, register EDX = Standard features bitmap (2 of 2)
@@ -5736,7 +7201,7 @@ print_1_ecx(unsigned int value)
 static void
 print_1_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "x87 FPU on chip"                         ,  0,  0, bools },
             { "VME: virtual-8086 mode enhancement"      ,  1,  1, bools },
             { "DE: debugging extensions"                ,  2,  2, bools },
@@ -5768,10 +7233,11 @@ print_1_edx(unsigned int value)
             { "IA64"                                    , 30, 30, bools },
             { "PBE: pending break event"                , 31, 31, bools },
     };
+    static_assert(FEATURES_NAMED(names, 0x01, 0, WORD_EDX), "cpuid_features.h differs from 1/edx names");
 
-    printf("   feature information (1/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   feature information (1/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000002h, sequence of Cache and TLB descriptors bytes
@@ -5782,177 +7248,7 @@ static void print_2_byte(unsigned char value, vendor_t vendor, unsigned int val_
 {
     if (value == 0x00) return;
 
-    printf("      0x%02x: ", value);
-#define CONT "\n            "
-
-    if (vendor == VENDOR_CYRIX || vendor == VENDOR_VIA) {
-        switch (value) {
-        case 0x70: printf("TLB: 4K pages, 4-way, 32 entries\n");    return;
-        case 0x74: printf("Cyrix-specific: ?\n");                   return;
-        case 0x77: printf("Cyrix-specific: ?\n");                   return;
-        case 0x80: printf("L1 cache: 16K, 4-way, 16 byte lines\n"); return;
-        case 0x82: printf("Cyrix-specific: ?\n");                   return;
-        case 0x84: printf("L2 cache: 1M, 8-way, 32 byte lines\n");  return;
-        }
-    }
-
-    switch (value) {
-    case 0x01: printf("instruction TLB: 4K pages, 4-way, 32 entries");    break;
-    case 0x02: printf("instruction TLB: 4M pages, 4-way, 2 entries");     break;
-    case 0x03: printf("data TLB: 4K pages, 4-way, 64 entries");           break;
-    case 0x04: printf("data TLB: 4M pages, 4-way, 8 entries");            break;
-    case 0x05: printf("data TLB: 4M pages, 4-way, 32 entries");           break;
-    case 0x06: printf("L1 instruction cache: 8K, 4-way, 32 byte lines");  break;
-    case 0x08: printf("L1 instruction cache: 16K, 4-way, 32 byte lines"); break;
-    case 0x09: printf("L1 instruction cache: 32K, 4-way, 64-byte lines"); break;
-    case 0x0a: printf("L1 data cache: 8K, 2-way, 32 byte lines");         break;
-    case 0x0b: printf("instruction TLB: 4M pages, 4-way, 4 entries");     break;
-    case 0x0c: printf("L1 data cache: 16K, 4-way, 32 byte lines");        break;
-    case 0x0d: printf("L1 data cache: 16K, 4-way, 64-byte lines");        break;
-    case 0x0e: printf("L1 data cache: 24K, 6-way, 64 byte lines");        break;
-    case 0x10: printf("L1 data cache: 16K, 4-way, 32 byte lines");        break;
-    case 0x15: printf("L1 instruction cache: 16K, 4-way, 32 byte lines"); break;
-    case 0x1d: printf("L2 cache: 128K, 2-way, 64 byte lines");            break;
-    case 0x1a: printf("L2 cache: 96K, 6-way, 64 byte lines");             break;
-    case 0x21: printf("L2 cache: 256K MLC, 8-way, 64 byte lines");        break;
-    case 0x22: printf("L3 cache: 512K, 4-way, 64 byte lines");            break;
-    case 0x23: printf("L3 cache: 1M, 8-way, 64 byte lines");              break;
-    case 0x24: printf("L2 cache: 1M, 16-way, 64 byte lines");             break;
-    case 0x25: printf("L3 cache: 2M, 8-way, 64 byte lines");              break;
-    case 0x29: printf("L3 cache: 4M, 8-way, 64 byte lines");              break;
-    case 0x2c: printf("L1 data cache: 32K, 8-way, 64 byte lines");        break;
-    case 0x30: printf("L1 cache: 32K, 8-way, 64 byte lines");             break;
-    case 0x39: printf("L2 cache: 128K, 4-way, sectored, 64 byte lines");  break;
-    case 0x3a: printf("L2 cache: 192K, 6-way, sectored, 64 byte lines");  break;
-    case 0x3b: printf("L2 cache: 128K, 2-way, sectored, 64 byte lines");  break;
-    case 0x3c: printf("L2 cache: 256K, 4-way, sectored, 64 byte lines");  break;
-    case 0x3d: printf("L2 cache: 384K, 6-way, sectored, 64 byte lines");  break;
-    case 0x3e: printf("L2 cache: 512K, 4-way, sectored, 64 byte lines");  break;
-    case 0x40: if (__F(val_1_eax) <= _XF(0) + _F(6)) {
-        printf("No L2 cache");
-    }
-             else {
-        printf("No L3 cache");
-    }
-             break;
-    case 0x41: printf("L2 cache: 128K, 4-way, 32 byte lines");            break;
-    case 0x42: printf("L2 cache: 256K, 4-way, 32 byte lines");            break;
-    case 0x43: printf("L2 cache: 512K, 4-way, 32 byte lines");            break;
-    case 0x44: printf("L2 cache: 1M, 4-way, 32 byte lines");              break;
-    case 0x45: printf("L2 cache: 2M, 4-way, 32 byte lines");              break;
-    case 0x46: printf("L3 cache: 4M, 4-way, 64 byte lines");              break;
-    case 0x47: printf("L3 cache: 8M, 8-way, 64 byte lines");              break;
-    case 0x48: printf("L2 cache: 3M, 12-way, 64 byte lines");             break;
-    case 0x49: if (__FM(val_1_eax) == _XF(0) + _F(15) + _XM(0) + _M(6)) {
-        printf("L3 cache: 4M, 16-way, 64 byte lines");
-    }
-             else {
-        printf("L2 cache: 4M, 16-way, 64 byte lines");
-    }
-             break;
-    case 0x4a: printf("L3 cache: 6M, 12-way, 64 byte lines");             break;
-    case 0x4b: printf("L3 cache: 8M, 16-way, 64 byte lines");             break;
-    case 0x4c: printf("L3 cache: 12M, 12-way, 64 byte lines");            break;
-    case 0x4d: printf("L3 cache: 16M, 16-way, 64 byte lines");            break;
-    case 0x4e: printf("L2 cache: 6M, 24-way, 64 byte lines");             break;
-    case 0x4f: printf("instruction TLB: 4K pages, 32 entries");           break;
-    case 0x50: printf("instruction TLB: 4K & 2M/4M pages, 64 entries");   break;
-    case 0x51: printf("instruction TLB: 4K & 2M/4M pages, 128 entries");  break;
-    case 0x52: printf("instruction TLB: 4K & 2M/4M pages, 256 entries");  break;
-    case 0x55: printf("instruction TLB: 2M/4M pages, fully, 7 entries");  break;
-    case 0x56: printf("L1 data TLB: 4M pages, 4-way, 16 entries");        break;
-    case 0x57: printf("L1 data TLB: 4K pages, 4-way, 16 entries");        break;
-    case 0x59: printf("data TLB: 4K pages, 16 entries");                  break;
-    case 0x5a: printf("data TLB: 2M/4M pages, 4-way, 32 entries");        break;
-    case 0x5b: printf("data TLB: 4K & 4M pages, 64 entries");             break;
-    case 0x5c: printf("data TLB: 4K & 4M pages, 128 entries");            break;
-    case 0x5d: printf("data TLB: 4K & 4M pages, 256 entries");            break;
-    case 0x60: printf("L1 data cache: 16K, 8-way, 64 byte lines");        break;
-    case 0x61: printf("instruction TLB: 4K pages, 48 entries");           break;
-    case 0x63: printf("data TLB: 2M/4M pages, 4-way, 32 entries");
-        printf(CONT "data TLB: 1G pages, 4-way, 4 entries");       break;
-    case 0x64: printf("data TLB: 4K pages, 4-way, 512 entries");          break;
-    case 0x66: printf("L1 data cache: 8K, 4-way, 64 byte lines");         break;
-    case 0x67: printf("L1 data cache: 16K, 4-way, 64 byte lines");        break;
-    case 0x68: printf("L1 data cache: 32K, 4-way, 64 byte lines");        break;
-    case 0x6a: printf("micro-data TLB: 4K pages, 8-way, 64 entries");     break;
-    case 0x6b: printf("data TLB: 4K pages, 8-way, 256 entries");          break;
-    case 0x6c: printf("data TLB: 2M/4M pages, 8-way, 128 entries");       break;
-    case 0x6d: printf("data TLB: 1G pages, fully, 16 entries");           break;
-    case 0x70: printf("Trace cache: 12K-uop, 8-way");                     break;
-    case 0x71: printf("Trace cache: 16K-uop, 8-way");                     break;
-    case 0x72: printf("Trace cache: 32K-uop, 8-way");                     break;
-    case 0x73: printf("Trace cache: 64K-uop, 8-way");                     break;
-    case 0x76: printf("instruction TLB: 2M/4M pages, fully, 8 entries");  break;
-    case 0x77: printf("L1 instruction cache: 16K, 4-way, sectored,"
-        " 64 byte lines");                                  break;
-    case 0x78: printf("L2 cache: 1M, 4-way, 64 byte lines");              break;
-    case 0x79: printf("L2 cache: 128K, 8-way, sectored, 64 byte lines");  break;
-    case 0x7a: printf("L2 cache: 256K, 8-way, sectored, 64 byte lines");  break;
-    case 0x7b: printf("L2 cache: 512K, 8-way, sectored, 64 byte lines");  break;
-    case 0x7c: printf("L2 cache: 1M, 8-way, sectored, 64 byte lines");    break;
-    case 0x7d: printf("L2 cache: 2M, 8-way, 64 byte lines");              break;
-    case 0x7e: printf("L2 cache: 256K, 8-way, sectored, 128 byte lines"); break;
-    case 0x7f: printf("L2 cache: 512K, 2-way, 64 byte lines");            break;
-    case 0x80: printf("L2 cache: 512K, 8-way, 64 byte lines");            break;
-    case 0x81: printf("L2 cache: 128K, 8-way, 32 byte lines");            break;
-    case 0x82: printf("L2 cache: 256K, 8-way, 32 byte lines");            break;
-    case 0x83: printf("L2 cache: 512K, 8-way, 32 byte lines");            break;
-    case 0x84: printf("L2 cache: 1M, 8-way, 32 byte lines");              break;
-    case 0x85: printf("L2 cache: 2M, 8-way, 32 byte lines");              break;
-    case 0x86: printf("L2 cache: 512K, 4-way, 64 byte lines");            break;
-    case 0x87: printf("L2 cache: 1M, 8-way, 64 byte lines");              break;
-    case 0x88: printf("L3 cache: 2M, 4-way, 64 byte lines");              break;
-    case 0x89: printf("L3 cache: 4M, 4-way, 64 byte lines");              break;
-    case 0x8a: printf("L3 cache: 8M, 4-way, 64 byte lines");              break;
-    case 0x8d: printf("L3 cache: 3M, 12-way, 128 byte lines");            break;
-    case 0x90: printf("instruction TLB: 4K-256M, fully, 64 entries");     break;
-    case 0x96: printf("instruction TLB: 4K-256M, fully, 32 entries");     break;
-    case 0x9b: printf("instruction TLB: 4K-256M, fully, 96 entries");     break;
-    case 0xa0: printf("data TLB: 4K pages, fully, 32 entries");           break;
-    case 0xb0: printf("instruction TLB: 4K, 4-way, 128 entries");         break;
-    case 0xb1: printf("instruction TLB: 2M/4M, 4-way, 4/8 entries");      break;
-    case 0xb2: printf("instruction TLB: 4K, 4-way, 64 entries");          break;
-    case 0xb3: printf("data TLB: 4K pages, 4-way, 128 entries");          break;
-    case 0xb4: printf("data TLB: 4K pages, 4-way, 256 entries");          break;
-    case 0xb5: printf("instruction TLB: 4K, 8-way, 64 entries");          break;
-    case 0xb6: printf("instruction TLB: 4K, 8-way, 128 entries");         break;
-    case 0xba: printf("data TLB: 4K pages, 4-way, 64 entries");           break;
-    case 0xc0: printf("data TLB: 4K & 4M pages, 4-way, 8 entries");       break;
-    case 0xc1: printf("L2 TLB: 4K/2M pages, 8-way, 1024 entries");        break;
-    case 0xc2: printf("data TLB: 4K & 2M pages, 4-way, 16 entries");      break;
-    case 0xc3: printf("L2 TLB: 4K/2M pages, 6-way, 1536 entries");        break;
-    case 0xc4: printf("data TLB: 2M/4M pages, 4-way, 32 entries");        break;
-    case 0xca: printf("L2 TLB: 4K pages, 4-way, 512 entries");            break;
-    case 0xd0: printf("L3 cache: 512K, 4-way, 64 byte lines");            break;
-    case 0xd1: printf("L3 cache: 1M, 4-way, 64 byte lines");              break;
-    case 0xd2: printf("L3 cache: 2M, 4-way, 64 byte lines");              break;
-    case 0xd6: printf("L3 cache: 1M, 8-way, 64 byte lines");              break;
-    case 0xd7: printf("L3 cache: 2M, 8-way, 64 byte lines");              break;
-    case 0xd8: printf("L3 cache: 4M, 8-way, 64 byte lines");              break;
-    case 0xdc: printf("L3 cache: 1.5M, 12-way, 64 byte lines");           break;
-    case 0xdd: printf("L3 cache: 3M, 12-way, 64 byte lines");             break;
-    case 0xde: printf("L3 cache: 6M, 12-way, 64 byte lines");             break;
-    case 0xe2: printf("L3 cache: 2M, 16-way, 64 byte lines");             break;
-    case 0xe3: printf("L3 cache: 4M, 16-way, 64 byte lines");             break;
-    case 0xe4: printf("L3 cache: 8M, 16-way, 64 byte lines");             break;
-    case 0xea: printf("L3 cache: 12M, 24-way, 64 byte lines");            break;
-    case 0xeb: printf("L3 cache: 18M, 24-way, 64 byte lines");            break;
-    case 0xec: printf("L3 cache: 24M, 24-way, 64 byte lines");            break;
-    case 0xf0: printf("64 byte prefetching");                             break;
-    case 0xf1: printf("128 byte prefetching");                            break;
-    case 0xfe: printf("TLB data is in CPUID leaf 0x18");                  break;
-    case 0xff: printf("cache data is in CPUID leaf 4");                   break;
-    default:   printf("unknown");                                         break;
-    }
-
-    /*
-    ** WARNING: If you add values here, you probably need to update the code in
-    **          stash_intel_cache, too.
-    */
-
-    printf("\n");
-#undef CONT
+    emit("      0x%02x: %s\n", value, lookup_cache_desc(value, vendor, val_1_eax)->text);
 }
 
 // print results of CPUID function 00000004h, deterministic cache information, register EAX
@@ -5965,7 +7261,7 @@ print_4_eax(unsigned int value)
                                           "data cache (1)",
                                           "instruction cache (2)",
                                           "unified cache (3)" };
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "cache type"                              ,  0,  4, cache_type },
             { "cache level"                             ,  5,  7, NIL_IMAGES },
             { "self-initializing cache level"           ,  8,  8, bools },
@@ -5974,7 +7270,7 @@ print_4_eax(unsigned int value)
             { "maximum IDs for cores in pkg"            , 26, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 36);
 }
 
@@ -5984,13 +7280,13 @@ print_4_eax(unsigned int value)
 static void
 print_4_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "system coherency line size"              ,  0, 11, MINUS1_IMAGES },
             { "physical line partitions"                , 12, 21, MINUS1_IMAGES },
             { "ways of associativity"                   , 22, 31, MINUS1_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 36);
 }
 
@@ -6000,11 +7296,11 @@ print_4_ebx(unsigned int value)
 static void
 print_4_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "number of sets"                          ,  0, 31, MINUS1_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 36);
 }
 
@@ -6014,13 +7310,13 @@ print_4_ecx(unsigned int value)
 static void
 print_4_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "WBINVD/INVD acts on lower caches"        ,  0,  0, bools },
             { "inclusive to lower caches"               ,  1,  1, bools },
             { "complex cache indexing"                  ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 36);
 }
 
@@ -6036,24 +7332,24 @@ print_4_synth(const unsigned int words[])
     unsigned int  sets = words[WORD_ECX] + 1;
     unsigned int  size = (ways_assoc * parts * line_size * sets);
 
-    printf("      (size synth)                         = %u", size);
+    emit("      (size synth)                         = %u", size);
     if (size > 1048576) {
         if ((size % 1048576) == 0) {
-            printf(" (%u MB)", size / 1048576);
+            emit(" (%u MB)", size / 1048576);
         }
         else {
-            printf(" (%3.1f MB)", ((float)size) / 1048576.0);
+            emit(" (%3.1f MB)", ((float)size) / 1048576.0);
         }
     }
     else if (size > 1024) {
         if ((size % 1024) == 0) {
-            printf(" (%u KB)", size / 1024);
+            emit(" (%u KB)", size / 1024);
         }
         else {
-            printf(" (%3.1f KB)", ((float)size) / 1024.0);
+            emit(" (%3.1f KB)", ((float)size) / 1024.0);
         }
     }
-    printf("\n");
+    emit("\n");
 }
 
 // print results of CPUID function 00000005h, register EAX
@@ -6061,11 +7357,11 @@ print_4_synth(const unsigned int words[])
 static void
 print_5_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "smallest monitor-line size (bytes)"      ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6074,11 +7370,11 @@ print_5_eax(unsigned int value)
 static void
 print_5_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "largest monitor-line size (bytes)"       ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6087,12 +7383,12 @@ print_5_ebx(unsigned int value)
 static void
 print_5_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "enum of Monitor-MWAIT exts supported"    ,  0,  0, bools },
             { "supports intrs as break-event for MWAIT" ,  1,  1, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6101,7 +7397,7 @@ print_5_ecx(unsigned int value)
 static void
 print_5_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "number of C0 sub C-states using MWAIT"   ,  0,  3, NIL_IMAGES },
             { "number of C1 sub C-states using MWAIT"   ,  4,  7, NIL_IMAGES },
             { "number of C2 sub C-states using MWAIT"   ,  8, 11, NIL_IMAGES },
@@ -6112,7 +7408,7 @@ print_5_edx(unsigned int value)
             { "number of C7 sub C-states using MWAIT"   , 28, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6121,7 +7417,7 @@ print_5_edx(unsigned int value)
 static void
 print_6_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "digital thermometer"                     ,  0,  0, bools },
             { "Intel Turbo Boost Technology"            ,  1,  1, bools },
             { "ARAT always running APIC timer"          ,  2,  2, bools },
@@ -6144,7 +7440,7 @@ print_6_eax(unsigned int value)
             { "enhanced hardware feedback interface"    , 23, 23, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 39);
 }
 
@@ -6153,11 +7449,11 @@ print_6_eax(unsigned int value)
 static void
 print_6_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "digital thermometer thresholds"          ,  0,  3, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 39);
 }
 
@@ -6166,14 +7462,14 @@ print_6_ebx(unsigned int value)
 static void
 print_6_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "hardware coordination feedback"          ,  0,  0, bools },
             { "ACNT2 available"                         ,  1,  1, bools },
             { "performance-energy bias capability"      ,  3,  3, bools },
             { "number of enh hardware feedback classes" ,  8, 11, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 39);
 }
 
@@ -6182,14 +7478,14 @@ print_6_ecx(unsigned int value)
 static void
 print_6_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "performance capability reporting"        ,  0,  0, bools },
             { "energy efficiency capability reporting"  ,  1,  1, bools },
             { "size of feedback struct (4KB pages)"     ,  8, 11, MINUS1_IMAGES },
             { "index of CPU's row in feedback struct"   , 16, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 39);
 }
 
@@ -6198,7 +7494,7 @@ print_6_edx(unsigned int value)
 static void
 print_7_0_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "FSGSBASE instructions"                   ,  0,  0, bools },
             { "IA32_TSC_ADJUST MSR supported"           ,  1,  1, bools },
             { "SGX: Software Guard Extensions supported",  2,  2, bools },
@@ -6232,8 +7528,9 @@ print_7_0_ebx(unsigned int value)
             { "AVX512BW: byte & word instructions"      , 30, 30, bools },
             { "AVX512VL: vector length"                 , 31, 31, bools },
     };
+    static_assert(FEATURES_NAMED(names, 0x07, 0, WORD_EBX), "cpuid_features.h differs from 7/0/ebx names");
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6242,7 +7539,7 @@ print_7_0_ebx(unsigned int value)
 static void
 print_7_0_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "PREFETCHWT1"                             ,  0,  0, bools },
             { "AVX512VBMI: vector byte manipulation"    ,  1,  1, bools },
             { "UMIP: user-mode instruction prevention"  ,  2,  2, bools },
@@ -6269,8 +7566,9 @@ print_7_0_ecx(unsigned int value)
             { "SGX_LC: SGX launch config supported"     , 30, 30, bools },
             { "PKS: supervisor protection keys"         , 31, 31, bools },
     };
+    static_assert(FEATURES_NAMED(names, 0x07, 0, WORD_ECX), "cpuid_features.h differs from 7/0/ecx names");
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6279,7 +7577,7 @@ print_7_0_ecx(unsigned int value)
 static void
 print_7_0_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "AVX512_4VNNIW: neural network instrs"    ,  2,  2, bools },
             { "AVX512_4FMAPS: multiply acc single prec" ,  3,  3, bools },
             { "fast short REP MOV"                      ,  4,  4, bools },
@@ -6304,7 +7602,8 @@ print_7_0_edx(unsigned int value)
             { "IA32_CORE_CAPABILITIES MSR"              , 30, 30, bools },
             { "SSBD: speculative store bypass disable"  , 31, 31, bools },
     };
-    print_names(value, names, LENGTH(names),
+    static_assert(FEATURES_NAMED(names, 0x07, 0, WORD_EDX), "cpuid_features.h differs from 7/0/edx names");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6313,7 +7612,7 @@ print_7_0_edx(unsigned int value)
 static void
 print_7_1_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "AVX-VNNI: AVX VNNI neural network instrs",  4,  4, bools },
             { "AVX512_BF16: bfloat16 instructions"      ,  5,  5, bools },
             { "zero-length MOVSB"                       , 10, 10, bools },
@@ -6321,7 +7620,8 @@ print_7_1_eax(unsigned int value)
             { "fast short CMPSB, SCASB"                 , 12, 12, bools },
             { "HRESET: history reset support"           , 22, 22, bools },
     };
-    print_names(value, names, LENGTH(names),
+    static_assert(FEATURES_NAMED(names, 0x07, 1, WORD_EAX), "cpuid_features.h differs from 7/1/eax names");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6330,14 +7630,14 @@ print_7_1_eax(unsigned int value)
 static void
 print_a_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "version ID"                              ,  0,  7, NIL_IMAGES },
             { "number of counters per logical processor",  8, 15, NIL_IMAGES },
             { "bit width of counter"                    , 16, 23, NIL_IMAGES },
             { "length of EBX bit vector"                , 24, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6346,7 +7646,7 @@ print_a_eax(unsigned int value)
 static void
 print_a_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "core cycle event not available"          ,  0,  0, bools },
             { "instruction retired event not available" ,  1,  1, bools },
             { "reference cycles event not available"    ,  2,  2, bools },
@@ -6356,7 +7656,7 @@ print_a_ebx(unsigned int value)
             { "branch mispred retired event not avail"  ,  6,  6, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6368,7 +7668,7 @@ print_a_ecx(unsigned int value)
     unsigned int  bit;
     for (bit = 0; bit < sizeof(value) * 8; bit++) {
         unsigned int  field = BIT_EXTRACT_LE(value, bit, bit + 1);
-        printf("      fixed counter %2u supported               = %s\n",
+        emit("      fixed counter %2u supported               = %s\n",
             bit, bools[field]);
     }
 }
@@ -6378,13 +7678,13 @@ print_a_ecx(unsigned int value)
 static void
 print_a_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "number of fixed counters"                ,  0,  4, NIL_IMAGES },
             { "bit width of fixed counters"             ,  5, 12, NIL_IMAGES },
             { "anythread deprecation"                   , 15, 15, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6394,11 +7694,11 @@ print_a_edx(unsigned int value)
 static void
 print_b_1f_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "bit width of level"                      ,  0,  4, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 37);
 }
 
@@ -6408,11 +7708,11 @@ print_b_1f_eax(unsigned int value)
 static void
 print_b_1f_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "number of logical processors at level"   ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 37);
 }
 
@@ -6429,12 +7729,12 @@ print_b_1f_ecx(unsigned int value)
                                           "tile (4)",
                                           "die (5)" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "level number"                            ,  0,  7, NIL_IMAGES },
             { "level type"                              ,  8, 15, level_type },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 37);
 }
 
@@ -6454,7 +7754,7 @@ print_d_0_eax(unsigned int value)
     **
     ** These align with the supported features[] in print_d_n() for values > 1.
     */
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "   XCR0 supported: x87 state"            ,  0,  0, bools },
             { "   XCR0 supported: SSE state"            ,  1,  1, bools },
             { "   XCR0 supported: AVX state"            ,  2,  2, bools },
@@ -6475,7 +7775,7 @@ print_d_0_eax(unsigned int value)
             { "   XTILEDATA supported"                  , 18, 18, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 39);
 }
 
@@ -6484,15 +7784,16 @@ print_d_0_eax(unsigned int value)
 static void
 print_d_1_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "XSAVEOPT instruction"                    ,  0,  0, bools },
             { "XSAVEC instruction"                      ,  1,  1, bools },
             { "XGETBV instruction"                      ,  2,  2, bools },
             { "XSAVES/XRSTORS instructions"             ,  3,  3, bools },
             { "XFD: extended feature disable supported" ,  4,  4, bools },
     };
+    static_assert(FEATURES_NAMED(names, 0x0d, 1, WORD_EAX), "cpuid_features.h differs from 0xd/1/eax names");
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 43);
 }
 
@@ -6504,13 +7805,13 @@ print_d_n_ecx(unsigned int value)
     static ccstring  which[] = { "XCR0 (user state)",
                                  "IA32_XSS (supervisor state)" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "supported in IA32_XSS or XCR0"           ,  0,  0, which },
             { "64-byte alignment in compacted XSAVE"    ,  1,  1, bools },
             { "XFD faulting supported"                  ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6598,15 +7899,15 @@ print_d_n(const unsigned int words[WORD_NUM], unsigned int tryX)
     int       feature_pad = 17 - (int)strlen(feature);
 
     if (tryX > 9) {
-        printf("   %s features (0xd/0x%x):\n", feature, tryX);
+        emit("   %s features (0xd/0x%x):\n", feature, tryX);
     }
     else {
-        printf("   %s features (0xd/%d):\n", feature, tryX);
+        emit("   %s features (0xd/%d):\n", feature, tryX);
     }
-    printf("      %s save state byte size%*s   = 0x%08x (%u)\n",
+    emit("      %s save state byte size%*s   = 0x%08x (%u)\n",
         feature, feature_pad, "",
         words[WORD_EAX], words[WORD_EAX]);
-    printf("      %s save state byte offset%*s = 0x%08x (%u)\n",
+    emit("      %s save state byte offset%*s = 0x%08x (%u)\n",
         feature, feature_pad, "",
         words[WORD_EBX], words[WORD_EBX]);
     print_d_n_ecx(words[WORD_ECX]);
@@ -6617,12 +7918,12 @@ print_d_n(const unsigned int words[WORD_NUM], unsigned int tryX)
 static void
 print_f_0_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "supports L3 cache QoS monitoring"        ,  1,  1, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 0000000Fh, subfunction 1, register EAX
@@ -6630,11 +7931,11 @@ print_f_0_edx(unsigned int value)
 static void
 print_f_1_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "IA32_QM_CTR bit 61 is overflow"          ,  8,  8, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 43);
 }
 
@@ -6643,13 +7944,13 @@ print_f_1_eax(unsigned int value)
 static void
 print_f_1_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "supports L3 occupancy monitoring"        ,  0,  0, bools },
             { "supports L3 total bandwidth monitoring"  ,  1,  1, bools },
             { "supports L3 local bandwidth monitoring"  ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 43);
 }
 
@@ -6658,14 +7959,14 @@ print_f_1_edx(unsigned int value)
 static void
 print_10_0_ebx(unsigned int  value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "L3 cache allocation technology supported",  1,  1, bools },
             { "L2 cache allocation technology supported",  2,  2, bools },
             { "memory bandwidth allocation supported"   ,  3,  3, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000010h, subfunction N, register EAX
@@ -6673,11 +7974,11 @@ print_10_0_ebx(unsigned int  value)
 static void
 print_10_n_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "length of capacity bit mask"             ,  0,  4, MINUS1_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6686,12 +7987,12 @@ print_10_n_eax(unsigned int value)
 static void
 print_10_n_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "infrequent updates of COS"               ,  1,  1, bools },
             { "code and data prioritization supported"  ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6700,11 +8001,11 @@ print_10_n_ecx(unsigned int value)
 static void
 print_10_n_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "highest COS number supported"            ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6713,11 +8014,11 @@ print_10_n_edx(unsigned int value)
 static void
 print_10_3_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "maximum throttling value"                ,  0, 11, MINUS1_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6726,12 +8027,12 @@ print_10_3_eax(unsigned int value)
 static void
 print_10_3_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "per-thread MBA control"                  ,  0,  0, bools },
             { "delay values are linear"                 ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -6740,14 +8041,14 @@ print_10_3_ecx(unsigned int value)
 static void
 print_12_0_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "SGX1 supported"                          ,  0,  0, bools },
             { "SGX2 supported"                          ,  1,  1, bools },
             { "SGX ENCLV E*VIRTCHILD, ESETCONTEXT"      ,  5,  5, bools },
             { "SGX ENCLS ETRACKC, ERDINFO, ELDBC, ELDUC",  6,  6, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -6760,12 +8061,12 @@ print_12_0_ebx(unsigned int value)
     ** MISCSELECT is described in Table 38-4: Bit Vector Layout of MISCSELECT
     ** Field of Extended Information.
     */
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "MISCSELECT.EXINFO supported: #PF & #GP"  ,  0,  0, bools },
             { "MISCSELECT.CPINFO supported: #CP"        ,  1,  1, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -6774,12 +8075,12 @@ print_12_0_ebx(unsigned int value)
 static void
 print_12_0_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "MaxEnclaveSize_Not64 (log2)"             ,  0,  7, NIL_IMAGES },
             { "MaxEnclaveSize_64 (log2)"                ,  8, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -6792,11 +8093,11 @@ print_12_n_ecx(unsigned int value)
         /* 1 => */ "confidentiality & integrity"
                    " protection" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "section property"                        ,  0,  3, props },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 23);
 }
 
@@ -6805,7 +8106,7 @@ print_12_n_ecx(unsigned int value)
 static void
 print_14_0_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "IA32_RTIT_CR3_MATCH is accessible"       ,  0,  0, bools },
             { "configurable PSB & cycle-accurate"       ,  1,  1, bools },
             { "IP & TraceStop filtering; PT preserve"   ,  2,  2, bools },
@@ -6814,7 +8115,7 @@ print_14_0_ebx(unsigned int value)
             { "power event trace support"               ,  5,  5, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -6823,7 +8124,7 @@ print_14_0_ebx(unsigned int value)
 static void
 print_14_0_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "ToPA output scheme support"              ,  0,  0, bools },
             { "ToPA can hold many output entries"       ,  1,  1, bools },
             { "single-range output scheme support"      ,  2,  2, bools },
@@ -6831,7 +8132,7 @@ print_14_0_ecx(unsigned int value)
             { "IP payloads have LIP values & CS"        , 31, 31, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -6840,12 +8141,12 @@ print_14_0_ecx(unsigned int value)
 static void
 print_14_1_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "configurable address ranges"             ,  0,  2, NIL_IMAGES },
             { "supported MTC periods bitmask"           , 16, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -6854,12 +8155,12 @@ print_14_1_eax(unsigned int value)
 static void
 print_14_1_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "supported cycle threshold bitmask"       ,  0, 15, NIL_IMAGES },
             { "supported config PSB freq bitmask"       , 16, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -6868,12 +8169,12 @@ print_14_1_ebx(unsigned int value)
 static void
 print_16_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "Core Base Frequency (MHz)"               ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000016h, register EBX
@@ -6881,12 +8182,12 @@ print_16_eax(unsigned int value)
 static void
 print_16_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "Core Maximum Frequency (MHz)"            ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000016h, register ECX
@@ -6894,12 +8195,12 @@ print_16_ebx(unsigned int value)
 static void
 print_16_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "Bus (Reference) Frequency (MHz)"         ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000017h, subfunction 0, register EBX
@@ -6910,13 +8211,13 @@ print_17_0_ebx(unsigned int value)
     static ccstring schemes[] = { /* 0 => */ "assigned by intel",
         /* 1 => */ "industry standard" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "vendor id"                               ,  0, 15, NIL_IMAGES },
             { "vendor scheme"                           , 16, 16, schemes },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000018h, subfunction N, register EBX
@@ -6933,7 +8234,7 @@ print_18_n_ebx(unsigned int value)
         /* 6 => */ NULL,
         /* 7 => */ NULL };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "4KB page size entries supported"         ,  0,  0, bools },
             { "2MB page size entries supported"         ,  1,  1, bools },
             { "4MB page size entries supported"         ,  2,  2, bools },
@@ -6942,8 +8243,8 @@ print_18_n_ebx(unsigned int value)
             { "ways of associativity"                   , 16, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000018h, subfunction N, register EDX
@@ -6958,15 +8259,15 @@ print_18_n_edx(unsigned int value)
         /* 00100b => */ "load-only TLB",
         /* 00101b => */ "store-only TLB" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "translation cache type"                  ,  0,  4, tlbs },
             { "translation cache level"                 ,  5,  7, MINUS1_IMAGES },
             { "fully associative"                       ,  8,  8, bools },
             { "maximum number of addressible IDs"       , 14, 25, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000019h, register EAX
@@ -6974,13 +8275,13 @@ print_18_n_edx(unsigned int value)
 static void
 print_19_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "CPL0-only restriction supported"         ,  0,  0, bools },
             { "no-encrypt restriction supported"        ,  1,  1, bools },
             { "no-decrypt restriction supported"        ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 32);
 }
 
@@ -6989,13 +8290,13 @@ print_19_eax(unsigned int value)
 static void
 print_19_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "AESKLE: AES instructions"                ,  0,  0, bools },
             { "AES wide instructions"                   ,  2,  2, bools },
             { "MSRs & IWKEY backups"                    ,  4,  4, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 32);
 }
 
@@ -7004,12 +8305,12 @@ print_19_ebx(unsigned int value)
 static void
 print_19_ecx(unsigned int  value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "LOADIWKEY NoBackup parameter"            ,  0,  0, bools },
             { "IWKEY randomization supported"           ,  1,  1, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 32);
 }
 
@@ -7037,13 +8338,13 @@ print_1a_0_eax(unsigned int  value)
                          NULL, NULL, NULL, NULL,
         /* 40h     => */ "Intel Core" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "native model ID of core"                 ,  0, 23, NIL_IMAGES },
             { "core type"                               , 24, 31, coretypes },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 0000001Bh, subfunction N, register EAX
@@ -7054,12 +8355,12 @@ print_1b_n_eax(unsigned int value)
     static ccstring types[1 << 12] = { /* 0 => */ "invalid (0)",
         /* 1 => */ "target identifier (1)" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "sub-leaf type"                           ,  0, 11, types },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 0000001Ch, register EAX
@@ -7070,7 +8371,7 @@ print_1c_eax(unsigned int value)
     static ccstring ipvs[1 << 1] = { /* 0 => */ "EIP (0)",
         /* 1 => */ "LIP (1)" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "IA32_LBR_DEPTH.DEPTH  8 supported"       ,  0,  0, bools },
             { "IA32_LBR_DEPTH.DEPTH 16 supported"       ,  1,  1, bools },
             { "IA32_LBR_DEPTH.DEPTH 24 supported"       ,  2,  2, bools },
@@ -7083,7 +8384,7 @@ print_1c_eax(unsigned int value)
             { "LBR IP values contain"                   , 31, 31, ipvs },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 33);
 }
 
@@ -7092,13 +8393,13 @@ print_1c_eax(unsigned int value)
 static void
 print_1c_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "CPL filtering supported"                 ,  0,  0, bools },
             { "branch filtering supported"              ,  1,  1, bools },
             { "call-stack mode supported"               ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 33);
 }
 
@@ -7107,13 +8408,13 @@ print_1c_ebx(unsigned int value)
 static void
 print_1c_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "mispredict bit supported"                ,  0,  0, bools },
             { "timed LBRs supported"                    ,  1,  1, bools },
             { "branch type field supported"             ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 33);
 }
 
@@ -7122,12 +8423,12 @@ print_1c_ecx(unsigned int value)
 static void
 print_1d_n_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "total_tile_bytes"                        ,  0, 15, NIL_IMAGES },
             { "bytes_per_tile"                          , 16, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 16);
 }
 
@@ -7136,12 +8437,12 @@ print_1d_n_eax(unsigned int value)
 static void
 print_1d_n_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "bytes_per_row"                           ,  0, 15, NIL_IMAGES },
             { "max_names"                               , 16, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 16);
 }
 
@@ -7150,11 +8451,11 @@ print_1d_n_ebx(unsigned int value)
 static void
 print_1d_n_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "max_rows"                                ,  0, 15, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 16);
 }
 
@@ -7163,13 +8464,13 @@ print_1d_n_ecx(unsigned int value)
 static void
 print_1e_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "tmul_maxk"                               ,  0,  7, NIL_IMAGES },
             { "tmul_maxn"                               ,  8, 23, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 00000020h, register EBX
@@ -7180,12 +8481,12 @@ print_20_ebx(unsigned int value)
     /*
     ** The meanings of the bits correlate with the IA32_HRESET_ENABLE MSR bits.
     */
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "HRESET supported: EHFI history"          ,  0,  0, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 20000001h, register EDX
@@ -7198,13 +8499,13 @@ print_20000001_edx(unsigned int value)
     // information."  But I found no document that specifies that information.
     // sandpile.org had the following bit.
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "k1om"                                    ,  0,  0, bools },
     };
 
-    printf("   Xeon Phi graphics function features (0x20000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Xeon Phi graphics function features (0x20000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000001h, register EAX
@@ -7212,7 +8513,7 @@ print_20000001_edx(unsigned int value)
 static void
 print_40000001_eax_kvm(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "kvmclock available at MSR 0x11"          ,  0,  0, bools },
             { "delays unnecessary for PIO ops"          ,  1,  1, bools },
             { "mmu_op"                                  ,  2,  2, bools },
@@ -7230,9 +8531,9 @@ print_40000001_eax_kvm(unsigned int value)
             { "stable: no guest per-cpu warps expected" , 24, 24, bools },
     };
 
-    printf("   hypervisor features (0x40000001/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor features (0x40000001/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000001h, register EDX
@@ -7240,13 +8541,13 @@ print_40000001_eax_kvm(unsigned int value)
 static void
 print_40000001_edx_kvm(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "realtime hint: no unbound preemption"    ,  0,  0, bools },
     };
 
-    printf("   hypervisor features (0x40000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor features (0x40000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000002h, register ECX
@@ -7254,12 +8555,12 @@ print_40000001_edx_kvm(unsigned int value)
 static void
 print_40000002_ecx_xen(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "MMU_PT_UPDATE_PRESERVE_AD supported"     ,  0,  0, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000003h, register EAX
@@ -7267,14 +8568,14 @@ print_40000002_ecx_xen(unsigned int value)
 static void
 print_40000003_eax_xen(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "vtsc"                                    ,  0,  0, bools },
             { "host tsc is safe"                        ,  1,  1, bools },
             { "boot cpu has RDTSCP"                     ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000003h, register EAX
@@ -7282,7 +8583,7 @@ print_40000003_eax_xen(unsigned int value)
 static void
 print_40000003_eax_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "VP run time"                             ,  0,  0, bools },
             { "partition reference counter"             ,  1,  1, bools },
             { "basic synIC MSRs"                        ,  2,  2, bools },
@@ -7299,9 +8600,9 @@ print_40000003_eax_microsoft(unsigned int value)
     };
 
 
-    printf("   hypervisor feature identification (0x40000003/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor feature identification (0x40000003/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000003h, register EBX
@@ -7309,7 +8610,7 @@ print_40000003_eax_microsoft(unsigned int value)
 static void
 print_40000003_ebx_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "CreatePartitions"                        ,  0,  0, bools },
             { "AccessPartitionId"                       ,  1,  1, bools },
             { "AccessMemoryPool"                        ,  2,  2, bools },
@@ -7328,9 +8629,9 @@ print_40000003_ebx_microsoft(unsigned int value)
             { "StartVirtualProcessor"                   , 21, 21, bools },
     };
 
-    printf("   hypervisor partition creation flags (0x40000003/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor partition creation flags (0x40000003/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000003h, register ECX
@@ -7338,13 +8639,13 @@ print_40000003_ebx_microsoft(unsigned int value)
 static void
 print_40000003_ecx_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "maximum process power state"             ,  0,  3, NIL_IMAGES },
     };
 
-    printf("   hypervisor power management features (0x40000003/ecx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor power management features (0x40000003/ecx):\n");
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000003h, register EDX
@@ -7352,7 +8653,7 @@ print_40000003_ecx_microsoft(unsigned int value)
 static void
 print_40000003_edx_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "MWAIT available"                         ,  0,  0, bools },
             { "guest debugging support available"       ,  1,  1, bools },
             { "performance monitor support available"   ,  2,  2, bools },
@@ -7374,9 +8675,9 @@ print_40000003_edx_microsoft(unsigned int value)
             { "use direct synthetic timers"             , 19, 19, bools },
     };
 
-    printf("   hypervisor feature identification (0x40000003/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor feature identification (0x40000003/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000004h, register EAX
@@ -7384,7 +8685,7 @@ print_40000003_edx_microsoft(unsigned int value)
 static void
 print_40000004_eax_xen(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "virtualized APIC registers"              ,  0,  0, bools },
             { "virtualized x2APIC accesses"             ,  1,  1, bools },
             { "IOMMU mappings for other domain memory"  ,  2,  2, bools },
@@ -7392,8 +8693,8 @@ print_40000004_eax_xen(unsigned int value)
             { "domain id is valid"                      ,  4,  4, bools },
     };
 
-    printf("   HVM-specific parameters (0x40000004):\n");
-    print_names(value, names, LENGTH(names),
+    emit("   HVM-specific parameters (0x40000004):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 38);
 }
 
@@ -7402,7 +8703,7 @@ print_40000004_eax_xen(unsigned int value)
 static void
 print_40000004_eax_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "use hypercalls for AS switches"          ,  0,  0, bools },
             { "use hypercalls for local TLB flushes"    ,  1,  1, bools },
             { "use hypercalls for remote TLB flushes"   ,  2,  2, bools },
@@ -7420,9 +8721,9 @@ print_40000004_eax_microsoft(unsigned int value)
             { "use enlightened VMCS interface"          , 14, 14, bools },
     };
 
-    printf("   hypervisor recommendations (0x40000004/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor recommendations (0x40000004/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000005h, subfunction 0, register EBX
@@ -7430,13 +8731,13 @@ print_40000004_eax_microsoft(unsigned int value)
 static void
 print_40000005_0_ebx_xen(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "maximum machine address width"           ,  0,  7, NIL_IMAGES },
     };
 
-    printf("   PV-specific parameters (0x40000005):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   PV-specific parameters (0x40000005):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000006h, register EAX
@@ -7444,7 +8745,7 @@ print_40000005_0_ebx_xen(unsigned int value)
 static void
 print_40000006_eax_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "APIC overlay assist"                     ,  0,  0, bools },
             { "MSR bitmaps"                             ,  1,  1, bools },
             { "performance counters"                    ,  2,  2, bools },
@@ -7457,9 +8758,9 @@ print_40000006_eax_microsoft(unsigned int value)
             { "synthetic timers are volatile"           ,  9,  9, bools },
     };
 
-    printf("   hypervisor hardware features used (0x40000006/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   hypervisor hardware features used (0x40000006/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000007h, register EAX
@@ -7467,13 +8768,13 @@ print_40000006_eax_microsoft(unsigned int value)
 static void
 print_40000007_eax_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "StartLogicalProcessor"                   ,  0,  0, bools },
             { "CreateRootvirtualProcessor"              ,  1,  1, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000006h, register EBX
@@ -7481,14 +8782,14 @@ print_40000007_eax_microsoft(unsigned int value)
 static void
 print_40000007_ebx_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "ProcessorPowerManagement"                ,  0,  0, bools },
             { "MwaitIdleStates"                         ,  1,  1, bools },
             { "LogicalProcessorIdling"                  ,  2,  2, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000008h, register EAX
@@ -7496,13 +8797,13 @@ print_40000007_ebx_microsoft(unsigned int value)
 static void
 print_40000008_eax_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "SvmSupported"                            ,  0,  0, bools },
             { "MaxPasidSpacePasidCount"                 , 11, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000009h, register EAX
@@ -7510,7 +8811,7 @@ print_40000008_eax_microsoft(unsigned int value)
 static void
 print_40000009_eax_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "AccessSynicRegs"                         ,  2,  2, bools },
             { "AccessIntrCtrlRegs"                      ,  4,  4, bools },
             { "AccessHypercallMsrs"                     ,  5,  5, bools },
@@ -7518,8 +8819,8 @@ print_40000009_eax_microsoft(unsigned int value)
             { "AccessReenlightenmentControls"           , 12, 12, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 40000009h, register EBX
@@ -7527,14 +8828,14 @@ print_40000009_eax_microsoft(unsigned int value)
 static void
 print_40000009_edx_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "XmmRegistersForFastHypercallAvailable"   ,  4,  4, bools },
             { "FastHypercallOutputAvailable"            , 15, 15, bools },
             { "SintPoillingModeAvailable"               , 17, 17, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 4000000Ah, register EAX
@@ -7542,7 +8843,7 @@ print_40000009_edx_microsoft(unsigned int value)
 static void
 print_4000000a_eax_microsoft(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "enlightened VMCS version (low)"          ,  0,  7, NIL_IMAGES },
             { "enlightened VMCS version (high)"         ,  8, 15, NIL_IMAGES },
             { "direct virtual flush hypercalls support" , 17, 17, bools },
@@ -7550,8 +8851,8 @@ print_4000000a_eax_microsoft(unsigned int value)
             { "enlightened MSR bitmap support"          , 19, 19, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register EAX
@@ -7559,7 +8860,7 @@ print_4000000a_eax_microsoft(unsigned int value)
 static void
 print_80000001_eax_amd(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "family/generation"                       ,  8, 11, NIL_IMAGES },
             { "model"                                   ,  4,  7, NIL_IMAGES },
             { "stepping id"                             ,  0,  3, NIL_IMAGES },
@@ -7567,14 +8868,14 @@ print_80000001_eax_amd(unsigned int value)
             { "extended model"                          , 16, 19, NIL_IMAGES },
     };
 
-    printf("   extended processor signature (0x80000001/eax):\n");
-    print_names(value, names, LENGTH(names),
+    emit("   extended processor signature (0x80000001/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 15);
 
     unsigned int  synth_family = Synth_Family(value);
     unsigned int  synth_model = Synth_Model(value);
-    printf("      (family synth)  = 0x%x (%u)\n", synth_family, synth_family);
-    printf("      (model synth)   = 0x%x (%u)\n", synth_model, synth_model);
+    emit("      (family synth)  = 0x%x (%u)\n", synth_family, synth_family);
+    emit("      (model synth)   = 0x%x (%u)\n", synth_model, synth_model);
 
     print_x_synth_amd(value);
 }
@@ -7584,7 +8885,7 @@ print_80000001_eax_amd(unsigned int value)
 static void
 print_80000001_eax_hygon(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "family/generation"                       ,  8, 11, NIL_IMAGES },
             { "model"                                   ,  4,  7, NIL_IMAGES },
             { "stepping id"                             ,  0,  3, NIL_IMAGES },
@@ -7592,14 +8893,14 @@ print_80000001_eax_hygon(unsigned int value)
             { "extended model"                          , 16, 19, NIL_IMAGES },
     };
 
-    printf("   extended processor signature (0x80000001/eax):\n");
-    print_names(value, names, LENGTH(names),
+    emit("   extended processor signature (0x80000001/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 15);
 
     unsigned int  synth_family = Synth_Family(value);
     unsigned int  synth_model = Synth_Model(value);
-    printf("      (family synth)  = 0x%x (%u)\n", synth_family, synth_family);
-    printf("      (model synth)   = 0x%x (%u)\n", synth_model, synth_model);
+    emit("      (family synth)  = 0x%x (%u)\n", synth_family, synth_family);
+    emit("      (model synth)   = 0x%x (%u)\n", synth_model, synth_model);
 
     print_x_synth_hygon(value);
 }
@@ -7609,15 +8910,15 @@ print_80000001_eax_hygon(unsigned int value)
 static void
 print_80000001_eax_via(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "generation"                              ,  8, 11, NIL_IMAGES },
             { "model"                                   ,  4,  7, NIL_IMAGES },
             { "stepping"                                ,  0,  3, NIL_IMAGES },
     };
 
-    printf("   extended processor signature (0x80000001/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   extended processor signature (0x80000001/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 
     print_x_synth_via(value);
 }
@@ -7627,22 +8928,22 @@ print_80000001_eax_via(unsigned int value)
 static void
 print_80000001_eax_transmeta(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "generation"                              ,  8, 11, NIL_IMAGES },
             { "model"                                   ,  4,  7, NIL_IMAGES },
             { "stepping"                                ,  0,  3, NIL_IMAGES },
     };
 
-    printf("   extended processor signature (0x80000001/eax):\n");
-    print_names(value, names, LENGTH(names),
+    emit("   extended processor signature (0x80000001/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 14);
 
     ccstring  synth = decode_synth_transmeta(value, NULL);
-    printf("      (simple synth) = ");
+    emit("      (simple synth) = ");
     if (synth != NULL) {
-        printf("%s", synth);
+        emit("%s", synth);
     }
-    printf("\n");
+    emit("\n");
 }
 
 // print results of CPUID function 80000001h, register EAX
@@ -7685,7 +8986,7 @@ print_80000001_eax(unsigned int value, vendor_t vendor)
 static void
 print_80000001_edx_intel(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "SYSCALL and SYSRET instructions"         , 11, 11, bools },
             { "execution disable"                       , 20, 20, bools },
             { "1-GB large page support"                 , 26, 26, bools },
@@ -7693,9 +8994,9 @@ print_80000001_edx_intel(unsigned int value)
             { "64-bit extensions technology available"  , 29, 29, bools },
     };
 
-    printf("   extended feature flags (0x80000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   extended feature flags (0x80000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register EDX
@@ -7703,7 +9004,7 @@ print_80000001_edx_intel(unsigned int value)
 static void
 print_80000001_edx_amd(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "x87 FPU on chip"                         ,  0,  0, bools },
             { "virtual-8086 mode enhancement"           ,  1,  1, bools },
             { "debugging extensions"                    ,  2,  2, bools },
@@ -7734,9 +9035,9 @@ print_80000001_edx_amd(unsigned int value)
             { "3DNow! instructions"                     , 31, 31, bools },
     };
 
-    printf("   extended feature flags (0x80000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   extended feature flags (0x80000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register EDX
@@ -7744,7 +9045,7 @@ print_80000001_edx_amd(unsigned int value)
 static void
 print_80000001_edx_cyrix_via(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "x87 FPU on chip"                         ,  0,  0, bools },
             { "virtual-8086 mode enhancement"           ,  1,  1, bools },
             { "debugging extensions"                    ,  2,  2, bools },
@@ -7772,9 +9073,9 @@ print_80000001_edx_cyrix_via(unsigned int value)
             { "3DNow! instructions"                     , 31, 31, bools },
     };
 
-    printf("   extended feature flags (0x80000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   extended feature flags (0x80000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register EDX
@@ -7782,7 +9083,7 @@ print_80000001_edx_cyrix_via(unsigned int value)
 static void
 print_80000001_edx_transmeta(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "x87 FPU on chip"                         ,  0,  0, bools },
             { "virtual-8086 mode enhancement"           ,  1,  1, bools },
             { "debugging extensions"                    ,  2,  2, bools },
@@ -7802,9 +9103,9 @@ print_80000001_edx_transmeta(unsigned int value)
             { "FXSAVE/FXRSTOR"                          , 24, 24, bools },
     };
 
-    printf("   extended feature flags (0x80000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   extended feature flags (0x80000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register EDX
@@ -7812,7 +9113,7 @@ print_80000001_edx_transmeta(unsigned int value)
 static void
 print_80000001_edx_nsc(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "x87 FPU on chip"                         ,  0,  0, bools },
             { "virtual-8086 mode enhancement"           ,  1,  1, bools },
             { "debugging extensions"                    ,  2,  2, bools },
@@ -7829,9 +9130,9 @@ print_80000001_edx_nsc(unsigned int value)
             { "6x86MX multimedia extensions"            , 24, 24, bools },
     };
 
-    printf("   extended feature flags (0x80000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   extended feature flags (0x80000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register EDX
@@ -7876,7 +9177,7 @@ print_80000001_edx(unsigned int value, vendor_t vendor)
 static void
 print_80000001_ecx_amd(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "LAHF/SAHF supported in 64-bit mode"      ,  0,  0, bools },
             { "CMP Legacy"                              ,  1,  1, bools },
             { "SVM: secure virtual machine"             ,  2,  2, bools },
@@ -7905,9 +9206,10 @@ print_80000001_ecx_amd(unsigned int value)
             { "MWAITX/MONITORX supported"               , 29, 29, bools },
             { "Address mask extension support"          , 30, 30, bools }, // SKC*
     };
+    static_assert(FEATURES_NAMED(names, 0x80000001, 0, WORD_ECX), "cpuid_features.h differs from 0x80000001/ecx names");
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register ECX
@@ -7915,14 +9217,14 @@ print_80000001_ecx_amd(unsigned int value)
 static void
 print_80000001_ecx_intel(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "LAHF/SAHF supported in 64-bit mode"      ,  0,  0, bools },
             { "LZCNT advanced bit manipulation"         ,  5,  5, bools },
             { "3DNow! PREFETCH/PREFETCHW instructions"  ,  8,  8, bools },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000001h, register ECX
@@ -7933,15 +9235,15 @@ print_80000001_ecx(unsigned int value, vendor_t vendor)
 {
     switch (vendor) {
     case VENDOR_AMD:
-        printf("   AMD feature flags (0x80000001/ecx):\n");
+        emit("   AMD feature flags (0x80000001/ecx):\n");
         print_80000001_ecx_amd(value);
         break;
     case VENDOR_INTEL:
-        printf("   Intel feature flags (0x80000001/ecx):\n");
+        emit("   Intel feature flags (0x80000001/ecx):\n");
         print_80000001_ecx_intel(value);
         break;
     case VENDOR_HYGON:
-        printf("   Hygon feature flags (0x80000001/ecx):\n");
+        emit("   Hygon feature flags (0x80000001/ecx):\n");
         print_80000001_ecx_amd(value);
         break;
     case VENDOR_CYRIX:
@@ -7970,20 +9272,20 @@ print_80000001_ebx_amd(unsigned int value, unsigned int val_1_eax)
 
     if (__F(val_1_eax) == _XF(0) + _F(15)
         && __M(val_1_eax) < _XM(4) + _M(0)) {
-        static named_item  names[]
+        static constexpr named_item  names[]
             = { { "raw"                                     ,  0, 31, NIL_IMAGES },
                 { "BrandId"                                 ,  0, 16, NIL_IMAGES },
                 { "BrandTableIndex"                         ,  6, 12, NIL_IMAGES },
                 { "NN"                                      ,  0,  6, NIL_IMAGES },
         };
 
-        printf("   extended brand id (0x80000001/ebx):\n");
-        print_names(value, names, LENGTH(names),
-            /* max_len => */ 0);
+        emit("   extended brand id (0x80000001/ebx):\n");
+        print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+            /* max_len => */ NAMES_WIDTH(names));
     }
     else if (__F(val_1_eax) == _XF(0) + _F(15)
         && __M(val_1_eax) >= _XM(4) + _M(0)) {
-        static named_item  names[]
+        static constexpr named_item  names[]
             = { { "raw"                                     ,  0, 31, NIL_IMAGES },
                 { "BrandId"                                 ,  0, 16, NIL_IMAGES },
                 { "PwrLmt:high"                             ,  6,  8, NIL_IMAGES },
@@ -7993,13 +9295,13 @@ print_80000001_ebx_amd(unsigned int value, unsigned int val_1_eax)
                 { "NN:low"                                  ,  0,  5, NIL_IMAGES },
         };
 
-        printf("   extended brand id (0x80000001/ebx):\n");
-        print_names(value, names, LENGTH(names),
-            /* max_len => */ 0);
+        emit("   extended brand id (0x80000001/ebx):\n");
+        print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+            /* max_len => */ NAMES_WIDTH(names));
     }
     else if (__F(val_1_eax) == _XF(1) + _F(15)
         || __F(val_1_eax) == _XF(2) + _F(15)) {
-        static named_item  names[]
+        static constexpr named_item  names[]
             = { { "raw"                                     ,  0, 31, NIL_IMAGES },
                 { "BrandId"                                 ,  0, 15, NIL_IMAGES },
                 { "str1"                                    , 11, 14, NIL_IMAGES },
@@ -8008,20 +9310,20 @@ print_80000001_ebx_amd(unsigned int value, unsigned int val_1_eax)
                 { "PG"                                      , 15, 15, NIL_IMAGES },
         };
 
-        printf("   extended brand id (0x80000001/ebx):\n");
+        emit("   extended brand id (0x80000001/ebx):\n");
         max_len = 12;
-        print_names(value, names, LENGTH(names),
+        print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
             /* max_len => */ max_len);
     }
     else {
-        static named_item  names[]
+        static constexpr named_item  names[]
             = { { "raw"                                     ,  0, 31, NIL_IMAGES },
                 { "BrandId"                                 ,  0, 15, NIL_IMAGES },
         };
 
-        printf("   extended brand id (0x80000001/ebx):\n");
+        emit("   extended brand id (0x80000001/ebx):\n");
         max_len = 7;
-        print_names(value, names, LENGTH(names),
+        print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
             /* max_len => */ max_len);
     }
 
@@ -8130,7 +9432,7 @@ print_80000001_ebx_amd(unsigned int value, unsigned int val_1_eax)
 
         named_item  names[] = { { "PkgType", 28, 31, use_pkg_type } };
 
-        print_names(value, names, LENGTH(names),
+        print_names(value, WORD_EBX, names, LENGTH(names), 0,
             /* max_len => */ max_len);
     }
 }
@@ -8170,17 +9472,17 @@ print_80000001_ebx(unsigned int value, vendor_t vendor, unsigned int val_1_eax)
 static void
 print_80000005_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "instruction # entries"                   ,  0,  7, NIL_IMAGES },
             { "instruction associativity"               ,  8, 15, NIL_IMAGES },
             { "data # entries"                          , 16, 23, NIL_IMAGES },
             { "data associativity"                      , 24, 31, NIL_IMAGES },
     };
 
-    printf("   L1 TLB/cache information: 2M/4M pages & L1 TLB"
+    emit("   L1 TLB/cache information: 2M/4M pages & L1 TLB"
         " (0x80000005/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000005h, register EBX
@@ -8188,17 +9490,17 @@ print_80000005_eax(unsigned int value)
 static void
 print_80000005_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "instruction # entries"                   ,  0,  7, NIL_IMAGES },
             { "instruction associativity"               ,  8, 15, NIL_IMAGES },
             { "data # entries"                          , 16, 23, NIL_IMAGES },
             { "data associativity"                      , 24, 31, NIL_IMAGES },
     };
 
-    printf("   L1 TLB/cache information: 4K pages & L1 TLB"
+    emit("   L1 TLB/cache information: 4K pages & L1 TLB"
         " (0x80000005/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000005h, register ECX
@@ -8206,16 +9508,16 @@ print_80000005_ebx(unsigned int value)
 static void
 print_80000005_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
             { "lines per tag"                           ,  8, 15, NIL_IMAGES },
             { "associativity"                           , 16, 23, NIL_IMAGES },
             { "size (KB)"                               , 24, 31, NIL_IMAGES },
     };
 
-    printf("   L1 data cache information (0x80000005/ecx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   L1 data cache information (0x80000005/ecx):\n");
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000005h, register EDX
@@ -8223,16 +9525,16 @@ print_80000005_ecx(unsigned int value)
 static void
 print_80000005_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
             { "lines per tag"                           ,  8, 15, NIL_IMAGES },
             { "associativity"                           , 16, 23, NIL_IMAGES },
             { "size (KB)"                               , 24, 31, NIL_IMAGES },
     };
 
-    printf("   L1 instruction cache information (0x80000005/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   L1 instruction cache information (0x80000005/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // strings array for decode cache associativity
@@ -8258,17 +9560,17 @@ static ccstring  l2_assoc[1 << 4] = { "L2 off (0)",
 static void
 print_80000006_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
             { "instruction associativity"               , 12, 15, l2_assoc },
             { "data # entries"                          , 16, 27, NIL_IMAGES },
             { "data associativity"                      , 28, 31, l2_assoc },
     };
 
-    printf("   L2 TLB/cache information: 2M/4M pages & L2 TLB"
+    emit("   L2 TLB/cache information: 2M/4M pages & L2 TLB"
         " (0x80000006/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000006h, register EBX
@@ -8276,40 +9578,33 @@ print_80000006_eax(unsigned int value)
 static void
 print_80000006_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
             { "instruction associativity"               , 12, 15, l2_assoc },
             { "data # entries"                          , 16, 27, NIL_IMAGES },
             { "data associativity"                      , 28, 31, l2_assoc },
     };
 
-    printf("   L2 TLB/cache information: 4K pages & L2 TLB (0x80000006/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   L2 TLB/cache information: 4K pages & L2 TLB (0x80000006/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000006h, register ECX
 // value = CPUID function 80000006h, register ECX
 static void
-print_80000006_ecx(unsigned int value, code_stash_t* stash)
+print_80000006_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
             { "lines per tag"                           ,  8, 11, NIL_IMAGES },
             { "associativity"                           , 12, 15, l2_assoc },
             { "size (KB)"                               , 16, 31, NIL_IMAGES },
     };
 
-    printf("   L2 unified cache information (0x80000006/ecx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
-
-    if (((value >> 12) & 0xf) == 4 && (value >> 16) == 256) {
-        stash->L2_4w_256K = TRUE;
-    }
-    else if (((value >> 12) & 0xf) == 4 && (value >> 16) == 512) {
-        stash->L2_4w_512K = TRUE;
-    }
+    emit("   L2 unified cache information (0x80000006/ecx):\n");
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000006h, register EDX
@@ -8317,16 +9612,16 @@ print_80000006_ecx(unsigned int value, code_stash_t* stash)
 static void
 print_80000006_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
             { "lines per tag"                           ,  8, 11, NIL_IMAGES },
             { "associativity"                           , 12, 15, l2_assoc },
             { "size (in 512KB units)"                   , 18, 31, NIL_IMAGES },
     };
 
-    printf("   L3 cache information (0x80000006/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   L3 cache information (0x80000006/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000007h, register EBX
@@ -8334,16 +9629,16 @@ print_80000006_edx(unsigned int value)
 static void
 print_80000007_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "MCA overflow recovery support"           ,  0,  0, bools },
             { "SUCCOR support"                          ,  1,  1, bools },
             { "HWA: hardware assert support"            ,  2,  2, bools },
             { "scalable MCA support"                    ,  3,  3, bools },
     };
 
-    printf("   RAS Capability (0x80000007/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   RAS Capability (0x80000007/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000007h, register ECX
@@ -8351,13 +9646,13 @@ print_80000007_ebx(unsigned int value)
 static void
 print_80000007_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "CmpUnitPwrSampleTimeRatio"               ,  0, 31, NIL_IMAGES },
     };
 
-    printf("   Advanced Power Management Features (0x80000007/ecx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Advanced Power Management Features (0x80000007/ecx):\n");
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000007h, register EDX
@@ -8365,7 +9660,7 @@ print_80000007_ecx(unsigned int value)
 static void
 print_80000007_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "TS: temperature sensing diode"           ,  0,  0, bools },
             { "FID: frequency ID control"               ,  1,  1, bools },
             { "VID: voltage ID control"                 ,  2,  2, bools },
@@ -8383,9 +9678,9 @@ print_80000007_edx(unsigned int value)
             { "RAPL: running average power limit"       , 14, 14, bools },
     };
 
-    printf("   Advanced Power Management Features (0x80000007/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Advanced Power Management Features (0x80000007/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000008h, register EAX
@@ -8393,15 +9688,15 @@ print_80000007_edx(unsigned int value)
 static void
 print_80000008_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "maximum physical address bits"           ,  0,  7, NIL_IMAGES },
             { "maximum linear (virtual) address bits"   ,  8, 15, NIL_IMAGES },
             { "maximum guest physical address bits"     , 16, 23, NIL_IMAGES },
     };
 
-    printf("   Physical Address and Linear Address Size (0x80000008/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Physical Address and Linear Address Size (0x80000008/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000008h, register EBX
@@ -8409,7 +9704,7 @@ print_80000008_eax(unsigned int value)
 static void
 print_80000008_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "CLZERO instruction"                      ,  0,  0, bools },
             { "instructions retired count support"      ,  1,  1, bools },
             { "always save/restore error pointers"      ,  2,  2, bools },
@@ -8426,9 +9721,9 @@ print_80000008_ebx(unsigned int value)
             { "SSBD fixed in hardware"                  , 26, 26, bools },
     };
 
-    printf("   Extended Feature Extensions ID (0x80000008/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Extended Feature Extensions ID (0x80000008/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000008h, register ECX
@@ -8436,14 +9731,14 @@ print_80000008_ebx(unsigned int value)
 static void
 print_80000008_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { // bit field 0, 7 is reported by caller
             { "ApicIdCoreIdSize"                        , 12, 15, NIL_IMAGES },
             { "performance time-stamp counter size"     , 16, 17, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000008h, register EDX
@@ -8451,13 +9746,13 @@ print_80000008_ecx(unsigned int value)
 static void
 print_80000008_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "RDPRU instruction max input support"     , 16, 23, NIL_IMAGES },
     };
 
-    printf("   Feature Extended Size (0x80000008/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Feature Extended Size (0x80000008/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000000Ah, register EAX
@@ -8465,13 +9760,13 @@ print_80000008_edx(unsigned int value)
 static void
 print_8000000a_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "SvmRev: SVM revision"                    ,  0,  7, NIL_IMAGES },
     };
 
-    printf("   SVM Secure Virtual Machine (0x8000000a/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   SVM Secure Virtual Machine (0x8000000a/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000000Ah, register EDX
@@ -8479,7 +9774,7 @@ print_8000000a_eax(unsigned int value)
 static void
 print_8000000a_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "nested paging"                           ,  0,  0, bools },
             { "LBR virtualization"                      ,  1,  1, bools },
             { "SVM lock"                                ,  2,  2, bools },
@@ -8499,9 +9794,9 @@ print_8000000a_edx(unsigned int value)
             { "INVLPGB/TLBSYNC hyperv interc enable"    , 24, 24, bools },
     };
 
-    printf("   SVM Secure Virtual Machine (0x8000000a/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   SVM Secure Virtual Machine (0x8000000a/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000000Ah, register EBX
@@ -8509,7 +9804,7 @@ print_8000000a_edx(unsigned int value)
 static void
 print_8000000a_ebx(unsigned int value)
 {
-    printf("   NASID: number of address space identifiers = 0x%x (%u):\n",
+    emit("   NASID: number of address space identifiers = 0x%x (%u):\n",
         value, value);
 }
 
@@ -8518,16 +9813,16 @@ print_8000000a_ebx(unsigned int value)
 static void
 print_80000019_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
             { "instruction associativity"               , 12, 15, l2_assoc },
             { "data # entries"                          , 16, 27, NIL_IMAGES },
             { "data associativity"                      , 28, 31, l2_assoc },
     };
 
-    printf("   L1 TLB information: 1G pages (0x80000019/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   L1 TLB information: 1G pages (0x80000019/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 80000019h, register EBX
@@ -8535,16 +9830,16 @@ print_80000019_eax(unsigned int value)
 static void
 print_80000019_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
             { "instruction associativity"               , 12, 15, l2_assoc },
             { "data # entries"                          , 16, 27, NIL_IMAGES },
             { "data associativity"                      , 28, 31, l2_assoc },
     };
 
-    printf("   L2 TLB information: 1G pages (0x80000019/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   L2 TLB information: 1G pages (0x80000019/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Ah, register EAX
@@ -8552,15 +9847,15 @@ print_80000019_ebx(unsigned int value)
 static void
 print_8000001a_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "128-bit SSE executed full-width"         ,  0,  0, bools },
             { "MOVU* better than MOVL*/MOVH*"           ,  1,  1, bools },
             { "256-bit SSE executed full-width"         ,  2,  2, bools },
     };
 
-    printf("   SVM Secure Virtual Machine (0x8000001a/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   SVM Secure Virtual Machine (0x8000001a/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Bh, register EAX
@@ -8568,7 +9863,7 @@ print_8000001a_eax(unsigned int value)
 static void
 print_8000001b_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "IBS feature flags valid"                 ,  0,  0, bools },
             { "IBS fetch sampling"                      ,  1,  1, bools },
             { "IBS execution sampling"                  ,  2,  2, bools },
@@ -8582,9 +9877,9 @@ print_8000001b_eax(unsigned int value)
             { "IBS op data 4 MSR support"               , 10, 10, bools },
     };
 
-    printf("   Instruction Based Sampling Identifiers (0x8000001b/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Instruction Based Sampling Identifiers (0x8000001b/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Ch, register EAX
@@ -8592,7 +9887,7 @@ print_8000001b_eax(unsigned int value)
 static void
 print_8000001c_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "lightweight profiling"                   ,  0,  0, bools },
             { "LWPVAL instruction"                      ,  1,  1, bools },
             { "instruction retired event"               ,  2,  2, bools },
@@ -8603,10 +9898,10 @@ print_8000001c_eax(unsigned int value)
             { "interrupt on threshold overflow"         , 31, 31, bools },
     };
 
-    printf("   Lightweight Profiling Capabilities: Availability"
+    emit("   Lightweight Profiling Capabilities: Availability"
         " (0x8000001c/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Ch, register EBX
@@ -8614,16 +9909,16 @@ print_8000001c_eax(unsigned int value)
 static void
 print_8000001c_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "LWPCB byte size"                         ,  0,  7, NIL_IMAGES },
             { "event record byte size"                  ,  8, 15, NIL_IMAGES },
             { "maximum EventId"                         , 16, 23, NIL_IMAGES },
             { "EventInterval1 field offset"             , 24, 31, NIL_IMAGES },
     };
 
-    printf("   Lightweight Profiling Capabilities (0x8000001c/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Lightweight Profiling Capabilities (0x8000001c/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Ch, register ECX
@@ -8631,7 +9926,7 @@ print_8000001c_ebx(unsigned int value)
 static void
 print_8000001c_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "latency counter bit size"                ,  0,  4, NIL_IMAGES },
             { "data cache miss address valid"           ,  5,  5, bools },
             { "amount cache latency is rounded"         ,  6,  8, NIL_IMAGES },
@@ -8643,9 +9938,9 @@ print_8000001c_ecx(unsigned int value)
             { "cache latency filteing"                  , 31, 31, bools },
     };
 
-    printf("   Lightweight Profiling Capabilities (0x8000001c/ecx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Lightweight Profiling Capabilities (0x8000001c/ecx):\n");
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Ch, register EDX
@@ -8653,7 +9948,7 @@ print_8000001c_ecx(unsigned int value)
 static void
 print_8000001c_edx(unsigned int  value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "lightweight profiling"                   ,  0,  0, bools },
             { "LWPVAL instruction"                      ,  1,  1, bools },
             { "instruction retired event"               ,  2,  2, bools },
@@ -8664,10 +9959,10 @@ print_8000001c_edx(unsigned int  value)
             { "interrupt on threshold overflow"         , 31, 31, bools },
     };
 
-    printf("   Lightweight Profiling Capabilities: Supported"
+    emit("   Lightweight Profiling Capabilities: Supported"
         " (0x8000001c/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Dh, register EAX
@@ -8680,7 +9975,7 @@ print_8000001d_eax(unsigned int value)
                                           "instruction (2)",
                                           "unified (3)" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "type"                                    ,  0,  4, cache_type },
             { "level"                                   ,  5,  7, NIL_IMAGES },
             { "self-initializing"                       ,  8,  8, bools },
@@ -8688,7 +9983,7 @@ print_8000001d_eax(unsigned int value)
             { "extra cores sharing this cache"          , 14, 25, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 31);
 }
 
@@ -8697,13 +9992,13 @@ print_8000001d_eax(unsigned int value)
 static void
 print_8000001d_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "line size in bytes"                      ,  0, 11, MINUS1_IMAGES },
             { "physical line partitions"                , 12, 21, MINUS1_IMAGES },
             { "number of ways"                          , 22, 31, MINUS1_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 31);
 }
 
@@ -8712,12 +10007,12 @@ print_8000001d_ebx(unsigned int value)
 static void
 print_8000001d_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "write-back invalidate"                   ,  0,  0, bools },
             { "cache inclusive of lower levels"         ,  1,  1, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 31);
 }
 
@@ -8735,24 +10030,24 @@ print_8000001d_synth(const unsigned int words[])
     unsigned int  sets = words[WORD_ECX] + 1;
     unsigned int  size = (ways_assoc * parts * line_size * sets);
 
-    printf("      (synth size)                    = %u", size);
+    emit("      (synth size)                    = %u", size);
     if (size > 1048576) {
         if ((size % 1048576) == 0) {
-            printf(" (%u MB)", size / 1048576);
+            emit(" (%u MB)", size / 1048576);
         }
         else {
-            printf(" (%.1f MB)", ((float)size) / 1048576.0);
+            emit(" (%.1f MB)", ((float)size) / 1048576.0);
         }
     }
     else if (size > 1024) {
         if ((size % 1024) == 0) {
-            printf(" (%u KB)", size / 1024);
+            emit(" (%u KB)", size / 1024);
         }
         else {
-            printf(" (%.1f KB)", ((float)size) / 1024.0);
+            emit(" (%.1f KB)", ((float)size) / 1024.0);
         }
     }
-    printf("\n");
+    emit("\n");
 }
 
 // print results of CPUID function 8000001Eh, register EBX
@@ -8760,14 +10055,14 @@ print_8000001d_synth(const unsigned int words[])
 static void
 print_8000001e_ebx_f16(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "compute unit ID"                         ,  0,  7, NIL_IMAGES },
             { "cores per compute unit"                  ,  8,  9, MINUS1_IMAGES },
     };
 
-    printf("   Compute Unit Identifiers (0x8000001e/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Compute Unit Identifiers (0x8000001e/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Eh, register EBX
@@ -8775,14 +10070,14 @@ print_8000001e_ebx_f16(unsigned int value)
 static void
 print_8000001e_ebx_gt_f16(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "core ID"                                 ,  0,  7, NIL_IMAGES },
             { "threads per core"                        ,  8, 15, MINUS1_IMAGES },
     };
 
-    printf("   Core Identifiers (0x8000001e/ebx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Core Identifiers (0x8000001e/ebx):\n");
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Eh, register ECX
@@ -8790,14 +10085,14 @@ print_8000001e_ebx_gt_f16(unsigned int value)
 static void
 print_8000001e_ecx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "node ID"                                 ,  0,  7, NIL_IMAGES },
             { "nodes per processor"                     ,  8, 10, MINUS1_IMAGES },
     };
 
-    printf("   Node Identifiers (0x8000001e/ecx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Node Identifiers (0x8000001e/ecx):\n");
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function 8000001Fh, register EAX
@@ -8805,7 +10100,7 @@ print_8000001e_ecx(unsigned int value)
 static void
 print_8000001f_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "SME: secure memory encryption support"   ,  0,  0, bools },
             { "SEV: secure encrypted virtualize support",  1,  1, bools },
             { "VM page flush MSR support"               ,  2,  2, bools },
@@ -8820,7 +10115,7 @@ print_8000001f_eax(unsigned int value)
             { "disallowing IBS use by host"             , 15, 15, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -8829,12 +10124,12 @@ print_8000001f_eax(unsigned int value)
 static void
 print_8000001f_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "encryption bit position in PTE"          ,  0,  5, NIL_IMAGES },
             { "physical address space width reduction"  ,  6, 11, NIL_IMAGES },
             { "number of VM permission levels"          , 12, 15, NIL_IMAGES },
     };
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -8843,11 +10138,11 @@ print_8000001f_ebx(unsigned int value)
 static void
 print_80000020_0_ebx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "memory bandwidth enforcement support"    ,  1,  1, bools },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 36);
 }
 
@@ -8856,22 +10151,22 @@ print_80000020_0_ebx(unsigned int value)
 static void
 print_80860001_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "generation"                              ,  8, 11, NIL_IMAGES },
             { "model"                                   ,  4,  7, NIL_IMAGES },
             { "stepping"                                ,  0,  3, NIL_IMAGES },
     };
 
-    printf("   Transmeta processor signature (0x80860001/eax):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Transmeta processor signature (0x80860001/eax):\n");
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 
     ccstring  synth = decode_synth_transmeta(value, NULL);
-    printf("      (simple synth) = ");
+    emit("      (simple synth) = ");
     if (synth != NULL) {
-        printf("%s", synth);
+        emit("%s", synth);
     }
-    printf("\n");
+    emit("\n");
 }
 
 // print results of CPUID function 80860001h, register EDX
@@ -8879,7 +10174,7 @@ print_80860001_eax(unsigned int value)
 static void
 print_80860001_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "recovery CMS active"                     ,  0,  0, bools },
             { "LongRun"                                 ,  1,  1, bools },
             { "LongRun Table Interface LRTI (CMS 4.2)"  ,  3,  3, bools },
@@ -8888,9 +10183,9 @@ print_80860001_edx(unsigned int value)
             { "processor break events"                  , 12, 12, bools },
     };
 
-    printf("   Transmeta feature flags (0x80860001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   Transmeta feature flags (0x80860001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print TRANSMETA processor revision
@@ -8900,25 +10195,25 @@ print_transmeta_proc_rev_meaning(unsigned int proc_rev)
 {
     switch (proc_rev & 0xffff0000) {
     case 0x01010000:
-        printf("(TM3200)");
+        emit("(TM3200)");
         break;
     case 0x01020000:
-        printf("(TM5400)");
+        emit("(TM5400)");
         break;
     case 0x01030000:
         if ((proc_rev & 0xffffff00) == 0x00000000) {
-            printf("(TM5400 / TM5600)");
+            emit("(TM5400 / TM5600)");
         }
         else {
-            printf("(unknown)");
+            emit("(unknown)");
         }
         break;
     case 0x01040000:
     case 0x01050000:
-        printf("(TM5500 / TM5800)");
+        emit("(TM5500 / TM5800)");
         break;
     default:
-        printf("(unknown)");
+        emit("(unknown)");
         break;
     }
 }
@@ -8929,7 +10224,7 @@ print_transmeta_proc_rev_meaning(unsigned int proc_rev)
 static void
 print_80860001_ebx_ecx(unsigned int val_ebx, unsigned int  val_ecx)
 {
-    printf("   Transmeta processor revision (0x80000001/edx)"
+    emit("   Transmeta processor revision (0x80000001/edx)"
         " = %u.%u-%u.%u-%u ",
         (val_ebx >> 24) & 0xff,
         (val_ebx >> 16) & 0xff,
@@ -8938,12 +10233,12 @@ print_80860001_ebx_ecx(unsigned int val_ebx, unsigned int  val_ecx)
         val_ecx);
 
     if (val_ebx == 0x20000000) {
-        printf("(see 80860002/eax)");
+        emit("(see 80860002/eax)");
     }
     else {
         print_transmeta_proc_rev_meaning(val_ebx);
     }
-    printf("\n");
+    emit("\n");
 }
 
 // print results of CPUID function 80860002h, register EAX
@@ -8953,7 +10248,7 @@ static void
 print_80860002_eax(unsigned int value, code_stash_t* stash)
 {
     if (stash->transmeta_proc_rev == 0x02000000) {
-        printf("   Transmeta processor revision (0x80860002/eax)"
+        emit("   Transmeta processor revision (0x80860002/eax)"
             " = %u.%u-%u.%u ",
             (value >> 24) & 0xff,
             (value >> 16) & 0xff,
@@ -8962,7 +10257,7 @@ print_80860002_eax(unsigned int value, code_stash_t* stash)
 
         print_transmeta_proc_rev_meaning(value);
 
-        printf("\n");
+        emit("\n");
 
         stash->transmeta_proc_rev = value;
     }
@@ -8973,7 +10268,7 @@ print_80860002_eax(unsigned int value, code_stash_t* stash)
 static void
 print_c0000001_edx(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "alternate instruction set"                ,  0,  0, bools }, // sandpile.org
             { "alternate instruction set enabled"        ,  1,  1, bools }, // sandpile.org
             { "random number generator"                  ,  2,  2, bools },
@@ -8990,9 +10285,9 @@ print_c0000001_edx(unsigned int value)
             { "padlock montgomery mult. (PMM) enabled"   , 13, 13, bools }, // LX*
     };
 
-    printf("   extended feature flags (0xc0000001/edx):\n");
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    emit("   extended feature flags (0xc0000001/edx):\n");
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function C0000002h, register EBX
@@ -9000,11 +10295,11 @@ print_c0000001_edx(unsigned int value)
 static void
 print_c0000002_ebx(unsigned int value)
 {
-    printf("      input voltage (mV)                 = %d (0x%0x)\n",
+    emit("      input voltage (mV)                 = %d (0x%0x)\n",
         (BIT_EXTRACT_LE(value, 0, 8) << 4) + 700,
         BIT_EXTRACT_LE(value, 0, 8));
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "current clock multipler"                 ,  8, 15, NIL_IMAGES },
             { "clock ratio transition in progress"      , 16, 16, bools },
             { "voltage transition in progress"          , 17, 17, bools },
@@ -9014,7 +10309,7 @@ print_c0000002_ebx(unsigned int value)
             { "lowest clock ratio"                      , 24, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 34);
 }
 
@@ -9023,19 +10318,19 @@ print_c0000002_ebx(unsigned int value)
 static void
 print_c0000002_ecx(unsigned int value)
 {
-    printf("      highest voltage (mV)               = %d (0x%0x)\n",
+    emit("      highest voltage (mV)               = %d (0x%0x)\n",
         (BIT_EXTRACT_LE(value, 0, 8) << 4) + 700,
         BIT_EXTRACT_LE(value, 0, 8));
-    printf("      lowest voltage (mV)                = %d (0x%0x)\n",
+    emit("      lowest voltage (mV)                = %d (0x%0x)\n",
         (BIT_EXTRACT_LE(value, 16, 24) << 4) + 700,
         BIT_EXTRACT_LE(value, 16, 24));
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "highest clock multiplier"                ,  8, 15, NIL_IMAGES },
             { "lowest clock multiplier"                 , 24, 31, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 34);
 }
 
@@ -9051,7 +10346,7 @@ print_c0000002_edx(unsigned int value)
                                          "200 MHz (2)",
                                          "166 MHz (3)" };
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "MB reset vector"                         , 14, 14, mb_reset },
             { "APIC cluster ID"                         , 16, 17, NIL_IMAGES },
             { "input front side bus clock"              , 16, 17, bus_clock },
@@ -9059,7 +10354,7 @@ print_c0000002_edx(unsigned int value)
             { "current clock multiplier"                , 22, 26, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EDX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 34);
 }
 
@@ -9068,12 +10363,12 @@ print_c0000002_edx(unsigned int value)
 static void
 print_c0000004_eax(unsigned int value)
 {
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "thermal monitor temperature"             ,  0,  7, NIL_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
-        /* max_len => */ 0);
+    print_names(value, WORD_EAX, names, LENGTH(names), NAMES_LAYOUT(names),
+        /* max_len => */ NAMES_WIDTH(names));
 }
 
 // print results of CPUID function C0000004h, register EBX
@@ -9081,14 +10376,14 @@ print_c0000004_eax(unsigned int value)
 static void
 print_c0000004_ebx(unsigned int value)
 {
-    printf("      current voltage (mV)                     = %d (0x%0x)\n",
+    emit("      current voltage (mV)                     = %d (0x%0x)\n",
         (BIT_EXTRACT_LE(value, 0, 8) << 4) + 700,
         BIT_EXTRACT_LE(value, 0, 8));
 
     // This is a mirror of MSR 198h [31:0]
     // If it had been read via rdmsr, this would be eax.
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "current clock ratio"                     ,  8, 15, X2_IMAGES },
             { "clock ratio transition in progress"      , 16, 16, bools },
             { "voltage transition in progress"          , 17, 17, bools },
@@ -9101,7 +10396,7 @@ print_c0000004_ebx(unsigned int value)
 
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_EBX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -9113,14 +10408,14 @@ print_c0000004_ecx(unsigned int value)
     // This is a mirror of MSR 198h [63:32]
     // If it had been read via rdmsr, this would be edx.
 
-    static named_item  names[]
+    static constexpr named_item  names[]
         = { { "highest supported voltage"               ,  0,  7, NIL_IMAGES },
             { "highest supported clock ratio"           ,  8, 15, X2_IMAGES },
             { "lowest supported voltage"                , 16, 23, NIL_IMAGES },
             { "lowest supported clock ratio"            , 24, 31, X2_IMAGES },
     };
 
-    print_names(value, names, LENGTH(names),
+    print_names(value, WORD_ECX, names, LENGTH(names), NAMES_LAYOUT(names),
         /* max_len => */ 40);
 }
 
@@ -9138,17 +10433,30 @@ usage(void)
     printf("\n");
     printf("   -1,      --one-cpu    display information only for the current"
         " CPU\n");
+    printf("   -b,      --brief      display only feature flags which are set,"
+        " omitting false ones\n");
     printf("   -f FILE, --file=FILE  read raw hex information (-r output) from"
         " FILE instead\n");
     printf("                         of from executions of the cpuid"
         " instruction.\n");
     printf("                         If FILE is '-', read from stdin.\n");
-    printf("   -l V,    --leaf=V     display information for the single specified"
-        " leaf.\n");
-    printf("                         If -s/--subleaf is not specified, 0 is"
-        " assumed.\n");
-    printf("   -s V,    --subleaf=V  display information for the single specified"
-        " subleaf.\n");
+    printf("   -F L,    --format=L   display decoded information in the specified"
+        " formats,\n");
+    printf("                         L is a comma-separated list of text, json"
+        " and csv.\n");
+    printf("                         Information is decoded once for all"
+        " formats.\n");
+    printf("   -l V,    --leaf=V     display information for the specified"
+        " leaves.\n");
+    printf("                         V is a comma-separated list of"
+        " LEAF[-LEAF][/SUBLEAF],\n");
+    printf("                         SUBLEAF is a number, a range or '*' for all"
+        " subleaves,\n");
+    printf("                         e.g. 1,7/*,0x16,0x80000000-0x80000008.\n");
+    printf("                         If no subleaf is specified, -s/--subleaf"
+        " or 0 is assumed.\n");
+    printf("   -s V,    --subleaf=V  display information for the specified"
+        " subleaf, or '*'.\n");
     printf("                         It requires -l/--leaf.\n");
     printf("   -h, -H,  --help       display this help information\n");
     printf("   -i,      --inst       use the CPUID instruction: The information"
@@ -9164,9 +10472,83 @@ usage(void)
     printf("                         and kernel version.  Typically, it is"
         " necessary to be\n");
     printf("                         root.\n");
+    printf("                         CPUs are read in place, without migration."
+        "  The device\n");
+    printf("                         directory (default /dev/cpu) can be"
+        " overridden by the\n");
+    printf("                         CPUID_DEV_DIR environment variable; regular"
+        " files there\n");
+    printf("                         hold 16-byte records at offset"
+        " (leaf + (subleaf << 32)) * 16.\n");
 #endif
+#ifdef USE_SNAPSHOT_CACHE
+    printf("   -c,      --cache      use snapshot of all CPUs saved by previous"
+        " run in\n");
+    printf("                         /run/cpuid (or CPUID_CACHE_DIR), if boot ID,"
+        " microcode\n");
+    printf("                         and online CPUs are unchanged; otherwise"
+        " collect and\n");
+    printf("                         save it.  Not used with -1, -f or -l;"
+        " incompatible\n");
+    printf("                         with -T, -S and -p.\n");
+#endif
+    printf("   -p,      --sample     fully query one CPU per package and core"
+        " type only;\n");
+    printf("                         other CPUs are verified by a hash of leaves"
+        " 1, 7 and\n");
+    printf("                         0x80000001 and copy it, or are fully queried"
+        " on mismatch.\n");
     printf("   -r,      --raw        display raw hex information with no"
         " decoding\n");
+    printf("   -R FILE, --resolver=FILE\n");
+    printf("                         generate C source of GNU ifunc resolvers"
+        " from FILE:\n");
+    printf("                         'function PROTOTYPE' lines, each followed"
+        " by lines\n");
+    printf("                         'IMPL [needs FEATURE,...]' in order of"
+        " preference, last\n");
+    printf("                         without needs.  FEATURE is a feature of"
+        " cpuid_features.h\n");
+    printf("                         or os_xmm_state, os_ymm_state,"
+        " os_zmm_state, os_tile_state.\n");
+    printf("                         Lines starting with '#' are copied to"
+        " the output, e.g.\n");
+    printf("                         #include for types of prototypes;"
+        " <stddef.h> is included.\n");
+    printf("                         On Linux, AMX (tile) implementations need"
+        " AMX permission\n");
+    printf("                         when resolvers run; resolvers of a program"
+        " run before\n");
+    printf("                         main(), so they are never selected there,"
+        " only in a\n");
+    printf("                         library loaded by dlopen() after"
+        " requesting it with\n");
+    printf("                         arch_prctl(ARCH_REQ_XCOMP_PERM).\n");
+#ifdef USE_SYSFS_TOPOLOGY
+    printf("   -y,      --sysfs      display topology and caches of all CPUs"
+        " from sysfs,\n");
+    printf("                         without affinity changes, cross-checked"
+        " against CPUID\n");
+    printf("                         of the current CPU.\n");
+#endif
+    printf("   -u,      --unique     decode identical CPUs once, showing only"
+        " per-CPU\n");
+    printf("                         topology (APIC IDs) for the others.\n");
+    printf("   -t,      --types      decode once per hybrid core type (leaf"
+        " 0x1a), then\n");
+    printf("                         summarize caches and ISA differences per"
+        " type.\n");
+    printf("                         It cannot be combined with -u/--unique.\n");
+    printf("   -S,      --synth-only display only synthesized summary (synth,"
+        " uarch synth,\n");
+    printf("                         multiprocessor and APIC), querying only"
+        " leaves it needs.\n");
+    printf("   -T N,    --timing=N   execute each leaf/subleaf N times (default"
+        " %u) and show\n", TIMING_RUNS_DEFAULT);
+    printf("                         min/median/p99 latency in cycles and ns"
+        " before each\n");
+    printf("                         leaf; leaves over %u cycles are flagged as"
+        " trap.\n", TIMING_TRAP_CYCLES);
     printf("   -v,      --version    display cpuid version\n");
     printf("\n");
     exit(1);
@@ -9237,6 +10619,27 @@ explain_dev_cpu_errno(void)
     && (words)[WORD_ECX] == FOUR_CHARS_VALUE(&(s)[4]) \
     && (words)[WORD_EDX] == FOUR_CHARS_VALUE(&(s)[8]))
 
+// detect hypervisor (VMM) vendor by CPUID function 40000000h results
+// words = array of EAX, EBX, ECX, EDX values after CPUID function 40000000h
+// return hypervisor vendor numeric id by hypervisor_t enumeration
+static hypervisor_t
+decode_hypervisor(const unsigned int words[WORD_NUM])
+{
+    if (IS_HYPERVISOR_ID(words, "VMwareVMware")) {
+        return HYPERVISOR_VMWARE;
+    }
+    else if (IS_HYPERVISOR_ID(words, "XenVMMXenVMM")) {
+        return HYPERVISOR_XEN;
+    }
+    else if (IS_HYPERVISOR_ID(words, "KVMKVMKVM\0\0\0")) {
+        return HYPERVISOR_KVM;
+    }
+    else if (IS_HYPERVISOR_ID(words, "Microsoft Hv")) {
+        return HYPERVISOR_MICROSOFT;
+    }
+    return HYPERVISOR_UNKNOWN;
+}
+
 // print CPU registers as raw dump
 // reg   = CPUID function number
 // tryX  = CPUID sub-function number
@@ -9244,1622 +10647,5462 @@ explain_dev_cpu_errno(void)
 static void
 print_reg_raw(unsigned int reg, unsigned int tryX, const unsigned int words[WORD_NUM])
 {
-    printf("   0x%08x 0x%02x: eax=0x%08x ebx=0x%08x ecx=0x%08x edx=0x%08x\n",
+    emit("   0x%08x 0x%02x: eax=0x%08x ebx=0x%08x ecx=0x%08x edx=0x%08x\n",
         reg, tryX,
         words[WORD_EAX], words[WORD_EBX],
         words[WORD_ECX], words[WORD_EDX]);
 }
 
-// print CPU registers as decoded CPUID information
-// reg   = CPUID function number, select information interpreter
+// stash hook of one CPUID function, accumulate information used by other functions and do_final()
+// reg   = CPUID function number
 // words = pointer to array of registers EAX, EBX, ECX, EDX after execution of one function:subfunction
-// raw   = flag for print raw data, without decoding
 // tryX  = CPUID subfunction number
 // stash = collection of vendor-specific and device-specific information after CPUID functions execution
+typedef void (*leaf_stash_t)(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash);
+
+// decoder of one CPUID function, called after stash hook, same parameters as leaf_stash_t
+typedef void (*leaf_print_t)(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash);
+
+// rule for enumerate sub-functions of CPUID function, see collect_subleaves()
+typedef enum {
+    SUBLEAF_NONE,           // sub-function 0 only
+    SUBLEAF_COUNT,          // repeat sub-function 0, number of repeats in EAX[7:0] of first result
+    SUBLEAF_CACHE,          // sub-functions until cache type EAX[4:0] is 0
+    SUBLEAF_MAX_EAX,        // sub-functions from 0 to maximal sub-function in EAX of sub-function 0
+    SUBLEAF_TOPOLOGY,       // sub-functions until EAX and EBX are 0
+    SUBLEAF_TOPOLOGY_V2,    // sub-functions until level type ECX[15:8] is 0, up to 255
+    SUBLEAF_XSAVE,          // sub-functions 0, 1 and state components valid in XCR0 | IA32_XSS
+    SUBLEAF_RDT_MONITOR,    // sub-function 0, sub-function 1 if EDX bit 1 of sub-function 0
+    SUBLEAF_RDT_ALLOCATION, // sub-function 0 and resources in EBX bits 1-31 of sub-function 0
+    SUBLEAF_SGX,            // sub-functions 0, 1 and EPC sections in EAX bits of sub-function 0
+    SUBLEAF_NONZERO,        // sub-functions until all registers are 0
+    SUBLEAF_XEN_TIME,       // sub-functions 0 - 2
+} subleaf_rule_t;
+
+// return TRUE if rule enumerates sub-functions 0, 1, 2, ... without gaps
+// rule = rule for enumerate sub-functions
+static intbool
+subleaves_contiguous(subleaf_rule_t rule)
+{
+    switch (rule) {
+    case SUBLEAF_COUNT:
+    case SUBLEAF_CACHE:
+    case SUBLEAF_MAX_EAX:
+    case SUBLEAF_TOPOLOGY:
+    case SUBLEAF_TOPOLOGY_V2:
+    case SUBLEAF_NONZERO:
+    case SUBLEAF_XEN_TIME:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+#define ANY_HYPERVISOR  HYPERVISOR_UNKNOWN
+
+// description of CPUID function or range of functions
+typedef struct {
+    unsigned int    first;       // first CPUID function number
+    unsigned int    last;        // last CPUID function number, same as first for one function
+    hypervisor_t    hypervisor;  // function of this hypervisor only, ANY_HYPERVISOR for all
+    subleaf_rule_t  subleaves;   // rule for enumerate sub-functions
+    intbool         synth;       // function stashed and used by do_final(), queried in synth-only mode
+    leaf_stash_t    stash;       // stash hook, NULL if function not stashed
+    leaf_print_t    print;       // decoder, NULL if function not printed
+    cstring         headers[3];  // header of sub-functions 0 - 2, NULL if no header
+} leaf_info_t;
+
+// CPUID function 0x0, see leaf_stash_t
 static void
-print_reg(unsigned int reg, const unsigned int words[WORD_NUM], intbool raw, unsigned int tryX, code_stash_t* stash)
+stash_leaf_0(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
 {
-    if (reg == 0) {
-        if (IS_VENDOR_ID(words, "GenuineIntel")) {
-            stash->vendor = VENDOR_INTEL;
-        }
-        else if (IS_VENDOR_ID(words, "AuthenticAMD")) {
-            stash->vendor = VENDOR_AMD;
-        }
-        else if (IS_VENDOR_ID(words, "CyrixInstead")) {
-            stash->vendor = VENDOR_CYRIX;
-        }
-        else if (IS_VENDOR_ID(words, "CentaurHauls")) {
-            stash->vendor = VENDOR_VIA;
-        }
-        else if (IS_VENDOR_ID(words, "UMC UMC UMC ")) {
-            stash->vendor = VENDOR_UMC;
-        }
-        else if (IS_VENDOR_ID(words, "NexGenDriven")) {
-            stash->vendor = VENDOR_NEXGEN;
-        }
-        else if (IS_VENDOR_ID(words, "RiseRiseRise")) {
-            stash->vendor = VENDOR_RISE;
+    if (IS_VENDOR_ID(words, "GenuineIntel")) {
+        stash->vendor = VENDOR_INTEL;
+    }
+    else if (IS_VENDOR_ID(words, "AuthenticAMD")) {
+        stash->vendor = VENDOR_AMD;
+    }
+    else if (IS_VENDOR_ID(words, "CyrixInstead")) {
+        stash->vendor = VENDOR_CYRIX;
+    }
+    else if (IS_VENDOR_ID(words, "CentaurHauls")) {
+        stash->vendor = VENDOR_VIA;
+    }
+    else if (IS_VENDOR_ID(words, "UMC UMC UMC ")) {
+        stash->vendor = VENDOR_UMC;
+    }
+    else if (IS_VENDOR_ID(words, "NexGenDriven")) {
+        stash->vendor = VENDOR_NEXGEN;
+    }
+    else if (IS_VENDOR_ID(words, "RiseRiseRise")) {
+        stash->vendor = VENDOR_RISE;
+    }
+    else if (IS_VENDOR_ID(words, "GenuineTMx86")) {
+        stash->vendor = VENDOR_TRANSMETA;
+    }
+    else if (IS_VENDOR_ID(words, "SiS SiS SiS ")) {
+        stash->vendor = VENDOR_SIS;
+    }
+    else if (IS_VENDOR_ID(words, "Geode by NSC")) {
+        stash->vendor = VENDOR_NSC;
+    }
+    else if (IS_VENDOR_ID(words, "Vortex86 SoC")) {
+        stash->vendor = VENDOR_VORTEX;
+    }
+    else if (IS_VENDOR_ID(words, "Genuine  RDC")) {
+        stash->vendor = VENDOR_RDC;
+    }
+    else if (IS_VENDOR_ID(words, "HygonGenuine")) {
+        stash->vendor = VENDOR_HYGON;
+    }
+    else if (IS_VENDOR_ID(words, "  Shanghai  ")) {
+        stash->vendor = VENDOR_ZHAOXIN;
+    }
+    stash->val_0_eax = words[WORD_EAX];
+}
+
+// CPUID function 0x1, see leaf_stash_t
+static void
+stash_leaf_1(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    stash->val_1_eax = words[WORD_EAX];
+    stash->val_1_ebx = words[WORD_EBX];
+    stash->val_1_ecx = words[WORD_ECX];
+    stash->val_1_edx = words[WORD_EDX];
+}
+
+// CPUID function 0x2, see leaf_stash_t
+static void
+stash_leaf_2(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    unsigned int  word = 0;
+    for (; word < 4; word++) {
+        if ((words[word] & 0x80000000) == 0) {
+            const unsigned char* bytes = (const unsigned char*)&words[word];
+            unsigned int          byte = (tryX == 0 && word == WORD_EAX ? 1
+                : 0);
+            for (; byte < 4; byte++) {
+                stash_intel_cache(stash, bytes[byte]);
+            }
+        }
+    }
+}
+
+// CPUID function 0x4, see leaf_stash_t
+static void
+stash_leaf_4(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    stash->saw_4 = TRUE;
+    if (tryX == 0) {
+        stash->val_4_eax = words[WORD_EAX];
+    }
+}
+
+// CPUID function 0xb, see leaf_stash_t
+static void
+stash_leaf_b(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    stash->saw_b = TRUE;
+    if (tryX < LENGTH(stash->val_b_eax)) {
+        stash->val_b_eax[tryX] = words[WORD_EAX];
+    }
+    if (tryX < LENGTH(stash->val_b_ebx)) {
+        stash->val_b_ebx[tryX] = words[WORD_EBX];
+    }
+}
+
+// CPUID function 0x17, see leaf_stash_t
+static void
+stash_leaf_17(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    if (tryX >= 1 && tryX <= 3) {
+        memcpy(&stash->soc_brand[(tryX - 1) * 16], words, sizeof(unsigned int) * WORD_NUM);
+    }
+}
+
+// CPUID function 0x1f, see leaf_stash_t
+static void
+stash_leaf_1f(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    stash->saw_1f = TRUE;
+    if (tryX < LENGTH(stash->val_1f_eax)) {
+        stash->val_1f_eax[tryX] = words[WORD_EAX];
+    }
+    if (tryX < LENGTH(stash->val_1f_ebx)) {
+        stash->val_1f_ebx[tryX] = words[WORD_EBX];
+    }
+    if (tryX < LENGTH(stash->val_1f_ecx)) {
+        stash->val_1f_ecx[tryX] = words[WORD_ECX];
+    }
+}
+
+// CPUID function 0x40000000, see leaf_stash_t
+static void
+stash_leaf_40000000(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    stash->hypervisor = decode_hypervisor(words);
+}
+
+// CPUID function 0x80000001, see leaf_stash_t
+static void
+stash_leaf_80000001(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    stash->val_80000001_eax = words[WORD_EAX];
+    stash->val_80000001_ebx = words[WORD_EBX];
+    stash->val_80000001_ecx = words[WORD_ECX];
+    stash->val_80000001_edx = words[WORD_EDX];
+}
+
+// CPUID function 0x80000002, see leaf_stash_t
+static void
+stash_leaf_80000002(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    memcpy(&stash->brand[0], words, sizeof(unsigned int) * WORD_NUM);
+}
+
+// CPUID function 0x80000003, see leaf_stash_t
+static void
+stash_leaf_80000003(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    memcpy(&stash->brand[16], words, sizeof(unsigned int) * WORD_NUM);
+}
+
+// CPUID function 0x80000004, see leaf_stash_t
+static void
+stash_leaf_80000004(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    memcpy(&stash->brand[32], words, sizeof(unsigned int) * WORD_NUM);
+}
+
+// CPUID function 0x80000006, see leaf_stash_t
+static void
+stash_leaf_80000006(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    unsigned int  value = words[WORD_ECX];
+    if (((value >> 12) & 0xf) == 4 && (value >> 16) == 256) {
+        stash->L2_4w_256K = TRUE;
+    }
+    else if (((value >> 12) & 0xf) == 4 && (value >> 16) == 512) {
+        stash->L2_4w_512K = TRUE;
+    }
+}
+
+// CPUID function 0x80000008, see leaf_stash_t
+static void
+stash_leaf_80000008(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    stash->val_80000008_ecx = words[WORD_ECX];
+}
+
+// CPUID function 0x8000001e, see leaf_stash_t
+static void
+stash_leaf_8000001e(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    stash->val_8000001e_ebx = words[WORD_EBX];
+}
+
+// CPUID function 0x80860003, see leaf_stash_t
+static void
+stash_leaf_80860003(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    memcpy(&stash->transmeta_info[0], words, sizeof(unsigned int) * WORD_NUM);
+}
+
+// CPUID function 0x80860004, see leaf_stash_t
+static void
+stash_leaf_80860004(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    memcpy(&stash->transmeta_info[16], words, sizeof(unsigned int) * WORD_NUM);
+}
+
+// CPUID function 0x80860005, see leaf_stash_t
+static void
+stash_leaf_80860005(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    memcpy(&stash->transmeta_info[32], words, sizeof(unsigned int) * WORD_NUM);
+}
+
+// CPUID function 0x80860006, see leaf_stash_t
+static void
+stash_leaf_80860006(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    memcpy(&stash->transmeta_info[48], words, sizeof(unsigned int) * WORD_NUM);
+}
+
+// CPUID function 0x0, see leaf_print_t
+static void
+print_leaf_0(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    // max already set to words[WORD_EAX]
+    emit("   vendor_id = \"%-4.4s%-4.4s%-4.4s\"\n",
+        (const char*)&words[WORD_EBX],
+        (const char*)&words[WORD_EDX],
+        (const char*)&words[WORD_ECX]);
+}
+
+// CPUID function 0x1, see leaf_print_t
+static void
+print_leaf_1(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    print_1_eax(words[WORD_EAX], stash->vendor);
+    print_1_ebx(words[WORD_EBX]);
+    print_brand(words[WORD_EAX], words[WORD_EBX]);
+    print_1_edx(words[WORD_EDX]);
+    print_1_ecx(words[WORD_ECX]);
+}
+
+// CPUID function 0x2, see leaf_print_t
+static void
+print_leaf_2(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    unsigned int  word = 0;
+    for (; word < 4; word++) {
+        if ((words[word] & 0x80000000) == 0) {
+            const unsigned char* bytes = (const unsigned char*)&words[word];
+            unsigned int          byte = (tryX == 0 && word == WORD_EAX ? 1
+                : 0);
+            for (; byte < 4; byte++) {
+                print_2_byte(bytes[byte], stash->vendor, stash->val_1_eax);
+            }
+        }
+    }
+}
+
+// CPUID function 0x3, see leaf_print_t
+static void
+print_leaf_3(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    emit("   processor serial number ="
+        " %04X-%04X-%04X-%04X-%04X-%04X\n",
+        stash->val_1_eax >> 16, stash->val_1_eax & 0xffff,
+        words[WORD_EDX] >> 16, words[WORD_EDX] & 0xffff,
+        words[WORD_ECX] >> 16, words[WORD_ECX] & 0xffff);
+}
+
+// CPUID function 0x4, see leaf_print_t
+static void
+print_leaf_4(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    emit("      --- cache %d ---\n", tryX);
+    print_4_eax(words[WORD_EAX]);
+    print_4_ebx(words[WORD_EBX]);
+    print_4_ecx(words[WORD_ECX]);
+    print_4_edx(words[WORD_EDX]);
+    emit("      number of sets (s)                   = %llu\n",
+        (unsigned long long)words[WORD_ECX] + 1ULL);
+    print_4_synth(words);
+}
+
+// CPUID function 0x5, see leaf_print_t
+static void
+print_leaf_5(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   MONITOR/MWAIT (5):\n");
+    print_5_eax(words[WORD_EAX]);
+    print_5_ebx(words[WORD_EBX]);
+    print_5_ecx(words[WORD_ECX]);
+    print_5_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x6, see leaf_print_t
+static void
+print_leaf_6(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Thermal and Power Management Features (6):\n");
+    print_6_eax(words[WORD_EAX]);
+    print_6_ebx(words[WORD_EBX]);
+    print_6_ecx(words[WORD_ECX]);
+    print_6_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x7, see leaf_print_t
+static void
+print_leaf_7(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        print_7_0_ebx(words[WORD_EBX]);
+        print_7_0_ecx(words[WORD_ECX]);
+        print_7_0_edx(words[WORD_EDX]);
+    }
+    else if (tryX == 1) {
+        print_7_1_eax(words[WORD_EAX]);
+    }
+    else {
+        /* Reserved: DO NOTHING */
+    }
+}
+
+// CPUID function 0x8, see leaf_print_t
+static void
+print_leaf_8(unsigned int reg UNUSED, const unsigned int words[WORD_NUM] UNUSED, unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    /* Reserved: DO NOTHING */
+}
+
+// CPUID function 0x9, see leaf_print_t
+static void
+print_leaf_9(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Direct Cache Access Parameters (9):\n");
+    emit("      PLATFORM_DCA_CAP MSR bits = %u\n", words[WORD_EAX]);
+}
+
+// CPUID function 0xa, see leaf_print_t
+static void
+print_leaf_a(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Architecture Performance Monitoring Features (0xa):\n");
+    print_a_eax(words[WORD_EAX]);
+    print_a_ebx(words[WORD_EBX]);
+    print_a_ecx(words[WORD_ECX]);
+    print_a_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0xb, see leaf_print_t
+static void
+print_leaf_b(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        // This is invariant across subleaves, so print it only once
+        emit("      extended APIC ID                      = %u\n",
+            words[WORD_EDX]);
+    }
+    emit("      --- level %d ---\n", tryX);
+    print_b_1f_ecx(words[WORD_ECX]);
+    print_b_1f_eax(words[WORD_EAX]);
+    print_b_1f_ebx(words[WORD_EBX]);
+}
+
+// CPUID function 0xc, see leaf_print_t
+static void
+print_leaf_c(unsigned int reg UNUSED, const unsigned int words[WORD_NUM] UNUSED, unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    /* Reserved: DO NOTHING */
+}
+
+// CPUID function 0xd, see leaf_print_t
+static void
+print_leaf_d(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        emit("   XSAVE features (0xd/0):\n");
+        emit("      XCR0 lower 32 bits valid bit field mask = 0x%08x\n",
+            words[WORD_EAX]);
+        emit("      XCR0 upper 32 bits valid bit field mask = 0x%08x\n",
+            words[WORD_EDX]);
+        print_d_0_eax(words[WORD_EAX]);
+        // No bits current are defined in d_0_edx
+        emit("      bytes required by fields in XCR0        = 0x%08x (%u)\n",
+            words[WORD_EBX], words[WORD_EBX]);
+        emit("      bytes required by XSAVE/XRSTOR area     = 0x%08x (%u)\n",
+            words[WORD_ECX], words[WORD_ECX]);
+    }
+    else if (tryX == 1) {
+        emit("   XSAVE features (0xd/1):\n");
+        print_d_1_eax(words[WORD_EAX]);
+        emit("      SAVE area size in bytes                    "
+            " = 0x%08x (%u)\n",
+            words[WORD_EBX], words[WORD_EBX]);
+        emit("      IA32_XSS lower 32 bits valid bit field mask"
+            " = 0x%08x\n",
+            words[WORD_ECX]);
+        emit("      IA32_XSS upper 32 bits valid bit field mask"
+            " = 0x%08x\n",
+            words[WORD_EDX]);
+    }
+    else if (tryX >= 2 && tryX < 63) {
+        print_d_n(words, tryX);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0xe, see leaf_print_t
+static void
+print_leaf_e(unsigned int reg UNUSED, const unsigned int words[WORD_NUM] UNUSED, unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    /* Reserved: DO NOTHING */
+}
+
+// CPUID function 0xf, see leaf_print_t
+static void
+print_leaf_f(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        emit("   Quality of Service Monitoring Resource Type (0xf/0):\n");
+        emit("      Maximum range of RMID = %u\n", words[WORD_EBX]);
+        print_f_0_edx(words[WORD_EDX]);
+    }
+    else if (tryX == 1) {
+        emit("   L3 Cache Quality of Service Monitoring (0xf/1):\n");
+        emit("      Conversion factor from IA32_QM_CTR to bytes = %u\n",
+            words[WORD_EBX]);
+        emit("      Maximum range of RMID                       = %u\n",
+            words[WORD_ECX]);
+        emit("      Counter width                               = %u\n",
+            24 + BIT_EXTRACT_LE(words[WORD_EAX], 0, 8));
+        print_f_1_eax(words[WORD_EAX]);
+        print_f_1_edx(words[WORD_EDX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x10, see leaf_print_t
+static void
+print_leaf_10(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        emit("   Resource Director Technology Allocation (0x10/0):\n");
+        print_10_0_ebx(words[WORD_EBX]);
+    }
+    else if (tryX == 1 || tryX == 2) {
+        if (tryX == 1) {
+            emit("   L3 Cache Allocation Technology (0x10/1):\n");
+        }
+        else if (tryX == 2) {
+            emit("   L2 Cache Allocation Technology (0x10/2):\n");
+        }
+        print_10_n_eax(words[WORD_EAX]);
+        emit("      Bit-granular map of isolation/contention = 0x%08x\n",
+            words[WORD_EBX]);
+        print_10_n_ecx(words[WORD_ECX]);
+        print_10_n_edx(words[WORD_EDX]);
+    }
+    else if (tryX == 3) {
+        emit("   Memory Bandwidth Allocation (0x10/3):\n");
+        print_10_3_eax(words[WORD_EAX]);
+        print_10_3_ecx(words[WORD_ECX]);
+        print_10_n_edx(words[WORD_EDX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x12, see leaf_print_t
+static void
+print_leaf_12(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        emit("   Software Guard Extensions (SGX) capability (0x12/0):\n");
+        print_12_0_eax(words[WORD_EAX]);
+        print_12_0_ebx(words[WORD_EBX]);
+        print_12_0_edx(words[WORD_EDX]);
+    }
+    else if (tryX == 1) {
+        emit("   SGX attributes (0x12/1):\n");
+        emit("      ECREATE SECS.ATTRIBUTES valid bit mask ="
+            " 0x%08x%08x%08x%08x\n",
+            words[WORD_EDX],
+            words[WORD_ECX],
+            words[WORD_EBX],
+            words[WORD_EAX]);
+    }
+    else {
+        if ((words[WORD_EAX] & 0xf) == 1) {
+            emit("   SGX EPC enumeration (0x12/n):\n");
+            emit("      section physical address = 0x%08x%08x\n",
+                words[WORD_EBX], words[WORD_EAX] & 0xfffff000);
+            emit("      section size             = 0x%08x%08x\n",
+                words[WORD_EDX], words[WORD_ECX] & 0xfffff000);
+            print_12_n_ecx(words[WORD_ECX]);
+        }
+        else {
+            print_reg_raw(reg, tryX, words);
+        }
+    }
+}
+
+// CPUID function 0x14, see leaf_print_t
+static void
+print_leaf_14(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        emit("   Intel Processor Trace (0x14):\n");
+        print_14_0_ebx(words[WORD_EBX]);
+        print_14_0_ecx(words[WORD_ECX]);
+    }
+    else if (tryX == 1) {
+        print_14_1_eax(words[WORD_EAX]);
+        print_14_1_ebx(words[WORD_EBX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x15, see leaf_print_t
+static void
+print_leaf_15(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Time Stamp Counter/Core Crystal Clock Information (0x15):\n");
+    emit("      TSC/clock ratio = %u/%u\n",
+        words[WORD_EBX], words[WORD_EAX]);
+    emit("      nominal core crystal clock = %u Hz\n", words[WORD_ECX]);
+}
+
+// CPUID function 0x16, see leaf_print_t
+static void
+print_leaf_16(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Processor Frequency Information (0x16):\n");
+    print_16_eax(words[WORD_EAX]);
+    print_16_ebx(words[WORD_EBX]);
+    print_16_ecx(words[WORD_ECX]);
+}
+
+// CPUID function 0x17, see leaf_print_t
+static void
+print_leaf_17(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    if (tryX == 0) {
+        emit("   System-On-Chip Vendor Attribute (0x17/0):\n");
+        print_17_0_ebx(words[WORD_EBX]);
+        emit("      project id  = 0x%08x (%u)\n",
+            words[WORD_ECX], words[WORD_ECX]);
+        emit("      stepping id = 0x%08x (%u)\n",
+            words[WORD_EDX], words[WORD_EDX]);
+    }
+    else if (tryX == 1 || tryX == 2) {
+        // stashed, printed with subfunction 3
+    }
+    else if (tryX == 3) {
+        emit("      SoC brand   = \"%s\"\n", stash->soc_brand);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x18, see leaf_print_t
+static void
+print_leaf_18(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    emit("   Deterministic Address Translation Parameters (0x18/%d):\n",
+        tryX);
+    print_18_n_ebx(words[WORD_EBX]);
+    emit("      number of sets = 0x%08x (%u)\n",
+        words[WORD_ECX], words[WORD_ECX]);
+    print_18_n_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x19, see leaf_print_t
+static void
+print_leaf_19(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Key Locker information (0x19):\n");
+    print_19_eax(words[WORD_EAX]);
+    print_19_ebx(words[WORD_EBX]);
+    print_19_ecx(words[WORD_ECX]);
+}
+
+// CPUID function 0x1a, see leaf_print_t
+static void
+print_leaf_1a(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Hybrid Information (0x1a/0):\n");
+    print_1a_0_eax(words[WORD_EAX]);
+}
+
+// CPUID function 0x1b, see leaf_print_t
+static void
+print_leaf_1b(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    emit("   PCONFIG information (0x1b/n):\n");
+    print_1b_n_eax(words[WORD_EAX]);
+    emit("      identifier of target %d = 0x%08x (%u)\n",
+        3 * tryX + 1, words[WORD_EBX], words[WORD_EBX]);
+    emit("      identifier of target %d = 0x%08x (%u)\n",
+        3 * tryX + 2, words[WORD_ECX], words[WORD_ECX]);
+    emit("      identifier of target %d = 0x%08x (%u)\n",
+        3 * tryX + 3, words[WORD_EDX], words[WORD_EDX]);
+}
+
+// CPUID function 0x1c, see leaf_print_t
+static void
+print_leaf_1c(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Architectural LBR Capabilities (0x1c/0):\n");
+    print_1c_eax(words[WORD_EAX]);
+    print_1c_ebx(words[WORD_EBX]);
+    print_1c_ecx(words[WORD_ECX]);
+}
+
+// CPUID function 0x1d, see leaf_print_t
+static void
+print_leaf_1d(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        emit("      max_palette = %u\n", words[WORD_EAX]);
+    }
+    else {
+        emit("      --- palette %d ---\n", tryX);
+        print_1d_n_eax(words[WORD_EAX]);
+        print_1d_n_ebx(words[WORD_EBX]);
+        print_1d_n_ecx(words[WORD_ECX]);
+    }
+}
+
+// CPUID function 0x1e, see leaf_print_t
+static void
+print_leaf_1e(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   TMUL Information (0x1e/0):\n");
+    print_1e_ebx(words[WORD_EBX]);
+}
+
+// CPUID function 0x1f, see leaf_print_t
+static void
+print_leaf_1f(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        // This is invariant across subleaves, so print it only once
+        emit("      x2APIC ID of logical processor = 0x%x (%u)\n",
+            words[WORD_EDX], words[WORD_EDX]);
+    }
+    emit("      --- level %d ---\n", tryX);
+    print_b_1f_ecx(words[WORD_ECX]);
+    print_b_1f_eax(words[WORD_EAX]);
+    print_b_1f_ebx(words[WORD_EBX]);
+}
+
+// CPUID function 0x20, see leaf_print_t
+static void
+print_leaf_20(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        print_20_ebx(words[WORD_EBX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x20000001, see leaf_print_t
+static void
+print_leaf_20000001(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_20000001_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x40000000, see leaf_print_t
+static void
+print_leaf_40000000(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    // max already set to words[WORD_EAX]
+    emit("   hypervisor_id = \"%-4.4s%-4.4s%-4.4s\"\n",
+        (const char*)&words[WORD_EBX],
+        (const char*)&words[WORD_ECX],
+        (const char*)&words[WORD_EDX]);
+}
+
+// CPUID function 0x40000001 of Xen hypervisor, see leaf_print_t
+static void
+print_leaf_40000001_xen(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor version (0x40000001/eax):\n");
+    emit("      version = %d.%d\n",
+        BIT_EXTRACT_LE(words[WORD_EAX], 16, 32),
+        BIT_EXTRACT_LE(words[WORD_EAX], 0, 16));
+}
+
+// CPUID function 0x40000001 of KVM hypervisor, see leaf_print_t
+static void
+print_leaf_40000001_kvm(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_40000001_eax_kvm(words[WORD_EAX]);
+    print_40000001_edx_kvm(words[WORD_EDX]);
+}
+
+// CPUID function 0x40000001 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000001_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor interface identification (0x40000001/eax):\n");
+    emit("      version = \"%-4.4s\"\n",
+        (const char*)&words[WORD_EAX]);
+}
+
+// CPUID function 0x40000002 of Xen hypervisor, see leaf_print_t
+static void
+print_leaf_40000002_xen(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor features (0x40000002):\n");
+    emit("      number of hypercall-transfer pages = 0x%0x (%u)\n",
+        words[WORD_EAX], words[WORD_EAX]);
+    emit("      MSR base address                   = 0x%0x\n",
+        words[WORD_EBX]);
+    print_40000002_ecx_xen(words[WORD_ECX]);
+}
+
+// CPUID function 0x40000002 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000002_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor system identity (0x40000002):\n");
+    emit("      build          = %d\n", words[WORD_EAX]);
+    emit("      version        = %d.%d\n",
+        BIT_EXTRACT_LE(words[WORD_EBX], 16, 32),
+        BIT_EXTRACT_LE(words[WORD_EBX], 0, 16));
+    emit("      service pack   = %d\n", words[WORD_ECX]);
+    emit("      service branch = %d\n",
+        BIT_EXTRACT_LE(words[WORD_EDX], 24, 32));
+    emit("      service number = %d\n",
+        BIT_EXTRACT_LE(words[WORD_EDX], 0, 24));
+}
+
+// CPUID function 0x40000003 of Xen hypervisor, see leaf_print_t
+static void
+print_leaf_40000003_xen(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        print_40000003_eax_xen(words[WORD_EAX]);
+        emit("      tsc mode            = 0x%0x (%u)\n",
+            words[WORD_EBX], words[WORD_EBX]);
+        emit("      tsc frequency (kHz) = %u\n",
+            words[WORD_ECX]);
+        emit("      incarnation         = 0x%0x (%u)\n",
+            words[WORD_EDX], words[WORD_EDX]);
+    }
+    else if (tryX == 1) {
+        unsigned long long  vtsc_offset
+            = ((unsigned long long)words[WORD_EAX]
+                + ((unsigned long long)words[WORD_EBX] << 32));
+        emit("      vtsc offset   = 0x%0llx (%llu)\n", vtsc_offset, vtsc_offset);
+        emit("      vtsc mul_frac = 0x%0x (%u)\n",
+            words[WORD_ECX], words[WORD_ECX]);
+        emit("      vtsc shift    = 0x%0x (%u)\n",
+            words[WORD_EDX], words[WORD_EDX]);
+    }
+    else if (tryX == 2) {
+        emit("      cpu frequency (kHZ) = %u\n", words[WORD_EAX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x40000003 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000003_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_40000003_eax_microsoft(words[WORD_EAX]);
+    print_40000003_ebx_microsoft(words[WORD_EBX]);
+    print_40000003_ecx_microsoft(words[WORD_ECX]);
+    print_40000003_edx_microsoft(words[WORD_EDX]);
+}
+
+// CPUID function 0x40000004 of Xen hypervisor, see leaf_print_t
+static void
+print_leaf_40000004_xen(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_40000004_eax_xen(words[WORD_EAX]);
+    emit("      vcpu id                                = 0x%x (%u)\n",
+        words[WORD_EBX], words[WORD_EBX]);
+    emit("      domain id                              = 0x%x (%u)\n",
+        words[WORD_ECX], words[WORD_ECX]);
+}
+
+// CPUID function 0x40000004 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000004_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_40000004_eax_microsoft(words[WORD_EAX]);
+    emit("      maximum number of spinlock retry attempts = 0x%0x (%u)\n",
+        words[WORD_EBX], words[WORD_EBX]);
+}
+
+// CPUID function 0x40000005 of Xen hypervisor, see leaf_print_t
+static void
+print_leaf_40000005_xen(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        print_40000005_0_ebx_xen(words[WORD_EBX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x40000005 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000005_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor implementation limits (0x40000005):\n");
+    emit("      maximum number of virtual processors                      "
+        " = 0x%0x (%u)\n",
+        words[WORD_EAX], words[WORD_EAX]);
+    emit("      maximum number of logical processors                      "
+        " = 0x%0x (%u)\n",
+        words[WORD_EBX], words[WORD_EBX]);
+    emit("      maximum number of physical interrupt vectors for remapping"
+        " = 0x%0x (%u)\n",
+        words[WORD_ECX], words[WORD_ECX]);
+}
+
+// CPUID function 0x40000006 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000006_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_40000006_eax_microsoft(words[WORD_EAX]);
+}
+
+// CPUID function 0x40000007 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000007_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor root partition enlightenments (0x40000007):\n");
+    print_40000007_eax_microsoft(words[WORD_EAX]);
+    print_40000007_ebx_microsoft(words[WORD_EBX]);
+}
+
+// CPUID function 0x40000008 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000008_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor shared virtual memory (0x40000008):\n");
+    print_40000008_eax_microsoft(words[WORD_EAX]);
+}
+
+// CPUID function 0x40000009 of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_40000009_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor nested hypervisor features (0x40000009):\n");
+    print_40000009_eax_microsoft(words[WORD_EAX]);
+    print_40000009_edx_microsoft(words[WORD_EDX]);
+}
+
+// CPUID function 0x4000000a of Microsoft hypervisor, see leaf_print_t
+static void
+print_leaf_4000000a_microsoft(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor nested virtualization features (0x4000000a):\n");
+    print_4000000a_eax_microsoft(words[WORD_EAX]);
+}
+
+// CPUID function 0x40000010, see leaf_print_t
+static void
+print_leaf_40000010(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   hypervisor generic timing information (0x40000010):\n");
+    emit("      TSC frequency (Hz) = %d\n", words[WORD_EAX]);
+    emit("      bus frequency (Hz) = %d\n", words[WORD_EBX]);
+}
+
+// CPUID function 0x80000001, see leaf_print_t
+static void
+print_leaf_80000001(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    print_80000001_eax(words[WORD_EAX], stash->vendor);
+    print_80000001_edx(words[WORD_EDX], stash->vendor);
+    print_80000001_ebx(words[WORD_EBX], stash->vendor, stash->val_1_eax);
+    print_80000001_ecx(words[WORD_ECX], stash->vendor);
+}
+
+// CPUID function 0x80000004, see leaf_print_t
+static void
+print_leaf_80000004(unsigned int reg UNUSED, const unsigned int words[WORD_NUM] UNUSED, unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    emit("   brand = \"%s\"\n", stash->brand);
+}
+
+// CPUID function 0x80000005, see leaf_print_t
+static void
+print_leaf_80000005(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_80000005_eax(words[WORD_EAX]);
+    print_80000005_ebx(words[WORD_EBX]);
+    print_80000005_ecx(words[WORD_ECX]);
+    print_80000005_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x80000006, see leaf_print_t
+static void
+print_leaf_80000006(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_80000006_eax(words[WORD_EAX]);
+    print_80000006_ebx(words[WORD_EBX]);
+    print_80000006_ecx(words[WORD_ECX]);
+    print_80000006_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x80000007, see leaf_print_t
+static void
+print_leaf_80000007(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_80000007_ebx(words[WORD_EBX]);
+    print_80000007_ecx(words[WORD_ECX]);
+    print_80000007_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x80000008, see leaf_print_t
+static void
+print_leaf_80000008(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    print_80000008_eax(words[WORD_EAX]);
+    print_80000008_ebx(words[WORD_EBX]);
+    emit("   Size Identifiers (0x80000008/ecx):\n");
+    unsigned int  num_thrs = BIT_EXTRACT_LE(stash->val_80000008_ecx, 0, 8);
+    if (Synth_Family(stash->val_80000001_eax) > 0x16) {
+        emit("      number of threads                   = 0x%llx (%llu)\n",
+            (unsigned long long)num_thrs + 1ULL,
+            (unsigned long long)num_thrs + 1ULL);
+    }
+    else {
+        emit("      number of CPU cores                 = 0x%llx (%llu)\n",
+            (unsigned long long)num_thrs + 1ULL,
+            (unsigned long long)num_thrs + 1ULL);
+    }
+    print_80000008_ecx(words[WORD_ECX]);
+    print_80000008_edx(words[WORD_EDX]);
+}
+
+// CPUID function 0x80000009, see leaf_print_t
+static void
+print_leaf_80000009(unsigned int reg UNUSED, const unsigned int words[WORD_NUM] UNUSED, unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    /* reserved for Intel feature flag expansion */
+}
+
+// CPUID function 0x8000000a, see leaf_print_t
+static void
+print_leaf_8000000a(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_8000000a_eax(words[WORD_EAX]);
+    print_8000000a_edx(words[WORD_EDX]);
+    print_8000000a_ebx(words[WORD_EBX]);
+}
+
+// CPUID functions 0x8000000b - 0x80000018, see leaf_print_t
+static void
+print_leaf_8000000b_80000018(unsigned int reg UNUSED, const unsigned int words[WORD_NUM] UNUSED, unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    /* reserved for vendors to be determined feature flag expansion */
+}
+
+// CPUID function 0x80000019, see leaf_print_t
+static void
+print_leaf_80000019(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_80000019_eax(words[WORD_EAX]);
+    print_80000019_ebx(words[WORD_EBX]);
+}
+
+// CPUID function 0x8000001a, see leaf_print_t
+static void
+print_leaf_8000001a(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_8000001a_eax(words[WORD_EAX]);
+}
+
+// CPUID function 0x8000001b, see leaf_print_t
+static void
+print_leaf_8000001b(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_8000001b_eax(words[WORD_EAX]);
+}
+
+// CPUID function 0x8000001c, see leaf_print_t
+static void
+print_leaf_8000001c(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_8000001c_eax(words[WORD_EAX]);
+    print_8000001c_edx(words[WORD_EDX]);
+    print_8000001c_ebx(words[WORD_EBX]);
+    print_8000001c_ecx(words[WORD_ECX]);
+}
+
+// CPUID function 0x8000001d, see leaf_print_t
+static void
+print_leaf_8000001d(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    emit("      --- cache %d ---\n", tryX);
+    print_8000001d_eax(words[WORD_EAX]);
+    print_8000001d_ebx(words[WORD_EBX]);
+    emit("      number of sets                  = %llu\n",
+        (unsigned long long)words[WORD_ECX] + 1ULL);
+    print_8000001d_edx(words[WORD_EDX]);
+    print_8000001d_synth(words);
+}
+
+// CPUID function 0x8000001e, see leaf_print_t
+static void
+print_leaf_8000001e(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    emit("   extended APIC ID = %u\n", words[WORD_EAX]);
+    if (Synth_Family(stash->val_80000001_eax) > 0x16) {
+        print_8000001e_ebx_gt_f16(words[WORD_EBX]);
+    }
+    else {
+        print_8000001e_ebx_f16(words[WORD_EBX]);
+    }
+    print_8000001e_ecx(words[WORD_ECX]);
+}
+
+// CPUID function 0x8000001f, see leaf_print_t
+static void
+print_leaf_8000001f(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   AMD Secure Encryption (0x8000001f):\n");
+    print_8000001f_eax(words[WORD_EAX]);
+    print_8000001f_ebx(words[WORD_EBX]);
+    emit("      number of SEV-enabled guests supported   = 0x%0x (%u)\n",
+        words[WORD_ECX], words[WORD_ECX]);
+    emit("      minimum SEV guest ASID                   = 0x%0x (%u)\n",
+        words[WORD_EDX], words[WORD_EDX]);
+}
+
+// CPUID function 0x80000020, see leaf_print_t
+static void
+print_leaf_80000020(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash UNUSED)
+{
+    if (tryX == 0) {
+        emit("   PQoS Enforcement for Memory Bandwidth (0x80000020):\n");
+        print_80000020_0_ebx(words[WORD_EBX]);
+    }
+    else if (tryX == 1) {
+        emit("      capacity bitmask length              = 0x%0llx (%llu)\n",
+            (unsigned long long)words[WORD_EAX] + 1,
+            (unsigned long long)words[WORD_EAX] + 1);
+        emit("      number of classes of service         = 0x%0x (%u)\n",
+            words[WORD_EDX], words[WORD_EDX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0x80860001, see leaf_print_t
+static void
+print_leaf_80860001(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    print_80860001_eax(words[WORD_EAX]);
+    print_80860001_edx(words[WORD_EDX]);
+    print_80860001_ebx_ecx(words[WORD_EBX], words[WORD_ECX]);
+}
+
+// CPUID function 0x80860002, see leaf_print_t
+static void
+print_leaf_80860002(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    print_80860002_eax(words[WORD_EAX], stash);
+    emit("   Transmeta CMS revision (0x80000002/ecx)"
+        " = %u.%u-%u.%u-%u\n",
+        (words[WORD_EBX] >> 24) & 0xff,
+        (words[WORD_EBX] >> 16) & 0xff,
+        (words[WORD_EBX] >> 8) & 0xff,
+        (words[WORD_EBX] >> 0) & 0xff,
+        words[WORD_ECX]);
+}
+
+// CPUID function 0x80860006, see leaf_print_t
+static void
+print_leaf_80860006(unsigned int reg UNUSED, const unsigned int words[WORD_NUM] UNUSED, unsigned int tryX UNUSED, code_stash_t* stash)
+{
+    emit("   Transmeta information = \"%s\"\n", stash->transmeta_info);
+}
+
+// CPUID function 0x80860007, see leaf_print_t
+static void
+print_leaf_80860007(unsigned int reg UNUSED, const unsigned int words[WORD_NUM], unsigned int tryX UNUSED, code_stash_t* stash UNUSED)
+{
+    emit("   Transmeta core clock frequency = %u MHz\n",
+        words[WORD_EAX]);
+    emit("   Transmeta processor voltage    = %u mV\n",
+        words[WORD_EBX]);
+    emit("   Transmeta performance          = %u%%\n",
+        words[WORD_ECX]);
+    emit("   Transmeta gate delay           = %u fs\n",
+        words[WORD_EDX]);
+}
+
+// CPUID function 0xc0000001, see leaf_print_t
+static void
+print_leaf_c0000001(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    if (stash->vendor == VENDOR_VIA) {
+        /* TODO: figure out how to decode 0xc0000001:eax */
+        emit("   0x%08x 0x%02x: eax=0x%08x\n",
+            (unsigned int)reg, tryX, words[WORD_EAX]);
+        print_c0000001_edx(words[WORD_EDX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0xc0000002, see leaf_print_t
+static void
+print_leaf_c0000002(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    if (stash->vendor == VENDOR_VIA) {
+        emit("   VIA C7 Current Performance Data (0xc0000002):\n");
+        if (BIT_EXTRACT_LE(words[WORD_EAX], 0, 8) != 0) {
+            emit("      core temperature (degrees C)       = %f\n",
+                (double)words[WORD_EAX] / 256.0);
+        }
+        else {
+            emit("      core temperature (degrees C)       = %d\n",
+                BIT_EXTRACT_LE(words[WORD_EAX], 8, 32));
+        }
+        print_c0000002_ebx(words[WORD_EBX]);
+        print_c0000002_ecx(words[WORD_ECX]);
+        print_c0000002_edx(words[WORD_EDX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// CPUID function 0xc0000004, see leaf_print_t
+static void
+print_leaf_c0000004(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    if (stash->vendor == VENDOR_VIA) {
+        emit("   VIA Temperature (0xc0000004/eax):\n");
+        print_c0000004_eax(words[WORD_EAX]);
+        emit("   VIA MSR 198 Mirror (0xc0000004):\n");
+        print_c0000004_ebx(words[WORD_EBX]);
+        print_c0000004_ecx(words[WORD_ECX]);
+    }
+    else {
+        print_reg_raw(reg, tryX, words);
+    }
+}
+
+// all known CPUID functions, function with hypervisor-specific meaning has entry for each hypervisor
+// function not listed here printed as raw registers
+static constexpr leaf_info_t  leaf_registry[] = {
+//    first       last        hypervisor           subleaves                synth  stash                 print
+    { 0x00000000, 0x00000000, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_0,         print_leaf_0, { NULL } },
+    { 0x00000001, 0x00000001, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_1,         print_leaf_1, { NULL } },
+    { 0x00000002, 0x00000002, ANY_HYPERVISOR,       SUBLEAF_COUNT,           TRUE,  stash_leaf_2,         print_leaf_2,
+      { "   cache and TLB information (2):" } },
+    { 0x00000003, 0x00000003, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_3, { NULL } },
+    { 0x00000004, 0x00000004, ANY_HYPERVISOR,       SUBLEAF_CACHE,           TRUE,  stash_leaf_4,         print_leaf_4,
+      { "   deterministic cache parameters (4):" } },
+    { 0x00000005, 0x00000005, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_5, { NULL } },
+    { 0x00000006, 0x00000006, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_6, { NULL } },
+    { 0x00000007, 0x00000007, ANY_HYPERVISOR,       SUBLEAF_MAX_EAX,         FALSE, NULL,                 print_leaf_7,
+      { "   extended feature flags (7):" } },
+    { 0x00000008, 0x00000008, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_8, { NULL } },
+    { 0x00000009, 0x00000009, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_9, { NULL } },
+    { 0x0000000a, 0x0000000a, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_a, { NULL } },
+    { 0x0000000b, 0x0000000b, ANY_HYPERVISOR,       SUBLEAF_TOPOLOGY,        TRUE,  stash_leaf_b,         print_leaf_b,
+      { "   x2APIC features / processor topology (0xb):" } },
+    { 0x0000000c, 0x0000000c, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_c, { NULL } },
+    { 0x0000000d, 0x0000000d, ANY_HYPERVISOR,       SUBLEAF_XSAVE,           FALSE, NULL,                 print_leaf_d, { NULL } },
+    { 0x0000000e, 0x0000000e, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_e, { NULL } },
+    { 0x0000000f, 0x0000000f, ANY_HYPERVISOR,       SUBLEAF_RDT_MONITOR,     FALSE, NULL,                 print_leaf_f, { NULL } },
+    { 0x00000010, 0x00000010, ANY_HYPERVISOR,       SUBLEAF_RDT_ALLOCATION,  FALSE, NULL,                 print_leaf_10, { NULL } },
+    { 0x00000012, 0x00000012, ANY_HYPERVISOR,       SUBLEAF_SGX,             FALSE, NULL,                 print_leaf_12, { NULL } },
+    { 0x00000014, 0x00000014, ANY_HYPERVISOR,       SUBLEAF_MAX_EAX,         FALSE, NULL,                 print_leaf_14, { NULL } },
+    { 0x00000015, 0x00000015, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_15, { NULL } },
+    { 0x00000016, 0x00000016, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_16, { NULL } },
+    { 0x00000017, 0x00000017, ANY_HYPERVISOR,       SUBLEAF_MAX_EAX,         FALSE, stash_leaf_17,        print_leaf_17, { NULL } },
+    { 0x00000018, 0x00000018, ANY_HYPERVISOR,       SUBLEAF_MAX_EAX,         FALSE, NULL,                 print_leaf_18, { NULL } },
+    { 0x00000019, 0x00000019, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_19, { NULL } },
+    { 0x0000001a, 0x0000001a, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_1a, { NULL } },
+    { 0x0000001b, 0x0000001b, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_1b, { NULL } },
+    { 0x0000001c, 0x0000001c, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_1c, { NULL } },
+    { 0x0000001d, 0x0000001d, ANY_HYPERVISOR,       SUBLEAF_MAX_EAX,         FALSE, NULL,                 print_leaf_1d,
+      { "   Tile Information (0x1d/0):" } },
+    { 0x0000001e, 0x0000001e, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_1e, { NULL } },
+    { 0x0000001f, 0x0000001f, ANY_HYPERVISOR,       SUBLEAF_TOPOLOGY_V2,     TRUE,  stash_leaf_1f,        print_leaf_1f,
+      { "   V2 extended topology (0x1f):" } },
+    { 0x00000020, 0x00000020, ANY_HYPERVISOR,       SUBLEAF_MAX_EAX,         FALSE, NULL,                 print_leaf_20,
+      { "   Processor History Reset information (0x20):" } },
+    { 0x20000000, 0x20000000, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 NULL, { NULL } },  // max already set to words[WORD_EAX]
+    { 0x20000001, 0x20000001, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_20000001, { NULL } },
+    { 0x40000000, 0x40000000, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_40000000,  print_leaf_40000000, { NULL } },
+    { 0x40000001, 0x40000001, HYPERVISOR_XEN,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000001_xen, { NULL } },
+    { 0x40000001, 0x40000001, HYPERVISOR_KVM,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000001_kvm, { NULL } },
+    { 0x40000001, 0x40000001, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000001_microsoft, { NULL } },
+    { 0x40000002, 0x40000002, HYPERVISOR_XEN,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000002_xen, { NULL } },
+    { 0x40000002, 0x40000002, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000002_microsoft, { NULL } },
+    { 0x40000003, 0x40000003, HYPERVISOR_XEN,       SUBLEAF_XEN_TIME,        FALSE, NULL,                 print_leaf_40000003_xen,
+      { "   hypervisor time features (0x40000003/00):",
+        "   hypervisor time scale & offset (0x40000003/01):",
+        "   hypervisor time physical cpu frequency (0x40000003/02):" } },
+    { 0x40000003, 0x40000003, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000003_microsoft, { NULL } },
+    { 0x40000004, 0x40000004, HYPERVISOR_XEN,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000004_xen, { NULL } },
+    { 0x40000004, 0x40000004, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000004_microsoft, { NULL } },
+    { 0x40000005, 0x40000005, HYPERVISOR_XEN,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000005_xen, { NULL } },
+    { 0x40000005, 0x40000005, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000005_microsoft, { NULL } },
+    { 0x40000006, 0x40000006, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000006_microsoft, { NULL } },
+    { 0x40000007, 0x40000007, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000007_microsoft, { NULL } },
+    { 0x40000008, 0x40000008, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000008_microsoft, { NULL } },
+    { 0x40000009, 0x40000009, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000009_microsoft, { NULL } },
+    { 0x4000000a, 0x4000000a, HYPERVISOR_MICROSOFT, SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_4000000a_microsoft, { NULL } },
+    { 0x40000010, 0x40000010, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_40000010, { NULL } },
+    { 0x80000000, 0x80000000, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  NULL,                 NULL, { NULL } },  // max already set to words[WORD_EAX]
+    { 0x80000001, 0x80000001, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80000001,  print_leaf_80000001, { NULL } },
+    { 0x80000002, 0x80000002, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80000002,  NULL, { NULL } },  // stashed, printed with function 80000004h
+    { 0x80000003, 0x80000003, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80000003,  NULL, { NULL } },  // stashed, printed with function 80000004h
+    { 0x80000004, 0x80000004, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80000004,  print_leaf_80000004, { NULL } },
+    { 0x80000005, 0x80000005, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_80000005, { NULL } },
+    { 0x80000006, 0x80000006, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80000006,  print_leaf_80000006, { NULL } },
+    { 0x80000007, 0x80000007, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_80000007, { NULL } },
+    { 0x80000008, 0x80000008, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80000008,  print_leaf_80000008, { NULL } },
+    { 0x80000009, 0x80000009, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_80000009, { NULL } },
+    { 0x8000000a, 0x8000000a, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_8000000a, { NULL } },
+    { 0x8000000b, 0x80000018, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_8000000b_80000018, { NULL } },
+    { 0x80000019, 0x80000019, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_80000019, { NULL } },
+    { 0x8000001a, 0x8000001a, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_8000001a, { NULL } },
+    { 0x8000001b, 0x8000001b, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_8000001b, { NULL } },
+    { 0x8000001c, 0x8000001c, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_8000001c, { NULL } },
+    { 0x8000001d, 0x8000001d, ANY_HYPERVISOR,       SUBLEAF_CACHE,           FALSE, NULL,                 print_leaf_8000001d,
+      { "   Cache Properties (0x8000001d):" } },
+    { 0x8000001e, 0x8000001e, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_8000001e,  print_leaf_8000001e, { NULL } },
+    { 0x8000001f, 0x8000001f, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_8000001f, { NULL } },
+    { 0x80000020, 0x80000020, ANY_HYPERVISOR,       SUBLEAF_NONZERO,         FALSE, NULL,                 print_leaf_80000020, { NULL } },
+    { 0x80860000, 0x80860000, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  NULL,                 NULL, { NULL } },  // max already set to words[WORD_EAX]
+    { 0x80860001, 0x80860001, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  NULL,                 print_leaf_80860001, { NULL } },
+    { 0x80860002, 0x80860002, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  NULL,                 print_leaf_80860002, { NULL } },
+    { 0x80860003, 0x80860003, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80860003,  NULL, { NULL } },  // DO NOTHING
+    { 0x80860004, 0x80860004, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80860004,  NULL, { NULL } },  // DO NOTHING
+    { 0x80860005, 0x80860005, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80860005,  NULL, { NULL } },  // DO NOTHING
+    { 0x80860006, 0x80860006, ANY_HYPERVISOR,       SUBLEAF_NONE,            TRUE,  stash_leaf_80860006,  print_leaf_80860006, { NULL } },
+    { 0x80860007, 0x80860007, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_80860007, { NULL } },
+    { 0xc0000000, 0xc0000000, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 NULL, { NULL } },  // max already set to words[WORD_EAX]
+    { 0xc0000001, 0xc0000001, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_c0000001, { NULL } },
+    { 0xc0000002, 0xc0000002, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_c0000002, { NULL } },
+    { 0xc0000004, 0xc0000004, ANY_HYPERVISOR,       SUBLEAF_NONE,            FALSE, NULL,                 print_leaf_c0000004, { NULL } },
+};
+
+#define LEAF_BASES  6     // number of CPUID function ranges, see leaf_base()
+#define LEAF_SLOTS  0x40  // functions per range with direct index
+#define LEAF_NONE   0xff  // no entry in index
+
+// return index of CPUID function range: standard, Xeon Phi, hypervisor, extended, Transmeta, VIA
+// reg = CPUID function number
+// return range index or LEAF_BASES if function out of ranges
+static constexpr unsigned int
+leaf_base(unsigned int reg)
+{
+    return ((reg >> 16) == 0x0000) ? 0
+        : ((reg >> 16) == 0x2000) ? 1
+        : ((reg >> 16) == 0x4000) ? 2
+        : ((reg >> 16) == 0x8000) ? 3
+        : ((reg >> 16) == 0x8086) ? 4
+        : ((reg >> 16) == 0xc000) ? 5
+        : LEAF_BASES;
+}
+
+// return TRUE if entries [first, last) of leaf_registry fit to direct index, compile time
+// first = index of first entry
+// last  = index after last entry
+static constexpr intbool
+leaf_registry_fits(size_t first, size_t last)
+{
+    return (last - first == 1)
+        ? leaf_base(leaf_registry[first].first) < LEAF_BASES
+          && leaf_base(leaf_registry[first].first) == leaf_base(leaf_registry[first].last)
+          && (leaf_registry[first].last & 0xffff) < LEAF_SLOTS
+          && leaf_registry[first].first <= leaf_registry[first].last
+        : (last - first > 1)
+          && leaf_registry_fits(first, first + (last - first) / 2)
+          && leaf_registry_fits(first + (last - first) / 2, last);
+}
+
+static_assert(leaf_registry_fits(0, LENGTH(leaf_registry)), "leaf_registry: function out of direct index");
+static_assert(LENGTH(leaf_registry) < LEAF_NONE, "leaf_registry: too many entries for leaf_index_t");
+
+// direct index of leaf_registry by range and function number, built once, see leaf_registry_index()
+typedef struct {
+    unsigned char  first[LEAF_BASES][LEAF_SLOTS]; // first entry of function, LEAF_NONE if none
+    unsigned char  next[LENGTH(leaf_registry)];   // next entry of same function, other hypervisor
+} leaf_index_t;
+
+// return index of leaf_registry, keep order of entries
+static leaf_index_t
+leaf_registry_index(void)
+{
+    leaf_index_t  index;
+    unsigned int  i;
+    memset(index.first, LEAF_NONE, sizeof(index.first));
+    memset(index.next, LEAF_NONE, sizeof(index.next));
+    for (i = LENGTH(leaf_registry); i > 0; i--) {
+        const leaf_info_t*  info = &leaf_registry[i - 1];
+        unsigned int        reg;
+        for (reg = info->first; reg <= info->last; reg++) {
+            unsigned char*  slot = &index.first[leaf_base(reg)][reg & 0xffff];
+            if (reg == info->first) {
+                index.next[i - 1] = *slot;
+            }
+            *slot = (unsigned char)(i - 1);
+        }
+    }
+    return index;
+}
+
+// find description of CPUID function
+// reg        = CPUID function number
+// hypervisor = detected hypervisor, select hypervisor-specific entry
+// return entry of leaf_registry or NULL if function unknown
+static const leaf_info_t*
+lookup_leaf(unsigned int reg, hypervisor_t hypervisor)
+{
+    static const leaf_index_t  index = leaf_registry_index();
+    unsigned int               base = leaf_base(reg);
+    unsigned int               i;
+
+    if (base >= LEAF_BASES || (reg & 0xffff) >= LEAF_SLOTS) return NULL;
+
+    for (i = index.first[base][reg & 0xffff]; i != LEAF_NONE; i = index.next[i]) {
+        if (leaf_registry[i].hypervisor == ANY_HYPERVISOR || leaf_registry[i].hypervisor == hypervisor) {
+            return &leaf_registry[i];
+        }
+    }
+    return NULL;
+}
+
+// accumulate processor information from CPUID registers, without print
+// used by print_reg() and by synth-only mode, which prints do_final() summary only
+// reg   = CPUID function number
+// words = pointer to array of registers EAX, EBX, ECX, EDX after execution of one function:subfunction
+// tryX  = CPUID subfunction number
+// stash = collection of vendor-specific and device-specific information after CPUID functions execution
+static void
+stash_reg(unsigned int reg, const unsigned int words[WORD_NUM], unsigned int tryX, code_stash_t* stash)
+{
+    const leaf_info_t*  info = lookup_leaf(reg, stash->hypervisor);
+
+    if (info != NULL && info->stash != NULL) {
+        info->stash(reg, words, tryX, stash);
+    }
+}
+
+// print CPU registers as decoded CPUID information
+// reg   = CPUID function number, select information interpreter
+// words = pointer to array of registers EAX, EBX, ECX, EDX after execution of one function:subfunction
+// raw   = flag for print raw data, without decoding
+// tryX  = CPUID subfunction number
+// stash = collection of vendor-specific and device-specific information after CPUID functions execution
+static void
+print_reg(unsigned int reg, const unsigned int words[WORD_NUM], intbool raw, unsigned int tryX, code_stash_t* stash)
+{
+    stash_reg(reg, words, tryX, stash);
+    model_leaf(reg, tryX, words);
+
+    const leaf_info_t*  info = raw ? NULL : lookup_leaf(reg, stash->hypervisor);
+    if (info == NULL) {
+        print_reg_raw(reg, tryX, words);
+    }
+    else if (info->print != NULL) {
+        info->print(reg, words, tryX, stash);
+    }
+
+    model_leaf_end();
+}
+
+#define USE_INSTRUCTION  (-2)
+#define USE_FILE         (-3)    // no CPUID execution, data read from file by -f option
+
+// this helper added for WinAPI support when porting from Linux to Windows
+// get number of processors by OS API
+static int
+processors_count_helper()
+{
+#if defined(_WIN32)
+    SYSTEM_INFO sysinfo;
+    GetSystemInfo(&sysinfo);
+    return sysinfo.dwNumberOfProcessors;
+#else
+    return (int)sysconf(_SC_NPROCESSORS_CONF);
+#endif
+}
+
+// print list of logical processors numbers as ranges, for example "0-95,192-287"
+// stream = output stream, stdout for decoded output, stderr for messages
+// cpus   = array of logical processors numbers, ascending order
+// count  = number of elements in the array
+static void
+print_cpu_ranges(FILE* stream, const unsigned int cpus[], unsigned int count)
+{
+    unsigned int  i = 0;
+
+    while (i < count) {
+        unsigned int  j = i;
+        while (j + 1 < count && cpus[j + 1] == cpus[j] + 1) j++;
+
+        if (i > 0) emit_to(stream, ",");
+        if (j > i) {
+            emit_to(stream, "%u-%u", cpus[i], cpus[j]);
+        }
+        else {
+            emit_to(stream, "%u", cpus[i]);
+        }
+        i = j + 1;
+    }
+}
+
+#if !defined(_WIN32)
+// parse Linux CPU list format, for example "0-95,192-287", as used by sysfs and cgroups
+// text  = CPU list string, terminated by zero or new line
+// cpus  = pointer for return allocated array of logical processors numbers, ascending order
+// return number of elements in the array, 0 if string not recognized
+static unsigned int
+parse_cpu_list(ccstring text, unsigned int** cpus)
+{
+    unsigned int   count = 0;
+    unsigned int   capacity = 0;
+    unsigned int*  list = NULL;
+    cstring        ptr = text;
+
+    while (*ptr != '\0' && *ptr != '\n') {
+        char*          endptr;
+        unsigned long  first = strtoul(ptr, &endptr, 10);
+        unsigned long  last = first;
+        if (endptr == ptr) break;
+        ptr = endptr;
+        if (*ptr == '-') {
+            ptr++;
+            last = strtoul(ptr, &endptr, 10);
+            if (endptr == ptr || last < first) break;
+            ptr = endptr;
+        }
+        if (*ptr == ',') ptr++;
+
+        unsigned long  cpu;
+        for (cpu = first; cpu <= last; cpu++) {
+            if (count == capacity) {
+                capacity = (capacity == 0) ? 64 : capacity * 2;
+                unsigned int*  grown = (unsigned int*)realloc(list, capacity * sizeof(unsigned int));
+                if (grown == NULL) {
+                    fprintf(stderr,
+                        "%s: unable to allocate memory for cpu list\n",
+                        program);
+                    exit(1);
+                }
+                list = grown;
+            }
+            list[count++] = (unsigned int)cpu;
+        }
+    }
+
+    *cpus = list;
+    return count;
+}
+#endif
+
+#ifdef USE_CPUID_MODULE
+// compare two logical processors numbers, qsort() callback
+static int
+compare_cpus(const void* left, const void* right)
+{
+    unsigned int  l = *(const unsigned int*)left;
+    unsigned int  r = *(const unsigned int*)right;
+    return (l > r) - (l < r);
+}
+
+// get logical processors numbers which have kernel cpuid driver nodes, ascending order
+// cpus = pointer for return allocated array of logical processors numbers, must be released by free()
+// return number of elements in the array, 0 if device directory not readable
+static unsigned int
+get_dev_cpu_list(unsigned int** cpus)
+{
+    unsigned int   count = 0;
+    unsigned int   capacity = 0;
+    unsigned int*  list = NULL;
+
+    DIR*  dir = opendir(cpuid_dev_dir);
+    if (dir == NULL) {
+        *cpus = NULL;
+        return 0;
+    }
+
+    struct dirent*  entry;
+    while ((entry = readdir(dir)) != NULL) {
+        char*          endptr;
+        unsigned long  cpu = strtoul(entry->d_name, &endptr, 10);
+        if (endptr == entry->d_name || *endptr != '\0') continue;  // not a CPU number
+
+        if (count == capacity) {
+            capacity = (capacity == 0) ? 64 : capacity * 2;
+            unsigned int*  grown = (unsigned int*)realloc(list, capacity * sizeof(unsigned int));
+            if (grown == NULL) {
+                fprintf(stderr,
+                    "%s: unable to allocate memory for cpu list\n",
+                    program);
+                exit(1);
+            }
+            list = grown;
+        }
+        list[count++] = (unsigned int)cpu;
+    }
+    closedir(dir);
+
+    qsort(list, count, sizeof(unsigned int), compare_cpus);
+    *cpus = list;
+    return count;
+}
+#endif
+
+#if !defined(_WIN32)
+// get online logical processors, read from sysfs
+// cpus = pointer for return allocated array of logical processors numbers, ascending order
+// return number of elements in the array, 0 if sysfs not available
+static unsigned int
+get_online_cpu_list(unsigned int** cpus)
+{
+    unsigned int  count = 0;
+
+    *cpus = NULL;
+    FILE*  file = fopen("/sys/devices/system/cpu/online", "r");
+    if (file != NULL) {
+        char  buffer[4096];
+        if (fgets(buffer, LENGTH(buffer), file) != NULL) {
+            count = parse_cpu_list(buffer, cpus);
+        }
+        fclose(file);
+    }
+
+    return count;
+}
+
+// get logical processors permitted for current thread by sched_getaffinity(),
+// dynamic CPU set grown until the kernel mask fits, so not limited by 1024-bit cpu_set_t
+// cpus = pointer for return allocated array of logical processors numbers, ascending order
+// return number of elements in the array, 0 if affinity mask not available
+static unsigned int
+get_affinity_cpu_list(unsigned int** cpus)
+{
+    unsigned int  count = 0;
+    int           size;
+
+    *cpus = NULL;
+    for (size = 1024; size <= (1 << 22); size *= 2) {
+        size_t      setsize = CPU_ALLOC_SIZE(size);
+        cpu_set_t*  cpuset = CPU_ALLOC(size);
+        if (cpuset == NULL) return 0;
+
+        CPU_ZERO_S(setsize, cpuset);
+        if (sched_getaffinity(0, setsize, cpuset) != 0) {
+            CPU_FREE(cpuset);
+            if (errno == EINVAL) continue;  // kernel mask is larger, retry with larger set
+            return 0;
+        }
+
+        *cpus = (unsigned int*)malloc(CPU_COUNT_S(setsize, cpuset) * sizeof(unsigned int));
+        if (*cpus == NULL) {
+            fprintf(stderr,
+                "%s: unable to allocate memory for cpu list\n",
+                program);
+            exit(1);
+        }
+        int  cpu;
+        for (cpu = 0; cpu < size; cpu++) {
+            if (CPU_ISSET_S(cpu, setsize, cpuset)) {
+                (*cpus)[count++] = (unsigned int)cpu;
+            }
+        }
+        CPU_FREE(cpuset);
+        break;
+    }
+
+    return count;
+}
+
+// get logical processors of cgroup v2 effective cpuset of current process,
+// for example the CPUs granted to a container, read from cpuset.cpus.effective
+// cpus = pointer for return allocated array of logical processors numbers, ascending order
+// return number of elements in the array, 0 if not cgroup v2 or cpuset controller not enabled
+static unsigned int
+get_cgroup_cpu_list(unsigned int** cpus)
+{
+    unsigned int  count = 0;
+    char          line[4096];
+    char          name[4096 + 64];
+
+    *cpus = NULL;
+    FILE*  file = fopen("/proc/self/cgroup", "r");
+    if (file == NULL) return 0;
+
+    // cgroup v2 unified hierarchy line is "0::PATH"
+    name[0] = '\0';
+    while (fgets(line, LENGTH(line), file) != NULL) {
+        if (strncmp(line, "0::", 3) == 0) {
+            line[strcspn(line, "\n")] = '\0';
+            snprintf(name, LENGTH(name), "/sys/fs/cgroup%s/cpuset.cpus.effective", line + 3);
+            break;
+        }
+    }
+    fclose(file);
+    if (name[0] == '\0') return 0;
+
+    file = fopen(name, "r");
+    if (file == NULL) return 0;
+    if (fgets(line, LENGTH(line), file) != NULL) {
+        count = parse_cpu_list(line, cpus);
+    }
+    fclose(file);
+
+    return count;
+}
+#endif
+
+// remove logical processors which are not permitted from the list, report removed ones
+// cpus    = array of logical processors numbers, ascending order, updated
+// count   = number of elements in the array
+// allowed = array of permitted logical processors numbers, ascending order
+// num_allowed = number of elements in the allowed array
+// reason  = text for report of removed processors, NULL means no report
+// return number of remaining elements in the array
+static unsigned int
+filter_cpu_list(unsigned int cpus[], unsigned int count,
+    const unsigned int allowed[], unsigned int num_allowed, ccstring reason)
+{
+    unsigned int*  skipped = (unsigned int*)malloc((count + 1) * sizeof(unsigned int));
+    unsigned int   num_skipped = 0;
+    unsigned int   kept = 0;
+    unsigned int   i;
+    unsigned int   j = 0;
+
+    if (skipped == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for cpu list\n",
+            program);
+        exit(1);
+    }
+
+    for (i = 0; i < count; i++) {
+        while (j < num_allowed && allowed[j] < cpus[i]) j++;
+        if (j < num_allowed && allowed[j] == cpus[i]) {
+            cpus[kept++] = cpus[i];
+        }
+        else {
+            skipped[num_skipped++] = cpus[i];
+        }
+    }
+
+    if (num_skipped > 0 && reason != NULL) {
+        fprintf(stderr, "%s: skipped cpus ", program);
+        print_cpu_ranges(stderr, skipped, num_skipped);
+        fprintf(stderr, ": %s\n", reason);
+    }
+
+    free(skipped);
+    return kept;
+}
+
+// restrict list of logical processors to ones current process may run on,
+// so restricted cpusets (containers, taskset) not abort collection at first forbidden CPU
+// Linux: sched_getaffinity() mask and cgroup v2 cpuset.cpus.effective
+// Windows: process affinity mask, yet for single processor group only (DWORD_PTR bits: 32 or 64 logical processors)
+// cpus   = array of logical processors numbers, ascending order, updated
+// count  = number of elements in the array
+// report = flag for report skipped processors and reason to stderr
+// return number of remaining elements in the array
+static unsigned int
+filter_permitted_cpus(unsigned int cpus[], unsigned int count, intbool report)
+{
+#if defined(_WIN32)
+    DWORD_PTR     process_mask = 0;
+    DWORD_PTR     system_mask = 0;
+    unsigned int  allowed[sizeof(DWORD_PTR) * 8];
+    unsigned int  num_allowed = 0;
+    unsigned int  cpu;
+
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) return count;
+    for (cpu = 0; cpu < sizeof(DWORD_PTR) * 8; cpu++) {
+        if ((process_mask >> cpu) & 1) allowed[num_allowed++] = cpu;
+    }
+    count = filter_cpu_list(cpus, count, allowed, num_allowed,
+        (report) ? "not in process affinity mask" : NULL);
+#else
+    unsigned int*  allowed = NULL;
+    unsigned int   num_allowed = get_affinity_cpu_list(&allowed);
+    if (num_allowed > 0) {
+        count = filter_cpu_list(cpus, count, allowed, num_allowed,
+            (report) ? "not in sched_getaffinity() mask" : NULL);
+    }
+    free(allowed);
+
+    num_allowed = get_cgroup_cpu_list(&allowed);
+    if (num_allowed > 0) {
+        count = filter_cpu_list(cpus, count, allowed, num_allowed,
+            (report) ? "not in cgroup cpuset.cpus.effective" : NULL);
+    }
+    free(allowed);
+#endif
+
+    return count;
+}
+
+// get logical processors numbers available for CPUID collection, ascending order
+// Linux numbering can be sparse (offline CPUs), so list is read from sysfs, not built by count
+// instruction mode: only CPUs permitted by affinity mask and cpuset, see filter_permitted_cpus()
+// inst   = flag for instruction mode, if FALSE list is built by kernel cpuid driver nodes
+// report = flag for report CPUs skipped as not permitted
+// cpus   = pointer for return allocated array of logical processors numbers, must be released by free()
+// return number of elements in the array
+static unsigned int
+get_cpu_list(intbool inst, intbool report, unsigned int** cpus)
+{
+    unsigned int  count = 0;
+
+#ifdef USE_CPUID_MODULE
+    if (!inst) {
+        count = get_dev_cpu_list(cpus);
+        if (count > 0) return count;
+        free(*cpus);
+    }
+#else
+    (void)inst;
+#endif
+
+#if !defined(_WIN32)
+    count = get_online_cpu_list(cpus);
+#endif
+
+    // fallback and Windows: contiguous numbering 0..N-1
+    if (count == 0) {
+        int  num_cpus = processors_count_helper();
+        if (num_cpus < 1) num_cpus = 1;
+        *cpus = (unsigned int*)malloc(num_cpus * sizeof(unsigned int));
+        if (*cpus == NULL) {
+            fprintf(stderr,
+                "%s: unable to allocate memory for cpu list\n",
+                program);
+            exit(1);
+        }
+        for (count = 0; count < (unsigned int)num_cpus; count++) {
+            (*cpus)[count] = count;
+        }
+    }
+
+    // kernel cpuid driver executes CPUID on any CPU, no migration, so no restriction
+    if (inst) {
+        count = filter_permitted_cpus(*cpus, count, report);
+        if (count == 0) {
+            fprintf(stderr,
+                "%s: no online cpus permitted by affinity mask and cpuset\n",
+                program);
+            exit(1);
+        }
+    }
+    return count;
+}
+
+
+// prepare OS for execute CPUID: set affinity mask for select CPU
+// cpu     = CPU selection number
+// one_cpu = flag for single CPU mode selected by user
+// inst    = flag for instruction mode selected by user
+// file    = pointer for return flag descriptor is regular file, stand-in for kernel cpuid driver node,
+//           file contains 16-byte records at offset (function + (sub-function << 32)) * 16
+// return mode selection code, yet used -1 = Error, USE_INSTRUCTION = use CPUID indtruction
+static int
+real_setup(unsigned int cpu, intbool one_cpu, intbool inst, intbool* file)
+{
+    *file = FALSE;
+
+    if (inst) {
+        if (!one_cpu) {
+#if defined(_WIN32)
+            // not cached in static variable: real_setup() called by concurrent collection workers
+            // num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+            unsigned int  num_cpus = processors_count_helper();  // porting changes: replace Linux API to Windows API
+            if (cpu >= num_cpus) return -1;
+
+// start of porting fragment, yet for single processor group only (yet max. 64 logical processors)
+
+            // affinization variant 1, not effective
+            //HANDLE hThread = GetCurrentThread();
+            //int status = -1;
+            //if (hThread != NULL)
+            //    status = SetThreadIdealProcessor(hThread, cpu);
+
+            // affinization variant 2, effective
+            HANDLE hThread = GetCurrentThread();
+            DWORD_PTR status = -1;
+            DWORD_PTR cpumask = 1;
+            cpumask <<= cpu;
+            if (hThread != NULL)
+                status = SetThreadAffinityMask(hThread, cpumask);
+
+            // end of porting fragment, yet for single processor group only (yet max. 64 logical processors)
+
+            //if (status == -1) {
+            if (status == 0) {
+#else
+            // native Linux backend: dynamic CPU set sized by CPU number, so not limited
+            // by fixed 1024-bit cpu_set_t, CPU numbers come from sysfs online list
+            size_t      setsize = CPU_ALLOC_SIZE(cpu + 1);
+            cpu_set_t*  cpuset = CPU_ALLOC(cpu + 1);
+            int         status = ENOMEM;
+            if (cpuset != NULL) {
+                CPU_ZERO_S(setsize, cpuset);
+                CPU_SET_S(cpu, setsize, cpuset);
+                status = pthread_setaffinity_np(pthread_self(), setsize, cpuset);
+                CPU_FREE(cpuset);
+            }
+
+            if (status != 0) {
+                errno = status;  // pthread functions return error code, not set errno
+#endif
+                if (cpu > 0) {
+                    if (errno == EINVAL) return -1;
+                }
+
+                fprintf(stderr,
+                    "%s: unable to setaffinity to cpu %d; errno = %d (%s)\n",
+                    program, cpu, errno, strerror(errno));
+                fprintf(stderr,
+                    "%s: using -1 will avoid trying to setaffinity and run"
+                    " on an arbitrary CPU\n",
+                    program);
+                exit(1);
+            }
+
+#if defined(_WIN32)
+            // sleep(0); /* to have a chance to migrate */
+            Sleep(0);    // porting from Linux to Windows
+#else
+            sched_yield();  /* to have a chance to migrate */
+#endif
+
+        }
+
+        return USE_INSTRUCTION;
+    }
+    else {
+
+#ifdef USE_CPUID_MODULE
+        // kernel cpuid driver: descriptor opened once per CPU, then read by real_get(),
+        // the calling thread is never migrated, the kernel executes CPUID on the target CPU
+        char  cpuid_name[4096];
+        snprintf(cpuid_name, LENGTH(cpuid_name), "%s/%u/cpuid", cpuid_dev_dir, cpu);
+
+        int  cpuid_fd = open(cpuid_name, O_RDONLY);
+        if (cpuid_fd == -1) {
+            if (cpu > 0) {
+                if (errno == ENXIO)  return -1;
+                if (errno == ENODEV) return -1;
+            }
+            fprintf(stderr,
+                "%s: cannot open %s; errno = %d (%s)\n",
+                program, cpuid_name, errno, strerror(errno));
+            explain_dev_cpu_errno();
+        }
+
+        struct stat  info;
+        *file = fstat(cpuid_fd, &info) == 0 && S_ISREG(info.st_mode);
+
+        return cpuid_fd;
+#else
+        return -1;
+#endif
+    }
+}
+
+// release CPUID execution method, selected by real_setup()
+// cpuid_fd = real_setup() result: USE_INSTRUCTION or descriptor of /dev/cpu/N/cpuid
+static void
+close_cpuid(int cpuid_fd)
+{
+#ifdef USE_CPUID_MODULE
+    if (cpuid_fd >= 0) {
+        close(cpuid_fd);
+    }
+#else
+    (void)cpuid_fd;
+#endif
+}
+
+// print CPUID function name (information header)
+// reg        = CPUID function number
+// tryX       = CPUID sub-function number
+// raw        = flag for raw dump without decoding data, no prints if raw mode selected
+// hypervisor = detected hypervisor, headers of hypervisor-specific functions
+static void
+print_header(unsigned int reg, unsigned int tryX, intbool raw, hypervisor_t hypervisor)
+{
+    if (!raw) {
+        const leaf_info_t*  info = lookup_leaf(reg, hypervisor);
+        if (info != NULL && tryX < LENGTH(info->headers) && info->headers[tryX] != NULL) {
+            emit("%s\n", info->headers[tryX]);
+        }
+    }
+}
+
+// one CPUID function:subfunction result, collected before decoding
+typedef struct {
+    unsigned int  reg;               // CPUID function number, input EAX
+    unsigned int  tryX;              // CPUID sub-function number, input ECX
+    unsigned int  words[WORD_NUM];   // output EAX, EBX, ECX, EDX
+} leaf_record_t;
+
+// latency of one CPUID function:subfunction, TSC cycles
+typedef struct {
+    unsigned long long  min;      // minimal latency
+    unsigned long long  median;   // median latency
+    unsigned long long  p99;      // 99th percentile latency
+} leaf_timing_t;
+
+// CPUID results for one logical processor, filled by collect_leaves() or read_table(), printed by print_leaves()
+typedef struct {
+    unsigned int    cpu;         // logical processor number
+    int             cpuid_fd;    // real_setup() result for this CPU, -1 means CPU not available
+    unsigned int    count;       // number of used records
+    unsigned int    capacity;    // number of allocated records
+    leaf_record_t*  records;     // array of records in the order of CPUID execution
+    unsigned int    hybrid;      // CPUID function 1Ah/0 EAX: core type and native model ID, 0 if not hybrid
+    leaf_timing_t*  timings;     // latency of each record, timing mode only, otherwise NULL
+    intbool         cpuid_file;  // flag cpuid_fd is regular file, stand-in for kernel cpuid driver node
+    int             read_errno;  // errno of failed read by real_get(), 0 = none, reported after workers joined
+    unsigned long long  read_offset;  // file offset of failed read
+    intbool         no_memory;   // flag add_leaf() or add_query() allocation failed, records incomplete,
+                                 // reported after workers joined
+} cpu_leaves_t;
+
+// Get CPUID data: direct execute CPUID instruction or read kernel cpuid driver
+// leaves = per-CPU buffer, cpuid_fd selected by real_setup(): USE_INSTRUCTION or descriptor of /dev/cpu/N/cpuid,
+//          read error stored in read_errno, collection worker threads never exit, see report_collect_error()
+// reg = function code for CPUID instruction, input EAX for CPUID instruction
+// ecx = sub-function code for CPUID instruction, input ECX for CPUID instruction
+// words[] = array of 4 32-bit double words, return EAX, EBX, ECX, EDX registers after CPUID execution
+// quiet = flag for return FALSE on read errors, instead of error stored in leaves
+static int real_get(cpu_leaves_t* leaves, unsigned int reg, unsigned int words[], unsigned int ecx, intbool quiet)
+{
+    if (leaves->cpuid_fd == USE_INSTRUCTION)
+    {
+
+#if defined(__GNUC__)
+        __cpuid_count(reg, ecx, words[0], words[1], words[2], words[3]);      // use GNU intrinsic
+#else
+        __cpuidex((int*)words, reg, ecx);                                     // use Microsoft intrinsic
+#endif
+
+        return TRUE;
+    }
+
+#ifdef USE_CPUID_MODULE
+    // after read error no more reads, enumeration of this CPU ends quickly
+    if (leaves->read_errno != 0) {
+        memset(words, 0, sizeof(unsigned int) * WORD_NUM);
+        return FALSE;
+    }
+
+    // file offset selects function (low 32 bits) and sub-function (high 32 bits),
+    // positioned read: one system call per leaf, no separate seek
+    off64_t  offset = ((off64_t)ecx << 32) + reg;
+    off64_t  position = offset;
+    if (leaves->cpuid_file) {
+        position *= sizeof(unsigned int) * WORD_NUM;
+    }
+
+    unsigned int  old_words[WORD_NUM];
+    if (ecx != 0) memcpy(old_words, words, sizeof(old_words));
+
+    ssize_t  status = pread64(leaves->cpuid_fd, words, sizeof(unsigned int) * WORD_NUM, position);
+    if (status != (ssize_t)(sizeof(unsigned int) * WORD_NUM)) {
+        if (status >= 0) errno = EIO;  // short read, possible for regular file instead of device
+        if (quiet) {
+            return FALSE;
+        }
+        leaves->read_errno = errno;
+        leaves->read_offset = offset;
+        memset(words, 0, sizeof(unsigned int) * WORD_NUM);
+        return FALSE;
+    }
+
+    if (ecx != 0 && memcmp(old_words, words, sizeof(old_words)) == 0) {
+        if (quiet) {
+            return FALSE;
+        }
+        static volatile intbool  said = FALSE;
+        if (!said) {
+            said = TRUE;
+            fprintf(stderr,
+                "%s: reading cpuid file at offset 0x%llx produced"
+                " duplicate results\n",
+                program, (long long unsigned)offset);
+            fprintf(stderr,
+                "%s: older kernels do not support cpuid ecx control\n",
+                program);
+            fprintf(stderr,
+                "%s: consider not using -k\n",
+                program);
+        }
+        memset(words, 0, sizeof(old_words));
+        return FALSE;
+    }
+
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+// CPUID results table for all logical processors: filled once (phase one), then can be used
+// by any consumer (phase two): decoded output, raw output, identical CPUs detection
+typedef struct {
+    cpu_leaves_t*  cpus;        // array of per-CPU tables, ascending logical processor numbers
+    long           num_cpus;    // number of elements in the cpus array
+} leaf_table_t;
+
+// logical processor number for "CPU:" header: single CPU mode or file without CPU numbers
+#define CPU_UNNUMBERED  ((unsigned int)-1)
+
+// one item of -l/--leaf list: range of CPUID functions and range of sub-functions
+typedef struct {
+    unsigned int  first;       // first CPUID function number
+    unsigned int  last;        // last CPUID function number
+    unsigned int  sub_first;   // first CPUID sub-function number, SUBLEAF_ALL means all enumerated
+    unsigned int  sub_last;    // last CPUID sub-function number
+} leaf_select_t;
+
+// sub-function wildcard: all sub-functions found by full enumeration of the leaf
+#define SUBLEAF_ALL     ((unsigned int)-1)
+
+// maximum number of CPUID functions or sub-functions in one range of -l/--leaf list
+#define MAX_LEAF_RANGE  0x1000
+
+// append one CPUID result to the per-CPU buffer, grow buffer if required
+// leaves = per-CPU buffer
+// reg    = CPUID function number
+// tryX   = CPUID sub-function number
+// words  = array of EAX, EBX, ECX, EDX values after CPUID function:subfunction
+// return TRUE if appended, FALSE if no memory, no_memory flag of leaves set, see report_collect_error()
+static intbool
+add_leaf(cpu_leaves_t* leaves, unsigned int reg, unsigned int tryX, const unsigned int words[WORD_NUM])
+{
+    if (leaves->count == leaves->capacity) {
+        unsigned int    capacity = (leaves->capacity == 0) ? 256 : leaves->capacity * 2;
+        leaf_record_t*  records = (leaf_record_t*)realloc(leaves->records,
+            capacity * sizeof(leaf_record_t));
+        if (records == NULL) {
+            leaves->no_memory = TRUE;
+            return FALSE;
+        }
+        leaves->records = records;
+        leaves->capacity = capacity;
+    }
+
+    leaf_record_t*  record = &leaves->records[leaves->count++];
+    record->reg = reg;
+    record->tryX = tryX;
+    memcpy(record->words, words, sizeof(record->words));
+    return TRUE;
+}
+
+// one query of the CPUID plan, in the order of execution
+typedef struct {
+    unsigned int  reg;     // CPUID function number, input EAX
+    unsigned int  ecx;     // CPUID sub-function number, input ECX
+    intbool       quiet;   // real_get() quiet flag, failure is end of enumeration
+} plan_query_t;
+
+// CPUID plan: exact list of queries executed by discovery logic of collect_leaves(),
+// derived once and replayed by other CPUs as straight-line array
+typedef struct {
+    unsigned int   count;       // number of used queries
+    unsigned int   capacity;    // number of allocated queries
+    plan_query_t*  queries;     // array of queries
+} leaf_plan_t;
+
+// result of one executed plan query
+typedef struct {
+    unsigned int  words[WORD_NUM];   // output EAX, EBX, ECX, EDX
+    intbool       success;           // real_get() result
+} plan_result_t;
+
+// source of CPUID results for collect_leaves()
+// live mode:   execute CPUID functions and record plan
+// replay mode: take results of executed plan, no CPUID execution, detect plan mismatch
+typedef struct {
+    cpu_leaves_t*         leaves;     // live mode: CPU of real_get() calls, cpuid_fd selected by real_setup()
+    leaf_plan_t*          plan;       // live mode: plan for record, replay mode: executed plan
+    const plan_result_t*  results;    // replay mode: results of executed plan, NULL means live mode
+    unsigned int          position;   // replay mode: index of next query
+    intbool               stale;      // replay mode: CPU requires other queries, so plan not usable
+    intbool               synth_only; // query only functions stashed for do_final(), see is_synth_leaf()
+} leaf_source_t;
+
+// detect CPUID function used by summary only (do_final), for synth-only mode:
+// vendor, signature, caches and topology for synth and multiprocessor/APIC summary,
+// hypervisor, brand string and Transmeta information, see synth flag of leaf_registry
+// reg = CPUID function number
+// return TRUE if function stashed by stash_reg() and used by do_final()
+static intbool
+is_synth_leaf(unsigned int reg)
+{
+    const leaf_info_t*  info = lookup_leaf(reg, ANY_HYPERVISOR);
+
+    return info != NULL && info->synth;
+}
+
+// append one query to the plan, grow buffer if required
+// plan  = CPUID plan
+// reg   = CPUID function number
+// ecx   = CPUID sub-function number
+// quiet = real_get() quiet flag
+// return TRUE if appended, FALSE if no memory
+static intbool
+add_query(leaf_plan_t* plan, unsigned int reg, unsigned int ecx, intbool quiet)
+{
+    if (plan->count == plan->capacity) {
+        unsigned int   capacity = (plan->capacity == 0) ? 256 : plan->capacity * 2;
+        plan_query_t*  queries = (plan_query_t*)realloc(plan->queries,
+            capacity * sizeof(plan_query_t));
+        if (queries == NULL) {
+            return FALSE;
+        }
+        plan->queries = queries;
+        plan->capacity = capacity;
+    }
+
+    plan_query_t*  query = &plan->queries[plan->count++];
+    query->reg = reg;
+    query->ecx = ecx;
+    query->quiet = quiet;
+    return TRUE;
+}
+
+// get CPUID function:subfunction result for collect_leaves(), same parameters as real_get()
+// live mode executes CPUID and records query, replay mode returns next result of executed plan
+// source = CPUID results source
+// return TRUE if success
+static int
+source_get(leaf_source_t* source, unsigned int reg, unsigned int words[], unsigned int ecx, intbool quiet)
+{
+    if (source->results == NULL) {
+        if (!add_query(source->plan, reg, ecx, quiet)) {
+            source->leaves->no_memory = TRUE;
+        }
+        return real_get(source->leaves, reg, words, ecx, quiet);
+    }
+
+    if (source->stale
+        || source->position >= source->plan->count
+        || source->plan->queries[source->position].reg != reg
+        || source->plan->queries[source->position].ecx != ecx
+        || source->plan->queries[source->position].quiet != quiet) {
+        // discovery logic goes other way on this CPU, finish enumeration quickly
+        source->stale = TRUE;
+        memset(words, 0, sizeof(unsigned int) * WORD_NUM);
+        return FALSE;
+    }
+
+    const plan_result_t*  result = &source->results[source->position++];
+    memcpy(words, result->words, sizeof(result->words));
+    return result->success;
+}
+
+// execute all queries of the plan on the current CPU, tight loop without discovery logic
+// leaves  = per-CPU buffer, cpuid_fd selected by real_setup()
+// plan    = CPUID plan
+// results = array for results, plan->count elements
+static void
+run_plan(cpu_leaves_t* leaves, const leaf_plan_t* plan, plan_result_t results[])
+{
+    unsigned int  i;
+
+    for (i = 0; i < plan->count; i++) {
+        const plan_query_t*  query = &plan->queries[i];
+
+        // kernel method detects unsupported ECX by compare with previous sub-function result
+        if (query->ecx != 0 && i > 0) {
+            memcpy(results[i].words, results[i - 1].words, sizeof(results[i].words));
+        }
+        results[i].success = real_get(leaves, query->reg, results[i].words, query->ecx, query->quiet);
+    }
+}
+
+// enumerate sub-functions of one CPUID function and store results, see subleaf_rule_t
+// source = CPUID results source
+// leaves = per-CPU buffer for results
+// rule   = rule for enumerate sub-functions, from leaf_registry
+// reg    = CPUID function number
+// words  = result of sub-function 0, already queried, used as buffer for next sub-functions
+static void
+collect_subleaves(leaf_source_t* source, cpu_leaves_t* leaves, subleaf_rule_t rule, unsigned int reg, unsigned int words[WORD_NUM])
+{
+    unsigned int  tryX = 0;
+
+    switch (rule) {
+    case SUBLEAF_COUNT: {
+        unsigned int  max_tries = words[WORD_EAX] & 0xff;
+        for (;;) {
+            add_leaf(leaves, reg, tryX, words);
+
+            tryX++;
+            if (tryX >= max_tries) break;
+
+            source_get(source, reg, words, 0, FALSE);
+        }
+        break;
+    }
+    case SUBLEAF_CACHE:
+        while ((words[WORD_EAX] & 0x1f) != 0) {
+            add_leaf(leaves, reg, tryX, words);
+            tryX++;
+            source_get(source, reg, words, tryX, FALSE);
+        }
+        break;
+    case SUBLEAF_MAX_EAX: {
+        unsigned int  max_tries = words[WORD_EAX];
+        for (;;) {
+            add_leaf(leaves, reg, tryX, words);
+            tryX++;
+            if (tryX > max_tries) break;
+            source_get(source, reg, words, tryX, FALSE);
+        }
+        break;
+    }
+    case SUBLEAF_TOPOLOGY:
+        while (words[WORD_EAX] != 0 || words[WORD_EBX] != 0) {
+            add_leaf(leaves, reg, tryX, words);
+            tryX++;
+            source_get(source, reg, words, tryX, FALSE);
+        }
+        break;
+    case SUBLEAF_TOPOLOGY_V2:
+        add_leaf(leaves, reg, 0, words);
+        for (tryX = 1; tryX < 256; tryX++) {
+            source_get(source, reg, words, tryX, FALSE);
+            add_leaf(leaves, reg, tryX, words);
+            if (BIT_EXTRACT_LE(words[WORD_ECX], 8, 16) == 0) break;
+        }
+        break;
+    case SUBLEAF_XSAVE: {
+        /*
+        ** ecx values 0 & 1 are special.
+        **
+        ** Intel:
+        **    For ecx values 2..63, the leaf is present if the corresponding
+        **    bit is present in the bit catenation of 0xd/0/edx + 0xd/0/eax,
+        **    or the bit catenation of 0xd/1/edx + 0xd/1/ecx.
+        ** AMD:
+        **    Only 4 ecx values are defined and it's gappy.  It's unclear
+        **    what the upper bound of any loop would be, so it seems
+        **    inappropriate to use one.
+        */
+        add_leaf(leaves, reg, 0, words);
+        unsigned long long  valid_xcr0
+            = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_EAX];
+        source_get(source, reg, words, 1, FALSE);
+        add_leaf(leaves, reg, 1, words);
+        unsigned long long  valid_xss
+            = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_ECX];
+        unsigned long long  valid_tries = valid_xcr0 | valid_xss;
+        for (tryX = 2; tryX < 63; tryX++) {
+            if (valid_tries & (1ull << tryX)) {
+                source_get(source, reg, words, tryX, FALSE);
+                add_leaf(leaves, reg, tryX, words);
+            }
+        }
+        break;
+    }
+    case SUBLEAF_RDT_MONITOR: {
+        unsigned int  mask = words[WORD_EDX];
+        add_leaf(leaves, reg, 0, words);
+        if (BIT_EXTRACT_LE(mask, 1, 2)) {
+            source_get(source, reg, words, 1, FALSE);
+            add_leaf(leaves, reg, 1, words);
+        }
+        break;
+    }
+    case SUBLEAF_RDT_ALLOCATION: {
+        unsigned int  mask = words[WORD_EBX];
+        add_leaf(leaves, reg, 0, words);
+        for (tryX = 1; tryX < 32; tryX++) {
+            if (mask & (1 << tryX)) {
+                source_get(source, reg, words, tryX, FALSE);
+                add_leaf(leaves, reg, tryX, words);
+            }
+        }
+        break;
+    }
+    case SUBLEAF_SGX: {
+        unsigned int  mask = words[WORD_EAX];
+        add_leaf(leaves, reg, 0, words);
+        for (tryX = 1; tryX < 33; tryX++) {
+            if (mask & (1 << (tryX - 1))) {
+                source_get(source, reg, words, tryX, FALSE);
+                add_leaf(leaves, reg, tryX, words);
+            }
+        }
+        break;
+    }
+    case SUBLEAF_NONZERO:
+        // Rules for loop termination from SKC*.
+        while (words[WORD_EAX] != 0 || words[WORD_EBX] != 0 ||
+            words[WORD_ECX] != 0 || words[WORD_EDX] != 0) {
+            add_leaf(leaves, reg, tryX, words);
+            tryX++;
+            source_get(source, reg, words, tryX, FALSE);
+        }
+        break;
+    case SUBLEAF_XEN_TIME:
+        while (tryX <= 2) {
+            add_leaf(leaves, reg, tryX, words);
+            tryX++;
+            source_get(source, reg, words, tryX, FALSE);
+        }
+        break;
+    default:
+        add_leaf(leaves, reg, 0, words);
+        break;
+    }
+}
+
+// enumerate sub-functions of CPUID function by rule of leaf_registry
+// source     = CPUID results source
+// leaves     = per-CPU buffer for results
+// reg        = CPUID function number
+// hypervisor = detected hypervisor, rules of hypervisor-specific functions
+// words      = result of sub-function 0, already queried
+static void
+collect_leaf(leaf_source_t* source, cpu_leaves_t* leaves, unsigned int reg, hypervisor_t hypervisor, unsigned int words[WORD_NUM])
+{
+    const leaf_info_t*  info = lookup_leaf(reg, hypervisor);
+
+    collect_subleaves(source, leaves, (info != NULL) ? info->subleaves : SUBLEAF_NONE, reg, words);
+}
+
+// execute all supported CPUID functions on the current CPU and store results, without decoding
+// this is time-critical part, executed by thread pinned to the target CPU, so no output here
+// in replay mode the same discovery logic checks that results of executed plan match the plan
+// source = CPUID results source, live execution or replay of executed plan
+// leaves = per-CPU buffer for results
+static void
+collect_leaves(leaf_source_t* source, cpu_leaves_t* leaves)
+{
+    unsigned int  val_1_ecx = 0;                    // CPUID function 01h output ECX, bit 31 = hypervisor present
+    hypervisor_t  hypervisor = HYPERVISOR_UNKNOWN;  // hypervisor detected by CPUID function 40000000h
+    unsigned int  max;
+    unsigned int  reg;
+
+    // enumerate standard CPUID functions at theoretical range 00000000h - 3FFFFFFFh
+    max = 0;
+    for (reg = 0; reg <= max; reg++) {
+        unsigned int  words[WORD_NUM];
+
+        if (source->synth_only && !is_synth_leaf(reg)) continue;
+
+        source_get(source, reg, words, 0, FALSE);
+
+        if (reg == 0) {
+            max = words[WORD_EAX];  // update maximum function number
+        }
+        else if (reg == 1) {
+            val_1_ecx = words[WORD_ECX];  // required for detect hypervisor presence
+        }
+
+        collect_leaf(source, leaves, reg, hypervisor, words);
+    }
+
+    // enumerate virtual CPUID functions at theoretical range 40000000h - 7FFFFFFFh
+    if (BIT_EXTRACT_LE(val_1_ecx, 31, 32)) {
+        max = 0x40000000;
+        for (reg = 0x40000000; reg <= max; reg++) {
+            intbool       success;
+            unsigned int  words[WORD_NUM];
+
+            if (source->synth_only && !is_synth_leaf(reg)) continue;
+
+            success = source_get(source, reg, words, 0, TRUE);
+            if (!success) break;
+
+            if (reg == 0x40000000) {
+                max = words[WORD_EAX];
+                hypervisor = decode_hypervisor(words);
+            }
+
+            collect_leaf(source, leaves, reg, hypervisor, words);
+
+            if (reg == 0x40000000
+                && hypervisor == HYPERVISOR_KVM
+                && max == 0) {
+                max = 0x40000001;
+            }
+            if (reg == 0x40000000
+                && hypervisor == HYPERVISOR_UNKNOWN
+                && max > 0x40001000) {
+                // Assume some busted cpuid information and stop walking
+                // further 0x4xxxxxxx registers.
+                max = 0x40000000;
+            }
+        }
+    }
+
+    // enumerate Intel Xeon Phi specific CPUID functions at theoretical range 20000000h - 200000FFh
+    max = 0x20000000;
+    for (reg = 0x20000000; reg <= max; reg++) {
+        intbool       success;
+        unsigned int  words[WORD_NUM];
+
+        if (source->synth_only && !is_synth_leaf(reg)) continue;
+
+        success = source_get(source, reg, words, 0, TRUE);
+        if (!success) break;
+
+        if (reg == 0x20000000) {
+            max = words[WORD_EAX];
+            if (max > 0x20000100) {
+                // Pentium 4 (and probably many early CPUs) don't support this
+                // leaf correctly and return garbage (which appears to be a
+                // replica of the values for the last valid leaf in the
+                // 0x0xxxxxxx range).  As a sanity check to avoid an absurdly
+                // long dump, if the value obviously is out-of-range, just
+                // disable all further 0x2xxxxxxx leaves.
+                max = 0x20000000;
+            }
+        }
+
+        collect_leaf(source, leaves, reg, hypervisor, words);
+    }
+
+    // enumerate extended CPUID functions at theoretical range 80000000h - FFFFFFFFh
+    max = 0x80000000;
+    for (reg = 0x80000000; reg <= max; reg++) {
+        intbool       success;
+        unsigned int  words[WORD_NUM];
+
+        if (source->synth_only && !is_synth_leaf(reg)) continue;
+
+        success = source_get(source, reg, words, 0, TRUE);
+        if (!success) break;
+
+        if (reg == 0x80000000) {
+            max = words[WORD_EAX];
+        }
+
+        collect_leaf(source, leaves, reg, hypervisor, words);
+    }
+
+    // enumerate Transmeta specific CPUID functions from 80860000h
+    max = 0x80860000;
+    for (reg = 0x80860000; reg <= max; reg++) {
+        intbool       success;
+        unsigned int  words[WORD_NUM];
+
+        if (source->synth_only && !is_synth_leaf(reg)) continue;
+
+        success = source_get(source, reg, words, 0, TRUE);
+        if (!success) break;
+
+        if (reg == 0x80860000) {
+            max = words[WORD_EAX];  // update maximum function number
+        }
+
+        collect_leaf(source, leaves, reg, hypervisor, words);
+    }
+
+    // enumerate VIA specific CPUID functions from C0000000h
+    max = 0xc0000000;
+    for (reg = 0xc0000000; reg <= max; reg++) {
+        intbool       success;
+        unsigned int  words[WORD_NUM];
+
+        if (source->synth_only && !is_synth_leaf(reg)) continue;
+
+        success = source_get(source, reg, words, 0, TRUE);
+        if (!success) break;
+
+        if (reg == 0xc0000000) {
+            max = words[WORD_EAX];  // update maximum function number
+        }
+
+        if (max > 0xc0001000) {
+            // Assume some busted cpuid information and stop walking
+            // further 0x4xxxxxxx registers.
+            max = 0xc0000000;
+        }
+
+        collect_leaf(source, leaves, reg, hypervisor, words);
+    }
+
+}
+
+// read time stamp counter, serialized: not executed before previous instructions complete
+// and following instructions not started before read
+static inline unsigned long long
+read_tsc(void)
+{
+    unsigned long long  tsc;
+
+    _mm_lfence();
+    tsc = __rdtsc();
+    _mm_lfence();
+    return tsc;
+}
+
+// measure TSC frequency against OS monotonic clock, about 20 milliseconds
+// return TSC cycles per nanosecond
+static double
+calibrate_tsc(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER       frequency;
+    LARGE_INTEGER       start;
+    LARGE_INTEGER       now;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&start);
+    unsigned long long  tsc_start = read_tsc();
+    do {
+        QueryPerformanceCounter(&now);
+    } while ((now.QuadPart - start.QuadPart) * 50 < frequency.QuadPart);
+    unsigned long long  tsc_end = read_tsc();
+    double              ns = (double)(now.QuadPart - start.QuadPart) * 1e9 / (double)frequency.QuadPart;
+#else
+    struct timespec     start;
+    struct timespec     now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    unsigned long long  tsc_start = read_tsc();
+    double              ns;
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        ns = (double)(now.tv_sec - start.tv_sec) * 1e9 + (double)(now.tv_nsec - start.tv_nsec);
+    } while (ns < 20e6);
+    unsigned long long  tsc_end = read_tsc();
+#endif
+
+    return (double)(tsc_end - tsc_start) / ns;
+}
+
+// compare two latencies, qsort() callback
+static int
+compare_cycles(const void* left, const void* right)
+{
+    unsigned long long  l = *(const unsigned long long*)left;
+    unsigned long long  r = *(const unsigned long long*)right;
+
+    return (l > r) - (l < r);
+}
+
+// measure latency of each collected CPUID function:subfunction on the current CPU
+// executed by thread pinned to the target CPU, after collection
+// leaves = per-CPU buffer, filled by collect_leaves(), timings allocated here
+// runs   = number of executions of each function:subfunction
+static void
+time_leaves(cpu_leaves_t* leaves, unsigned int runs)
+{
+    unsigned long long*  samples = (unsigned long long*)malloc(runs * sizeof(unsigned long long));
+    leaves->timings = (leaf_timing_t*)malloc((leaves->count + 1) * sizeof(leaf_timing_t));
+    if (samples == NULL || leaves->timings == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for cpu %u timings\n",
+            program, leaves->cpu);
+        exit(1);
+    }
+
+    unsigned int  i;
+    for (i = 0; i < leaves->count; i++) {
+        const leaf_record_t*  record = &leaves->records[i];
+        unsigned int          ecx = (record->reg == 2) ? 0 : record->tryX;  // leaf 2 repeats are not sub-functions
+        unsigned int          run;
+
+        for (run = 0; run < runs; run++) {
+            unsigned int        words[WORD_NUM];
+            memcpy(words, record->words, sizeof(words));
+            unsigned long long  start = read_tsc();
+            real_get(leaves, record->reg, words, ecx, TRUE);
+            samples[run] = read_tsc() - start;
+        }
+
+        qsort(samples, runs, sizeof(unsigned long long), compare_cycles);
+        leaves->timings[i].min = samples[0];
+        leaves->timings[i].median = samples[runs / 2];
+        leaves->timings[i].p99 = samples[(runs - 1) * 99 / 100];
+    }
+
+    free(samples);
+}
+
+// print latency of one collected CPUID function:subfunction, timing mode only
+// leaves = per-CPU buffer
+// index  = index of record
+static void
+print_timing(const cpu_leaves_t* leaves, unsigned int index)
+{
+    if (leaves->timings == NULL) return;
+
+    const leaf_timing_t*  timing = &leaves->timings[index];
+    emit("   (timing 0x%08x/0x%02x: min %llu median %llu p99 %llu cycles"
+        ", %.0f/%.0f/%.0f ns%s)\n",
+        leaves->records[index].reg, leaves->records[index].tryX,
+        timing->min, timing->median, timing->p99,
+        timing->min / tsc_per_ns, timing->median / tsc_per_ns, timing->p99 / tsc_per_ns,
+        (timing->min >= TIMING_TRAP_CYCLES) ? ", trap" : "");
+}
+
+// decode and print CPUID results collected for one logical processor
+// leaves = per-CPU buffer, filled by collect_leaves()
+// raw    = flag for raw dump without decoding data
+// debug  = flag for debug mode, print detail transit info
+// stash  = pointer for return accumulated processor information
+static void
+print_leaves(const cpu_leaves_t* leaves, intbool raw, intbool debug, code_stash_t* stash)
+{
+    static const code_stash_t  empty_stash = NIL_STASH;
+    unsigned int               i;
+
+    *stash = empty_stash;
+
+    for (i = 0; i < leaves->count; i++) {
+        const leaf_record_t*  record = &leaves->records[i];
+
+        print_header(record->reg, record->tryX, raw, stash->hypervisor);
+        if (!raw) {
+            print_timing(leaves, i);
+        }
+        print_reg(record->reg, record->words, raw, record->tryX, stash);
+    }
+
+    // summary information
+    do_final(raw, debug, stash);
+}
+
+// find collected CPUID result by function and sub-function numbers
+// leaves = per-CPU buffer, filled by collect_leaves()
+// reg    = CPUID function number
+// tryX   = CPUID sub-function number
+// return pointer to record or NULL if not collected
+static const leaf_record_t*
+find_leaf(const cpu_leaves_t* leaves, unsigned int reg, unsigned int tryX)
+{
+    unsigned int  i;
+
+    for (i = 0; i < leaves->count; i++) {
+        if (leaves->records[i].reg == reg && leaves->records[i].tryX == tryX) {
+            return &leaves->records[i];
+        }
+    }
+
+    return NULL;
+}
+
+// clear fields which differ between identical CPUs: APIC IDs and core/node IDs
+// reg   = CPUID function number
+// words = array of EAX, EBX, ECX, EDX values for modify
+static void
+mask_per_cpu_fields(unsigned int reg, unsigned int words[WORD_NUM])
+{
+    if (reg == 1) {
+        words[WORD_EBX] &= 0x00ffffff;       // initial APIC ID
+    }
+    else if (reg == 0xb || reg == 0x1f) {
+        words[WORD_EDX] = 0;                 // x2APIC ID
+    }
+    else if (reg == 0x8000001e) {
+        words[WORD_EAX] = 0;                 // extended APIC ID
+        words[WORD_EBX] &= 0xffffff00;       // core ID
+        words[WORD_ECX] &= 0xffffff00;       // node ID
+    }
+}
+
+// initial value of 64-bit FNV-1a hash
+#define HASH_INIT  0xcbf29ce484222325ull
+
+// update 64-bit FNV-1a hash by data bytes
+// hash = hash of previous data, HASH_INIT for start
+// data = pointer to data bytes
+// size = number of data bytes
+// return updated hash
+static unsigned long long
+hash_bytes(unsigned long long hash, const void* data, size_t size)
+{
+    const unsigned char*  bytes = (const unsigned char*)data;
+    size_t                i;
+
+    for (i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+// signature of CPUID results collected for one logical processor, ignoring per-CPU fields
+// leaves = per-CPU buffer, filled by collect_leaves()
+// return 64-bit FNV-1a hash of all records
+static unsigned long long
+hash_leaves(const cpu_leaves_t* leaves)
+{
+    unsigned long long  hash = HASH_INIT;
+    unsigned int        i;
+
+    for (i = 0; i < leaves->count; i++) {
+        leaf_record_t  record = leaves->records[i];
+        mask_per_cpu_fields(record.reg, record.words);
+        hash = hash_bytes(hash, &record, sizeof(record));
+    }
+
+    return hash;
+}
+
+// compare CPUID results collected for two logical processors, ignoring per-CPU fields
+// this is exact check after signatures match, so hash collisions not merge different CPUs
+// return TRUE if results are identical
+static intbool
+same_leaves(const cpu_leaves_t* left, const cpu_leaves_t* right)
+{
+    unsigned int  i;
+
+    if (left->count != right->count) return FALSE;
+
+    for (i = 0; i < left->count; i++) {
+        leaf_record_t  l = left->records[i];
+        leaf_record_t  r = right->records[i];
+        mask_per_cpu_fields(l.reg, l.words);
+        mask_per_cpu_fields(r.reg, r.words);
+        if (memcmp(&l, &r, sizeof(leaf_record_t)) != 0) return FALSE;
+    }
+
+    return TRUE;
+}
+
+// print CPU header line, "CPU:" if logical processor number unknown
+// cpu = logical processor number or CPU_UNNUMBERED
+static void
+print_cpu_header(unsigned int cpu)
+{
+    if (output_model.active) {
+        model_cpu(cpu);
+    }
+    else if (cpu == CPU_UNNUMBERED) {
+        emit("CPU:\n");
+    }
+    else {
+        emit("CPU %u:\n", cpu);
+    }
+}
+
+// decode and print CPUID results, once per group of identical logical processors
+// for other CPUs of the group only the per-CPU topology (APIC synth) is printed
+// cpus     = array of per-CPU tables, ascending CPU numbers
+// num_cpus = number of elements in the array
+// debug    = flag for debug mode, print detail transit info
+static void
+print_unique_leaves(const cpu_leaves_t cpus[], long num_cpus, intbool debug)
+{
+    long  count = num_cpus;
+    if (count == 0) return;
+
+    unsigned long long*  hashes = (unsigned long long*)malloc(count * sizeof(unsigned long long));
+    long*                group = (long*)malloc(count * sizeof(long));
+    unsigned int*        members = (unsigned int*)malloc(count * sizeof(unsigned int));
+    if (hashes == NULL || group == NULL || members == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for %ld cpus\n",
+            program, count);
+        exit(1);
+    }
+
+    // group index is index of first CPU with same signature, -1 for CPU not collected
+    long  i;
+    long  j;
+    for (i = 0; i < count; i++) {
+        if (cpus[i].cpuid_fd == -1) {
+            group[i] = -1;
+            continue;
+        }
+        hashes[i] = hash_leaves(&cpus[i]);
+        group[i] = i;
+        for (j = 0; j < i; j++) {
+            if (group[j] == j && hashes[j] == hashes[i] && same_leaves(&cpus[j], &cpus[i])) {
+                group[i] = j;
+                break;
+            }
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        if (group[i] != i) continue;
+
+        code_stash_t  stash;
+        print_cpu_header(cpus[i].cpu);
+        print_leaves(&cpus[i], FALSE, debug, &stash);
+
+        unsigned int  num_members = 0;
+        for (j = i; j < count; j++) {
+            if (group[j] == i) members[num_members++] = cpus[j].cpu;
+        }
+        if (num_members < 2) continue;
+
+        emit("CPUs ");
+        print_cpu_ranges(stdout, members, num_members);
+        emit(": identical to CPU %u\n", cpus[i].cpu);
+
+        // only APIC ID differs, so topology of other CPUs is synthesized by replace it
+        for (j = i + 1; j < count; j++) {
+            if (group[j] != i) continue;
+
+            const leaf_record_t*  leaf_1 = find_leaf(&cpus[j], 1, 0);
+            code_stash_t          member = stash;
+            if (leaf_1 != NULL) {
+                member.val_1_ebx = leaf_1->words[WORD_EBX];
+            }
+            print_cpu_header(cpus[j].cpu);
+            print_apic_synth(&member);
+        }
+    }
+
+    free(members);
+    free(group);
+    free(hashes);
+}
+
+// core type name for CPUID function 1Ah/0 EAX bits 24-31
+// type = core type code
+// return core type name
+static cstring
+core_type_name(unsigned int type)
+{
+    switch (type) {
+    case 0x00: return "not hybrid";
+    case 0x20: return "Intel Atom";
+    case 0x40: return "Intel Core";
+    default:   return "unknown";
+    }
+}
+
+// cache parameters of one cache, see decode_cache_params()
+typedef struct {
+    unsigned int        type;        // cache type: 1 = data, 2 = instruction, 3 = unified
+    unsigned int        level;       // cache level, 1 = L1
+    unsigned int        ways;        // ways of associativity
+    unsigned int        line_size;   // line size in bytes
+    unsigned int        sets;        // number of sets
+    unsigned int        sharing;     // maximum number of logical processors sharing this cache
+    unsigned long long  size;        // cache size in bytes
+} cache_params_t;
+
+// decode deterministic cache parameters of CPUID function 4 or 8000001Dh subfunction
+// record = CPUID results of subfunction
+// cache  = pointer for return cache parameters
+// return TRUE if subfunction describes cache, FALSE if end of caches list or reserved type
+static intbool
+decode_cache_params(const leaf_record_t* record, cache_params_t* cache)
+{
+    cache->type = BIT_EXTRACT_LE(record->words[WORD_EAX], 0, 5);
+    cache->level = BIT_EXTRACT_LE(record->words[WORD_EAX], 5, 8);
+    cache->sharing = BIT_EXTRACT_LE(record->words[WORD_EAX], 14, 26) + 1;
+    cache->ways = BIT_EXTRACT_LE(record->words[WORD_EBX], 22, 32) + 1;
+    cache->line_size = BIT_EXTRACT_LE(record->words[WORD_EBX], 0, 12) + 1;
+    cache->sets = record->words[WORD_ECX] + 1;
+    cache->size = (unsigned long long)cache->ways
+        * (BIT_EXTRACT_LE(record->words[WORD_EBX], 12, 22) + 1)
+        * cache->line_size
+        * ((unsigned long long)record->words[WORD_ECX] + 1);
+    return cache->type != 0 && cache->type <= 3;
+}
+
+// print cache sizes summary for one core type, from deterministic cache parameters
+// leaves = per-CPU buffer of core type representative
+static void
+print_core_type_caches(const cpu_leaves_t* leaves)
+{
+    static ccstring  types[] = { "", "d", "i", "" };
+    unsigned int     reg = (find_leaf(leaves, 4, 0) != NULL) ? 4 : 0x8000001d;
+    unsigned int     printed = 0;
+    unsigned int     i;
+
+    emit("      caches:");
+    for (i = 0; i < leaves->count; i++) {
+        const leaf_record_t*  record = &leaves->records[i];
+        cache_params_t        cache;
+        if (record->reg != reg) continue;
+        if (!decode_cache_params(record, &cache)) continue;
+
+        emit("%s L%u%s %llu KB", (printed > 0) ? "," : "", cache.level, types[cache.type], cache.size / 1024);
+        printed++;
+    }
+    if (printed == 0) {
+        emit(" unknown");
+    }
+    emit("\n");
+}
+
+// collect names of one-bit flags of register from named_item table of its decoder,
+// decoder output captured by temporary decoded output model, so nothing printed
+// print = register decoder, prints by print_names()
+// value = register value for decoder
+// names = array for return names, indexed by bit, NULL if no one-bit flag at bit
+static void
+decoder_flag_names(void (*print)(unsigned int value), unsigned int value, cstring names[BPI])
+{
+    output_model_t        saved = output_model;
+    const model_node_t*   node;
+    unsigned int          i;
+
+    for (i = 0; i < BPI; i++) {
+        names[i] = NULL;
+    }
+    if (print == NULL) return;
+
+    memset(&output_model, 0, sizeof(output_model));
+    output_model.root.kind = NODE_ROOT;
+    output_model.active = TRUE;
+    print(value);
+    for (node = output_model.root.child; node != NULL; node = node->next) {
+        if (node->kind != NODE_NAMES) continue;
+        for (i = 0; i < node->length; i++) {
+            if (node->names[i].low_bit == node->names[i].high_bit) {
+                names[node->names[i].low_bit] = node->names[i].name;
+            }
+        }
+    }
+    arena_free(&output_model.arena);
+    output_model = saved;
+}
+
+// print ISA differences between core types: feature flags not present on all core types,
+// named by decoders of feature registers, core types come from function 1Ah, so Intel decoders
+// cpus     = array of per-CPU tables
+// reps     = array of indexes of core types representatives at cpus array
+// num_reps = number of core types
+// rep      = index of core type at reps array for print
+static void
+print_core_type_isa(const cpu_leaves_t cpus[], const long reps[], unsigned int num_reps, unsigned int rep)
+{
+    static const struct {
+        unsigned int  reg;
+        unsigned int  tryX;
+        unsigned int  word;
+        ccstring      name;
+        void          (*print)(unsigned int value);   // decoder of register, NULL if not decoded
+    } features[] = {
+        { 0x00000001, 0, WORD_ECX, "1/ecx"         , print_1_ecx              },
+        { 0x00000001, 0, WORD_EDX, "1/edx"         , print_1_edx              },
+        { 0x00000007, 0, WORD_EBX, "7/0/ebx"       , print_7_0_ebx            },
+        { 0x00000007, 0, WORD_ECX, "7/0/ecx"       , print_7_0_ecx            },
+        { 0x00000007, 0, WORD_EDX, "7/0/edx"       , print_7_0_edx            },
+        { 0x00000007, 1, WORD_EAX, "7/1/eax"       , print_7_1_eax            },
+        { 0x00000007, 1, WORD_EDX, "7/1/edx"       , NULL                     },
+        { 0x0000000d, 1, WORD_EAX, "0xd/1/eax"     , print_d_1_eax            },
+        { 0x80000001, 0, WORD_ECX, "0x80000001/ecx", print_80000001_ecx_intel },
+        { 0x80000001, 0, WORD_EDX, "0x80000001/edx", print_80000001_edx_intel },
+    };
+    unsigned int  printed = 0;
+    unsigned int  i;
+    unsigned int  j;
+
+    emit("      ISA:");
+    for (i = 0; i < LENGTH(features); i++) {
+        unsigned int  common = 0xffffffff;
+        unsigned int  own = 0;
+        for (j = 0; j < num_reps; j++) {
+            const leaf_record_t*  record = find_leaf(&cpus[reps[j]], features[i].reg, features[i].tryX);
+            unsigned int          value = (record != NULL) ? record->words[features[i].word] : 0;
+            common &= value;
+            if (j == rep) own = value;
+        }
+
+        // hypervisor guest status bit is not ISA
+        if (features[i].reg == 1 && features[i].word == WORD_ECX) {
+            own &= ~(1u << 31);
+        }
+
+        unsigned int  missing = own & ~common;
+        if (missing == 0) continue;
+
+        cstring  names[BPI];
+        decoder_flag_names(features[i].print, missing, names);
+        while (missing != 0) {
+            unsigned int  bit = lowest_bit(missing);
+            missing &= missing - 1;
+            if (printed == 0) {
+                emit(" feature flags missing on other core types:\n");
+            }
+            if (names[bit] != NULL) {
+                emit("         %s\n", names[bit]);
+            }
+            else {
+                emit("         %s bit %u\n", features[i].name, bit);
+            }
+            printed++;
+        }
+    }
+    if (printed == 0) {
+        emit(" common feature flags only\n");
+    }
+}
+
+// print core type line: type, native model ID and list of member CPUs
+// cpus    = array of per-CPU tables
+// count   = number of elements in the array, CPUs not collected are skipped
+// leaves  = per-CPU buffer of core type representative
+// members = buffer for member CPUs numbers, count elements
+// indent  = prefix of the line
+static void
+print_core_type_header(const cpu_leaves_t cpus[], long count, const cpu_leaves_t* leaves,
+    unsigned int members[], ccstring indent)
+{
+    unsigned int  num_members = 0;
+    long          i;
+
+    for (i = 0; i < count; i++) {
+        if (cpus[i].cpuid_fd == -1) continue;
+        if (cpus[i].hybrid == leaves->hybrid) members[num_members++] = cpus[i].cpu;
+    }
+
+    emit("%score type 0x%02x (%s), native model ID 0x%06x, CPUs ",
+        indent,
+        BIT_EXTRACT_LE(leaves->hybrid, 24, 32),
+        core_type_name(BIT_EXTRACT_LE(leaves->hybrid, 24, 32)),
+        BIT_EXTRACT_LE(leaves->hybrid, 0, 24));
+    print_cpu_ranges(stdout, members, num_members);
+    emit(":\n");
+}
+
+// decode and print CPUID results, once per hybrid core type (CPUID function 1Ah core type and native model ID)
+// then summary of cache sizes and ISA differences per core type
+// cpus     = array of per-CPU tables, ascending CPU numbers
+// num_cpus = number of elements in the array
+// debug    = flag for debug mode, print detail transit info
+static void
+print_core_types(const cpu_leaves_t cpus[], long num_cpus, intbool debug)
+{
+    long  count = num_cpus;
+    if (count == 0) return;
+
+    long*          reps = (long*)malloc(count * sizeof(long));
+    unsigned int*  members = (unsigned int*)malloc(count * sizeof(unsigned int));
+    if (reps == NULL || members == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for %ld cpus\n",
+            program, count);
+        exit(1);
+    }
+
+    // representative of core type is first CPU of this type
+    unsigned int  num_reps = 0;
+    unsigned int  rep;
+    long          i;
+    for (i = 0; i < count; i++) {
+        if (cpus[i].cpuid_fd == -1) continue;
+        for (rep = 0; rep < num_reps; rep++) {
+            if (cpus[reps[rep]].hybrid == cpus[i].hybrid) break;
+        }
+        if (rep == num_reps) reps[num_reps++] = i;
+    }
+
+    for (rep = 0; rep < num_reps; rep++) {
+        code_stash_t  stash;
+        print_core_type_header(cpus, count, &cpus[reps[rep]], members, "");
+        print_cpu_header(cpus[reps[rep]].cpu);
+        print_leaves(&cpus[reps[rep]], FALSE, debug, &stash);
+    }
+
+    emit("core types summary:\n");
+    for (rep = 0; rep < num_reps; rep++) {
+        print_core_type_header(cpus, count, &cpus[reps[rep]], members, "   ");
+        print_core_type_caches(&cpus[reps[rep]]);
+        print_core_type_isa(cpus, reps, num_reps, rep);
+    }
+
+    free(members);
+    free(reps);
+}
+
+// classify logical processor by hybrid core type, after CPUID results collected
+// leaves = per-CPU buffer, filled by collect_leaves() or read_table()
+static void
+classify_cpu(cpu_leaves_t* leaves)
+{
+    const leaf_record_t*  record = find_leaf(leaves, 0x1a, 0);
+
+    leaves->hybrid = (record != NULL) ? record->words[WORD_EAX] : 0;
+}
+
+// add logical processor to the table, with empty leaves list
+// table = CPUID results table
+// cpu   = logical processor number or CPU_UNNUMBERED
+// return pointer to per-CPU table of added processor
+static cpu_leaves_t*
+add_table_cpu(leaf_table_t* table, unsigned int cpu)
+{
+    cpu_leaves_t*  cpus = (cpu_leaves_t*)realloc(table->cpus,
+        (table->num_cpus + 1) * sizeof(cpu_leaves_t));
+    if (cpus == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for %ld cpus\n",
+            program, table->num_cpus + 1);
+        exit(1);
+    }
+    table->cpus = cpus;
+
+    cpu_leaves_t*  leaves = &table->cpus[table->num_cpus++];
+    leaves->cpu = cpu;
+    leaves->cpuid_fd = -1;
+    leaves->count = 0;
+    leaves->capacity = 0;
+    leaves->records = NULL;
+    leaves->hybrid = 0;
+    leaves->timings = NULL;
+    leaves->cpuid_file = FALSE;
+    leaves->read_errno = 0;
+    leaves->read_offset = 0;
+    leaves->no_memory = FALSE;
+    return leaves;
+}
+
+// release all memory of the table
+// table = CPUID results table
+static void
+free_table(leaf_table_t* table)
+{
+    long  cpu;
+
+    for (cpu = 0; cpu < table->num_cpus; cpu++) {
+        free(table->cpus[cpu].records);
+        free(table->cpus[cpu].timings);
+    }
+    free(table->cpus);
+    table->cpus = NULL;
+    table->num_cpus = 0;
+}
+
+// print summary (do_final) only for each CPU, without field-by-field decode
+// table = CPUID results table
+// debug = flag for debug mode, print detail transit info
+static void
+print_synth_table(const leaf_table_t* table, intbool debug)
+{
+    long  cpu;
+
+    for (cpu = 0; cpu < table->num_cpus; cpu++) {
+        const cpu_leaves_t*  leaves = &table->cpus[cpu];
+        code_stash_t         stash = NIL_STASH;
+        unsigned int         i;
+
+        if (leaves->cpuid_fd == -1) continue;
+
+        print_cpu_header(leaves->cpu);
+        for (i = 0; i < leaves->count; i++) {
+            stash_reg(leaves->records[i].reg, leaves->records[i].words, leaves->records[i].tryX, &stash);
+        }
+        do_final(FALSE, debug, &stash);
+    }
+}
+
+// lowercase hexadecimal digits, raw dump encoder table
+static const char  hex_digits[] = "0123456789abcdef";
+
+// maximum size of one raw dump line: "   0x%08x 0x%02x: eax=0x%08x ebx=0x%08x ecx=0x%08x edx=0x%08x\n"
+// with 8 digits sub-function number, or "CPU %u:\n"
+#define RAW_LINE_MAX  80
+
+// encode number as lowercase hexadecimal digits, same as printf("%0*x")
+// ptr    = output pointer
+// value  = number for encode
+// digits = minimal number of digits, more digits if value requires
+// return output pointer after digits
+static char*
+put_hex(char* ptr, unsigned int value, unsigned int digits)
+{
+    while (digits < 8 && (value >> (digits * 4)) != 0) digits++;
+
+    unsigned int  i;
+    for (i = digits; i > 0; i--) {
+        ptr[i - 1] = hex_digits[value & 0xf];
+        value >>= 4;
+    }
+    return ptr + digits;
+}
+
+// copy string without terminating zero
+// ptr  = output pointer
+// text = string for copy
+// return output pointer after string
+static char*
+put_text(char* ptr, ccstring text)
+{
+    size_t  size = strlen(text);
+    memcpy(ptr, text, size);
+    return ptr + size;
+}
+
+// format CPUID results table as raw hex information (-r output) in one buffer, without stash and printf(),
+// byte-identical to print_reg_raw() output, readable by read_table()
+// stop at first not available CPU, same as print_table()
+// table = CPUID results table
+// size  = pointer for return number of used bytes
+// return allocated buffer, must be released by free()
+static char*
+format_raw_table(const leaf_table_t* table, size_t* size)
+{
+    size_t  capacity = 1;
+    long    cpu;
+
+    for (cpu = 0; cpu < table->num_cpus; cpu++) {
+        capacity += (table->cpus[cpu].count + 1) * RAW_LINE_MAX;
+    }
+    char*  buffer = (char*)malloc(capacity);
+    if (buffer == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for raw dump\n",
+            program);
+        exit(1);
+    }
+
+    char*  ptr = buffer;
+    for (cpu = 0; cpu < table->num_cpus; cpu++) {
+        const cpu_leaves_t*  leaves = &table->cpus[cpu];
+        unsigned int         i;
+
+        if (leaves->cpuid_fd == -1) continue;
+
+        if (leaves->cpu == CPU_UNNUMBERED) {
+            ptr = put_text(ptr, "CPU:\n");
         }
-        else if (IS_VENDOR_ID(words, "GenuineTMx86")) {
-            stash->vendor = VENDOR_TRANSMETA;
+        else {
+            ptr += snprintf(ptr, RAW_LINE_MAX, "CPU %u:\n", leaves->cpu);
+        }
+        for (i = 0; i < leaves->count; i++) {
+            const leaf_record_t*  record = &leaves->records[i];
+            ptr = put_text(ptr, "   0x");
+            ptr = put_hex(ptr, record->reg, 8);
+            ptr = put_text(ptr, " 0x");
+            ptr = put_hex(ptr, record->tryX, 2);
+            ptr = put_text(ptr, ": eax=0x");
+            ptr = put_hex(ptr, record->words[WORD_EAX], 8);
+            ptr = put_text(ptr, " ebx=0x");
+            ptr = put_hex(ptr, record->words[WORD_EBX], 8);
+            ptr = put_text(ptr, " ecx=0x");
+            ptr = put_hex(ptr, record->words[WORD_ECX], 8);
+            ptr = put_text(ptr, " edx=0x");
+            ptr = put_hex(ptr, record->words[WORD_EDX], 8);
+            *ptr++ = '\n';
         }
-        else if (IS_VENDOR_ID(words, "SiS SiS SiS ")) {
-            stash->vendor = VENDOR_SIS;
+    }
+
+    *size = ptr - buffer;
+    return buffer;
+}
+
+// write CPUID results table as raw hex information (-r output), one buffer by one write
+// file  = output file
+// table = CPUID results table
+// return TRUE if whole dump written
+static intbool
+write_raw_table(FILE* file, const leaf_table_t* table)
+{
+    size_t  size;
+    char*   buffer = format_raw_table(table, &size);
+
+#if defined(_WIN32)
+    size_t  done = fwrite(buffer, 1, size, file);
+#else
+    // bypass stdio buffering: normally whole dump is written by single write(2)
+    fflush(file);
+    size_t  done = 0;
+    while (done < size) {
+        ssize_t  written = write(fileno(file), buffer + done, size - done);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            break;
         }
-        else if (IS_VENDOR_ID(words, "Geode by NSC")) {
-            stash->vendor = VENDOR_NSC;
+        done += written;
+    }
+#endif
+
+    free(buffer);
+    return done == size;
+}
+
+// names of output formats, -F option, in output_format_t order
+static ccstring  output_format_names[] = { "text", "json", "csv" };
+
+// names of registers for model renderers, in WORD_* order
+static ccstring  word_names[WORD_NUM] = { "eax", "ebx", "ecx", "edx" };
+
+// parse comma-separated list of output formats, -F option argument, exit if not understood
+// text = list of format names, e.g. "text,json"
+static void
+parse_output_formats(ccstring text)
+{
+    cstring  ptr = text;
+
+    num_output_formats = 0;
+    for (;;) {
+        size_t        size = strcspn(ptr, ",");
+        unsigned int  format;
+
+        for (format = 0; format < LENGTH(output_format_names); format++) {
+            if (size == strlen(output_format_names[format])
+                && strncmp(ptr, output_format_names[format], size) == SAME) break;
         }
-        else if (IS_VENDOR_ID(words, "Vortex86 SoC")) {
-            stash->vendor = VENDOR_VORTEX;
+        if (format == LENGTH(output_format_names) || num_output_formats == MAX_OUTPUT_FORMATS) {
+            fprintf(stderr,
+                "%s: argument to -F/--format not understood: %s\n",
+                program, text);
+            exit(1);
         }
-        else if (IS_VENDOR_ID(words, "Genuine  RDC")) {
-            stash->vendor = VENDOR_RDC;
+        output_formats[num_output_formats++] = (output_format_t)format;
+
+        if (ptr[size] == '\0') break;
+        ptr += size + 1;
+    }
+}
+
+// render model node as text, same as printed by decoders directly
+// node = model node, rendered with children
+static void
+render_text(const model_node_t* node)
+{
+    const model_node_t*  child;
+
+    switch (node->kind) {
+    case NODE_CPU:
+        print_cpu_header(node->cpu);
+        break;
+    case NODE_NAMES:
+        write_names(node->value, node->names, node->length, node->layout, node->max_len);
+        break;
+    case NODE_TEXT:
+        fwrite(node->text, 1, node->size, stdout);
+        break;
+    default:
+        break;
+    }
+
+    for (child = node->child; child != NULL; child = child->next) {
+        render_text(child);
+    }
+}
+
+// print decoded value of bitfield: flag as true/false, number or decoded string, see format_item()
+// item         = parameter control structure
+// field        = extracted bitfield
+// print_string = function for print quoted decoded string
+static void
+print_field_value(const named_item* item, unsigned int field, void (*print_string)(ccstring text))
+{
+    if (item->images == bools && field < LENGTH(bools)) {
+        printf("%s", bools[field]);
+    }
+    else if (item->images == X2_IMAGES) {
+        printf("%.1f", (double)field / 2.0);
+    }
+    else if (item->images == MINUS1_IMAGES) {
+        printf("%llu", (unsigned long long)field + 1ULL);
+    }
+    else if (item->images == NIL_IMAGES
+        || item->images[field] == NULL) {
+        printf("%u", field);
+    }
+    else {
+        print_string(item->images[field]);
+    }
+}
+
+// print characters escaped for JSON string, without quotes
+// text = characters
+// size = number of characters
+static void
+print_json_chars(const char* text, size_t size)
+{
+    size_t  i;
+
+    for (i = 0; i < size; i++) {
+        unsigned char  c = (unsigned char)text[i];
+        if (c == '"' || c == '\\') {
+            printf("\\%c", c);
         }
-        else if (IS_VENDOR_ID(words, "HygonGenuine")) {
-            stash->vendor = VENDOR_HYGON;
+        else if (c < 0x20) {
+            printf("\\u%04x", c);
         }
-        else if (IS_VENDOR_ID(words, "  Shanghai  ")) {
-            stash->vendor = VENDOR_ZHAOXIN;
+        else {
+            putchar(c);
         }
     }
-    else if (reg == 1) {
-        stash->val_1_eax = words[WORD_EAX];
-        stash->val_1_ebx = words[WORD_EBX];
-        stash->val_1_ecx = words[WORD_ECX];
-        stash->val_1_edx = words[WORD_EDX];
-    }
-    else if (reg == 4) {
-        stash->saw_4 = TRUE;
-        if (tryX == 0) {
-            stash->val_4_eax = words[WORD_EAX];
+}
+
+// print JSON string
+// text = string
+static void
+print_json_string(ccstring text)
+{
+    putchar('"');
+    print_json_chars(text, strlen(text));
+    putchar('"');
+}
+
+static void render_json_nodes(const model_node_t* node, unsigned int depth);
+
+// render sequence of text model nodes as one JSON text node, text split by lines
+// node  = first text node of sequence
+// depth = indentation depth of lines
+// return node after sequence
+static const model_node_t*
+render_json_text(const model_node_t* node, unsigned int depth)
+{
+    intbool  open = FALSE;   // line string started
+    intbool  first = TRUE;
+
+    printf("{\"type\": \"text\", \"lines\": [");
+    for (; node != NULL && node->kind == NODE_TEXT; node = node->next) {
+        const char*  ptr = node->text;
+        const char*  end = node->text + node->size;
+        while (ptr < end) {
+            if (!open) {
+                printf("%s%*s\"", first ? "\n" : ",\n", depth * 2, "");
+                first = FALSE;
+                open = TRUE;
+            }
+            const char*  eol = (const char*)memchr(ptr, '\n', end - ptr);
+            print_json_chars(ptr, ((eol != NULL) ? eol : end) - ptr);
+            if (eol == NULL) break;
+            putchar('"');
+            open = FALSE;
+            ptr = eol + 1;
         }
     }
-    else if (reg == 0xb) {
-        stash->saw_b = TRUE;
-        if (tryX < LENGTH(stash->val_b_eax)) {
-            stash->val_b_eax[tryX] = words[WORD_EAX];
+    if (open) {
+        putchar('"');
+    }
+    printf("]}");
+
+    return node;
+}
+
+// render model node as JSON object
+// node  = model node, rendered with children
+// depth = indentation depth of children
+static void
+render_json_node(const model_node_t* node, unsigned int depth)
+{
+    unsigned int  i;
+
+    switch (node->kind) {
+    case NODE_CPU:
+        printf("{\"type\": \"cpu\", \"cpu\": ");
+        if (node->cpu == CPU_UNNUMBERED) {
+            printf("null");
+        }
+        else {
+            printf("%u", node->cpu);
+        }
+        printf(", \"nodes\": [");
+        render_json_nodes(node, depth);
+        printf("]}");
+        break;
+    case NODE_LEAF:
+        printf("{\"type\": \"leaf\", \"function\": %u, \"subfunction\": %u", node->reg, node->tryX);
+        for (i = 0; i < WORD_NUM; i++) {
+            printf(", \"%s\": %u", word_names[i], node->words[i]);
         }
-        if (tryX < LENGTH(stash->val_b_ebx)) {
-            stash->val_b_ebx[tryX] = words[WORD_EBX];
+        printf(", \"nodes\": [");
+        render_json_nodes(node, depth);
+        printf("]}");
+        break;
+    case NODE_NAMES:
+        printf("{\"type\": \"register\", \"register\": ");
+        print_json_string(word_names[node->word]);
+        printf(", \"value\": %u, \"fields\": [", node->value);
+        for (i = 0; i < node->length; i++) {
+            const named_item*  item = &node->names[i];
+            unsigned int       field = BIT_EXTRACT_LE(node->value, item->low_bit, item->high_bit + 1);
+            printf("%s%*s{\"name\": ", (i == 0) ? "\n" : ",\n", depth * 2, "");
+            print_json_string(item->name);
+            printf(", \"low_bit\": %u, \"high_bit\": %u, \"raw\": %u, \"value\": ",
+                item->low_bit, item->high_bit, field);
+            print_field_value(item, field, print_json_string);
+            printf("}");
         }
+        printf("\n%*s]}", (depth - 1) * 2, "");
+        break;
+    default:
+        break;
     }
-    else if (reg == 0x1f) {
-        stash->saw_1f = TRUE;
-        if (tryX < LENGTH(stash->val_1f_eax)) {
-            stash->val_1f_eax[tryX] = words[WORD_EAX];
+}
+
+// render children of model node as JSON array elements, one element per line
+// node  = model node
+// depth = indentation depth of elements
+static void
+render_json_nodes(const model_node_t* node, unsigned int depth)
+{
+    const model_node_t*  child = node->child;
+    intbool              first = TRUE;
+
+    while (child != NULL) {
+        printf("%s%*s", first ? "\n" : ",\n", depth * 2, "");
+        first = FALSE;
+        if (child->kind == NODE_TEXT) {
+            child = render_json_text(child, depth + 1);
         }
-        if (tryX < LENGTH(stash->val_1f_ebx)) {
-            stash->val_1f_ebx[tryX] = words[WORD_EBX];
+        else {
+            render_json_node(child, depth + 1);
+            child = child->next;
         }
-        if (tryX < LENGTH(stash->val_1f_ecx)) {
-            stash->val_1f_ecx[tryX] = words[WORD_ECX];
+    }
+    if (!first) {
+        printf("\n%*s", (depth - 1) * 2, "");
+    }
+}
+
+// print CSV string
+// text = string
+static void
+print_csv_string(ccstring text)
+{
+    cstring  ptr;
+
+    putchar('"');
+    for (ptr = text; *ptr != '\0'; ptr++) {
+        if (*ptr == '"') putchar('"');
+        putchar(*ptr);
+    }
+    putchar('"');
+}
+
+// render register nodes of model as CSV rows, one row per bitfield, text nodes omitted
+// node = model node, rendered with children
+// cpu  = CPU node of node, NULL if none
+// leaf = leaf node of node, NULL if none
+static void
+render_csv(const model_node_t* node, const model_node_t* cpu, const model_node_t* leaf)
+{
+    const model_node_t*  child;
+    unsigned int         i;
+
+    switch (node->kind) {
+    case NODE_CPU:
+        cpu = node;
+        break;
+    case NODE_LEAF:
+        leaf = node;
+        break;
+    case NODE_NAMES:
+        for (i = 0; i < node->length; i++) {
+            const named_item*  item = &node->names[i];
+            unsigned int       field = BIT_EXTRACT_LE(node->value, item->low_bit, item->high_bit + 1);
+            if (cpu != NULL && cpu->cpu != CPU_UNNUMBERED) {
+                printf("%u", cpu->cpu);
+            }
+            if (leaf != NULL) {
+                printf(",0x%08x,0x%02x,", leaf->reg, leaf->tryX);
+            }
+            else {
+                printf(",,,");
+            }
+            printf("%s,", word_names[node->word]);
+            print_csv_string(item->name);
+            printf(",%u,%u,%u,", item->low_bit, item->high_bit, field);
+            print_field_value(item, field, print_csv_string);
+            printf("\n");
         }
+        break;
+    default:
+        break;
     }
-    else if (reg == 0x40000000) {
-        if (IS_HYPERVISOR_ID(words, "VMwareVMware")) {
-            stash->hypervisor = HYPERVISOR_VMWARE;
+
+    for (child = node->child; child != NULL; child = child->next) {
+        render_csv(child, cpu, leaf);
+    }
+}
+
+// stop capture of decoders output, render model by each selected output format and release it
+static void
+model_end(void)
+{
+    if (!output_model.active) return;
+
+    output_model.active = FALSE;
+
+    unsigned int  i;
+    for (i = 0; i < num_output_formats; i++) {
+        switch (output_formats[i]) {
+        case FORMAT_TEXT:
+            render_text(&output_model.root);
+            break;
+        case FORMAT_JSON:
+            printf("[");
+            render_json_nodes(&output_model.root, 1);
+            printf("]\n");
+            break;
+        case FORMAT_CSV:
+            printf("cpu,function,subfunction,register,name,low_bit,high_bit,raw,value\n");
+            render_csv(&output_model.root, NULL, NULL);
+            break;
         }
-        else if (IS_HYPERVISOR_ID(words, "XenVMMXenVMM")) {
-            stash->hypervisor = HYPERVISOR_XEN;
+    }
+
+    arena_free(&output_model.arena);
+    memset(&output_model, 0, sizeof(output_model));
+}
+
+// phase two: decode and print CPUID results table, in CPU order
+// stop at first not available CPU, same as serial enumeration
+// table  = CPUID results table, filled by collect_table() or read_table()
+// raw    = flag for raw dump without decoding data, no prints if raw mode selected
+// debug  = flag for debug mode, print detail transit info
+// unique = flag for decode identical CPUs once, not used in raw mode
+// types  = flag for decode once per hybrid core type, not used in raw mode
+// synth  = flag for print summary (do_final) only, not used in raw mode
+static void
+print_table(const leaf_table_t* table, intbool raw, intbool debug, intbool unique, intbool types, intbool synth)
+{
+    if (raw) {
+        write_raw_table(stdout, table);
+        return;
+    }
+    if (synth && !raw) {
+        print_synth_table(table, debug);
+        return;
+    }
+    if (types && !raw) {
+        print_core_types(table->cpus, table->num_cpus, debug);
+        return;
+    }
+    if (unique && !raw) {
+        print_unique_leaves(table->cpus, table->num_cpus, debug);
+        return;
+    }
+
+    long  cpu;
+    for (cpu = 0; cpu < table->num_cpus; cpu++) {
+        const cpu_leaves_t*  leaves = &table->cpus[cpu];
+        code_stash_t         stash;
+
+        if (leaves->cpuid_fd == -1) continue;
+
+        print_cpu_header(leaves->cpu);
+        print_leaves(leaves, raw, debug, &stash);
+    }
+}
+
+// maximum number of collection worker threads
+#define MAX_WORKERS  64
+
+// maximum number of CPUID plans shared by workers, hybrid CPUs require one plan per core type
+#define MAX_PLANS    4
+
+// collection worker threads portability: WinAPI threads for Windows, POSIX threads for Linux
+#if defined(_WIN32)
+typedef HANDLE     worker_t;
+#define WORKER_RESULT               DWORD WINAPI
+#define ATOMIC_INCREMENT(pointer)   InterlockedIncrement(pointer)
+#else
+typedef pthread_t  worker_t;
+#define WORKER_RESULT               void*
+#define ATOMIC_INCREMENT(pointer)   __sync_add_and_fetch(pointer, 1)
+#endif
+
+// shared context of collection worker threads
+typedef struct {
+    leaf_table_t*  table;                   // CPUID results table, per-CPU tables prepared with CPU numbers
+    volatile long  next_cpu;                // index of next table element for collection, shared by workers
+    long           end_cpu;                 // index after last table element for collection
+    intbool        inst;                    // flag for instruction mode, see real_setup()
+    leaf_plan_t    plans[MAX_PLANS];        // CPUID plans derived by discovery, first is plan of first CPU
+    volatile long  reserved_plans;          // number of reserved plan slots, shared by workers
+    volatile long  ready_plans[MAX_PLANS];  // nonzero if plan slot filled and can be used
+    const leaf_select_t*  selects;          // -l/--leaf list, NULL means all supported functions
+    unsigned int          num_selects;      // number of elements in the selects array
+    unsigned int          timing;           // timing mode: executions of each function:subfunction, 0 = off
+    intbool               synth_only;       // synth-only mode: only functions used by summary
+    const long*           order;            // indexes of table elements for collection, NULL means all in order
+    cpu_leaves_t*         verify;           // sampling mode: verification pass per table element, NULL means off
+} collect_pool_t;
+
+// collect CPUID results for one CPU, thread already pinned to it
+// replay known plans, first the plan used for previous CPU by this worker,
+// if no plan matches this CPU (max leaf or subleaf bounds differ), do discovery and add new plan
+// pool   = shared context of collection worker threads
+// leaves = per-CPU buffer, cpuid_fd already selected by real_setup()
+// hint   = pointer to index of plan used for previous CPU, updated
+static void
+collect_cpu(collect_pool_t* pool, cpu_leaves_t* leaves, long* hint)
+{
+    plan_result_t*  results = NULL;
+    long            i;
+
+    for (i = 0; i < MAX_PLANS; i++) {
+        long  slot = (*hint + i) % MAX_PLANS;
+        if (!pool->ready_plans[slot]) continue;
+
+        leaf_plan_t*    plan = &pool->plans[slot];
+        plan_result_t*  grown = (plan_result_t*)realloc(results, plan->count * sizeof(plan_result_t));
+        if (grown == NULL) {
+            fprintf(stderr,
+                "%s: unable to allocate memory for cpu %u leaves\n",
+                program, leaves->cpu);
+            exit(1);
         }
-        else if (IS_HYPERVISOR_ID(words, "KVMKVMKVM\0\0\0")) {
-            stash->hypervisor = HYPERVISOR_KVM;
+        results = grown;
+        run_plan(leaves, plan, results);
+
+        leaf_source_t  source = { leaves, plan, results, 0, FALSE, pool->synth_only };
+        leaves->count = 0;
+        collect_leaves(&source, leaves);
+        if (!source.stale && source.position == plan->count) {
+            *hint = slot;
+            free(results);
+            return;
         }
-        else if (IS_HYPERVISOR_ID(words, "Microsoft Hv")) {
-            stash->hypervisor = HYPERVISOR_MICROSOFT;
+    }
+    free(results);
+
+    // re-plan: discovery on this CPU, publish the plan if free slot exists
+    leaf_plan_t    plan = { 0, 0, NULL };
+    leaf_source_t  source = { leaves, &plan, NULL, 0, FALSE, pool->synth_only };
+    leaves->count = 0;
+    collect_leaves(&source, leaves);
+
+    long  slot = ATOMIC_INCREMENT(&pool->reserved_plans) - 1;
+    if (slot < MAX_PLANS) {
+        pool->plans[slot] = plan;
+        ATOMIC_INCREMENT(&pool->ready_plans[slot]);
+        *hint = slot;
+    }
+    else {
+        free(plan.queries);
+    }
+}
+
+// collect CPUID results selected by -l/--leaf list for one CPU, thread already pinned to it
+// explicit sub-functions executed as is, wildcard selects sub-functions found by full enumeration
+// pool   = shared context of collection worker threads
+// leaves = per-CPU buffer, cpuid_fd already selected by real_setup()
+// hint   = pointer to index of plan used for previous CPU, updated
+static void
+collect_selected(collect_pool_t* pool, cpu_leaves_t* leaves, long* hint)
+{
+    if (pool->selects == NULL) {
+        collect_cpu(pool, leaves, hint);
+        return;
+    }
+
+    cpu_leaves_t  all = { leaves->cpu, leaves->cpuid_fd, 0, 0, NULL, 0, NULL, leaves->cpuid_file, 0, 0, FALSE };
+    unsigned int  i;
+    for (i = 0; i < pool->num_selects; i++) {
+        if (pool->selects[i].sub_first == SUBLEAF_ALL) {
+            collect_cpu(pool, &all, hint);
+            leaves->read_errno = all.read_errno;
+            leaves->read_offset = all.read_offset;
+            leaves->no_memory = all.no_memory;
+            break;
         }
     }
-    else if (reg == 0x80000008) {
-        stash->val_80000008_ecx = words[WORD_ECX];
+
+    for (i = 0; i < pool->num_selects; i++) {
+        const leaf_select_t*  select = &pool->selects[i];
+        unsigned int          reg = select->first;
+
+        for (;;) {
+            if (select->sub_first == SUBLEAF_ALL) {
+                unsigned int  j;
+                for (j = 0; j < all.count; j++) {
+                    if (all.records[j].reg == reg) {
+                        add_leaf(leaves, reg, all.records[j].tryX, all.records[j].words);
+                    }
+                }
+            }
+            else {
+                // kernel method detects unsupported ECX by compare with previous sub-function result
+                unsigned int  words[WORD_NUM] = { 0, 0, 0, 0 };
+                unsigned int  tryX = select->sub_first;
+                for (;;) {
+                    real_get(leaves, reg, words, tryX, FALSE);
+                    add_leaf(leaves, reg, tryX, words);
+                    if (tryX == select->sub_last) break;
+                    tryX++;
+                }
+            }
+            if (reg == select->last) break;
+            reg++;
+        }
     }
-    else if (reg == 0x8000001e) {
-        stash->val_8000001e_ebx = words[WORD_EBX];
+
+    free(all.records);
+}
+
+// sampling mode verification pass for one CPU, thread already pinned to it:
+// functions for signature (01h, 07h, 80000001h) and for grouping and per-CPU fields
+// (0Bh, 1Ah, 1Fh, 8000001Eh), about a dozen executions instead of full enumeration
+// leaves = per-CPU buffer for verification results, empty, cpuid_fd selected by real_setup()
+static void
+collect_verify(cpu_leaves_t* leaves)
+{
+    unsigned int  words[WORD_NUM];
+    unsigned int  max;
+    unsigned int  tryX;
+
+    real_get(leaves, 0, words, 0, FALSE);
+    add_leaf(leaves, 0, 0, words);
+    max = words[WORD_EAX];
+
+    if (max >= 1) {
+        real_get(leaves, 1, words, 0, FALSE);
+        add_leaf(leaves, 1, 0, words);
     }
-    else if (reg == 0x80860003) {
-        memcpy(&stash->transmeta_info[0], words, sizeof(unsigned int) * WORD_NUM);
+    if (max >= 7) {
+        real_get(leaves, 7, words, 0, FALSE);
+        add_leaf(leaves, 7, 0, words);
     }
-    else if (reg == 0x80860004) {
-        memcpy(&stash->transmeta_info[16], words, sizeof(unsigned int) * WORD_NUM);
+    if (max >= 0xb) {
+        // same enumeration as collect_leaves(): until level number and type are zero
+        for (tryX = 0; tryX < 256; tryX++) {
+            real_get(leaves, 0xb, words, tryX, FALSE);
+            if (words[WORD_EAX] == 0 && words[WORD_EBX] == 0) break;
+            add_leaf(leaves, 0xb, tryX, words);
+        }
     }
-    else if (reg == 0x80860005) {
-        memcpy(&stash->transmeta_info[32], words, sizeof(unsigned int) * WORD_NUM);
+    if (max >= 0x1a) {
+        real_get(leaves, 0x1a, words, 0, FALSE);
+        add_leaf(leaves, 0x1a, 0, words);
     }
-    else if (reg == 0x80860006) {
-        memcpy(&stash->transmeta_info[48], words, sizeof(unsigned int) * WORD_NUM);
+    if (max >= 0x1f) {
+        real_get(leaves, 0x1f, words, 0, FALSE);
+        add_leaf(leaves, 0x1f, 0, words);
+        for (tryX = 1; tryX < 256; tryX++) {
+            real_get(leaves, 0x1f, words, tryX, FALSE);
+            add_leaf(leaves, 0x1f, tryX, words);
+            if (BIT_EXTRACT_LE(words[WORD_ECX], 8, 16) == 0) break;
+        }
     }
 
-    if (raw) {
-        print_reg_raw(reg, tryX, words);
+    if (!real_get(leaves, 0x80000000, words, 0, TRUE)) return;
+    max = words[WORD_EAX];
+    if (max >= 0x80000001 && max <= 0x8000ffff) {
+        real_get(leaves, 0x80000001, words, 0, FALSE);
+        add_leaf(leaves, 0x80000001, 0, words);
     }
-    else if (reg == 0) {
-        // max already set to words[WORD_EAX]
-        stash->val_0_eax = words[WORD_EAX];
-        printf("   vendor_id = \"%-4.4s%-4.4s%-4.4s\"\n",
-            (const char*)&words[WORD_EBX],
-            (const char*)&words[WORD_EDX],
-            (const char*)&words[WORD_ECX]);
-    }
-    else if (reg == 1) {
-        print_1_eax(words[WORD_EAX], stash->vendor);
-        print_1_ebx(words[WORD_EBX]);
-        print_brand(words[WORD_EAX], words[WORD_EBX]);
-        print_1_edx(words[WORD_EDX]);
-        print_1_ecx(words[WORD_ECX]);
-    }
-    else if (reg == 2) {
-        unsigned int  word = 0;
-        for (; word < 4; word++) {
-            if ((words[word] & 0x80000000) == 0) {
-                const unsigned char* bytes = (const unsigned char*)&words[word];
-                unsigned int          byte = (tryX == 0 && word == WORD_EAX ? 1
-                    : 0);
-                for (; byte < 4; byte++) {
-                    print_2_byte(bytes[byte], stash->vendor, stash->val_1_eax);
-                    stash_intel_cache(stash, bytes[byte]);
-                }
+    if (max >= 0x8000001e && max <= 0x8000ffff) {
+        real_get(leaves, 0x8000001e, words, 0, FALSE);
+        add_leaf(leaves, 0x8000001e, 0, words);
+    }
+}
+
+// collection worker thread: take next not collected CPU, pin to it and execute CPUID functions
+// repeat until all CPUs collected, so pool can be smaller than number of CPUs
+// parameter = pointer to collect_pool_t structure shared by all workers
+static WORKER_RESULT
+collect_worker(void* parameter)
+{
+    collect_pool_t*  pool = (collect_pool_t*)parameter;
+    long             hint = 0;
+
+    for (;;) {
+        long  index = ATOMIC_INCREMENT(&pool->next_cpu) - 1;
+        if (index >= pool->end_cpu) break;
+        if (pool->order != NULL) {
+            index = pool->order[index];
+        }
+
+        cpu_leaves_t*  leaves = &pool->table->cpus[index];
+        if (pool->verify != NULL) {
+            cpu_leaves_t*  check = &pool->verify[index];
+            check->cpuid_fd = real_setup(check->cpu, FALSE, pool->inst, &check->cpuid_file);
+            if (check->cpuid_fd != -1) {
+                collect_verify(check);
+                classify_cpu(check);
+                close_cpuid(check->cpuid_fd);
+            }
+            continue;
+        }
+
+        leaves->cpuid_fd = real_setup(leaves->cpu, FALSE, pool->inst, &leaves->cpuid_file);
+        if (leaves->cpuid_fd != -1) {
+            collect_selected(pool, leaves, &hint);
+            classify_cpu(leaves);
+            if (pool->timing > 0) {
+                time_leaves(leaves, pool->timing);
             }
+            close_cpuid(leaves->cpuid_fd);
+        }
+    }
+
+    return 0;
+}
+
+// start one collection worker thread
+// worker = pointer for return thread handle
+// pool   = shared context of collection worker threads
+// return TRUE if thread started
+static intbool
+start_worker(worker_t* worker, collect_pool_t* pool)
+{
+#if defined(_WIN32)
+    *worker = CreateThread(NULL, 0, collect_worker, pool, 0, NULL);
+    return *worker != NULL;
+#else
+    return pthread_create(worker, NULL, collect_worker, pool) == 0;
+#endif
+}
+
+// wait for collection worker thread termination and release it
+// worker = thread handle, returned by start_worker()
+static void
+join_worker(worker_t worker)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(worker, INFINITE);
+    CloseHandle(worker);
+#else
+    pthread_join(worker, NULL);
+#endif
+}
+
+// run collection workers and wait for all CPUs of the pool range collected
+// pool        = shared context of collection worker threads
+// max_workers = number of workers required, limited by MAX_WORKERS
+static void
+run_workers(collect_pool_t* pool, unsigned int max_workers)
+{
+    worker_t      workers[MAX_WORKERS];
+    unsigned int  num_workers = 0;
+    unsigned int  i;
+
+    while (num_workers < MAX_WORKERS && num_workers < max_workers) {
+        if (!start_worker(&workers[num_workers], pool)) break;
+        num_workers++;
+    }
+
+    // if no threads available, collect by current thread
+    if (num_workers == 0) {
+        collect_worker(pool);
+    }
+
+    for (i = 0; i < num_workers; i++) {
+        join_worker(workers[i]);
+    }
+}
+
+// collect table elements listed by pool->order (or all if NULL) by workers pool
+// first element only derives the CPUID plan, then other elements replay it simultaneously
+// pool  = shared context of collection worker threads
+// count = number of elements for collection
+static void
+collect_stage(collect_pool_t* pool, long count)
+{
+    if (count == 0) return;
+
+    // first element only: discovery, derive the plan for other elements
+    pool->next_cpu = 0;
+    pool->end_cpu = 1;
+    run_workers(pool, 1);
+
+    // other elements: replay the plan simultaneously
+    if (count > 1) {
+        pool->next_cpu = 1;  // workers increment index after last CPU
+        pool->end_cpu = count;
+        run_workers(pool, (unsigned int)(count - 1));
+    }
+}
+
+// package number of logical processor: x2APIC ID shifted by width of last level of leaf 1Fh or 0Bh
+// leaves = verification pass results, see collect_verify()
+// return package number, 0 if leaves 1Fh and 0Bh are not supported
+static unsigned int
+sample_package(const cpu_leaves_t* leaves)
+{
+    unsigned int  regs[] = { 0x1f, 0xb };
+    unsigned int  i;
+
+    for (i = 0; i < LENGTH(regs); i++) {
+        const leaf_record_t*  first = find_leaf(leaves, regs[i], 0);
+        if (first == NULL || first->words[WORD_EBX] == 0) continue;
+
+        unsigned int  shift = 0;
+        unsigned int  tryX;
+        for (tryX = 0; ; tryX++) {
+            const leaf_record_t*  record = find_leaf(leaves, regs[i], tryX);
+            if (record == NULL || BIT_EXTRACT_LE(record->words[WORD_ECX], 8, 16) == 0) break;
+            shift = BIT_EXTRACT_LE(record->words[WORD_EAX], 0, 5);
         }
+        return (shift < 32) ? first->words[WORD_EDX] >> shift : 0;
+    }
+
+    return 0;
+}
+
+// signature of verification pass: functions 01h, 07h and 80000001h, ignoring per-CPU fields
+// leaves = verification pass results, see collect_verify()
+// return 64-bit FNV-1a hash of the records
+static unsigned long long
+sample_signature(const cpu_leaves_t* leaves)
+{
+    unsigned int        regs[] = { 1, 7, 0x80000001 };
+    unsigned long long  hash = HASH_INIT;
+    unsigned int        i;
+
+    for (i = 0; i < LENGTH(regs); i++) {
+        const leaf_record_t*  found = find_leaf(leaves, regs[i], 0);
+        if (found == NULL) continue;
+
+        leaf_record_t  record = *found;
+        mask_per_cpu_fields(record.reg, record.words);
+        hash = hash_bytes(hash, &record, sizeof(record));
+    }
+
+    return hash;
+}
+
+// copy CPUID results of representative CPU, then replace functions executed by verification pass
+// so per-CPU fields (APIC IDs, core/node IDs, core type) are own values of the CPU
+// leaves = per-CPU buffer, empty
+// source = fully collected representative CPU
+// check  = verification pass results of this CPU
+static void
+copy_sampled(cpu_leaves_t* leaves, const cpu_leaves_t* source, const cpu_leaves_t* check)
+{
+    unsigned int  i;
+
+    for (i = 0; i < source->count; i++) {
+        const leaf_record_t*  record = &source->records[i];
+        const leaf_record_t*  own = find_leaf(check, record->reg, record->tryX);
+        add_leaf(leaves, record->reg, record->tryX, (own != NULL) ? own->words : record->words);
     }
-    else if (reg == 3) {
-        printf("   processor serial number ="
-            " %04X-%04X-%04X-%04X-%04X-%04X\n",
-            stash->val_1_eax >> 16, stash->val_1_eax & 0xffff,
-            words[WORD_EDX] >> 16, words[WORD_EDX] & 0xffff,
-            words[WORD_ECX] >> 16, words[WORD_ECX] & 0xffff);
-    }
-    else if (reg == 4) {
-        printf("      --- cache %d ---\n", tryX);
-        print_4_eax(words[WORD_EAX]);
-        print_4_ebx(words[WORD_EBX]);
-        print_4_ecx(words[WORD_ECX]);
-        print_4_edx(words[WORD_EDX]);
-        printf("      number of sets (s)                   = %llu\n",
-            (unsigned long long)words[WORD_ECX] + 1ULL);
-        print_4_synth(words);
-    }
-    else if (reg == 5) {
-        printf("   MONITOR/MWAIT (5):\n");
-        print_5_eax(words[WORD_EAX]);
-        print_5_ebx(words[WORD_EBX]);
-        print_5_ecx(words[WORD_ECX]);
-        print_5_edx(words[WORD_EDX]);
-    }
-    else if (reg == 6) {
-        printf("   Thermal and Power Management Features (6):\n");
-        print_6_eax(words[WORD_EAX]);
-        print_6_ebx(words[WORD_EBX]);
-        print_6_ecx(words[WORD_ECX]);
-        print_6_edx(words[WORD_EDX]);
-    }
-    else if (reg == 7) {
-        if (tryX == 0) {
-            print_7_0_ebx(words[WORD_EBX]);
-            print_7_0_ecx(words[WORD_ECX]);
-            print_7_0_edx(words[WORD_EDX]);
-        }
-        else if (tryX == 1) {
-            print_7_1_eax(words[WORD_EAX]);
+    leaves->cpuid_fd = check->cpuid_fd;
+    classify_cpu(leaves);
+}
+
+// report CPUID read or allocation error of collection workers by joining thread,
+// workers never exit, see real_get() and add_leaf()
+// cpus     = per-CPU buffers, collected
+// num_cpus = number of elements in the cpus array
+static void
+report_collect_error(const cpu_leaves_t cpus[], long num_cpus)
+{
+    long  i;
+
+    for (i = 0; i < num_cpus; i++) {
+        if (cpus[i].no_memory) {
+            fprintf(stderr,
+                "%s: unable to allocate memory for cpu %u leaves\n",
+                program, cpus[i].cpu);
+            exit(1);
         }
-        else {
-            /* Reserved: DO NOTHING */
+        if (cpus[i].read_errno != 0) {
+            fprintf(stderr,
+                "%s: unable to read cpuid file at offset 0x%llx;"
+                " errno = %d (%s)\n",
+                program, cpus[i].read_offset,
+                cpus[i].read_errno, strerror(cpus[i].read_errno));
+            exit(1);
         }
     }
-    else if (reg == 8) {
-        /* Reserved: DO NOTHING */
+}
+
+// sampling mode for very large hosts: verification pass on all CPUs, full collection only
+// for first CPU of each (package, core type) pair and for CPUs whose signature differs from it,
+// other CPUs copy results of their representative, see copy_sampled()
+// pool     = shared context of collection worker threads, table prepared with CPU numbers
+// num_cpus = number of table elements
+static void
+collect_sampled(collect_pool_t* pool, long num_cpus)
+{
+    leaf_table_t*        table = pool->table;
+    cpu_leaves_t*        verify = (cpu_leaves_t*)calloc(num_cpus, sizeof(cpu_leaves_t));
+    long*                order = (long*)malloc(num_cpus * sizeof(long));
+    long*                reps = (long*)malloc(num_cpus * sizeof(long));
+    unsigned long long*  signatures = (unsigned long long*)malloc(num_cpus * sizeof(unsigned long long));
+    unsigned int*        packages = (unsigned int*)malloc(num_cpus * sizeof(unsigned int));
+    if (verify == NULL || order == NULL || reps == NULL || signatures == NULL || packages == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for %ld cpus\n",
+            program, num_cpus);
+        exit(1);
     }
-    else if (reg == 9) {
-        printf("   Direct Cache Access Parameters (9):\n");
-        printf("      PLATFORM_DCA_CAP MSR bits = %u\n", words[WORD_EAX]);
-    }
-    else if (reg == 0xa) {
-        printf("   Architecture Performance Monitoring Features (0xa):\n");
-        print_a_eax(words[WORD_EAX]);
-        print_a_ebx(words[WORD_EBX]);
-        print_a_ecx(words[WORD_ECX]);
-        print_a_edx(words[WORD_EDX]);
-    }
-    else if (reg == 0xb) {
-        if (tryX == 0) {
-            // This is invariant across subleaves, so print it only once
-            printf("      extended APIC ID                      = %u\n",
-                words[WORD_EDX]);
-        }
-        printf("      --- level %d ---\n", tryX);
-        print_b_1f_ecx(words[WORD_ECX]);
-        print_b_1f_eax(words[WORD_EAX]);
-        print_b_1f_ebx(words[WORD_EBX]);
-    }
-    else if (reg == 0xc) {
-        /* Reserved: DO NOTHING */
+
+    long  i;
+    long  j;
+    for (i = 0; i < num_cpus; i++) {
+        verify[i].cpu = table->cpus[i].cpu;
+        verify[i].cpuid_fd = -1;
     }
-    else if (reg == 0xd) {
-        if (tryX == 0) {
-            printf("   XSAVE features (0xd/0):\n");
-            printf("      XCR0 lower 32 bits valid bit field mask = 0x%08x\n",
-                words[WORD_EAX]);
-            printf("      XCR0 upper 32 bits valid bit field mask = 0x%08x\n",
-                words[WORD_EDX]);
-            print_d_0_eax(words[WORD_EAX]);
-            // No bits current are defined in d_0_edx
-            printf("      bytes required by fields in XCR0        = 0x%08x (%u)\n",
-                words[WORD_EBX], words[WORD_EBX]);
-            printf("      bytes required by XSAVE/XRSTOR area     = 0x%08x (%u)\n",
-                words[WORD_ECX], words[WORD_ECX]);
-        }
-        else if (tryX == 1) {
-            printf("   XSAVE features (0xd/1):\n");
-            print_d_1_eax(words[WORD_EAX]);
-            printf("      SAVE area size in bytes                    "
-                " = 0x%08x (%u)\n",
-                words[WORD_EBX], words[WORD_EBX]);
-            printf("      IA32_XSS lower 32 bits valid bit field mask"
-                " = 0x%08x\n",
-                words[WORD_ECX]);
-            printf("      IA32_XSS upper 32 bits valid bit field mask"
-                " = 0x%08x\n",
-                words[WORD_EDX]);
-        }
-        else if (tryX >= 2 && tryX < 63) {
-            print_d_n(words, tryX);
+
+    // verification pass on all CPUs
+    pool->verify = verify;
+    pool->order = NULL;
+    collect_stage(pool, num_cpus);
+    pool->verify = NULL;
+    report_collect_error(verify, num_cpus);
+
+    // representatives: first CPU of each (package, core type) pair
+    long  count = 0;
+    for (i = 0; i < num_cpus; i++) {
+        reps[i] = -1;
+        if (verify[i].cpuid_fd == -1) continue;
+
+        signatures[i] = sample_signature(&verify[i]);
+        packages[i] = sample_package(&verify[i]);
+        for (j = 0; j < i; j++) {
+            if (reps[j] == j && packages[j] == packages[i] && verify[j].hybrid == verify[i].hybrid) {
+                reps[i] = j;
+                break;
+            }
         }
-        else {
-            print_reg_raw(reg, tryX, words);
+        if (reps[i] == -1) {
+            reps[i] = i;
+            order[count++] = i;
         }
     }
-    else if (reg == 0xe) {
-        /* Reserved: DO NOTHING */
-    }
-    else if (reg == 0xf) {
-        if (tryX == 0) {
-            printf("   Quality of Service Monitoring Resource Type (0xf/0):\n");
-            printf("      Maximum range of RMID = %u\n", words[WORD_EBX]);
-            print_f_0_edx(words[WORD_EDX]);
-        }
-        else if (tryX == 1) {
-            printf("   L3 Cache Quality of Service Monitoring (0xf/1):\n");
-            printf("      Conversion factor from IA32_QM_CTR to bytes = %u\n",
-                words[WORD_EBX]);
-            printf("      Maximum range of RMID                       = %u\n",
-                words[WORD_ECX]);
-            printf("      Counter width                               = %u\n",
-                24 + BIT_EXTRACT_LE(words[WORD_EAX], 0, 8));
-            print_f_1_eax(words[WORD_EAX]);
-            print_f_1_edx(words[WORD_EDX]);
-        }
-        else {
-            print_reg_raw(reg, tryX, words);
+    pool->order = order;
+    collect_stage(pool, count);
+
+    // escalation: signature differs from representative, or representative not collected
+    count = 0;
+    for (i = 0; i < num_cpus; i++) {
+        j = reps[i];
+        if (j == -1 || j == i) continue;
+        if (signatures[i] != signatures[j] || table->cpus[j].cpuid_fd == -1) {
+            order[count++] = i;
+            reps[i] = i;
         }
     }
-    else if (reg == 0x10) {
-        if (tryX == 0) {
-            printf("   Resource Director Technology Allocation (0x10/0):\n");
-            print_10_0_ebx(words[WORD_EBX]);
-        }
-        else if (tryX == 1 || tryX == 2) {
-            if (tryX == 1) {
-                printf("   L3 Cache Allocation Technology (0x10/1):\n");
-            }
-            else if (tryX == 2) {
-                printf("   L2 Cache Allocation Technology (0x10/2):\n");
-            }
-            print_10_n_eax(words[WORD_EAX]);
-            printf("      Bit-granular map of isolation/contention = 0x%08x\n",
-                words[WORD_EBX]);
-            print_10_n_ecx(words[WORD_ECX]);
-            print_10_n_edx(words[WORD_EDX]);
-        }
-        else if (tryX == 3) {
-            printf("   Memory Bandwidth Allocation (0x10/3):\n");
-            print_10_3_eax(words[WORD_EAX]);
-            print_10_3_ecx(words[WORD_ECX]);
-            print_10_n_edx(words[WORD_EDX]);
-        }
-        else {
-            print_reg_raw(reg, tryX, words);
+    collect_stage(pool, count);
+    pool->order = NULL;
+
+    for (i = 0; i < num_cpus; i++) {
+        j = reps[i];
+        if (j != -1 && j != i) {
+            copy_sampled(&table->cpus[i], &table->cpus[j], &verify[i]);
         }
+        free(verify[i].records);
     }
-    else if (reg == 0x12) {
-        if (tryX == 0) {
-            printf("   Software Guard Extensions (SGX) capability (0x12/0):\n");
-            print_12_0_eax(words[WORD_EAX]);
-            print_12_0_ebx(words[WORD_EBX]);
-            print_12_0_edx(words[WORD_EDX]);
-        }
-        else if (tryX == 1) {
-            printf("   SGX attributes (0x12/1):\n");
-            printf("      ECREATE SECS.ATTRIBUTES valid bit mask ="
-                " 0x%08x%08x%08x%08x\n",
-                words[WORD_EDX],
-                words[WORD_ECX],
-                words[WORD_EBX],
-                words[WORD_EAX]);
-        }
-        else {
-            if ((words[WORD_EAX] & 0xf) == 1) {
-                printf("   SGX EPC enumeration (0x12/n):\n");
-                printf("      section physical address = 0x%08x%08x\n",
-                    words[WORD_EBX], words[WORD_EAX] & 0xfffff000);
-                printf("      section size             = 0x%08x%08x\n",
-                    words[WORD_EDX], words[WORD_ECX] & 0xfffff000);
-                print_12_n_ecx(words[WORD_ECX]);
-            }
-            else {
-                print_reg_raw(reg, tryX, words);
+
+    free(packages);
+    free(signatures);
+    free(reps);
+    free(order);
+    free(verify);
+}
+
+// phase one: execute all supported CPUID functions and fill the table, without decoding
+// first CPU derives the CPUID plan, then other CPUs replay it simultaneously (workers pool)
+// table       = empty CPUID results table
+// one_cpu     = flag for single CPU mode, not duplicate CPUID execution by logical processors
+// inst        = flag for instruction mode, use CPUID instruction on physical platform
+// selects     = -l/--leaf list, NULL means all supported functions
+// num_selects = number of elements in the selects array
+// timing      = timing mode: executions of each function:subfunction, 0 = off
+// synth_only  = flag for synth-only mode, only functions used by summary, see is_synth_leaf()
+// sample      = flag for sampling mode, full collection for representative CPUs only, see collect_sampled()
+static void
+collect_table(leaf_table_t* table, intbool one_cpu, intbool inst,
+    const leaf_select_t selects[], unsigned int num_selects, unsigned int timing, intbool synth_only,
+    intbool sample)
+{
+    collect_pool_t  pool;
+    memset(&pool, 0, sizeof(pool));
+    pool.table = table;
+    pool.inst = inst;
+    pool.selects = selects;
+    pool.num_selects = num_selects;
+    pool.timing = timing;
+    pool.synth_only = synth_only;
+
+    if (one_cpu) {
+        cpu_leaves_t*  leaves = add_table_cpu(table, (inst) ? CPU_UNNUMBERED : 0);
+        long           hint = 0;
+
+        leaves->cpuid_fd = real_setup(0, one_cpu, inst, &leaves->cpuid_file);
+        if (leaves->cpuid_fd != -1) {
+            collect_selected(&pool, leaves, &hint);
+            classify_cpu(leaves);
+            if (timing > 0) {
+                time_leaves(leaves, timing);
             }
+            close_cpuid(leaves->cpuid_fd);
         }
     }
-    else if (reg == 0x14) {
-        if (tryX == 0) {
-            printf("   Intel Processor Trace (0x14):\n");
-            print_14_0_ebx(words[WORD_EBX]);
-            print_14_0_ecx(words[WORD_ECX]);
+    else {
+        unsigned int*  cpu_list = NULL;
+        unsigned int   num_cpus = get_cpu_list(inst, TRUE, &cpu_list);
+        unsigned int   i;
+        for (i = 0; i < num_cpus; i++) {
+            add_table_cpu(table, cpu_list[i]);
         }
-        else if (tryX == 1) {
-            print_14_1_eax(words[WORD_EAX]);
-            print_14_1_ebx(words[WORD_EBX]);
+        free(cpu_list);
+
+        if (sample) {
+            collect_sampled(&pool, num_cpus);
         }
         else {
-            print_reg_raw(reg, tryX, words);
+            collect_stage(&pool, num_cpus);
         }
     }
-    else if (reg == 0x15) {
-        printf("   Time Stamp Counter/Core Crystal Clock Information (0x15):\n");
-        printf("      TSC/clock ratio = %u/%u\n",
-            words[WORD_EBX], words[WORD_EAX]);
-        printf("      nominal core crystal clock = %u Hz\n", words[WORD_ECX]);
-    }
-    else if (reg == 0x16) {
-        printf("   Processor Frequency Information (0x16):\n");
-        print_16_eax(words[WORD_EAX]);
-        print_16_ebx(words[WORD_EBX]);
-        print_16_ecx(words[WORD_ECX]);
+
+    long  slot;
+    for (slot = 0; slot < MAX_PLANS; slot++) {
+        free(pool.plans[slot].queries);
     }
-    else if (reg == 0x17) {
-        if (tryX == 0) {
-            printf("   System-On-Chip Vendor Attribute (0x17/0):\n");
-            print_17_0_ebx(words[WORD_EBX]);
-            printf("      project id  = 0x%08x (%u)\n",
-                words[WORD_ECX], words[WORD_ECX]);
-            printf("      stepping id = 0x%08x (%u)\n",
-                words[WORD_EDX], words[WORD_EDX]);
-        }
-        else if (tryX == 1) {
-            memcpy(&stash->soc_brand[0], words, sizeof(unsigned int) * WORD_NUM);
-        }
-        else if (tryX == 2) {
-            memcpy(&stash->soc_brand[16], words, sizeof(unsigned int) * WORD_NUM);
-        }
-        else if (tryX == 3) {
-            memcpy(&stash->soc_brand[32], words, sizeof(unsigned int) * WORD_NUM);
-            printf("      SoC brand   = \"%s\"\n", stash->soc_brand);
-        }
-        else {
-            print_reg_raw(reg, tryX, words);
+    report_collect_error(table->cpus, table->num_cpus);
+
+    // CPU went offline or left affinity mask after enumeration, other CPUs are still decoded
+    if (!one_cpu) {
+        for (slot = 0; slot < table->num_cpus; slot++) {
+            if (table->cpus[slot].cpuid_fd == -1) {
+                fprintf(stderr,
+                    "%s: cpu %u not available, skipped\n",
+                    program, table->cpus[slot].cpu);
+            }
         }
     }
-    else if (reg == 0x18) {
-        printf("   Deterministic Address Translation Parameters (0x18/%d):\n",
-            tryX);
-        print_18_n_ebx(words[WORD_EBX]);
-        printf("      number of sets = 0x%08x (%u)\n",
-            words[WORD_ECX], words[WORD_ECX]);
-        print_18_n_edx(words[WORD_EDX]);
-    }
-    else if (reg == 0x19) {
-        printf("   Key Locker information (0x19):\n");
-        print_19_eax(words[WORD_EAX]);
-        print_19_ebx(words[WORD_EBX]);
-        print_19_ecx(words[WORD_ECX]);
-    }
-    else if (reg == 0x1a) {
-        printf("   Hybrid Information (0x1a/0):\n");
-        print_1a_0_eax(words[WORD_EAX]);
-    }
-    else if (reg == 0x1b) {
-        printf("   PCONFIG information (0x1b/n):\n");
-        print_1b_n_eax(words[WORD_EAX]);
-        printf("      identifier of target %d = 0x%08x (%u)\n",
-            3 * tryX + 1, words[WORD_EBX], words[WORD_EBX]);
-        printf("      identifier of target %d = 0x%08x (%u)\n",
-            3 * tryX + 2, words[WORD_ECX], words[WORD_ECX]);
-        printf("      identifier of target %d = 0x%08x (%u)\n",
-            3 * tryX + 3, words[WORD_EDX], words[WORD_EDX]);
-    }
-    else if (reg == 0x1c) {
-        printf("   Architectural LBR Capabilities (0x1c/0):\n");
-        print_1c_eax(words[WORD_EAX]);
-        print_1c_ebx(words[WORD_EBX]);
-        print_1c_ecx(words[WORD_ECX]);
-    }
-    else if (reg == 0x1d) {
-        if (tryX == 0) {
-            printf("      max_palette = %u\n", words[WORD_EAX]);
+}
+
+// parse -l/--leaf list: comma-separated items LEAF[-LEAF][/SUBLEAF[-SUBLEAF]], SUBLEAF can be "*"
+// for example "1,7/*,0x16,0x80000000-0x80000008", numbers are decimal, octal or hexadecimal
+// text    = argument of -l/--leaf option
+// subleaf = sub-function for items without subleaf, -s/--subleaf value or SUBLEAF_ALL
+// selects = pointer for return allocated array of list items
+// return number of list items
+static unsigned int
+parse_leaf_list(ccstring text, unsigned int subleaf, leaf_select_t** selects)
+{
+    unsigned int    count = 0;
+    leaf_select_t*  list = NULL;
+    cstring         ptr = text;
+
+    for (;;) {
+        leaf_select_t  select;
+        char*          endptr;
+        unsigned long  first;
+        unsigned long  last;
+
+        errno = 0;
+        first = strtoul(ptr, &endptr, 0);
+        last = first;
+        if (endptr != ptr && *endptr == '-') {
+            ptr = endptr + 1;
+            last = strtoul(ptr, &endptr, 0);
         }
-        else {
-            printf("      --- palette %d ---\n", tryX);
-            print_1d_n_eax(words[WORD_EAX]);
-            print_1d_n_ebx(words[WORD_EBX]);
-            print_1d_n_ecx(words[WORD_ECX]);
+        if (endptr == ptr || errno != 0 || first > 0xffffffffUL || last > 0xffffffffUL
+            || last < first || last - first >= MAX_LEAF_RANGE) {
+            break;
         }
-    }
-    else if (reg == 0x1e) {
-        printf("   TMUL Information (0x1e/0):\n");
-        print_1e_ebx(words[WORD_EBX]);
-    }
-    else if (reg == 0x1f) {
-        if (tryX == 0) {
-            // This is invariant across subleaves, so print it only once
-            printf("      x2APIC ID of logical processor = 0x%x (%u)\n",
-                words[WORD_EDX], words[WORD_EDX]);
+        select.first = (unsigned int)first;
+        select.last = (unsigned int)last;
+        select.sub_first = subleaf;
+        select.sub_last = subleaf;
+        ptr = endptr;
+
+        if (*ptr == '/') {
+            ptr++;
+            if (*ptr == '*') {
+                select.sub_first = SUBLEAF_ALL;
+                select.sub_last = SUBLEAF_ALL;
+                ptr++;
+            }
+            else {
+                first = strtoul(ptr, &endptr, 0);
+                last = first;
+                if (endptr != ptr && *endptr == '-') {
+                    ptr = endptr + 1;
+                    last = strtoul(ptr, &endptr, 0);
+                }
+                if (endptr == ptr || errno != 0 || first > 0xffffffffUL || last >= 0xffffffffUL
+                    || last < first || last - first >= MAX_LEAF_RANGE) {
+                    break;
+                }
+                select.sub_first = (unsigned int)first;
+                select.sub_last = (unsigned int)last;
+                ptr = endptr;
+            }
         }
-        printf("      --- level %d ---\n", tryX);
-        print_b_1f_ecx(words[WORD_ECX]);
-        print_b_1f_eax(words[WORD_EAX]);
-        print_b_1f_ebx(words[WORD_EBX]);
-    }
-    else if (reg == 0x20) {
-        if (tryX == 0) {
-            print_20_ebx(words[WORD_EBX]);
+
+        leaf_select_t*  grown = (leaf_select_t*)realloc(list, (count + 1) * sizeof(leaf_select_t));
+        if (grown == NULL) {
+            fprintf(stderr,
+                "%s: unable to allocate memory for leaf list\n",
+                program);
+            exit(1);
         }
-        else {
-            print_reg_raw(reg, tryX, words);
+        list = grown;
+        list[count++] = select;
+
+        if (*ptr == '\0') {
+            *selects = list;
+            return count;
         }
+        if (*ptr != ',') break;
+        ptr++;
     }
-    else if (reg == 0x20000000) {
-        // max already set to words[WORD_EAX]
-    }
-    else if (reg == 0x20000001) {
-        print_20000001_edx(words[WORD_EDX]);
-    }
-    else if (reg == 0x40000000) {
-        // max already set to words[WORD_EAX]
-        printf("   hypervisor_id = \"%-4.4s%-4.4s%-4.4s\"\n",
-            (const char*)&words[WORD_EBX],
-            (const char*)&words[WORD_ECX],
-            (const char*)&words[WORD_EDX]);
-    }
-    else if (reg == 0x40000001 && stash->hypervisor == HYPERVISOR_XEN) {
-        printf("   hypervisor version (0x40000001/eax):\n");
-        printf("      version = %d.%d\n",
-            BIT_EXTRACT_LE(words[WORD_EAX], 16, 32),
-            BIT_EXTRACT_LE(words[WORD_EAX], 0, 16));
-    }
-    else if (reg == 0x40000001 && stash->hypervisor == HYPERVISOR_KVM) {
-        print_40000001_eax_kvm(words[WORD_EAX]);
-        print_40000001_edx_kvm(words[WORD_EAX]);
-    }
-    else if (reg == 0x40000001 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        printf("   hypervisor interface identification (0x40000001/eax):\n");
-        printf("      version = \"%-4.4s\"\n",
-            (const char*)&words[WORD_EAX]);
-    }
-    else if (reg == 0x40000002 && stash->hypervisor == HYPERVISOR_XEN) {
-        printf("   hypervisor features (0x40000002):\n");
-        printf("      number of hypercall-transfer pages = 0x%0x (%u)\n",
-            words[WORD_EAX], words[WORD_EAX]);
-        printf("      MSR base address                   = 0x%0x\n",
-            words[WORD_EBX]);
-        print_40000002_ecx_xen(words[WORD_ECX]);
-    }
-    else if (reg == 0x40000003 && stash->hypervisor == HYPERVISOR_XEN
-        && tryX == 0) {
-        print_40000003_eax_xen(words[WORD_EAX]);
-        printf("      tsc mode            = 0x%0x (%u)\n",
-            words[WORD_EBX], words[WORD_EBX]);
-        printf("      tsc frequency (kHz) = %u\n",
-            words[WORD_ECX]);
-        printf("      incarnation         = 0x%0x (%u)\n",
-            words[WORD_EDX], words[WORD_EDX]);
-    }
-    else if (reg == 0x40000003 && stash->hypervisor == HYPERVISOR_XEN
-        && tryX == 1) {
-        unsigned long long  vtsc_offset
-            = ((unsigned long long)words[WORD_EAX]
-                + ((unsigned long long)words[WORD_EBX] << 32));
-        printf("      vtsc offset   = 0x%0llx (%llu)\n", vtsc_offset, vtsc_offset);
-        printf("      vtsc mul_frac = 0x%0x (%u)\n",
-            words[WORD_ECX], words[WORD_ECX]);
-        printf("      vtsc shift    = 0x%0x (%u)\n",
-            words[WORD_EDX], words[WORD_EDX]);
-    }
-    else if (reg == 0x40000003 && stash->hypervisor == HYPERVISOR_XEN
-        && tryX == 2) {
-        printf("      cpu frequency (kHZ) = %u\n", words[WORD_EAX]);
-    }
-    else if (reg == 0x40000002 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        printf("   hypervisor system identity (0x40000002):\n");
-        printf("      build          = %d\n", words[WORD_EAX]);
-        printf("      version        = %d.%d\n",
-            BIT_EXTRACT_LE(words[WORD_EBX], 16, 32),
-            BIT_EXTRACT_LE(words[WORD_EBX], 0, 16));
-        printf("      service pack   = %d\n", words[WORD_ECX]);
-        printf("      service branch = %d\n",
-            BIT_EXTRACT_LE(words[WORD_EDX], 24, 32));
-        printf("      service number = %d\n",
-            BIT_EXTRACT_LE(words[WORD_EDX], 0, 24));
-    }
-    else if (reg == 0x40000003 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        print_40000003_eax_microsoft(words[WORD_EAX]);
-        print_40000003_ebx_microsoft(words[WORD_EBX]);
-        print_40000003_ecx_microsoft(words[WORD_ECX]);
-        print_40000003_edx_microsoft(words[WORD_EDX]);
-    }
-    else if (reg == 0x40000004 && stash->hypervisor == HYPERVISOR_XEN) {
-        print_40000004_eax_xen(words[WORD_EAX]);
-        printf("      vcpu id                                = 0x%x (%u)\n",
-            words[WORD_EBX], words[WORD_EBX]);
-        printf("      domain id                              = 0x%x (%u)\n",
-            words[WORD_ECX], words[WORD_ECX]);
-    }
-    else if (reg == 0x40000004 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        print_40000004_eax_microsoft(words[WORD_EAX]);
-        printf("      maximum number of spinlock retry attempts = 0x%0x (%u)\n",
-            words[WORD_EBX], words[WORD_EBX]);
-    }
-    else if (reg == 0x40000005 && stash->hypervisor == HYPERVISOR_XEN
-        && tryX == 0) {
-        print_40000005_0_ebx_xen(words[WORD_EBX]);
-    }
-    else if (reg == 0x40000005 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        printf("   hypervisor implementation limits (0x40000005):\n");
-        printf("      maximum number of virtual processors                      "
-            " = 0x%0x (%u)\n",
-            words[WORD_EAX], words[WORD_EAX]);
-        printf("      maximum number of logical processors                      "
-            " = 0x%0x (%u)\n",
-            words[WORD_EBX], words[WORD_EBX]);
-        printf("      maximum number of physical interrupt vectors for remapping"
-            " = 0x%0x (%u)\n",
-            words[WORD_ECX], words[WORD_ECX]);
+
+    fprintf(stderr,
+        "%s: argument to -l/--leaf not understood: %s\n",
+        program, text);
+    exit(1);
+}
+
+// Print CPUID data for selected leaves (means functions)
+// all leaves of the list executed by one pass per CPU, CPUs collected simultaneously
+// selects     = -l/--leaf list, parsed by parse_leaf_list()
+// num_selects = number of elements in the selects array
+// one_cpu     = flag for single CPU mode, not duplicate CPUID execution by logical processors
+// inst        = flag for instruction mode, use CPUID instruction on pinned thread (default),
+//               else read /dev/cpu/N/cpuid of kernel module (-k)
+// raw         = flag for raw dump without decoding data, no prints if raw mode selected
+// debug       = flag for debug mode, print detail transit info
+// timing      = timing mode: executions of each function:subfunction, 0 = off
+static void
+do_real_one(const leaf_select_t selects[], unsigned int num_selects, intbool one_cpu, intbool inst, intbool raw, intbool debug UNUSED,
+    unsigned int timing)
+{
+    leaf_table_t  table = { NULL, 0 };
+    long          cpu;
+
+    collect_table(&table, one_cpu, inst, selects, num_selects, timing, FALSE, FALSE);
+    if (raw) {
+        write_raw_table(stdout, &table);
+        free_table(&table);
+        return;
     }
-    else if (reg == 0x40000006 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        print_40000006_eax_microsoft(words[WORD_EAX]);
-    }
-    else if (reg == 0x40000007 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        printf("   hypervisor root partition enlightenments (0x40000007):\n");
-        print_40000007_eax_microsoft(words[WORD_EAX]);
-        print_40000007_ebx_microsoft(words[WORD_EBX]);
-    }
-    else if (reg == 0x40000008 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        printf("   hypervisor shared virtual memory (0x40000008):\n");
-        print_40000008_eax_microsoft(words[WORD_EAX]);
-    }
-    else if (reg == 0x40000009 && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        printf("   hypervisor nested hypervisor features (0x40000009):\n");
-        print_40000009_eax_microsoft(words[WORD_EAX]);
-        print_40000009_edx_microsoft(words[WORD_EAX]);
-    }
-    else if (reg == 0x4000000a && stash->hypervisor == HYPERVISOR_MICROSOFT) {
-        printf("   hypervisor nested virtualization features (0x4000000a):\n");
-        print_4000000a_eax_microsoft(words[WORD_EAX]);
-    }
-    else if (reg == 0x40000010) {
-        printf("   hypervisor generic timing information (0x40000010):\n");
-        printf("      TSC frequency (Hz) = %d\n", words[WORD_EAX]);
-        printf("      bus frequency (Hz) = %d\n", words[WORD_EBX]);
-    }
-    else if (reg == 0x80000000) {
-        // max already set to words[WORD_EAX]
-    }
-    else if (reg == 0x80000001) {
-        print_80000001_eax(words[WORD_EAX], stash->vendor);
-        print_80000001_edx(words[WORD_EDX], stash->vendor);
-        print_80000001_ebx(words[WORD_EBX], stash->vendor, stash->val_1_eax);
-        print_80000001_ecx(words[WORD_ECX], stash->vendor);
-        stash->val_80000001_eax = words[WORD_EAX];
-        stash->val_80000001_ebx = words[WORD_EBX];
-        stash->val_80000001_ecx = words[WORD_ECX];
-        stash->val_80000001_edx = words[WORD_EDX];
-    }
-    else if (reg == 0x80000002) {
-        memcpy(&stash->brand[0], words, sizeof(unsigned int) * WORD_NUM);
-    }
-    else if (reg == 0x80000003) {
-        memcpy(&stash->brand[16], words, sizeof(unsigned int) * WORD_NUM);
-    }
-    else if (reg == 0x80000004) {
-        memcpy(&stash->brand[32], words, sizeof(unsigned int) * WORD_NUM);
-        printf("   brand = \"%s\"\n", stash->brand);
-    }
-    else if (reg == 0x80000005) {
-        print_80000005_eax(words[WORD_EAX]);
-        print_80000005_ebx(words[WORD_EBX]);
-        print_80000005_ecx(words[WORD_ECX]);
-        print_80000005_edx(words[WORD_EDX]);
-    }
-    else if (reg == 0x80000006) {
-        print_80000006_eax(words[WORD_EAX]);
-        print_80000006_ebx(words[WORD_EBX]);
-        print_80000006_ecx(words[WORD_ECX], stash);
-        print_80000006_edx(words[WORD_EDX]);
-    }
-    else if (reg == 0x80000007) {
-        print_80000007_ebx(words[WORD_EBX]);
-        print_80000007_ecx(words[WORD_ECX]);
-        print_80000007_edx(words[WORD_EDX]);
-    }
-    else if (reg == 0x80000008) {
-        print_80000008_eax(words[WORD_EAX]);
-        print_80000008_ebx(words[WORD_EBX]);
-        printf("   Size Identifiers (0x80000008/ecx):\n");
-        unsigned int  num_thrs = BIT_EXTRACT_LE(stash->val_80000008_ecx, 0, 8);
-        if (Synth_Family(stash->val_80000001_eax) > 0x16) {
-            printf("      number of threads                   = 0x%llx (%llu)\n",
-                (unsigned long long)num_thrs + 1ULL,
-                (unsigned long long)num_thrs + 1ULL);
-        }
-        else {
-            printf("      number of CPU cores                 = 0x%llx (%llu)\n",
-                (unsigned long long)num_thrs + 1ULL,
-                (unsigned long long)num_thrs + 1ULL);
+
+    model_begin();
+    for (cpu = 0; cpu < table.num_cpus; cpu++) {
+        const cpu_leaves_t*  leaves = &table.cpus[cpu];
+        code_stash_t         stash = NIL_STASH;
+        unsigned int         i;
+
+        if (leaves->cpuid_fd == -1) continue;
+
+        print_cpu_header(leaves->cpu);
+        for (i = 0; i < leaves->count; i++) {
+            print_timing(leaves, i);
+            print_reg(leaves->records[i].reg, leaves->records[i].words, raw, leaves->records[i].tryX, &stash);
         }
-        print_80000008_ecx(words[WORD_ECX]);
-        print_80000008_edx(words[WORD_EDX]);
-    }
-    else if (reg == 0x80000009) {
-        /* reserved for Intel feature flag expansion */
-    }
-    else if (reg == 0x8000000a) {
-        print_8000000a_eax(words[WORD_EAX]);
-        print_8000000a_edx(words[WORD_EDX]);
-        print_8000000a_ebx(words[WORD_EBX]);
     }
-    else if (0x8000000b <= reg && reg <= 0x80000018) {
-        /* reserved for vendors to be determined feature flag expansion */
-    }
-    else if (reg == 0x80000019) {
-        print_80000019_eax(words[WORD_EAX]);
-        print_80000019_ebx(words[WORD_EBX]);
-    }
-    else if (reg == 0x8000001a) {
-        print_8000001a_eax(words[WORD_EAX]);
-    }
-    else if (reg == 0x8000001b) {
-        print_8000001b_eax(words[WORD_EAX]);
-    }
-    else if (reg == 0x8000001c) {
-        print_8000001c_eax(words[WORD_EAX]);
-        print_8000001c_edx(words[WORD_EDX]);
-        print_8000001c_ebx(words[WORD_EBX]);
-        print_8000001c_ecx(words[WORD_ECX]);
-    }
-    else if (reg == 0x8000001d) {
-        printf("      --- cache %d ---\n", tryX);
-        print_8000001d_eax(words[WORD_EAX]);
-        print_8000001d_ebx(words[WORD_EBX]);
-        printf("      number of sets                  = %llu\n",
-            (unsigned long long)words[WORD_ECX] + 1ULL);
-        print_8000001d_edx(words[WORD_EDX]);
-        print_8000001d_synth(words);
+    model_end();
+
+    free_table(&table);
+}
+
+// phase one for file mode: read raw hex information (-r output) into CPUID results table
+// filename = file name string, "-" means stdin
+// table    = empty CPUID results table
+// quiet    = flag for return FALSE on open, read or parse errors and on empty file, table left empty,
+//            instead of error message and exit, for snapshot cache
+// return TRUE if table filled
+static intbool
+read_table(ccstring filename, leaf_table_t* table, intbool quiet)
+{
+    cpu_leaves_t*  leaves = NULL;
+    intbool        valid = TRUE;
+    /*
+    ** cpuid's old-style method of dumping raw leaves lacked an explicit
+    ** indication of the try (a.k.a. ecx) number.  For such lines, the try
+    ** number is counted per CPU for each function whose sub-functions are
+    ** enumerated without gaps, see subleaves_contiguous().
+    */
+    unsigned int  tries[LENGTH(leaf_registry)] = { 0 };
+
+    FILE* file;
+    if (strcmp(filename, "-") == 0) {
+        file = stdin;
     }
-    else if (reg == 0x8000001e) {
-        printf("   extended APIC ID = %u\n", words[WORD_EAX]);
-        if (Synth_Family(stash->val_80000001_eax) > 0x16) {
-            print_8000001e_ebx_gt_f16(words[WORD_EBX]);
-        }
-        else {
-            print_8000001e_ebx_f16(words[WORD_EBX]);
+    else {
+        file = fopen(filename, "r");
+        if (file == NULL) {
+            if (quiet) return FALSE;
+            fprintf(stderr,
+                "%s: unable to open %s; errno = %d (%s)\n",
+                program, filename, errno, strerror(errno));
+            exit(1);
         }
-        print_8000001e_ecx(words[WORD_ECX]);
-    }
-    else if (reg == 0x8000001f) {
-        printf("   AMD Secure Encryption (0x8000001f):\n");
-        print_8000001f_eax(words[WORD_EAX]);
-        print_8000001f_ebx(words[WORD_EBX]);
-        printf("      number of SEV-enabled guests supported   = 0x%0x (%u)\n",
-            words[WORD_ECX], words[WORD_ECX]);
-        printf("      minimum SEV guest ASID                   = 0x%0x (%u)\n",
-            words[WORD_EDX], words[WORD_EDX]);
     }
-    else if (reg == 0x80000020) {
-        if (tryX == 0) {
-            printf("   PQoS Enforcement for Memory Bandwidth (0x80000020):\n");
-            print_80000020_0_ebx(words[WORD_EBX]);
-        }
-        else if (tryX == 1) {
-            printf("      capacity bitmask length              = 0x%0llx (%llu)\n",
-                (unsigned long long)words[WORD_EAX] + 1,
-                (unsigned long long)words[WORD_EAX] + 1);
-            printf("      number of classes of service         = 0x%0x (%u)\n",
-                words[WORD_EDX], words[WORD_EDX]);
+
+    while (!feof(file)) {
+        char          buffer[88];
+        char* ptr;
+        int           status;
+        unsigned int  cpu;
+        unsigned int  reg;
+        unsigned int  tryX;
+        unsigned int  words[WORD_NUM];
+
+        errno = 0;
+        ptr = fgets(buffer, LENGTH(buffer), file);
+        if (ptr == NULL && errno == 0) break;
+        if (ptr == NULL) {
+            if (quiet) {
+                valid = FALSE;
+                break;
+            }
+            if (errno != EPIPE) {
+                fprintf(stderr,
+                    "%s: unable to read a line of text from %s;"
+                    " errno = %d (%s)\n",
+                    program, filename, errno, strerror(errno));
+            }
+            exit(1);
         }
-        else {
-            print_reg_raw(reg, tryX, words);
+
+        status = sscanf(ptr, "CPU %u:\r", &cpu);
+        if (status == 1 || strcmp(ptr, "CPU:\n") == SAME) {
+            leaves = add_table_cpu(table, (status == 1) ? cpu : CPU_UNNUMBERED);
+            leaves->cpuid_fd = USE_FILE;
+            memset(tries, 0, sizeof(tries));
+            continue;
         }
-    }
-    else if (reg == 0x80860000) {
-        // max already set to words[WORD_EAX]
-    }
-    else if (reg == 0x80860001) {
-        print_80860001_eax(words[WORD_EAX]);
-        print_80860001_edx(words[WORD_EDX]);
-        print_80860001_ebx_ecx(words[WORD_EBX], words[WORD_ECX]);
-    }
-    else if (reg == 0x80860002) {
-        print_80860002_eax(words[WORD_EAX], stash);
-        printf("   Transmeta CMS revision (0x80000002/ecx)"
-            " = %u.%u-%u.%u-%u\n",
-            (words[WORD_EBX] >> 24) & 0xff,
-            (words[WORD_EBX] >> 16) & 0xff,
-            (words[WORD_EBX] >> 8) & 0xff,
-            (words[WORD_EBX] >> 0) & 0xff,
-            words[WORD_ECX]);
-    }
-    else if (reg == 0x80860003) {
-        // DO NOTHING
-    }
-    else if (reg == 0x80860004) {
-        // DO NOTHING
-    }
-    else if (reg == 0x80860005) {
-        // DO NOTHING
-    }
-    else if (reg == 0x80860006) {
-        printf("   Transmeta information = \"%s\"\n", stash->transmeta_info);
-    }
-    else if (reg == 0x80860007) {
-        printf("   Transmeta core clock frequency = %u MHz\n",
-            words[WORD_EAX]);
-        printf("   Transmeta processor voltage    = %u mV\n",
-            words[WORD_EBX]);
-        printf("   Transmeta performance          = %u%%\n",
-            words[WORD_ECX]);
-        printf("   Transmeta gate delay           = %u fs\n",
-            words[WORD_EDX]);
-    }
-    else if (reg == 0xc0000000) {
-        // max already set to words[WORD_EAX]
-    }
-    else if (reg == 0xc0000001) {
-        if (stash->vendor == VENDOR_VIA) {
-            /* TODO: figure out how to decode 0xc0000001:eax */
-            printf("   0x%08x 0x%02x: eax=0x%08x\n",
-                (unsigned int)reg, tryX, words[WORD_EAX]);
-            print_c0000001_edx(words[WORD_EDX]);
+
+        // leaves before any CPU line belong to unnumbered CPU
+        if (leaves == NULL) {
+            leaves = add_table_cpu(table, CPU_UNNUMBERED);
+            leaves->cpuid_fd = USE_FILE;
         }
-        else {
-            print_reg_raw(reg, tryX, words);
+
+        status = sscanf(ptr,
+            "   0x%x 0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
+            &reg, &tryX,
+            &words[WORD_EAX], &words[WORD_EBX],
+            &words[WORD_ECX], &words[WORD_EDX]);
+        if (status == 6) {
+            add_leaf(leaves, reg, tryX, words);
+            continue;
         }
-    }
-    else if (reg == 0xc0000002) {
-        if (stash->vendor == VENDOR_VIA) {
-            printf("   VIA C7 Current Performance Data (0xc0000002):\n");
-            if (BIT_EXTRACT_LE(words[WORD_EAX], 0, 8) != 0) {
-                printf("      core temperature (degrees C)       = %f\n",
-                    (double)words[WORD_EAX] / 256.0);
+        status = sscanf(ptr,
+            "   0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
+            &reg,
+            &words[WORD_EAX], &words[WORD_EBX],
+            &words[WORD_ECX], &words[WORD_EDX]);
+        if (status == 5) {
+            const leaf_info_t*  info = lookup_leaf(reg, ANY_HYPERVISOR);
+            if (info != NULL && subleaves_contiguous(info->subleaves)) {
+                add_leaf(leaves, reg, tries[info - leaf_registry]++, words);
             }
             else {
-                printf("      core temperature (degrees C)       = %d\n",
-                    BIT_EXTRACT_LE(words[WORD_EAX], 8, 32));
+                add_leaf(leaves, reg, 0, words);
             }
-            print_c0000002_ebx(words[WORD_EBX]);
-            print_c0000002_ecx(words[WORD_ECX]);
-            print_c0000002_edx(words[WORD_EDX]);
-        }
-        else {
-            print_reg_raw(reg, tryX, words);
-        }
-    }
-    else if (reg == 0xc0000004) {
-        if (stash->vendor == VENDOR_VIA) {
-            printf("   VIA Temperature (0xc0000004/eax):\n");
-            print_c0000004_eax(words[WORD_EAX]);
-            printf("   VIA MSR 198 Mirror (0xc0000004):\n");
-            print_c0000004_ebx(words[WORD_EBX]);
-            print_c0000004_ecx(words[WORD_ECX]);
+            continue;
         }
-        else {
-            print_reg_raw(reg, tryX, words);
+
+        if (quiet) {
+            valid = FALSE;
+            break;
         }
+        fprintf(stderr,
+            "%s: unexpected input with -f option: %s\n",
+            program, ptr);
+        exit(1);
     }
-    else {
-        print_reg_raw(reg, tryX, words);
+
+    if (file != stdin) {
+        fclose(file);
     }
-}
 
-#define USE_INSTRUCTION  (-2)
+    if (quiet && (!valid || table->num_cpus == 0)) {
+        free_table(table);
+        return FALSE;
+    }
 
-#define MAX_CPUS  1024
+    report_collect_error(table->cpus, table->num_cpus);
 
-// this helper added for WinAPI support when porting from Linux to Windows
-// get number of processors by OS API
-static int
-processors_count_helper()
-{
-    SYSTEM_INFO sysinfo;
-    GetSystemInfo(&sysinfo);
-    return sysinfo.dwNumberOfProcessors;
+    long  index;
+    for (index = 0; index < table->num_cpus; index++) {
+        classify_cpu(&table->cpus[index]);
+    }
+    return TRUE;
 }
 
-
-// prepare OS for execute CPUID: set affinity mask for select CPU
-// cpu     = CPU selection number
-// one_cpu = flag for single CPU mode selected by user
-// inst    = flag for instruction mode selected by user
-// return mode selection code, yet used -1 = Error, USE_INSTRUCTION = use CPUID indtruction
-static int
-real_setup(unsigned int cpu, intbool one_cpu, intbool inst)
+#ifdef USE_SNAPSHOT_CACHE
+// update snapshot key hash by contents of text file
+// hash     = pointer to hash for update
+// filename = file name string
+// prefix   = use only lines started by this string, NULL means all lines
+// return TRUE if any line used
+static intbool
+hash_file(unsigned long long* hash, ccstring filename, ccstring prefix)
 {
-    if (inst) {
-        if (!one_cpu) {
-            /*
-            ** This test is necessary because some versions of Linux will accept
-            ** a sched_setaffinity mask that includes only nonexistent CPUs.
-            */
-            static unsigned int  num_cpus = 0;
-            if (num_cpus == 0) {
+    FILE*    file = fopen(filename, "r");
+    intbool  found = FALSE;
+    char     buffer[256];
 
-                // num_cpus = sysconf(_SC_NPROCESSORS_CONF);
-                num_cpus = processors_count_helper();          // porting changes: replace Linux API to Windows API
+    if (file == NULL) return FALSE;
 
-            }
-            if (cpu >= num_cpus) return -1;
+    while (fgets(buffer, LENGTH(buffer), file) != NULL) {
+        if (prefix == NULL || strncmp(buffer, prefix, strlen(prefix)) == SAME) {
+            *hash = hash_bytes(*hash, buffer, strlen(buffer));
+            found = TRUE;
+        }
+    }
 
-#ifdef USE_KERNEL_SCHED_SETAFFINITY
-            // start of fragment, yet not ported from Linux to Windows
-                        /*
-                        ** The interface for sched_setaffinity and cpusets has changed many
-                        ** times.  Insulate this tool from all that by calling the system
-                        ** service directly.
-                        */
-            unsigned int  mask[MAX_CPUS / (sizeof(unsigned int) * 8)];
-            bzero(&mask, sizeof(mask));
-            mask[cpu / (sizeof(unsigned int) * 8)]
-                = (1 << cpu % (sizeof(unsigned int) * 8));
-
-            int  status;
-            status = syscall(__NR_sched_setaffinity, 0, sizeof(mask), &mask);
-            //
-            // end of fragment, yet not ported from Linux to Windows
-#endif
-//
-
-            // #elif defined(__sun)
-// start of fragment, yet not ported from Linux to Windows
-//            pthread_t thread = pthread_self();
-//            int status = processor_bind(P_LWPID, thread, cpu, NULL);
-// end of fragment, yet not ported from Linux to Windows
-// #else
-            // cpu_set_t  cpuset;
-            // CPU_ZERO(&cpuset);
-            // CPU_SET(cpu, &cpuset);
-            // int  status;
-            // status = sched_setaffinity(0, sizeof(cpu_set_t), &cpuset);
+    fclose(file);
+    return found;
+}
 
-// start of porting fragment, yet for single processor group only (yet max. 64 logical processors)
+// build snapshot file name for current key: boot ID, microcode revisions, online CPUs, CPUs permitted
+// by affinity mask and cpuset (instruction mode), and CPUID method: instruction (-i) and kernel
+// module (-k) snapshots never share key, whatever CPUID_DEV_DIR names
+// name is snapshot-BOOT-KEY: BOOT is hash of boot ID only, so snapshots of other modes of this boot are kept
+// inst = flag for instruction mode, see real_setup()
+// path = buffer for return snapshot file name
+// size = size of buffer
+// return TRUE if key available, FALSE means no cache (for example no boot ID)
+static intbool
+snapshot_path(intbool inst, char path[], size_t size)
+{
+    unsigned long long  hash = HASH_INIT;
 
-            // affinization variant 1, not effective
-            //HANDLE hThread = GetCurrentThread();
-            //int status = -1;
-            //if (hThread != NULL)
-            //    status = SetThreadIdealProcessor(hThread, cpu);
+    if (!hash_file(&hash, "/proc/sys/kernel/random/boot_id", NULL)) return FALSE;
+    unsigned long long  boot = hash;
+    hash_file(&hash, "/proc/cpuinfo", "microcode");
+    hash_file(&hash, "/sys/devices/system/cpu/online", NULL);
 
-            // affinization variant 2, effective
-            HANDLE hThread = GetCurrentThread();
-            DWORD_PTR status = -1;
-            DWORD_PTR cpumask = 1;
-            cpumask <<= cpu;
-            if (hThread != NULL)
-                status = SetThreadAffinityMask(hThread, cpumask);
+    unsigned int*  cpus = NULL;
+    unsigned int   count = get_cpu_list(inst, FALSE, &cpus);
+    hash = hash_bytes(hash, cpus, count * sizeof(unsigned int));
+    free(cpus);
 
-            // end of porting fragment, yet for single processor group only (yet max. 64 logical processors)
-            // #endif
+    ccstring  method = (inst) ? "inst" : cpuid_dev_dir;
+    hash = hash_bytes(hash, &inst, sizeof(inst));
+    hash = hash_bytes(hash, method, strlen(method) + 1);
+    hash = hash_bytes(hash, VERSTR2, strlen(VERSTR2));
 
-            //if (status == -1) {
-            if (status == 0) {
-                if (cpu > 0) {
-                    if (errno == EINVAL) return -1;
-                }
+    snprintf(path, size, "%s/snapshot-%016llx-%016llx", snapshot_dir, boot, hash);
+    return TRUE;
+}
 
-                fprintf(stderr,
-                    "%s: unable to setaffinity to cpu %d; errno = %d (%s)\n",
-                    program, cpu, errno, strerror(errno));
-                fprintf(stderr,
-                    "%s: using -1 will avoid trying to setaffinity and run"
-                    " on an arbitrary CPU\n",
-                    program);
-                exit(1);
-            }
+// save CPUID results table to snapshot cache, remove snapshots of previous boots
+// cache is optional: no messages if directory not writable
+// path  = snapshot file name, built by snapshot_path()
+// table = CPUID results table
+static void
+write_snapshot(ccstring path, const leaf_table_t* table)
+{
+    char  temp[FILENAME_MAX];
+    long  cpu;
 
-            // sleep(0); /* to have a chance to migrate */
-            Sleep(0);    // porting from Linux to Windows
+    // table with skipped CPUs is not saved, next run collects again
+    for (cpu = 0; cpu < table->num_cpus; cpu++) {
+        if (table->cpus[cpu].cpuid_fd == -1) return;
+    }
 
-        }
+    mkdir(snapshot_dir, 0755);
 
-        return USE_INSTRUCTION;
-    }
-    else {
+    // write to temporary file and rename, so readers never see partial snapshot
+    if (snprintf(temp, LENGTH(temp), "%s.XXXXXX", path) >= (int)LENGTH(temp)) return;
+    int  fd = mkstemp(temp);
+    if (fd == -1) return;
 
-        // start of fragment, yet not ported from Linux to Windows
-#ifdef USE_CPUID_MODULE
-        int    cpuid_fd = -1;
-        char   cpuid_name[20];
+    FILE*  file = fdopen(fd, "w");
+    if (file == NULL) {
+        close(fd);
+        unlink(temp);
+        return;
+    }
+    intbool  written = write_raw_table(file, table);
+    fchmod(fd, 0644);
+    if (fclose(file) != 0 || !written || rename(temp, path) != 0) {
+        unlink(temp);
+        return;
+    }
 
-        if (cpuid_fd == -1 && cpu == 0) {
-            cpuid_fd = open("/dev/cpuid", O_RDONLY);
-            if (cpuid_fd == -1 && errno != ENOENT) {
-                fprintf(stderr,
-                    "%s: cannot open /dev/cpuid; errno = %d (%s)\n",
-                    program, errno, strerror(errno));
-                explain_dev_cpu_errno();
-            }
+    DIR*  dir = opendir(snapshot_dir);
+    if (dir == NULL) return;
+
+    // prefix "snapshot-BOOT-" of current boot, see snapshot_path()
+    ccstring        name = strrchr(path, '/') + 1;
+    size_t          prefix = strrchr(name, '-') - name + 1;
+    struct dirent*  entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strncmp(entry->d_name, "snapshot-", 9) == SAME && strncmp(entry->d_name, name, prefix) != SAME) {
+            char  stale[FILENAME_MAX];
+            snprintf(stale, LENGTH(stale), "%s/%s", snapshot_dir, entry->d_name);
+            unlink(stale);
         }
+    }
+    closedir(dir);
+}
+#endif
 
-        if (cpuid_fd == -1) {
-            sprintf(cpuid_name, "/dev/cpu/%u/cpuid", cpu);
-            cpuid_fd = open(cpuid_name, O_RDONLY);
-            if (cpuid_fd == -1) {
-                if (cpu > 0) {
-                    if (errno == ENXIO)  return -1;
-                    if (errno == ENODEV) return -1;
-                }
-                if (errno != ENOENT) {
-                    fprintf(stderr,
-                        "%s: cannot open /dev/cpuid or %s; errno = %d (%s)\n",
-                        program, cpuid_name, errno, strerror(errno));
-                    explain_dev_cpu_errno();
-                }
-            }
+// Print CPUID data of physical platform: CPUID instruction on pinned thread per CPU,
+// or /dev/cpu/N/cpuid of kernel module, file method (-f) handled by do_file()
+// two phases: collect_table() executes CPUID, print_table() decodes, so pinned threads not wait for output
+// one_cpu = flag for single CPU mode, not duplicate CPUID execution by logical processors
+// inst    = flag for instruction mode, use CPUID instruction on pinned thread (default),
+//           else read /dev/cpu/N/cpuid of kernel module (-k)
+// raw     = flag for raw dump without decoding data, no prints if raw mode selected
+// debug   = flag for debug mode, print detail transit info
+// unique  = flag for decode identical CPUs once, not used in raw mode
+// types   = flag for decode once per hybrid core type, not used in raw mode
+// cache   = flag for use snapshot cache, not used in single CPU, timing and sampling modes
+// timing  = timing mode: executions of each function:subfunction, 0 = off
+// synth_only = flag for synth-only mode: query only functions used by summary, print summary only
+// sample  = flag for sampling mode: full collection for representative CPUs only, not used in single CPU mode
+static void
+do_real(intbool one_cpu, intbool inst, intbool raw, intbool debug, intbool unique, intbool types, intbool cache UNUSED,
+    unsigned int timing, intbool synth_only, intbool sample)
+{
+    leaf_table_t  table = { NULL, 0 };
+    intbool       loaded = FALSE;
+
+#ifdef USE_SNAPSHOT_CACHE
+    // decode from snapshot if it exists for current key, no affinity changes
+    char     path[FILENAME_MAX];
+    intbool  cached = cache && !one_cpu && timing == 0 && !synth_only && !sample
+        && snapshot_path(inst, path, LENGTH(path));
+    if (cached && access(path, R_OK) == 0) {
+        // damaged snapshot removed, then collected and written again
+        loaded = read_table(path, &table, TRUE);
+        if (!loaded) {
+            unlink(path);
         }
+    }
+#endif
 
-        if (cpuid_fd == -1) {
-            /*
-            ** Lots of Linux's omit the /dev/cpuid or /dev/cpu/%u/cpuid files.
-            ** Try creating a temporary file with mknod.
-            **
-            ** mkstemp is of absolutely no security value here because I can't
-            ** use the actual file it generates, and have to delete it and
-            ** re-create it with mknod.  But I have to use it anyway to
-            ** eliminate errors from smartypants gcc/glibc during the link if I
-            ** attempt to use tempnam.
-            */
-            char  tmpname[20];
-            int   dummy_fd;
-            strcpy(tmpname, "/tmp/cpuidXXXXXX");
-            dummy_fd = mkstemp(tmpname);
-            if (dummy_fd != -1) {
-                close(dummy_fd);
-                remove(tmpname);
-                {
-                    int  status = mknod(tmpname,
-                        (S_IFCHR | S_IRUSR),
-                        makedev(CPUID_MAJOR, cpu));
-                    if (status == 0) {
-                        cpuid_fd = open(tmpname, O_RDONLY);
-                        remove(tmpname);
-                    }
-                }
-            }
-            if (cpuid_fd == -1) {
-                if (cpu > 0) {
-                    if (errno == ENXIO)  return -1;
-                    if (errno == ENODEV) return -1;
-                }
-                fprintf(stderr,
-                    "%s: cannot open /dev/cpuid or %s; errno = %d (%s)\n",
-                    program, cpuid_name, errno, strerror(errno));
-                explain_dev_cpu_errno();
-            }
+    if (!loaded) {
+        collect_table(&table, one_cpu, inst, NULL, 0, timing, synth_only, sample);
+#ifdef USE_SNAPSHOT_CACHE
+        if (cached) {
+            write_snapshot(path, &table);
         }
-
-        return cpuid_fd;
-#else
-        return -1;
 #endif
-        // end of fragment, yet not ported from Linux to Windows
     }
+    model_begin();
+    print_table(&table, raw, debug, unique, types, synth_only);
+    model_end();
+    free_table(&table);
 }
 
-// Get CPUID data, yet ported one method only: direct execute CPUID instruction
-// file method (get data from text file) YET NOT SUPPORTED.
-// reg = function code for CPUID instruction, input EAX for CPUID instruction
-// ecx = sub-function code for CPUID instruction, input ECX for CPUID instruction
-// words[] = array of 4 32-bit double words, return EAX, EBX, ECX, EDX registers after CPUID execution
-static int real_get(int cpuid_fd, unsigned int reg, unsigned int words[], unsigned int ecx, intbool quiet)
+
+// Print CPUID data from text file, raw hex information (-r output)
+// two phases, same as do_real(): read_table() parses file, print_table() decodes
+// filename = file name string
+// raw      = flag for raw dump without decoding data, no prints if raw mode selected
+// debug    = flag for debug mode, print detail transit info
+// unique   = flag for decode identical CPUs once, not used in raw mode
+// types    = flag for decode once per hybrid core type, not used in raw mode
+// synth    = flag for print summary (do_final) only, not used in raw mode
+static void
+do_file(ccstring filename, intbool raw, intbool debug, intbool unique, intbool types, intbool synth)
 {
-    if (cpuid_fd == USE_INSTRUCTION)
-    {
+    leaf_table_t  table = { NULL, 0 };
 
-#if defined(__GNUC__)
-        __cpuid_count(reg, ecx, words[0], words[1], words[2], words[3]);      // use GNU intrinsic
-#else
-        __cpuidex((int*)words, reg, ecx);                                     // use Microsoft intrinsic
-#endif
+    read_table(filename, &table, FALSE);
+    model_begin();
+    print_table(&table, raw, debug, unique, types, synth);
+    model_end();
+    free_table(&table);
+}
 
-        return TRUE;
-    }
-    else
-    {
-        return FALSE;
-    }
 
-    /*
-    // yet ported one method only: direct execute CPUID instruction
-    // file method (get data from text file) YET NOT SUPPORTED.
-
-        if (cpuid_fd == USE_INSTRUCTION) {
-                bzero(words, sizeof(unsigned int) * WORD_NUM);
-        #ifdef USE_CPUID_COUNT
-                __cpuid_count(reg, ecx,
-                    words[WORD_EAX],
-                    words[WORD_EBX],
-                    words[WORD_ECX],
-                    words[WORD_EDX]);
-        #else
-                asm("cpuid"
-                    : "=a" (words[WORD_EAX]),
-                    "=b" (words[WORD_EBX]),
-                    "=c" (words[WORD_ECX]),
-                    "=d" (words[WORD_EDX])
-                    : "a" (reg),
-                    "c" (ecx));
-        #endif
-            }
-            else {
-                off64_t  result;
-                off64_t  offset = ((off64_t)ecx << 32) + reg;
-                int      status;
-
-                result = lseek64(cpuid_fd, offset, SEEK_SET);
-                if (result == -1) {
-                    if (quiet) {
-                        return FALSE;
-                    }
-                    else {
-                        fprintf(stderr,
-                            "%s: unable to seek cpuid file to offset 0x%llx;"
-                            " errno = %d (%s)\n",
-                            program, (long long unsigned)offset,
-                            errno, strerror(errno));
-                        exit(1);
-                    }
-                }
+#ifdef USE_SYSFS_TOPOLOGY
+// maximum number of caches per logical processor, sysfs cache/indexM directories
+#define MAX_SYSFS_CACHES  8
 
-                unsigned int  old_words[WORD_NUM];
-                if (ecx != 0) memcpy(old_words, words, sizeof(old_words));
+// one cache of logical processor, from sysfs cache/indexM directory
+typedef struct {
+    unsigned int  level;          // cache level, 1 = L1
+    unsigned int  type;           // cache type, same encoding as CPUID function 4: 1 = data, 2 = instruction, 3 = unified
+    unsigned int  size;           // cache size in KB
+    unsigned int  ways;           // ways of associativity
+    unsigned int  line_size;      // coherency line size in bytes
+    unsigned int  sets;           // number of sets
+    unsigned int  first_shared;   // first logical processor sharing this cache, identifies cache instance
+    unsigned int  num_shared;     // number of online logical processors sharing this cache
+} sysfs_cache_t;
+
+// topology and caches of one logical processor, from sysfs cpuN/topology and cpuN/cache
+typedef struct {
+    unsigned int   cpu;           // logical processor number
+    int            package;       // physical package ID, -1 if unknown
+    int            die;           // die ID in package, -1 if unknown
+    int            core;          // core ID in die or package, -1 if unknown
+    unsigned int   first_thread;  // first logical processor of the core
+    unsigned int   num_threads;   // number of online logical processors of the core
+    unsigned int   num_caches;    // number of used elements in caches array
+    sysfs_cache_t  caches[MAX_SYSFS_CACHES];
+} sysfs_cpu_t;
+
+// read first line of sysfs attribute file
+// cpu    = logical processor number
+// name   = attribute path relative to /sys/devices/system/cpu/cpuN
+// buffer = buffer for return line
+// size   = size of buffer
+// return TRUE if attribute read
+static intbool
+read_sysfs_attr(unsigned int cpu, ccstring name, char buffer[], size_t size)
+{
+    char  path[FILENAME_MAX];
+    snprintf(path, LENGTH(path), "/sys/devices/system/cpu/cpu%u/%s", cpu, name);
 
-                status = read(cpuid_fd, words, 16);
-                if (status == -1) {
-                    if (quiet) {
-                        return FALSE;
-                    }
-                    else {
-                        fprintf(stderr,
-                            "%s: unable to read cpuid file at offset 0x%llx;"
-                            " errno = %d (%s)\n",
-                            program, (long long unsigned)offset,
-                            errno, strerror(errno));
-                        exit(1);
-                    }
-                }
+    FILE*  file = fopen(path, "r");
+    if (file == NULL) return FALSE;
 
-                if (ecx != 0 && memcmp(old_words, words, sizeof(old_words)) == 0) {
-                    if (quiet) {
-                        return FALSE;
-                    }
-                    else {
-                        static intbool  said = FALSE;
-                        if (!said) {
-                            fprintf(stderr,
-                                "%s: reading cpuid file at offset 0x%llx produced"
-                                " duplicate results\n",
-                                program, (long long unsigned)offset);
-                            fprintf(stderr,
-                                "%s: older kernels do not support cpuid ecx control\n",
-                                program);
-                            fprintf(stderr,
-                                "%s: consider not using -k\n",
-                                program);
-                            said = TRUE;
-                        }
-                        bzero(words, sizeof(old_words));
-                        return FALSE;
-                    }
-                }
-            }
+    intbool  success = fgets(buffer, (int)size, file) != NULL;
+    fclose(file);
+    return success;
+}
 
-            return TRUE;
+// read numeric sysfs attribute, "48K" is 48 (unit suffix ignored)
+// cpu  = logical processor number
+// name = attribute path relative to /sys/devices/system/cpu/cpuN
+// return attribute value, -1 if not available
+static int
+read_sysfs_number(unsigned int cpu, ccstring name)
+{
+    char  buffer[64];
+    if (!read_sysfs_attr(cpu, name, buffer, LENGTH(buffer))) return -1;
+    return atoi(buffer);
+}
 
-    // yet ported one method only: direct execute CPUID instruction
-    // file method (get data from text file) YET NOT SUPPORTED.
-    */
+// read sysfs CPU list attribute, for example shared_cpu_list
+// cpu   = logical processor number
+// name  = attribute path relative to /sys/devices/system/cpu/cpuN
+// first = pointer for return first logical processor of the list
+// return number of logical processors in the list, 0 if not available
+static unsigned int
+read_sysfs_cpus(unsigned int cpu, ccstring name, unsigned int* first)
+{
+    char           buffer[4096];
+    unsigned int*  cpus = NULL;
+    unsigned int   count = 0;
 
+    if (read_sysfs_attr(cpu, name, buffer, LENGTH(buffer))) {
+        count = parse_cpu_list(buffer, &cpus);
+    }
+    *first = (count > 0) ? cpus[0] : cpu;
+    free(cpus);
+    return count;
 }
 
-// print CPUID function name (information header)
-// reg  = CPUID function number
-// tryX = CPUID sub-function number
-// raw  = flag for raw dump without decoding data, no prints if raw mode selected
+// collect topology and caches of one logical processor from sysfs, no CPUID execution
+// cpu  = logical processor number
+// info = structure for return results
 static void
-print_header(unsigned int reg, unsigned int tryX, intbool raw)
+read_sysfs_cpu(unsigned int cpu, sysfs_cpu_t* info)
 {
-    if (!raw) {
-        if (reg == 2 && tryX == 0) {
-            printf("   cache and TLB information (2):\n");
-        }
-        else if (reg == 4 && tryX == 0) {
-            printf("   deterministic cache parameters (4):\n");
-        }
-        else if (reg == 7 && tryX == 0) {
-            printf("   extended feature flags (7):\n");
-        }
-        else if (reg == 0xb && tryX == 0) {
-            printf("   x2APIC features / processor topology (0xb):\n");
-        }
-        else if (reg == 0x1d && tryX == 0) {
-            printf("   Tile Information (0x1d/0):\n");
-        }
-        else if (reg == 0x1f && tryX == 0) {
-            printf("   V2 extended topology (0x1f):\n");
-        }
-        else if (reg == 0x20 && tryX == 0) {
-            printf("   Processor History Reset information (0x20):\n");
-        }
-        else if (reg == 0x40000003 && tryX == 0) {
-            printf("   hypervisor time features (0x40000003/00):\n");
-        }
-        else if (reg == 0x40000003 && tryX == 1) {
-            printf("   hypervisor time scale & offset (0x40000003/01):\n");
-        }
-        else if (reg == 0x40000003 && tryX == 2) {
-            printf("   hypervisor time physical cpu frequency (0x40000003/02):\n");
-        }
-        else if (reg == 0x8000001d && tryX == 0) {
-            printf("   Cache Properties (0x8000001d):\n");
-        }
+    unsigned int  index;
+
+    memset(info, 0, sizeof(sysfs_cpu_t));
+    info->cpu = cpu;
+    info->package = read_sysfs_number(cpu, "topology/physical_package_id");
+    info->die = read_sysfs_number(cpu, "topology/die_id");
+    info->core = read_sysfs_number(cpu, "topology/core_id");
+    info->num_threads = read_sysfs_cpus(cpu, "topology/thread_siblings_list", &info->first_thread);
+
+    for (index = 0; index < MAX_SYSFS_CACHES; index++) {
+        char  name[64];
+        char  type[64];
+
+        snprintf(name, LENGTH(name), "cache/index%u/type", index);
+        if (!read_sysfs_attr(cpu, name, type, LENGTH(type))) break;
+
+        sysfs_cache_t*  cache = &info->caches[info->num_caches++];
+        cache->type = (strncmp(type, "Data", 4) == SAME) ? 1
+                    : (strncmp(type, "Instruction", 11) == SAME) ? 2 : 3;
+        snprintf(name, LENGTH(name), "cache/index%u/level", index);
+        cache->level = read_sysfs_number(cpu, name);
+        snprintf(name, LENGTH(name), "cache/index%u/size", index);
+        cache->size = read_sysfs_number(cpu, name);
+        snprintf(name, LENGTH(name), "cache/index%u/ways_of_associativity", index);
+        cache->ways = read_sysfs_number(cpu, name);
+        snprintf(name, LENGTH(name), "cache/index%u/coherency_line_size", index);
+        cache->line_size = read_sysfs_number(cpu, name);
+        snprintf(name, LENGTH(name), "cache/index%u/number_of_sets", index);
+        cache->sets = read_sysfs_number(cpu, name);
+        snprintf(name, LENGTH(name), "cache/index%u/shared_cpu_list", index);
+        cache->num_shared = read_sysfs_cpus(cpu, name, &cache->first_shared);
     }
 }
 
-// Print CPUID data for one leaf (means one function)
-// reg     = CPUID function number
-// tryX    = CPUID sub-function number
-// one_cpu = flag for single CPU mode, not duplicate CPUID execution by logical processors
-// inst    = flag for instruction mode, use CPUID instruction on physical platform
-//           INSTRUCTION MODE IS DEFAULT MODE, ONLY THIS MODE YET SUPPORTED
-// raw     = flag for raw dump without decoding data, no prints if raw mode selected
-// debug   = flag for debug mode, print detail transit info
-static void
-do_real_one(unsigned int reg, unsigned int tryX, intbool one_cpu, intbool inst, intbool raw, intbool debug UNUSED)
+// name of cache type, CPUID function 4 encoding
+// type = cache type: 1 = data, 2 = instruction, 3 = unified
+// return name string
+static cstring
+cache_type_name(unsigned int type)
 {
-    unsigned int  cpu;
+    switch (type) {
+    case 1:  return "data";
+    case 2:  return "instruction";
+    default: return "unified";
+    }
+}
 
-    for (cpu = 0;; cpu++) {
-        int            cpuid_fd = -1;
-        code_stash_t   stash = NIL_STASH;
+// print cross-check line: value from sysfs and from CPUID
+// name   = checked item name
+// sysfs  = value from sysfs
+// cpuid  = value from CPUID
+// return TRUE if values are equal
+static intbool
+print_sysfs_check(ccstring name, unsigned int sysfs, unsigned int cpuid)
+{
+    printf("      %-34s sysfs %8u, CPUID %8u: %s\n",
+        name, sysfs, cpuid, (sysfs == cpuid) ? "match" : "MISMATCH");
+    return sysfs == cpuid;
+}
 
-        if (one_cpu && cpu > 0) break;
+// cross-check topology and caches of one logical processor: sysfs against CPUID results
+// caches from CPUID function 4 (Intel) or 8000001Dh (AMD, Hygon), threads from CPUID function 0Bh
+// infos    = sysfs topology and caches of online logical processors
+// num_cpus = number of elements in the infos array
+// info     = sysfs topology and caches of the logical processor which executed CPUID
+// leaves   = CPUID results of the same logical processor
+// return number of mismatches
+static unsigned int
+check_sysfs_cpu(const sysfs_cpu_t infos[], unsigned int num_cpus, const sysfs_cpu_t* info,
+    const cpu_leaves_t* leaves)
+{
+    unsigned int  mismatches = 0;
+    unsigned int  reg = 4;
+    unsigned int  i;
 
-        cpuid_fd = real_setup(cpu, one_cpu, inst);
-        if (cpuid_fd == -1) break;
+    const leaf_record_t*  record = find_leaf(leaves, 4, 0);
+    if (record == NULL || BIT_EXTRACT_LE(record->words[WORD_EAX], 0, 5) == 0) {
+        reg = 0x8000001d;
+    }
 
-        if (inst && one_cpu) {
-            printf("CPU:\n");
+    for (i = 0; i < leaves->count; i++) {
+        record = &leaves->records[i];
+        if (record->reg != reg) continue;
+
+        unsigned int  type = BIT_EXTRACT_LE(record->words[WORD_EAX], 0, 5);
+        unsigned int  level = BIT_EXTRACT_LE(record->words[WORD_EAX], 5, 8);
+        if (type == 0) continue;
+
+        unsigned int  ways = BIT_EXTRACT_LE(record->words[WORD_EBX], 22, 32) + 1;
+        unsigned int  partitions = BIT_EXTRACT_LE(record->words[WORD_EBX], 12, 22) + 1;
+        unsigned int  line_size = BIT_EXTRACT_LE(record->words[WORD_EBX], 0, 12) + 1;
+        unsigned int  sets = record->words[WORD_ECX] + 1;
+        unsigned int  size = (unsigned int)((unsigned long long)ways * partitions * line_size * sets / 1024);
+
+        const sysfs_cache_t*  cache = NULL;
+        unsigned int          j;
+        for (j = 0; j < info->num_caches; j++) {
+            if (info->caches[j].level == level && info->caches[j].type == type) {
+                cache = &info->caches[j];
+                break;
+            }
         }
-        else {
-            printf("CPU %u:\n", cpu);
+
+        char  name[64];
+        snprintf(name, LENGTH(name), "L%u %s cache", level, cache_type_name(type));
+        if (cache == NULL) {
+            printf("      %-34s not in sysfs: MISMATCH\n", name);
+            mismatches++;
+            continue;
         }
 
-        unsigned int  words[WORD_NUM];
-        real_get(cpuid_fd, reg, words, tryX, FALSE);
-        print_reg(reg, words, raw, tryX, &stash);
+        char  item[96];
+        snprintf(item, LENGTH(item), "%s size (KB):", name);
+        mismatches += !print_sysfs_check(item, cache->size, size);
+        snprintf(item, LENGTH(item), "%s ways:", name);
+        mismatches += !print_sysfs_check(item, cache->ways, ways);
+        snprintf(item, LENGTH(item), "%s line size:", name);
+        mismatches += !print_sysfs_check(item, cache->line_size, line_size);
+        snprintf(item, LENGTH(item), "%s sets:", name);
+        mismatches += !print_sysfs_check(item, cache->sets, sets);
+    }
+
+    // CPUID function 0Bh: logical processors at SMT level (type 1), and at last level (package)
+    unsigned int  tryX;
+    unsigned int  threads = 0;
+    unsigned int  package = 0;
+    for (tryX = 0; (record = find_leaf(leaves, 0xb, tryX)) != NULL; tryX++) {
+        unsigned int  type = BIT_EXTRACT_LE(record->words[WORD_ECX], 8, 16);
+        if (type == 0) break;
+        if (type == 1) threads = BIT_EXTRACT_LE(record->words[WORD_EBX], 0, 16);
+        package = BIT_EXTRACT_LE(record->words[WORD_EBX], 0, 16);
     }
+    // offline CPUs or disabled SMT are reported as mismatch, sysfs counts online CPUs only
+    if (threads > 0) {
+        mismatches += !print_sysfs_check("logical processors per core:", info->num_threads, threads);
+    }
+    if (package > 0) {
+        unsigned int  count = 0;
+        for (i = 0; i < num_cpus; i++) {
+            if (infos[i].package == info->package) count++;
+        }
+        mismatches += !print_sysfs_check("logical processors per package:", count, package);
+    }
+
+    return mismatches;
 }
 
-// Print CPUID data, yet ported one method only: direct execute CPUID instruction
-// file method (get data from text file) YET NOT SUPPORTED.
-// one_cpu = flag for single CPU mode, not duplicate CPUID execution by logical processors
-// inst    = flag for instruction mode, use CPUID instruction on physical platform
-//           INSTRUCTION MODE IS DEFAULT MODE, ONLY THIS MODE YET SUPPORTED
-// raw     = flag for raw dump without decoding data, no prints if raw mode selected
-// debug   = flag for debug mode, print detail transit info
+// print topology and caches of all online logical processors read from sysfs, without affinity changes,
+// then cross-check logical processor which executed CPUID
+// infos    = sysfs topology and caches of online logical processors, ascending order
+// num_cpus = number of elements in the infos array
 static void
-do_real(intbool one_cpu, intbool inst, intbool raw, intbool debug)
+print_sysfs_table(const sysfs_cpu_t infos[], unsigned int num_cpus)
 {
-    unsigned int  cpu;
-
-    for (cpu = 0;; cpu++) {
-        int            cpuid_fd = -1;
-        code_stash_t   stash = NIL_STASH;
-        unsigned int   max;
-        unsigned int   reg;
-
-        if (one_cpu && cpu > 0) break;
+    unsigned int  i;
+    unsigned int  j;
 
-        cpuid_fd = real_setup(cpu, one_cpu, inst);
-        if (cpuid_fd == -1) break;
+    printf("sysfs topology (%u online CPUs):\n", num_cpus);
+    for (i = 0; i < num_cpus; i++) {
+        const sysfs_cpu_t*  info = &infos[i];
+        printf("   CPU %u: package %d, die %d, core %d, %u thread(s) from CPU %u\n",
+            info->cpu, info->package, info->die, info->core, info->num_threads, info->first_thread);
+    }
 
-        if (inst && one_cpu) {
-            printf("CPU:\n");
+    // each cache instance once: listed by its first sharing CPU
+    printf("sysfs caches:\n");
+    for (i = 0; i < num_cpus; i++) {
+        const sysfs_cpu_t*  info = &infos[i];
+        for (j = 0; j < info->num_caches; j++) {
+            const sysfs_cache_t*  cache = &info->caches[j];
+            if (cache->first_shared != info->cpu) continue;
+
+            printf("   L%u %-11s %6u KB, %2u-way, %3u byte lines, %6u sets, %u CPU(s) from CPU %u\n",
+                cache->level, cache_type_name(cache->type), cache->size, cache->ways,
+                cache->line_size, cache->sets, cache->num_shared, cache->first_shared);
         }
-        else {
-            printf("CPU %u:\n", cpu);
-        }
-
-        // enumerate standard CPUID functions at theoretical range 00000000h - 3FFFFFFFh
-        max = 0;
-        for (reg = 0; reg <= max; reg++) {
-            unsigned int  words[WORD_NUM];
-
-            real_get(cpuid_fd, reg, words, 0, FALSE);
-
-            if (reg == 0) {
-                max = words[WORD_EAX];  // update maximum function number
-            }
-
-            if (reg == 2) {
-                unsigned int  max_tries = words[WORD_EAX] & 0xff;
-                unsigned int  tryX = 0;
+    }
+}
 
-                print_header(reg, tryX, raw);
+// Print topology and caches of all CPUs from sysfs, CPUID executed on one CPU only for cross-check:
+// no affinity changes, so it is usable in restricted containers
+// inst = flag for instruction mode: CPUID on current CPU, else kernel cpuid driver of CPU 0
+static void
+do_sysfs(intbool inst)
+{
+    unsigned int*  cpus = NULL;
+    unsigned int   num_cpus = get_online_cpu_list(&cpus);
+    if (num_cpus == 0) {
+        fprintf(stderr,
+            "%s: unable to read online cpus from /sys/devices/system/cpu/online\n",
+            program);
+        exit(1);
+    }
 
-                for (;;) {
-                    print_reg(reg, words, raw, tryX, &stash);
+    sysfs_cpu_t*  infos = (sysfs_cpu_t*)malloc(num_cpus * sizeof(sysfs_cpu_t));
+    if (infos == NULL) {
+        fprintf(stderr,
+            "%s: unable to allocate memory for %u cpus\n",
+            program, num_cpus);
+        exit(1);
+    }
+    unsigned int  i;
+    for (i = 0; i < num_cpus; i++) {
+        read_sysfs_cpu(cpus[i], &infos[i]);
+    }
+    free(cpus);
+
+    // CPUID on one CPU: instruction mode uses current CPU, repeated if migrated meanwhile
+    leaf_table_t  table = { NULL, 0 };
+    int           cpu = 0;
+    int           tries;
+    for (tries = 0; tries < 8; tries++) {
+        if (inst) cpu = sched_getcpu();
+        collect_table(&table, TRUE, inst, NULL, 0, 0, FALSE, FALSE);
+        if (!inst || sched_getcpu() == cpu) break;
+        free_table(&table);
+    }
 
-                    tryX++;
-                    if (tryX >= max_tries) break;
+    print_sysfs_table(infos, num_cpus);
 
-                    real_get(cpuid_fd, reg, words, 0, FALSE);
-                }
-            }
-            else if (reg == 4) {
-                unsigned int  tryX = 0;
-                while ((words[WORD_EAX] & 0x1f) != 0) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    tryX++;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 7) {
-                unsigned int  tryX = 0;
-                unsigned int  max_tries;
-                for (;;) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    if (tryX == 0) {
-                        max_tries = words[WORD_EAX];
-                    }
-                    tryX++;
-                    if (tryX > max_tries) break;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 0xb) {
-                unsigned int  tryX = 0;
-                while (words[WORD_EAX] != 0 || words[WORD_EBX] != 0) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    tryX++;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 0xd) {
-                /*
-                ** ecx values 0 & 1 are special.
-                **
-                ** Intel:
-                **    For ecx values 2..63, the leaf is present if the corresponding
-                **    bit is present in the bit catenation of 0xd/0/edx + 0xd/0/eax,
-                **    or the bit catenation of 0xd/1/edx + 0xd/1/ecx.
-                ** AMD:
-                **    Only 4 ecx values are defined and it's gappy.  It's unclear
-                **    what the upper bound of any loop would be, so it seems
-                **    inappropriate to use one.
-                */
-                print_header(reg, 0, raw);
-                print_reg(reg, words, raw, 0, &stash);
-                unsigned long long  valid_xcr0
-                    = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_EAX];
-                real_get(cpuid_fd, reg, words, 1, FALSE);
-                print_reg(reg, words, raw, 1, &stash);
-                unsigned long long  valid_xss
-                    = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_ECX];
-                unsigned long long  valid_tries = valid_xcr0 | valid_xss;
-                unsigned int  tryX;
-                for (tryX = 2; tryX < 63; tryX++) {
-                    if (valid_tries & (1ull << tryX)) {
-                        real_get(cpuid_fd, reg, words, tryX, FALSE);
-                        print_reg(reg, words, raw, tryX, &stash);
-                    }
-                }
-            }
-            else if (reg == 0xf) {
-                unsigned int  mask = words[WORD_EDX];
-                print_header(reg, 0, raw);
-                print_reg(reg, words, raw, 0, &stash);
-                if (BIT_EXTRACT_LE(mask, 1, 2)) {
-                    real_get(cpuid_fd, reg, words, 1, FALSE);
-                    print_reg(reg, words, raw, 1, &stash);
-                }
-            }
-            else if (reg == 0x10) {
-                unsigned int  mask = words[WORD_EBX];
-                print_header(reg, 0, raw);
-                print_reg(reg, words, raw, 0, &stash);
-                unsigned int  tryX;
-                for (tryX = 1; tryX < 32; tryX++) {
-                    if (mask & (1 << tryX)) {
-                        real_get(cpuid_fd, reg, words, tryX, FALSE);
-                        print_reg(reg, words, raw, tryX, &stash);
-                    }
-                }
-            }
-            else if (reg == 0x12) {
-                unsigned int  mask = words[WORD_EAX];
-                print_header(reg, 0, raw);
-                print_reg(reg, words, raw, 0, &stash);
-                unsigned int  tryX;
-                for (tryX = 1; tryX < 33; tryX++) {
-                    if (mask & (1 << (tryX - 1))) {
-                        real_get(cpuid_fd, reg, words, tryX, FALSE);
-                        print_reg(reg, words, raw, tryX, &stash);
-                    }
-                }
-            }
-            else if (reg == 0x14) {
-                unsigned int  tryX = 0;
-                unsigned int  max_tries;
-                for (;;) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    if (tryX == 0) {
-                        max_tries = words[WORD_EAX];
-                    }
-                    tryX++;
-                    if (tryX > max_tries) break;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 0x17) {
-                unsigned int  tryX = 0;
-                unsigned int  max_tries;
-                for (;;) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    if (tryX == 0) {
-                        max_tries = words[WORD_EAX];
-                    }
-                    tryX++;
-                    if (tryX > max_tries) break;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 0x18) {
-                unsigned int  tryX = 0;
-                unsigned int  max_tries;
-                for (;;) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    if (tryX == 0) {
-                        max_tries = words[WORD_EAX];
-                    }
-                    tryX++;
-                    if (tryX > max_tries) break;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 0x1d) {
-                unsigned int  tryX = 0;
-                unsigned int  max_tries;
-                for (;;) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    if (tryX == 0) {
-                        max_tries = words[WORD_EAX];
-                    }
-                    tryX++;
-                    if (tryX > max_tries) break;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 0x1f) {
-                print_header(reg, 0, raw);
-                print_reg(reg, words, raw, 0, &stash);
-                unsigned int  tryX;
-                for (tryX = 1; tryX < 256; tryX++) {
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    if (BIT_EXTRACT_LE(words[WORD_ECX], 8, 16) == 0) break;
-                }
-            }
-            else if (reg == 0x20) {
-                unsigned int  tryX = 0;
-                unsigned int  max_tries;
-                for (;;) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    if (tryX == 0) {
-                        max_tries = words[WORD_EAX];
+    const sysfs_cpu_t*  info = NULL;
+    for (i = 0; i < num_cpus; i++) {
+        if (infos[i].cpu == (unsigned int)cpu) info = &infos[i];
+    }
+    if (table.num_cpus == 0 || table.cpus[0].cpuid_fd == -1 || info == NULL || cpu < 0) {
+        printf("cross-check against CPUID: not available\n");
+    }
+    else {
+        printf("cross-check of CPU %d against CPUID:\n", cpu);
+        unsigned int  mismatches = check_sysfs_cpu(infos, num_cpus, info, &table.cpus[0]);
+        printf("   %u mismatch(es)\n", mismatches);
+    }
+
+    free_table(&table);
+    free(infos);
+}
+#endif
+
+
+// command line parameters interpreter,
+// count = same as main input argc = number of command line parameters, include parameters[0] = application exe file name
+// options = same as main input argv = array of strings, command line parameters
+// shortcontrol = pointer to chars array for short (single char) options detection, for example "-h"
+// longcontrol = pointer to structures array for long (full name) options detection, for example "--help"
+// foundindex = pointer to returned index of detected option
+// return detected option key char, or '?' if not detected
+static int
+emulate_getopt_long(int count, string* options, ccstring shortcontrol, const option* longcontrol, int* foundindex UNUSED)
+{
+
+    // detect options count done or continue parse
+    if (emulate_optind < count)
+    {
+        string s1 = options[emulate_optind];  // pointer to command line option string
+        string s0 = s1;
+        cstring s2 = (cstring)shortcontrol;   // pointer to short options chars list control string
+        option* op = (option*)longcontrol;    // pointer to array of long options control structures
+        int c1 = *s1++;   // analysed char from command line
+        int c2 = 0;       // next analysed char from command line
+        int c3 = 0;       // control char from short options chars list control string
+        int c4 = 0;       // next control char from short options chars list control string
+        bool b = false;   // set to TRUE if option handled as short (single char)
+
+        emulate_optarg = NULL;
+
+        // detect wrong options, not start with "="
+        if ((c1 != '-') || (c1 == 0))
+        {
+            c1 = '?';
+            emulate_optopt = 0;
+        }
+
+        // detect short options, start with "-" or long options, start with "--"
+        else
+        {
+            c1 = *s1++;
+
+            // detect short options, start with "-" but not "--"
+            if ((c1 != 0) && (c1 != '-'))
+            {
+                c2 = *s1++;
+                if (c2 == 0)
+                {
+                    c3 = *s2++;
+                    while (c3 != 0)
+                    {
+                        if (c3 == c1)
+                        {
+                            c4 = *s2;
+                            if (c4 == ':')
+                            {
+                                emulate_optind++;
+                                if (emulate_optind < count)
+                                    emulate_optarg = options[emulate_optind];
+                            }
+                            break;
+                        }
+                        c3 = *s2++;
                     }
-                    tryX++;
-                    if (tryX > max_tries) break;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
+                    emulate_optopt = c1;
+                    if (c3 != c1)
+                        c1 = '?';
+                    b = true;  // mark handled as short
                 }
             }
-            else {
-                print_reg(reg, words, raw, 0, &stash);
-            }
-        }
 
-        // enumerate virtual CPUID functions at theoretical range 40000000h - 7FFFFFFFh
-        if (BIT_EXTRACT_LE(stash.val_1_ecx, 31, 32)) {
-            max = 0x40000000;
-            for (reg = 0x40000000; reg <= max; reg++) {
-                intbool       success;
-                unsigned int  words[WORD_NUM];
+            // detect long options, start with "--"
+            if (!b)
+            {
+                s0 = s0 + 2;   // +2 for skip "--"
+                cstring ls = op->name;
+                int cmp = 0;
 
-                success = real_get(cpuid_fd, reg, words, 0, TRUE);
-                if (!success) break;
+                // check for termination by "=" as parameter separator or 0 as string terminator
+                size_t n = strlen(s0);
+                s1 = strchr(s0, '=');
+                if (s1 != NULL)
+                    n = s1 - s0;
 
-                if (reg == 0x40000000) {
-                    max = words[WORD_EAX];
+                // compare ls=template and s1=option
+                while (ls != NULL)
+                {
+                    cmp = strncmp(ls, s0, n);
+                    if (cmp == 0)
+                        break;
+                    op++;
+                    ls = op->name;
                 }
-
-                if (reg == 0x40000003 && stash.hypervisor == HYPERVISOR_XEN) {
-                    unsigned int  tryX = 0;
-                    while (tryX <= 2) {
-                        print_header(reg, tryX, raw);
-                        print_reg(reg, words, raw, tryX, &stash);
-                        tryX++;
-                        real_get(cpuid_fd, reg, words, tryX, FALSE);
+                if (cmp == 0)
+                {
+                    emulate_optopt = op->val;  // handling strings match
+                    c1 = op->val;
+                    if ((op->has_arg == TRUE) && (s1 != NULL))
+                    {
+                        emulate_optarg = s1 + 1;  // +1 for skip "="
                     }
                 }
-                else {
-                    print_reg(reg, words, raw, 0, &stash);
-                }
-
-                if (reg == 0x40000000
-                    && stash.hypervisor == HYPERVISOR_KVM
-                    && max == 0) {
-                    max = 0x40000001;
-                }
-                if (reg == 0x40000000
-                    && stash.hypervisor == HYPERVISOR_UNKNOWN
-                    && max > 0x40001000) {
-                    // Assume some busted cpuid information and stop walking
-                    // further 0x4xxxxxxx registers.
-                    max = 0x40000000;
+                else
+                {
+                    emulate_optopt = 0;  // handling strings mismatch
+                    c1 = '?';
                 }
             }
         }
 
-        // enumerate Intel Xeon Phi specific CPUID functions at theoretical range 20000000h - 200000FFh
-        max = 0x20000000;
-        for (reg = 0x20000000; reg <= max; reg++) {
-            intbool       success;
-            unsigned int  words[WORD_NUM];
+        // return when current option parsed
+        emulate_optind++;
+        return c1;
+    }
 
-            success = real_get(cpuid_fd, reg, words, 0, TRUE);
-            if (!success) break;
+    // return if options count done
+    else
+    {
+        return EOF;
+    }
+}
 
-            if (reg == 0x20000000) {
-                max = words[WORD_EAX];
-                if (max > 0x20000100) {
-                    // Pentium 4 (and probably many early CPUs) don't support this
-                    // leaf correctly and return garbage (which appears to be a
-                    // replica of the values for the last valid leaf in the
-                    // 0x0xxxxxxx range).  As a sanity check to avoid an absurdly
-                    // long dump, if the value obviously is out-of-range, just
-                    // disable all further 0x2xxxxxxx leaves.
-                    max = 0x20000000;
-                }
-            }
+// maximum length of one line of resolver declarations, see generate_resolvers()
+#define RESOLVER_LINE_MAX   1024
 
-            print_reg(reg, words, raw, 0, &stash);
-        }
+// maximum number of implementations of one resolver declaration
+#define RESOLVER_IMPLS_MAX  16
 
-        // enumerate extended CPUID functions at theoretical range 80000000h - FFFFFFFFh
-        max = 0x80000000;
-        for (reg = 0x80000000; reg <= max; reg++) {
-            intbool       success;
-            unsigned int  words[WORD_NUM];
+// number of words read by generated resolvers: registers of cpuid_features.h queries, then XCR0
+#define RESOLVER_WORDS      (cpu::detail::query_count * WORD_NUM + 1)
 
-            success = real_get(cpuid_fd, reg, words, 0, TRUE);
-            if (!success) break;
+// index of XCR0 state components at words read by generated resolvers
+#define RESOLVER_XCR0       (cpu::detail::query_count * WORD_NUM)
 
-            if (reg == 0x80000000) {
-                max = words[WORD_EAX];
-            }
+// OS state requirements of resolver declarations, XCR0 state components enabled by OS
+static const struct {
+    ccstring      name;    // requirement name
+    unsigned int  state;   // XCR0 state components
+} resolver_states[] = { { "os_xmm_state",  0x00000002 },
+                        { "os_ymm_state",  cpu::detail::avx },
+                        { "os_zmm_state",  cpu::detail::avx512 },
+                        { "os_tile_state", cpu::detail::amx } };
 
-            if (reg == 0x8000001d) {
-                unsigned int  tryX = 0;
-                while ((words[WORD_EAX] & 0x1f) != 0) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    tryX++;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else if (reg == 0x80000020) {
-                // Rules for loop termination from SKC*.
-                unsigned int  tryX = 0;
-                while (words[WORD_EAX] != 0 || words[WORD_EBX] != 0 ||
-                    words[WORD_ECX] != 0 || words[WORD_EDX] != 0) {
-                    print_header(reg, tryX, raw);
-                    print_reg(reg, words, raw, tryX, &stash);
-                    tryX++;
-                    real_get(cpuid_fd, reg, words, tryX, FALSE);
-                }
-            }
-            else {
-                print_reg(reg, words, raw, 0, &stash);
-            }
-        }
+// one implementation of resolver declaration
+typedef struct {
+    char          name[RESOLVER_LINE_MAX];    // implementation function name
+    char          needs[RESOLVER_LINE_MAX];   // requirements list as declared, for comment
+    unsigned int  masks[RESOLVER_WORDS];      // required bits of each word
+    unsigned int  line;                       // line number of implementation, for messages
+} resolver_impl_t;
 
-        // enumerate Transmeta specific CPUID functions from 80860000h
-        max = 0x80860000;
-        for (reg = 0x80860000; reg <= max; reg++) {
-            intbool       success;
-            unsigned int  words[WORD_NUM];
+// one resolver declaration: function and implementations in order of preference
+typedef struct {
+    char             prototype[RESOLVER_LINE_MAX];   // function prototype as declared
+    char             name[RESOLVER_LINE_MAX];        // function name
+    size_t           name_pos;                       // offset of function name at prototype
+    unsigned int     line;                           // line number of declaration, for messages
+    unsigned int     num_impls;                      // number of implementations
+    resolver_impl_t  impls[RESOLVER_IMPLS_MAX];      // implementations
+} resolver_t;
+
+// print error of resolver declarations and exit
+// filename = declarations file name
+// line     = line number
+// message  = error description
+// text     = erroneous text
+static void
+resolver_error(ccstring filename, unsigned int line, ccstring message, ccstring text)
+{
+    fprintf(stderr,
+        "%s: %s line %u: %s: %s\n",
+        program, filename, line, message, text);
+    exit(1);
+}
 
-            success = real_get(cpuid_fd, reg, words, 0, TRUE);
-            if (!success) break;
+// return index of resolver word for register of CPUID function:subfunction of cpuid_features.h queries
+// leaf    = CPUID function number
+// subleaf = CPUID sub-function number
+// word    = register index, WORD_EAX - WORD_EDX
+static unsigned int
+resolver_word(unsigned int leaf, unsigned int subleaf, unsigned int word)
+{
+    unsigned int  i;
 
-            if (reg == 0x80860000) {
-                max = words[WORD_EAX];  // update maximum function number
-            }
+    for (i = 0; i < cpu::detail::query_count; i++) {
+        if (cpu::detail::queries[i].leaf == leaf && cpu::detail::queries[i].subleaf == subleaf) break;
+    }
+    return i * WORD_NUM + word;
+}
 
-            print_reg(reg, words, raw, 0, &stash);
-        }
+// return length of C identifier at text, 0 if no identifier
+// text = text
+static size_t
+identifier_length(ccstring text)
+{
+    size_t  length = 0;
 
-        // enumerate VIA specific CPUID functions from C0000000h
-        max = 0xc0000000;
-        for (reg = 0xc0000000; reg <= max; reg++) {
-            intbool       success;
-            unsigned int  words[WORD_NUM];
+    if (!isalpha((unsigned char)text[0]) && text[0] != '_') return 0;
+    while (isalnum((unsigned char)text[length]) || text[length] == '_') {
+        length++;
+    }
+    return length;
+}
 
-            success = real_get(cpuid_fd, reg, words, 0, TRUE);
-            if (!success) break;
+// add requirement of implementation: feature of cpuid_features.h with its OS state, or OS state only
+// impl = implementation
+// name = requirement name
+// return FALSE if requirement name unknown
+static intbool
+add_requirement(resolver_impl_t* impl, ccstring name)
+{
+    unsigned int  i;
 
-            if (reg == 0xc0000000) {
-                max = words[WORD_EAX];  // update maximum function number
-            }
+    for (i = 0; i < cpu::detail::feature_count; i++) {
+        const cpu::detail::descriptor&  item = cpu::detail::descriptors[i];
+        if (strcmp(item.id, name) == SAME) {
+            impl->masks[resolver_word(item.leaf, item.subleaf, item.word)] |= 1u << item.bit;
+            impl->masks[RESOLVER_XCR0] |= item.state;
+            return TRUE;
+        }
+    }
+    for (i = 0; i < LENGTH(resolver_states); i++) {
+        if (strcmp(resolver_states[i].name, name) == SAME) {
+            impl->masks[RESOLVER_XCR0] |= resolver_states[i].state;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
 
-            if (max > 0xc0001000) {
-                // Assume some busted cpuid information and stop walking
-                // further 0x4xxxxxxx registers.
-                max = 0xc0000000;
-            }
+// print common part of generated resolvers: function for read CPUID words, driven by cpuid_features.h
+// queries, without library calls, because resolvers run by dynamic loader before relocations done
+// filename = declarations file name, for comment
+static void
+print_resolver_words(ccstring filename)
+{
+    const cpu::detail::descriptor&  osxsave = cpu::detail::descriptors[(unsigned int)cpu::feature::osxsave];
+    unsigned int                    i;
+
+    printf("/*\n");
+    printf("** GNU ifunc resolvers generated by cpuid --resolver=%s, do not edit.\n", filename);
+    printf("** Implementation selected if processor supports all required features,\n");
+    printf("** and OS enabled XCR0 state components of registers used by these features.\n");
+    printf("** On Linux, AMX tile state also requires permission of this process when resolvers run:\n");
+    printf("** resolvers of a program run at relocation, before main(), so tile implementations are\n");
+    printf("** never selected there; only in a library loaded by dlopen() after\n");
+    printf("** arch_prctl(ARCH_REQ_XCOMP_PERM).\n");
+    printf("*/\n");
+    printf("\n");
+    printf("#include <stddef.h>\n");
+    printf("#include <cpuid.h>\n");
+    printf("\n");
+    printf("// read CPUID words for resolvers: EAX, EBX, ECX, EDX of CPUID functions");
+    for (i = 0; i < cpu::detail::query_count; i++) {
+        printf("%s 0x%x/%u", (i > 0) ? "," : "", cpu::detail::queries[i].leaf, cpu::detail::queries[i].subleaf);
+    }
+    printf(",\n");
+    printf("// then XCR0; no library calls, resolvers run before relocations are done\n");
+    printf("static void\n");
+    printf("cpuid_resolver_words(unsigned int words[%u])\n", RESOLVER_WORDS);
+    printf("{\n");
+    printf("    unsigned int  max;\n");
+    printf("    unsigned int  max_ext;\n");
+    printf("    unsigned int  ebx;\n");
+    printf("    unsigned int  ecx;\n");
+    printf("    unsigned int  edx;\n");
+    printf("    unsigned int  i;\n");
+    printf("\n");
+    printf("    for (i = 0; i < %u; i++) {\n", RESOLVER_WORDS);
+    printf("        words[i] = 0;\n");
+    printf("    }\n");
+    printf("    __cpuid(0, max, ebx, ecx, edx);\n");
+    printf("    __cpuid(0x80000000, max_ext, ebx, ecx, edx);\n");
+    for (i = 0; i < cpu::detail::query_count; i++) {
+        unsigned int  leaf = cpu::detail::queries[i].leaf;
+        unsigned int  subleaf = cpu::detail::queries[i].subleaf;
+        unsigned int  word = i * WORD_NUM;
+        printf("    if (%s >= 0x%x", (leaf & 0x80000000) ? "max_ext" : "max", leaf);
+        if (leaf == 0x07 && subleaf > 0) {   // 7/0 EAX = max subfunction
+            printf(" && words[%u] >= %u", resolver_word(0x07, 0, WORD_EAX), subleaf);
+        }
+        printf(") {\n");
+        printf("        __cpuid_count(0x%x, %u, words[%u], words[%u], words[%u], words[%u]);\n",
+            leaf, subleaf, word + WORD_EAX, word + WORD_EBX, word + WORD_ECX, word + WORD_EDX);
+        printf("    }\n");
+    }
+    printf("    if (words[%u] & (1u << %u)) {   // OSXSAVE: XGETBV enabled\n",
+        resolver_word(osxsave.leaf, osxsave.subleaf, osxsave.word), osxsave.bit);
+    printf("        __asm__ __volatile__(\".byte 0x0f, 0x01, 0xd0\"   // XGETBV\n");
+    printf("            : \"=a\"(words[%u]), \"=d\"(edx) : \"c\"(0));\n", RESOLVER_XCR0);
+    printf("    }\n");
+    printf("    if (words[%u] & 0x%08xu) {   // AMX tile state: 64-bit mode only, Linux permission required\n",
+        RESOLVER_XCR0, (unsigned int)cpu::detail::amx);
+    printf("#if defined(__x86_64__) && defined(__linux__)\n");
+    printf("        unsigned long long  perm = 0;\n");
+    printf("        long                ret;\n");
+    printf("        __asm__ __volatile__(\"syscall\"   // arch_prctl(ARCH_GET_XCOMP_PERM, &perm)\n");
+    printf("            : \"=a\"(ret) : \"0\"(158L), \"D\"(0x%xL), \"S\"(&perm) : \"rcx\", \"r11\", \"memory\");\n",
+        (unsigned int)cpu::detail::arch_get_xcomp_perm);
+    printf("        if (ret != 0 || (perm & (1ull << %u)) == 0) {\n", (unsigned int)cpu::detail::xfeature_xtiledata);
+    printf("            words[%u] &= ~0x%08xu;\n", RESOLVER_XCR0, (unsigned int)cpu::detail::amx);
+    printf("        }\n");
+    printf("#elif !defined(__x86_64__)\n");
+    printf("        words[%u] &= ~0x%08xu;\n", RESOLVER_XCR0, (unsigned int)cpu::detail::amx);
+    printf("#endif\n");
+    printf("    }\n");
+    printf("}\n");
+}
+
+// print generated resolver of one declaration
+// resolver = resolver declaration
+static void
+print_resolver(const resolver_t* resolver)
+{
+    unsigned int  i;
+    unsigned int  j;
 
-            print_reg(reg, words, raw, 0, &stash);
+    printf("\n");
+    printf("// %s: implementations in order of preference\n", resolver->name);
+    printf("typedef %.*s%s_t%s;\n",
+        (int)resolver->name_pos, resolver->prototype, resolver->name,
+        resolver->prototype + resolver->name_pos + strlen(resolver->name));
+    for (i = 0; i < resolver->num_impls; i++) {
+        printf("%s_t  %s;\n", resolver->name, resolver->impls[i].name);
+    }
+    printf("\n");
+    printf("static %s_t*\n", resolver->name);
+    printf("%s_resolver(void)\n", resolver->name);
+    printf("{\n");
+    printf("    unsigned int  words[%u];\n", RESOLVER_WORDS);
+    printf("\n");
+    printf("    cpuid_resolver_words(words);\n");
+    for (i = 0; i + 1 < resolver->num_impls; i++) {
+        const resolver_impl_t*  impl = &resolver->impls[i];
+        intbool                 first = TRUE;
+        printf("    // %s needs %s\n", impl->name, impl->needs);
+        printf("    if (");
+        for (j = 0; j < RESOLVER_WORDS; j++) {
+            if (impl->masks[j] == 0) continue;
+            printf("%s(words[%u] & 0x%08xu) == 0x%08xu",
+                first ? "   " : "\n        && ", j, impl->masks[j], impl->masks[j]);
+            first = FALSE;
         }
+        printf(") {\n");
+        printf("        return %s;\n", impl->name);
+        printf("    }\n");
+    }
+    printf("    return %s;\n", resolver->impls[resolver->num_impls - 1].name);
+    printf("}\n");
+    printf("\n");
+    printf("%s_t  %s __attribute__((ifunc(\"%s_resolver\")));\n", resolver->name, resolver->name, resolver->name);
+}
 
-        // summary information
-        do_final(raw, debug, &stash);
+// check and print resolver declaration, if any
+// filename = declarations file name, for messages
+// resolver = resolver declaration, num_impls 0 if none
+static void
+flush_resolver(ccstring filename, const resolver_t* resolver)
+{
+    if (resolver->prototype[0] == '\0') return;
 
-        // Yet ported one method only: direct execute CPUID instruction
-        // file method (get data from text file) YET NOT SUPPORTED.
-        // REQUIRED FIX
-        //      close(cpuid_fd);
-        // REQUIRED FIX
+    if (resolver->num_impls == 0) {
+        resolver_error(filename, resolver->line, "function without implementations", resolver->name);
+    }
 
+    // only last implementation without requirements, following implementations never selected
+    unsigned int  i;
+    unsigned int  j;
+    for (i = 0; i < resolver->num_impls; i++) {
+        const resolver_impl_t*  impl = &resolver->impls[i];
+        intbool                 needs = FALSE;
+        for (j = 0; j < RESOLVER_WORDS; j++) {
+            if (impl->masks[j] != 0) needs = TRUE;
+        }
+        if (needs && i == resolver->num_impls - 1) {
+            resolver_error(filename, impl->line, "last implementation must have no requirements", impl->name);
+        }
+        if (!needs && i < resolver->num_impls - 1) {
+            resolver_error(filename, impl->line, "implementation without requirements must be last", impl->name);
+        }
     }
+
+    print_resolver(resolver);
 }
 
-// Print CPUID data, yet ported one method only: direct execute CPUID instruction
-// THIS file method (get data from text file) YET NOT SUPPORTED.
-// filename = file name string
-// raw      = flag for raw dump without decoding data, no prints if raw mode selected
-// debug    = flag for debug mode, print detail transit info
+// generate C source of GNU ifunc resolvers from declarations, print to stdout
+// declarations file lines:
+//    function PROTOTYPE                 start of declaration, e.g. "function void kernel(const float* in, size_t n)"
+//    NAME [needs FEATURE, ...]          implementation with prototype of function, in order of preference,
+//                                       FEATURE is feature identifier of cpuid_features.h or OS state
+//                                       os_xmm_state, os_ymm_state, os_zmm_state, os_tile_state;
+//                                       last implementation without requirements, as fallback
+//    #...                               copied to output, e.g. #include
+//    // ... or empty                    comment
+// filename = declarations file name, "-" means stdin
 static void
-do_file(ccstring filename, intbool raw, intbool debug)
+generate_resolvers(ccstring filename)
 {
-    intbool       seen_cpu = FALSE;
-    unsigned int  cpu = -1;
-    /*
-    ** The try* variables are a kludge to deal with those leaves that depended on
-    ** the try (a.k.a. ecx) values that existed with cpuid's old-style method of
-    ** dumping raw leaves, which lacked an explicit indication of the try number.
-    ** It is not necessary to add more kludges for more modern ecx-dependent
-    ** leaves.
-    */
-    unsigned int  try2 = -1;
-    unsigned int  try4 = -1;
-    unsigned int  try7 = -1;
-    unsigned int  tryb = -1;
-    unsigned int  try8000001d = -1;
-    code_stash_t  stash = NIL_STASH;
+    static resolver_t  resolver;   // large, not at stack
+    char               buffer[RESOLVER_LINE_MAX];
+    unsigned int       line = 0;
 
     FILE* file;
     if (strcmp(filename, "-") == 0) {
@@ -10875,237 +16118,267 @@ do_file(ccstring filename, intbool raw, intbool debug)
         }
     }
 
-    while (!feof(file)) {
-        char          buffer[88];
-        char* ptr;
-        int           status;
-        unsigned int  reg;
-        unsigned int  tryX;
-        unsigned int  words[WORD_NUM];
-
-        ptr = fgets(buffer, LENGTH(buffer), file);
-        if (ptr == NULL && errno == 0) break;
-        if (ptr == NULL) {
-            if (errno != EPIPE) {
-                fprintf(stderr,
-                    "%s: unable to read a line of text from %s;"
-                    " errno = %d (%s)\n",
-                    program, filename, errno, strerror(errno));
-            }
-            exit(1);
-        }
-
-        status = sscanf(ptr, "CPU %u:\r", &cpu);
-        if (status == 1 || strcmp(ptr, "CPU:\n") == SAME) {
-            if (seen_cpu) {
-                do_final(raw, debug, &stash);
-            }
+    memset(&resolver, 0, sizeof(resolver));
+    print_resolver_words(filename);
 
-            seen_cpu = TRUE;
+    while (fgets(buffer, LENGTH(buffer), file) != NULL) {
+        line++;
 
-            if (status == 1) {
-                printf("CPU %u:\n", cpu);
-            }
-            else {
-                printf("CPU:\n");
-            }
-            try2 = 0;
-            try4 = 0;
-            try7 = 0;
-            tryb = 0;
-            try8000001d = 0;
-            {
-                static code_stash_t  empty_stash = NIL_STASH;
-                stash = empty_stash;
-            }
-            continue;
+        size_t  length = strlen(buffer);
+        if (length > 0 && buffer[length - 1] != '\n' && !feof(file)) {
+            resolver_error(filename, line, "line too long", buffer);
         }
-
-        status = sscanf(ptr,
-            "   0x%x 0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
-            &reg, &tryX,
-            &words[WORD_EAX], &words[WORD_EBX],
-            &words[WORD_ECX], &words[WORD_EDX]);
-        if (status == 6) {
-            print_header(reg, tryX, raw);
-            print_reg(reg, words, raw, tryX, &stash);
-            continue;
+        while (length > 0 && isspace((unsigned char)buffer[length - 1])) {
+            buffer[--length] = '\0';
         }
-        status = sscanf(ptr,
-            "   0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
-            &reg,
-            &words[WORD_EAX], &words[WORD_EBX],
-            &words[WORD_ECX], &words[WORD_EDX]);
-        if (status == 5) {
-            if (reg == 2) {
-                print_header(reg, try2, raw);
-                print_reg(reg, words, raw, try2++, &stash);
-            }
-            else if (reg == 4) {
-                print_header(reg, try4, raw);
-                print_reg(reg, words, raw, try4++, &stash);
-            }
-            else if (reg == 7) {
-                print_header(reg, try7, raw);
-                print_reg(reg, words, raw, try7++, &stash);
-            }
-            else if (reg == 0xb) {
-                print_header(reg, tryb, raw);
-                print_reg(reg, words, raw, tryb++, &stash);
-            }
-            else if (reg == 0x8000001d) {
-                print_header(reg, try8000001d, raw);
-                print_reg(reg, words, raw, try8000001d++, &stash);
+
+        string  ptr = buffer + strspn(buffer, " \t");
+        if (*ptr == '\0' || strncmp(ptr, "//", 2) == SAME) continue;
+
+        if (*ptr == '#') {
+            printf("%s\n", ptr);
+            continue;
+        }
+
+        if (strncmp(ptr, "function", 8) == SAME && isspace((unsigned char)ptr[8])) {
+            flush_resolver(filename, &resolver);
+            memset(&resolver, 0, sizeof(resolver));
+
+            ptr += 8 + strspn(ptr + 8, " \t");
+            length = strlen(ptr);
+            if (length > 0 && ptr[length - 1] == ';') {
+                ptr[--length] = '\0';
             }
-            else {
-                print_reg(reg, words, raw, 0, &stash);
+
+            // function name is identifier before parameters list, after return type
+            cstring  paren = strchr(ptr, '(');
+            cstring  name = paren;
+            while (name != NULL && name > ptr && isspace((unsigned char)name[-1])) name--;
+            cstring  tail = name;
+            while (name != NULL && name > ptr && (isalnum((unsigned char)name[-1]) || name[-1] == '_')) name--;
+            if (paren == NULL || name == tail || name == ptr || identifier_length(name) != (size_t)(tail - name)) {
+                resolver_error(filename, line, "function prototype not understood", ptr);
             }
+
+            strcpy(resolver.prototype, ptr);
+            memcpy(resolver.name, name, tail - name);
+            resolver.name[tail - name] = '\0';
+            resolver.name_pos = name - ptr;
+            resolver.line = line;
             continue;
         }
 
-        fprintf(stderr,
-            "%s: unexpected input with -f option: %s\n",
-            program, ptr);
-        exit(1);
-    }
+        if (resolver.prototype[0] == '\0') {
+            resolver_error(filename, line, "implementation before function", ptr);
+        }
+        if (resolver.num_impls == RESOLVER_IMPLS_MAX) {
+            resolver_error(filename, line, "too many implementations", ptr);
+        }
 
-    if (seen_cpu) {
-        do_final(raw, debug, &stash);
+        resolver_impl_t*  impl = &resolver.impls[resolver.num_impls++];
+        length = identifier_length(ptr);
+        if (length == 0) {
+            resolver_error(filename, line, "implementation name not understood", ptr);
+        }
+        memcpy(impl->name, ptr, length);
+        impl->name[length] = '\0';
+        impl->line = line;
+        ptr += length + strspn(ptr + length, " \t");
+        if (*ptr == '\0') continue;
+
+        if (strncmp(ptr, "needs", 5) != SAME || (ptr[5] != '\0' && !isspace((unsigned char)ptr[5]))) {
+            resolver_error(filename, line, "expected \"needs\"", ptr);
+        }
+        ptr += 5;
+
+        // requirements separated by commas or spaces, optionally in braces
+        ccstring  separators = " \t,{}";
+        while (*(ptr += strspn(ptr, separators)) != '\0') {
+            length = strcspn(ptr, separators);
+            char  requirement[RESOLVER_LINE_MAX];
+            memcpy(requirement, ptr, length);
+            requirement[length] = '\0';
+            if (!add_requirement(impl, requirement)) {
+                resolver_error(filename, line, "unknown feature", requirement);
+            }
+            size_t  used = strlen(impl->needs);
+            int     status = snprintf(impl->needs + used, sizeof(impl->needs) - used, "%s%s",
+                                      (used != 0) ? ", " : "", requirement);
+            if (status < 0 || (size_t)status >= sizeof(impl->needs) - used) {
+                resolver_error(filename, line, "requirements list too long", requirement);
+            }
+            ptr += length;
+        }
+        if (impl->needs[0] == '\0') {
+            resolver_error(filename, line, "\"needs\" without features", impl->name);
+        }
     }
 
+    flush_resolver(filename, &resolver);
+
     if (file != stdin) {
         fclose(file);
     }
 }
 
-
-// command line parameters interpreter,
-// count = same as main input argc = number of command line parameters, include parameters[0] = application exe file name
-// options = same as main input argv = array of strings, command line parameters
-// shortcontrol = pointer to chars array for short (single char) options detection, for example "-h"
-// longcontrol = pointer to structures array for long (full name) options detection, for example "--help"
-// foundindex = pointer to returned index of detected option
-// return detected option key char, or '?' if not detected
-int
-emulate_getopt_long(int count, string* options, ccstring shortcontrol, const option* longcontrol, int* foundindex)
+// decode CPUID results of one logical processor into library facts, see cpuid_api.h
+// leaves = per-CPU buffer of CPUID results
+// facts  = pointer for return decoded facts
+// return 0 if decoded, -1 if CPUID function 0 or 1 absent
+static int
+decode_facts(const cpu_leaves_t* leaves, cpuid_facts_t* facts)
 {
+    const leaf_record_t*  leaf_0 = find_leaf(leaves, 0, 0);
+    const leaf_record_t*  leaf_1 = find_leaf(leaves, 1, 0);
+    const leaf_record_t*  leaf_7 = find_leaf(leaves, 7, 0);
+    const leaf_record_t*  leaf_x1 = find_leaf(leaves, 0x80000001, 0);
+    code_stash_t          stash = NIL_STASH;
+    unsigned int          cache_reg = (find_leaf(leaves, 4, 0) != NULL) ? 4 : 0x8000001d;
+    unsigned int          i;
+
+    memset(facts, 0, sizeof(*facts));
+    if (leaf_0 == NULL || leaf_1 == NULL) {
+        return -1;
+    }
 
-    // detect options count done or continue parse
-    if (emulate_optind < count)
-    {
-        string s1 = options[emulate_optind];  // pointer to command line option string
-        string s0 = s1;
-        cstring s2 = (cstring)shortcontrol;   // pointer to short options chars list control string
-        option* op = (option*)longcontrol;    // pointer to array of long options control structures
-        int c1 = *s1++;   // analysed char from command line
-        int c2 = 0;       // next analysed char from command line
-        int c3 = 0;       // control char from short options chars list control string
-        int c4 = 0;       // next control char from short options chars list control string
-        bool b = false;   // set to TRUE if option handled as short (single char)
+    for (i = 0; i < leaves->count; i++) {
+        stash_reg(leaves->records[i].reg, leaves->records[i].words, leaves->records[i].tryX, &stash);
+    }
+    // same order of summary decoding as do_final()
+    decode_mp_synth(&stash);
+    decode_override_brand(&stash);
+    decode_brand_id_stash(&stash);
+    decode_brand_stash(&stash);
+
+    memcpy(&facts->vendor_id[0], &leaf_0->words[WORD_EBX], 4);
+    memcpy(&facts->vendor_id[4], &leaf_0->words[WORD_EDX], 4);
+    memcpy(&facts->vendor_id[8], &leaf_0->words[WORD_ECX], 4);
+    facts->vendor = decode_vendor(stash.vendor, &stash);
+    memcpy(facts->brand, stash.brand, sizeof(facts->brand));
+    facts->brand[sizeof(facts->brand) - 1] = '\0';
+
+    facts->signature = leaf_1->words[WORD_EAX];
+    facts->family = Synth_Family(facts->signature);
+    facts->model = Synth_Model(facts->signature);
+    facts->stepping = BIT_EXTRACT_LE(facts->signature, 0, 4);
 
-        emulate_optarg = NULL;
+    arch_t  arch;
+    decode_uarch(facts->signature, stash.vendor, &stash, &arch);
+    facts->uarch = arch.uarch;
+    facts->core = arch.family;
+    facts->process = arch.phys;
 
-        // detect wrong options, not start with "="
-        if ((c1 != '-') || (c1 == 0))
-        {
-            c1 = '?';
-            emulate_optopt = 0;
-        }
+    char      buffer[SYNTH_MAX];
+    ccstring  synth = decode_synth(facts->signature, stash.vendor, &stash, buffer);
+    if (synth != NULL) {
+        snprintf(facts->synth, sizeof(facts->synth), "%s", synth);
+    }
 
-        // detect short options, start with "-" or long options, start with "--"
-        else
-        {
-            c1 = *s1++;
+    apic_synth_t  apic;
+    facts->topology.method = stash.mp.method;
+    facts->topology.cores = stash.mp.cores;
+    facts->topology.threads = stash.mp.hyperthreads;
+    if (decode_apic_synth(&stash, &apic)) {
+        facts->topology.apic_valid = 1;
+        facts->topology.smt_width = apic.smt_width;
+        facts->topology.core_width = apic.core_width;
+        facts->topology.cu_width = apic.cu_width;
+        facts->topology.pkg_id = apic.pkg_id;
+        facts->topology.cu_id = apic.cu_id;
+        facts->topology.core_id = apic.core_id;
+        facts->topology.smt_id = apic.smt_id;
+    }
 
-            // detect short options, start with "-" but not "--"
-            if ((c1 != 0) && (c1 != '-'))
-            {
-                c2 = *s1++;
-                if (c2 == 0)
-                {
-                    c3 = *s2++;
-                    while (c3 != 0)
-                    {
-                        if (c3 == c1)
-                        {
-                            c4 = *s2;
-                            if (c4 == ':')
-                            {
-                                emulate_optind++;
-                                if (emulate_optind < count)
-                                    emulate_optarg = options[emulate_optind];
-                            }
-                            break;
-                        }
-                        c3 = *s2++;
-                    }
-                    emulate_optopt = c1;
-                    if (c3 != c1)
-                        c1 = '?';
-                    b = true;  // mark handled as short
-                }
-            }
+    for (i = 0; i < leaves->count && facts->num_caches < CPUID_MAX_CACHES; i++) {
+        const leaf_record_t*  record = &leaves->records[i];
+        cache_params_t        cache;
+        if (record->reg != cache_reg) continue;
+        if (!decode_cache_params(record, &cache)) continue;
+
+        cpuid_cache_t*  item = &facts->caches[facts->num_caches++];
+        item->level = cache.level;
+        item->type = cache.type;
+        item->size = (unsigned int)(cache.size / 1024);
+        item->ways = cache.ways;
+        item->line_size = cache.line_size;
+        item->sets = cache.sets;
+        item->sharing = cache.sharing;
+    }
 
-            // detect long options, start with "--"
-            if (!b)
-            {
-                s0 = s0 + 2;   // +2 for skip "--"
-                cstring ls = op->name;
-                int cmp = 0;
+    facts->features.std_1_ecx = leaf_1->words[WORD_ECX];
+    facts->features.std_1_edx = leaf_1->words[WORD_EDX];
+    if (leaf_7 != NULL) {
+        facts->features.std_7_ebx = leaf_7->words[WORD_EBX];
+        facts->features.std_7_ecx = leaf_7->words[WORD_ECX];
+        facts->features.std_7_edx = leaf_7->words[WORD_EDX];
+    }
+    if (leaf_x1 != NULL) {
+        facts->features.ext_1_ecx = leaf_x1->words[WORD_ECX];
+        facts->features.ext_1_edx = leaf_x1->words[WORD_EDX];
+    }
+    return 0;
+}
 
-                // check for termination by "=" as parameter separator or 0 as string terminator
-                size_t n = strlen(s0);
-                s1 = strchr(s0, '=');
-                if (s1 != NULL)
-                    n = s1 - s0;
+// library entry point: decode CPUID results of one logical processor, see cpuid_api.h
+// leaves = array of CPUID results
+// count  = number of elements in leaves array
+// facts  = pointer for return decoded facts
+// return 0 if decoded, -1 if CPUID function 0 or 1 absent or no memory
+int
+cpuid_decode(const cpuid_leaf_t leaves[], unsigned int count, cpuid_facts_t* facts)
+{
+    cpu_leaves_t  buffer = { CPU_UNNUMBERED, USE_INSTRUCTION, 0, 0, NULL, 0, NULL, FALSE, 0, 0, FALSE };
+    unsigned int  i;
 
-                // compare ls=template and s1=option
-                while (ls != NULL)
-                {
-                    cmp = strncmp(ls, s0, n);
-                    if (cmp == 0)
-                        break;
-                    op++;
-                    ls = op->name;
-                }
-                if (cmp == 0)
-                {
-                    emulate_optopt = op->val;  // handling strings match
-                    c1 = op->val;
-                    if ((op->has_arg == TRUE) && (s1 != NULL))
-                    {
-                        emulate_optarg = s1 + 1;  // +1 for skip "="
-                    }
-                }
-                else
-                {
-                    emulate_optopt = 0;  // handling strings mismatch
-                    c1 = '?';
-                }
-            }
+    for (i = 0; i < count; i++) {
+        unsigned int  words[WORD_NUM];
+        words[WORD_EAX] = leaves[i].eax;
+        words[WORD_EBX] = leaves[i].ebx;
+        words[WORD_ECX] = leaves[i].ecx;
+        words[WORD_EDX] = leaves[i].edx;
+        if (!add_leaf(&buffer, leaves[i].function, leaves[i].subfunction, words)) {
+            free(buffer.records);
+            return -1;
         }
-
-        // return when current option parsed
-        emulate_optind++;
-        return c1;
     }
 
-    // return if options count done
-    else
-    {
-        return EOF;
+    int  result = decode_facts(&buffer, facts);
+    free(buffer.records);
+    return result;
+}
+
+// library entry point: execute CPUID functions on current logical processor and decode results,
+// see cpuid_api.h
+// facts = pointer for return decoded facts
+// return 0 if decoded, -1 if CPUID function 0 or 1 absent or no memory
+int
+cpuid_query(cpuid_facts_t* facts)
+{
+    cpu_leaves_t   leaves = { CPU_UNNUMBERED, USE_INSTRUCTION, 0, 0, NULL, 0, NULL, FALSE, 0, 0, FALSE };
+    leaf_plan_t    plan = { 0, 0, NULL };
+    leaf_source_t  source = { &leaves, &plan, NULL, 0, FALSE, FALSE };
+
+    collect_leaves(&source, &leaves);
+    free(plan.queries);
+    if (leaves.no_memory) {
+        free(leaves.records);
+        return -1;
     }
+
+    int  result = decode_facts(&leaves, facts);
+    free(leaves.records);
+    return result;
 }
 
 
-// application entry point, 
+// command line tool entry point, main() unless library build, see CPUID_LIBRARY
 // argc = number of command line parameters, include parameters[0] = application exe file name
 // argv = array of strings, command line parameters
 // return integer = application exit code
 int
-main(int argc, string  argv[])
+cpuid_main(int argc, string  argv[])
 {
-    static ccstring             shortopts = "+hH1ikrdf:vl:s:";
+    static ccstring             shortopts = "+hH1ikrdf:vl:s:utcT:SpybF:R:";
     static const struct option  longopts[] = {
        { "help",    no_argument,       NULL, 'h'  },
        { "one-cpu", no_argument,       NULL, '1'  },
@@ -11117,6 +16390,16 @@ main(int argc, string  argv[])
        { "version", no_argument,       NULL, 'v'  },
        { "leaf",    required_argument, NULL, 'l'  },
        { "subleaf", required_argument, NULL, 's'  },
+       { "unique",  no_argument,       NULL, 'u'  },
+       { "types",   no_argument,       NULL, 't'  },
+       { "cache",   no_argument,       NULL, 'c'  },
+       { "timing",  required_argument, NULL, 'T'  },
+       { "synth-only", no_argument,    NULL, 'S'  },
+       { "sample",  no_argument,       NULL, 'p'  },
+       { "sysfs",   no_argument,       NULL, 'y'  },
+       { "brief",   no_argument,       NULL, 'b'  },
+       { "format",  required_argument, NULL, 'F'  },
+       { "resolver", required_argument, NULL, 'R' },
        { NULL,      no_argument,       NULL, '\0' }
     };
 
@@ -11130,12 +16413,26 @@ main(int argc, string  argv[])
     intbool  opt_version = FALSE;  // output version of original linux application and this windows port, "-v" or "--version"
     intbool  opt_leaf = FALSE;     // execute CPUID instruction only for specified leaf (CPUID function, input EAX), "-l NUMBER" or "leaf=NUMBER"
     intbool  opt_subleaf = FALSE;  // execute CPUID instruction only for specified subleaf (CPUID sub-function, input ECX), "-s NUMBER" or "--subleaf=NUMBER"
+    intbool  opt_unique = FALSE;   // decode once per group of identical CPUs, expand only per-CPU topology, "-u" or "--unique"
+    intbool  opt_types = FALSE;    // decode once per hybrid core type, with caches and ISA summary, "-t" or "--types"
+    intbool  opt_synth_only = FALSE; // query and print only summary: synth, uarch, multiprocessor and APIC, "-S" or "--synth-only"
+    intbool  opt_cache = FALSE;    // use snapshot cache of CPUID results, not supported by windows, "-c" or "--cache"
+    intbool  opt_sample = FALSE;   // full collection for one CPU per package and core type, verify others, "-p" or "--sample"
+    intbool  opt_sysfs = FALSE;    // topology and caches of all CPUs from sysfs, CPUID on one CPU, not supported by windows, "-y" or "--sysfs"
+    intbool  opt_brief = FALSE;    // omit feature flags which are false, "-b" or "--brief"
+    intbool  opt_format = FALSE;   // decoded information in output formats list, "-F LIST" or "--format=LIST"
 
     cstring        opt_filename = NULL;    // pointer to file name, used for file mode
-    unsigned long  opt_leaf_val = 0;       // CPUID instruction function number (same as input EAX), for single leaf mode
+    cstring        opt_leaf_val = NULL;    // CPUID instruction functions list (same as input EAX), for selected leaves mode
+    unsigned long  opt_timing_val = 0;     // timing mode executions of each function:subfunction, 0 = timing mode off
     unsigned long  opt_subleaf_val = 0;    // CPUID instruction sub-function number (same as input ECX), for single sub-leaf mode
+    cstring        opt_resolver = NULL;    // pointer to resolver declarations file name, generate ifunc resolvers instead of CPUID execution, "-R FILE" or "--resolver=FILE"
 
+#if defined(_WIN32)
     program = strrchr(argv[0], '\\');      // extract application exe file name (skip path) for text messages
+#else
+    program = strrchr(argv[0], '/');
+#endif
     if (program == NULL) {
         program = argv[0];
     }
@@ -11145,6 +16442,20 @@ main(int argc, string  argv[])
 
     emulate_opterr = 0;
 
+#ifdef USE_CPUID_MODULE
+    cstring  dev_dir = getenv("CPUID_DEV_DIR");  // kernel cpuid driver directory override, for example for testing by regular files
+    if (dev_dir != NULL && *dev_dir != '\0') {
+        cpuid_dev_dir = dev_dir;
+    }
+#endif
+
+#ifdef USE_SNAPSHOT_CACHE
+    cstring  cache_dir = getenv("CPUID_CACHE_DIR");  // snapshot cache directory override
+    if (cache_dir != NULL && *cache_dir != '\0') {
+        snapshot_dir = cache_dir;
+    }
+#endif
+
     // start cycle for parse command line arguments
     for (;;) {
         int  longindex = 0;
@@ -11179,27 +16490,62 @@ main(int argc, string  argv[])
         case 'v':
             opt_version = TRUE;
             break;
-        case 'l':
-            opt_leaf = TRUE;
-            {
-                emulate_errno = 0;
+        case 'u':
+            opt_unique = TRUE;
+            break;
+        case 't':
+            opt_types = TRUE;
+            break;
+        case 'c':
+            opt_cache = TRUE;
+            break;
+        case 'S':
+            opt_synth_only = TRUE;
+            break;
+        case 'p':
+            opt_sample = TRUE;
+            break;
+        case 'y':
+            opt_sysfs = TRUE;
+            break;
+        case 'b':
+            opt_brief = TRUE;
+            break;
+        case 'F':
+            opt_format = TRUE;
+            parse_output_formats(emulate_optarg);
+            break;
+        case 'R':
+            opt_resolver = emulate_optarg;
+            break;
+        case 'T':
+            opt_timing_val = TIMING_RUNS_DEFAULT;
+            if (emulate_optarg != NULL) {
+                errno = 0;
                 char* endptr = NULL;
-                opt_leaf_val = strtoul(emulate_optarg, &endptr, 0);
-                if (emulate_errno != 0) {
+                opt_timing_val = strtoul(emulate_optarg, &endptr, 0);
+                if (errno != 0 || *endptr != '\0' || opt_timing_val == 0 || opt_timing_val > TIMING_RUNS_MAX) {
                     fprintf(stderr,
-                        "%s: argument to -l/--leaf not understood: %s\n",
-                        program, argv[emulate_optind - 1]);
+                        "%s: argument to -T/--timing not understood: %s\n",
+                        program, emulate_optarg);
                     exit(1);
                 }
             }
             break;
+        case 'l':
+            opt_leaf = TRUE;
+            opt_leaf_val = emulate_optarg;  // parsed after -s/--subleaf known
+            break;
         case 's':
             opt_subleaf = TRUE;
-            {
+            if (strcmp(emulate_optarg, "*") == SAME) {
+                opt_subleaf_val = SUBLEAF_ALL;
+            }
+            else {
                 errno = 0;
                 char* endptr = NULL;
                 opt_subleaf_val = strtoul(emulate_optarg, &endptr, 0);
-                if (errno != 0) {
+                if (errno != 0 || *endptr != '\0' || opt_subleaf_val >= SUBLEAF_ALL) {
                     fprintf(stderr,
                         "%s: argument to -s/--subleaf not understood: %s\n",
                         program, argv[emulate_optind - 1]);
@@ -11239,6 +16585,59 @@ main(int argc, string  argv[])
     }
 #endif
 
+    // detect error: use cache option when not available
+#ifndef USE_SNAPSHOT_CACHE
+    if (opt_cache) {
+        fprintf(stderr, "%s: unrecognized argument: -c\n", program);
+        usage();
+        // NOTREACHED
+    }
+#endif
+
+    // detect error: use sysfs option when not available
+#ifndef USE_SYSFS_TOPOLOGY
+    if (opt_sysfs) {
+        fprintf(stderr, "%s: unrecognized argument: -y\n", program);
+        usage();
+        // NOTREACHED
+    }
+#endif
+
+    // detect error: sysfs mode has own collection and output
+    if (opt_sysfs && (opt_one_cpu || opt_filename != NULL || opt_leaf || opt_raw
+        || opt_unique || opt_types || opt_cache || opt_timing_val > 0 || opt_synth_only || opt_sample
+        || opt_format)) {
+        fprintf(stderr,
+            "%s: -y/--sysfs is incompatible with -1, -f, -l, -r, -u, -t, -c, -T, -S, -p and -F\n",
+            program);
+        exit(1);
+    }
+
+    // detect error: output formats are formats of decoded information, not raw dump
+    if (opt_format && opt_raw) {
+        fprintf(stderr,
+            "%s: -F/--format and -r/--raw are incompatible options\n",
+            program);
+        exit(1);
+    }
+
+    // detect error: resolver generation reads declarations only, no CPUID information
+    if (opt_resolver != NULL && (opt_one_cpu || opt_filename != NULL || opt_leaf || opt_raw
+        || opt_unique || opt_types || opt_synth_only || opt_sample || opt_sysfs || opt_format)) {
+        fprintf(stderr,
+            "%s: -R/--resolver is incompatible with -1, -f, -l, -r, -u, -t, -S, -p, -y and -F\n",
+            program);
+        exit(1);
+    }
+
+    // detect error: per core type and per identical CPUs group decoding are different summaries
+    if (opt_unique && opt_types) {
+        fprintf(stderr,
+            "%s: -u/--unique and -t/--types are incompatible options\n",
+            program);
+        exit(1);
+    }
+
     // detect error: use instruction and kernel options simultaneously
     if (opt_inst && opt_kernel) {
         fprintf(stderr,
@@ -11247,6 +16646,46 @@ main(int argc, string  argv[])
         exit(1);
     }
 
+    // detect error: timing mode requires CPUID execution
+    if (opt_filename != NULL && opt_timing_val > 0) {
+        fprintf(stderr,
+            "%s: -f/--file and -T/--timing are incompatible options\n",
+            program);
+        exit(1);
+    }
+
+    // detect error: synth-only mode is summary of all functions, not selected leaves
+    if (opt_synth_only && opt_leaf) {
+        fprintf(stderr,
+            "%s: -S/--synth-only and -l/--leaf are incompatible options\n",
+            program);
+        exit(1);
+    }
+
+    // detect error: synth-only mode prints one summary, not per identical CPUs group or core type summaries
+    if (opt_synth_only && (opt_unique || opt_types)) {
+        fprintf(stderr,
+            "%s: -S/--synth-only is incompatible with -u/--unique and -t/--types\n",
+            program);
+        exit(1);
+    }
+
+    // detect error: sampling mode is for collection of all functions on all CPUs
+    if (opt_sample && (opt_filename != NULL || opt_leaf || opt_timing_val > 0)) {
+        fprintf(stderr,
+            "%s: -p/--sample is incompatible with -f/--file, -l/--leaf and -T/--timing\n",
+            program);
+        exit(1);
+    }
+
+    // detect error: snapshot is full collection of all CPUs, not timing, synth-only or sampled collection
+    if (opt_cache && (opt_timing_val > 0 || opt_synth_only || opt_sample)) {
+        fprintf(stderr,
+            "%s: -c/--cache is incompatible with -T/--timing, -S/--synth-only and -p/--sample\n",
+            program);
+        exit(1);
+    }
+
     // detect error: use file and leaf options simultaneously
     if (opt_filename != NULL && opt_leaf) {
         fprintf(stderr,
@@ -11263,14 +16702,6 @@ main(int argc, string  argv[])
         exit(1);
     }
 
-    // detect error: file mode yet not supported, this temporary added for Windows Port version
-    if (opt_file) {
-        fprintf(stderr,
-            "%s: -f/--file option yet not supported by windows port version\n",
-            program);
-        exit(1);
-    }
-
     // detect error: instruction mode option yet not supported, 
     // because for current version instruction mode is only one supported mode
     // this temporary added for Windows Port version
@@ -11282,6 +16713,12 @@ main(int argc, string  argv[])
     }
 
 
+    if (opt_timing_val > 0) {
+        tsc_per_ns = calibrate_tsc();
+    }
+
+    names_set_only = opt_brief;
+
     // errors and warnings detection done,
     // Default to -i.  So use inst unless -k is specified.
     intbool  inst = !opt_kernel;
@@ -11291,17 +16728,32 @@ main(int argc, string  argv[])
         printf(VERSION_TEXT);
     }
 
+    // if resolver option - generate resolvers source
+    else if (opt_resolver != NULL) {
+        generate_resolvers(opt_resolver);
+    }
+
     // execute cpuid
     else {
-        if (opt_filename != NULL) {
-            do_file(opt_filename, opt_raw, opt_debug);         // file mode, YET NOT SUPPORTED
+        if (opt_sysfs) {
+#ifdef USE_SYSFS_TOPOLOGY
+            do_sysfs(inst);                                    // sysfs topology and caches, CPUID on one CPU
+#endif
+        }
+        else if (opt_file) {
+            do_file(opt_filename, opt_raw, opt_debug,          // file mode
+                opt_unique, opt_types, opt_synth_only);
         }
         else if (opt_leaf) {
-            do_real_one(opt_leaf_val, opt_subleaf_val,         // one selected function mode, from physical platform
-                opt_one_cpu, inst, opt_raw, opt_debug);
+            leaf_select_t*  selects = NULL;
+            unsigned int    num_selects = parse_leaf_list(opt_leaf_val, (unsigned int)opt_subleaf_val, &selects);
+            do_real_one(selects, num_selects,                  // selected functions mode, from physical platform
+                opt_one_cpu, inst, opt_raw, opt_debug, opt_timing_val);
+            free(selects);
         }
         else {
-            do_real(opt_one_cpu, inst, opt_raw, opt_debug);    // execute all supported functions, from physical platform, this is DEFAULT mode
+            do_real(opt_one_cpu, inst, opt_raw, opt_debug,     // execute all supported functions, from physical platform, this is DEFAULT mode
+                opt_unique, opt_types, opt_cache, opt_timing_val, opt_synth_only, opt_sample);
         }
     }
 
@@ -11310,4 +16762,14 @@ main(int argc, string  argv[])
     // NOTREACHED
 }
 
-
+#ifndef CPUID_LIBRARY
+// application entry point, 
+// argc = number of command line parameters, include parameters[0] = application exe file name
+// argv = array of strings, command line parameters
+// return integer = application exit code
+int
+main(int argc, string  argv[])
+{
+    return cpuid_main(argc, argv);
+}
+#endif
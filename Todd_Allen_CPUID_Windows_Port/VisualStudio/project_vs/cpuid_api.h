@@ -0,0 +1,117 @@
+/*
+**
+** cpuid dumps CPUID information for each CPU.
+** Copyright 2003,2004,2005,2006,2010,2011,2012,2013,2014,2015,2016,2017,2018,
+** 2020 by Todd Allen.
+**
+** Library interface of cpuid.cpp: decoded CPUID facts as plain structures,
+** without console output and without state shared between calls.
+** Build cpuid.cpp with CPUID_LIBRARY defined for omit main() of command line tool.
+**
+** This program is free software; you can redistribute it and/or
+** modify it under the terms of the GNU General Public License
+** as published by the Free Software Foundation; either version 2
+** of the License, or (at your option) any later version.
+**
+*/
+
+#ifndef CPUID_API_H
+#define CPUID_API_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum number of caches at cpuid_facts_t cache hierarchy
+#define CPUID_MAX_CACHES  8
+
+// size of synthesized processor name buffer at cpuid_facts_t
+#define CPUID_SYNTH_SIZE  256
+
+// one CPUID function:subfunction result, input of cpuid_decode()
+typedef struct {
+    unsigned int  function;      // CPUID function number, input EAX
+    unsigned int  subfunction;   // CPUID sub-function number, input ECX
+    unsigned int  eax;           // output EAX
+    unsigned int  ebx;           // output EBX
+    unsigned int  ecx;           // output ECX
+    unsigned int  edx;           // output EDX
+} cpuid_leaf_t;
+
+// one cache of cache hierarchy, from CPUID function 4 (Intel) or 8000001Dh (AMD)
+typedef struct {
+    unsigned int  level;         // cache level, 1 = L1
+    unsigned int  type;          // cache type: 1 = data, 2 = instruction, 3 = unified
+    unsigned int  size;          // cache size in KB
+    unsigned int  ways;          // ways of associativity
+    unsigned int  line_size;     // line size in bytes
+    unsigned int  sets;          // number of sets
+    unsigned int  sharing;       // maximum number of logical processors sharing this cache
+} cpuid_cache_t;
+
+// multiprocessing topology of logical processor
+typedef struct {
+    const char*   method;        // detection method of cores and threads counts, NULL if unknown
+    unsigned int  cores;         // number of cores per package
+    unsigned int  threads;       // number of threads per core
+    int           apic_valid;    // nonzero if APIC ID widths and IDs below are known
+    unsigned int  smt_width;     // APIC ID bits of thread
+    unsigned int  core_width;    // APIC ID bits of core
+    unsigned int  cu_width;      // APIC ID bits of compute unit, 0 if no compute units
+    unsigned int  pkg_id;        // package ID of logical processor
+    unsigned int  cu_id;         // compute unit ID of logical processor
+    unsigned int  core_id;       // core ID of logical processor
+    unsigned int  smt_id;        // thread ID of logical processor
+} cpuid_topology_t;
+
+// feature flags registers, 0 if function not supported
+typedef struct {
+    unsigned int  std_1_ecx;     // CPUID function 1, ECX
+    unsigned int  std_1_edx;     // CPUID function 1, EDX
+    unsigned int  std_7_ebx;     // CPUID function 7/0, EBX
+    unsigned int  std_7_ecx;     // CPUID function 7/0, ECX
+    unsigned int  std_7_edx;     // CPUID function 7/0, EDX
+    unsigned int  ext_1_ecx;     // CPUID function 80000001h, ECX
+    unsigned int  ext_1_edx;     // CPUID function 80000001h, EDX
+} cpuid_features_t;
+
+// decoded CPUID facts of one logical processor, strings are constants or members
+typedef struct {
+    char              vendor_id[12 + 1];             // vendor string of CPUID function 0
+    const char*       vendor;                        // vendor name, NULL if unknown
+    char              brand[48 + 1];                 // brand string of CPUID functions 80000002h-80000004h
+    unsigned int      signature;                     // CPUID function 1, EAX
+    unsigned int      family;                        // synthesized family, with extended family
+    unsigned int      model;                         // synthesized model, with extended model
+    unsigned int      stepping;                      // stepping ID
+    const char*       uarch;                         // microarchitecture, NULL if unknown
+    const char*       core;                          // process-neutral core family, NULL if unknown
+    const char*       process;                       // physical properties: die process, etc., NULL if unknown
+    char              synth[CPUID_SYNTH_SIZE];       // synthesized processor name, empty if unknown
+    cpuid_topology_t  topology;                      // multiprocessing topology
+    unsigned int      num_caches;                    // number of used elements in caches array
+    cpuid_cache_t     caches[CPUID_MAX_CACHES];      // cache hierarchy, in CPUID enumeration order
+    cpuid_features_t  features;                      // feature flags registers
+} cpuid_facts_t;
+
+// decode CPUID results of one logical processor, e.g. saved by "cpuid -r"
+// leaves = array of CPUID results
+// count  = number of elements in leaves array
+// facts  = pointer for return decoded facts
+// return 0 if decoded, -1 if CPUID function 0 or 1 absent or no memory
+int cpuid_decode(const cpuid_leaf_t leaves[], unsigned int count, cpuid_facts_t* facts);
+
+// execute CPUID functions on current logical processor and decode results,
+// caller thread must be pinned to processor for results of certain processor
+// facts = pointer for return decoded facts
+// return 0 if decoded, -1 if CPUID function 0 or 1 absent or no memory
+int cpuid_query(cpuid_facts_t* facts);
+
+// command line tool, same arguments as main()
+int cpuid_main(int argc, char* argv[]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CPUID_API_H